@@ -143,4 +143,10 @@ const char *vrvToolkit_getElementAttr(Toolkit *tk, const char *xmlId)
     tk->SetCString(tk->GetElementAttr(xmlId));
     return tk->GetCString();
 }
+
+const char *vrvToolkit_getMdivs(Toolkit *tk, const char *data)
+{
+    tk->SetCString(tk->GetMdivs(data));
+    return tk->GetCString();
+}
 }
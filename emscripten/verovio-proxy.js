@@ -21,6 +21,9 @@ verovio.vrvToolkit.getElementsAtTime = Module.cwrap('vrvToolkit_getElementsAtTim
 // char *getElementAttr(Toolkit *ic, const char *xmlId )
 verovio.vrvToolkit.getElementAttr = Module.cwrap('vrvToolkit_getElementAttr', 'string', ['number', 'string']);
 
+// char *getMdivs(Toolkit *ic, const char *data )
+verovio.vrvToolkit.getMdivs = Module.cwrap('vrvToolkit_getMdivs', 'string', ['number', 'string']);
+
 // char *getLog(Toolkit *ic)
 verovio.vrvToolkit.getLog = Module.cwrap('vrvToolkit_getLog', 'string', ['number']);
 
@@ -178,6 +181,10 @@ verovio.toolkit.prototype.getElementAttr = function (xmlId) {
 	return JSON.parse(verovio.vrvToolkit.getElementAttr(this.ptr, xmlId));
 };
 
+verovio.toolkit.prototype.getMdivs = function (data) {
+	return JSON.parse(verovio.vrvToolkit.getMdivs(this.ptr, data));
+};
+
 /***************************************************************************************************************************/
 
 // If the window object is defined (if we are not within a WebWorker)...
@@ -88,8 +88,47 @@ public:
     static void GetShared(const Object *element, ArrayOfStrAttr *attributes);
     // static void GetTablature(const Object *element, ArrayOfStrAttr *attributes);
     // static void GetUsersymbols(const Object *element, ArrayOfStrAttr *attributes);
+
+    /**
+     * Idem for filling the setters by attribute name
+     * See Att::SetAttribute
+     */
+    // static void FillAnalysisSetters(MapOfAttSetters *setters);
+    static void FillCmnSetters(MapOfAttSetters *setters);
+    static void FillCmnornamentsSetters(MapOfAttSetters *setters);
+    static void FillCritappSetters(MapOfAttSetters *setters);
+    // static void FillEdittransSetters(MapOfAttSetters *setters);
+    static void FillExternalsymbolsSetters(MapOfAttSetters *setters);
+    // static void FillFacsimileSetters(MapOfAttSetters *setters);
+    // static void FillFigtableSetters(MapOfAttSetters *setters);
+    // static void FillHarmonySetters(MapOfAttSetters *setters);
+    // static void FillHeaderSetters(MapOfAttSetters *setters);
+    // static void FillLyricsSetters(MapOfAttSetters *setters);
+    static void FillMeiSetters(MapOfAttSetters *setters);
+    static void FillMensuralSetters(MapOfAttSetters *setters);
+    static void FillMidiSetters(MapOfAttSetters *setters);
+    static void FillPagebasedSetters(MapOfAttSetters *setters);
+    // static void FillPerformanceSetters(MapOfAttSetters *setters);
+    // static void FillNeumesSetters(MapOfAttSetters *setters);
+    static void FillSharedSetters(MapOfAttSetters *setters);
+    // static void FillTablatureSetters(MapOfAttSetters *setters);
+    // static void FillUsersymbolsSetters(MapOfAttSetters *setters);
     ///@}
 
+    /**
+     * Set an attribute of an element from its name and its value.
+     * The setter is looked up by name in a table filled once from all the modules, and only the att classes registered
+     * for the element are considered. This is used for reading all the attributes of an element in a single pass.
+     * Return false if the attribute is not supported by the element.
+     */
+    static bool SetAttribute(Object *element, const char *attrType, const char *attrValue);
+
+private:
+    /**
+     * Fill the table of setters used by Att::SetAttribute
+     */
+    static MapOfAttSetters InitSetters();
+
 public:
     /** Dummy string converter */
     std::string StrToStr(std::string str) const;
@@ -9,6 +9,7 @@
 #define __VRV_ATT_DEF_H__
 
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -21,8 +22,19 @@
 
 namespace vrv {
 
+class Object;
+
 typedef std::vector<std::pair<std::string, std::string> > ArrayOfStrAttr;
 
+/**
+ * A function setting an attribute of an element from its string value
+ */
+typedef void (*AttSetter)(Object *element, const char *attrValue);
+
+typedef std::vector<std::pair<AttClassId, AttSetter> > ArrayOfAttSetters;
+
+typedef std::unordered_map<std::string, ArrayOfAttSetters> MapOfAttSetters;
+
 #define VRV_UNSET -0x7FFFFFFF
 
 //----------------------------------------------------------------------------
@@ -20,6 +20,7 @@
 
 namespace vrv {
 
+class FloatingObject;
 class Object;
 
 //----------------------------------------------------------------------------
@@ -32,8 +33,8 @@ class Object;
  * The drawing primitives do not draw anything but update the bounding box values of the
  * layout objects currently drawn. The layout objects store their own bounding box and a
  * bounding box of their content. The own bouding box is updated only for the object being
- * drawn (the top one on the stack). The content bounding box is updated for all objects
- * on the stack
+ * drawn (the top one on the stack). The content bounding box is accumulated for the object
+ * being drawn and propagated to its parent on the stack when the graphic is ended.
  */
 class BBoxDeviceContext : public DeviceContext {
 public:
@@ -127,6 +128,18 @@ public:
     virtual void EndPage();
     ///@}
 
+    /**
+     * @name Methods for updating the bounding box from the glyph metrics or the geometry.
+     * They are used by the drawing methods and directly by the View in place of them, in which case no pen, brush or
+     * font is set. Coordinates are device context ones. UpdateGlyphBB returns the advance of the glyph.
+     */
+    ///@{
+    void UpdateMusicTextBB(const std::wstring &text, int x, int y, int pointSize, bool setSmuflGlyph);
+    int UpdateGlyphBB(wchar_t code, int x, int y, int pointSize, bool setSmuflGlyph);
+    void UpdateLineBB(int x1, int y1, int x2, int y2, int penWidth);
+    void UpdateRectangleBB(int x, int y, int width, int height, int penWidth);
+    ///@}
+
     bool UpdateHorizontalValues() { return (m_update != BBOX_VERTICAL_ONLY); }
     bool UpdateVerticalValues() { return (m_update != BBOX_HORIZONTAL_ONLY); }
 
@@ -154,7 +167,36 @@ private:
      */
     View *m_view;
 
-    void UpdateBB(int x1, int y1, int x2, int y2, wchar_t glyph = 0);
+    void UpdateBB(int x1, int y1, int x2, int y2, wchar_t glyph = 0, int glyphPointSize = 0);
+
+    /**
+     * @name Methods for the content extents of the objects on the stack.
+     * PushContentExtent is called when starting a graphic, PopContentExtent when ending it (before the object is
+     * detached). StretchContentExtent extends the extent of an entry and FlushContentExtent applies an extent to the
+     * content bounding box of its target and merges it into the parent entry.
+     */
+    ///@{
+    void PushContentExtent(Object *object);
+    void PopContentExtent();
+    void StretchContentExtent(int idx, int x1, int x2, bool hasX, int y1, int y2, bool hasY);
+    void FlushContentExtent(int idx);
+    ///@}
+
+    /**
+     * The content extent (in logical coordinates) accumulated for each object of m_objects.
+     * Keeping one extent per entry avoids stretching the content bounding box of every object on the
+     * stack (with a virtual drawing position lookup each time) for every primitive drawn.
+     * The target is the bounding box receiving the extent. For a floating object, it is its current positioner,
+     * which changes within the graphic when the object is drawn for several staves. The extent is flushed to the
+     * previous positioner before it is stretched for a new one.
+     */
+    struct ContentExtent {
+        int m_x1, m_x2, m_y1, m_y2;
+        bool m_hasX, m_hasY;
+        BoundingBox *m_target;
+        FloatingObject *m_floatingObject;
+    };
+    std::vector<ContentExtent> m_contentExtents;
 };
 
 } // namespace vrv
@@ -30,7 +30,7 @@ public:
      */
     ///@{
     ControlElement();
-    ControlElement(std::string classid);
+    ControlElement(const char *classid);
     virtual ~ControlElement();
     virtual void Reset();
     virtual ClassId GetClassId() const { return CONTROL_ELEMENT; }
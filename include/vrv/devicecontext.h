@@ -18,8 +18,10 @@
 
 namespace vrv {
 
+class Doc;
 class Glyph;
 class Object;
+class Resources;
 class View;
 
 // ---------------------------------------------------------------------------
@@ -48,6 +50,8 @@ public:
         m_drawingBoundingBoxes = false;
         m_isDeactivatedX = false;
         m_isDeactivatedY = false;
+        m_resources = NULL;
+        m_doc = NULL;
     }
     virtual ~DeviceContext(){};
     virtual ClassId GetClassId() const;
@@ -202,8 +206,26 @@ public:
     virtual bool GetDrawBoundingBoxes() { return m_drawingBoundingBoxes; }
     ///@}
 
+    /**
+     * @name Setter and getter for the font resources (not owned)
+     * They are set by the View from the document being drawn.
+     */
+    ///@{
+    void SetResources(const Resources *resources) { m_resources = resources; }
+    const Resources *GetResources() const { return m_resources; }
+    ///@}
+
+    /**
+     * @name Setter and getter for the document being drawn (not owned)
+     * It is set by the View for each page drawn.
+     */
+    ///@{
+    void SetDoc(const Doc *doc) { m_doc = doc; }
+    const Doc *GetDoc() const { return m_doc; }
+    ///@}
+
 private:
-    void AddGlyphToTextExtend(Glyph *glyph, TextExtend *extend);
+    void AddGlyphToTextExtend(const Glyph *glyph, TextExtend *extend);
 
 public:
     //
@@ -217,6 +239,12 @@ protected:
     /** flag for indicating if the graphic is deactivated */
     bool m_isDeactivatedX;
     bool m_isDeactivatedY;
+
+    /** The font resources */
+    const Resources *m_resources;
+
+    /** The document being drawn */
+    const Doc *m_doc;
 };
 
 } // namespace vrv
@@ -8,6 +8,10 @@
 #ifndef __VRV_DOC_H__
 #define __VRV_DOC_H__
 
+#include <unordered_map>
+
+//----------------------------------------------------------------------------
+
 #include "devicecontextbase.h"
 #include "scoredef.h"
 #include "style.h"
@@ -19,6 +23,7 @@ namespace vrv {
 class FontInfo;
 class Glyph;
 class Page;
+class Resources;
 class Score;
 
 enum DocType { Raw = 0, Rendering, Transcription };
@@ -91,6 +96,44 @@ public:
 
     bool GetMidiExportDone() const;
 
+    /**
+     * @name Methods for the uuid index of the document.
+     * The index is maintained by Object::AddToUuidIndex and Object::RemoveFromUuidIndex.
+     * GetUuidIndexed returns the object registered with the uuid, which can be detached from the document.
+     * Use Object::FindChildByUuid for looking for an object in the document.
+     */
+    ///@{
+    void AddUuidIndexed(Object *object);
+    void RemoveUuidIndexed(Object *object);
+    Object *GetUuidIndexed(const std::string &uuid) const;
+    ///@}
+
+    /**
+     * @name Time index filled by Doc::ExportMIDI
+     * Score times are MIDI ticks as set in Note::m_playingOnset and Note::m_playingOffset.
+     * Real times are in milliseconds and take into account the tempo changes written to the MIDI file.
+     */
+    ///@{
+    /** Fill the notes sounding at the score time (onset < time < offset) in document order */
+    void GetNotesAtTime(ArrayOfObjects *notes, double scoreTime) const;
+    double GetRealTimeForScoreTime(double scoreTime) const;
+    double GetScoreTimeForRealTime(double realTime) const;
+    ///@}
+
+    /**
+     * @name Setter and getter for the font resources used by the document
+     * The resources are shared and not owned by the document. If none are set, the ones for the default resource
+     * path are used.
+     */
+    ///@{
+    void SetResources(const Resources *resources)
+    {
+        m_resources = resources;
+        m_castOffLayoutDone = false;
+    }
+    const Resources *GetResources() const;
+    ///@}
+
     /**
      * @name Get the height or width for a glyph taking into account the staff and grace sizes
      */
@@ -129,7 +172,7 @@ public:
 
     /**
      * @name Get the height or width for a glyph taking into account the staff and grace sizes
-     * (no const because the size of the member font is changed)
+     * (the font returned is shared within the calling thread and its size is changed at each call)
      */
     ///@{
     FontInfo *GetDrawingSmuflFont(int staffSize, bool graceSize);
@@ -211,6 +254,16 @@ public:
     double GetSpacingNonLinear() const { return m_drawingSpacingNonLinear; }
     ///@}
 
+    /*
+     * @name Setter and getter for the number of threads used for the horizontal layout of the measures
+     * and for processing the staff/layer/verse streams in PrepareDrawing.
+     * It is 1 by default and 0 means one thread per core.
+     */
+    ///@{
+    void SetLayoutThreads(int layoutThreads) { m_layoutThreads = layoutThreads; }
+    int GetLayoutThreads() const { return m_layoutThreads; }
+    ///@}
+
     /**
      * Export the document to a MIDI file.
      * Run trough all the layer and fill the midi file content.
@@ -235,8 +288,15 @@ public:
     /**
      * Casts off the entire document.
      * Starting from a single system, create and fill pages and systems.
+     * With reuseLayout, the content is not laid out horizontally again and the measure widths of the previous
+     * cast off are used. This is possible only when the content and the font did not change (see ResetCastOffLayout).
+     */
+    void CastOffDoc(bool reuseLayout = false);
+
+    /**
+     * Mark the layout of the previous cast off as invalid, for example after the content has been edited.
      */
-    void CastOffDoc();
+    void ResetCastOffLayout() { m_castOffLayoutDone = false; }
 
     /**
      * Undo the cast off of the entire document.
@@ -250,6 +310,17 @@ public:
      */
     void CastOffEncodingDoc();
 
+    /**
+     * @name Get and apply the system and page breaks of a cast off document.
+     * The breaks are given as the uuid and the number of children of each system and of each page.
+     * ApplyCastOff can replace CastOffDoc when the breaks are already known for the same data and layout options.
+     * It returns false (and leaves the document untouched) if the breaks do not match the content system.
+     */
+    ///@{
+    void GetCastOff(ArrayOfUuidCountPairs &systems, ArrayOfUuidCountPairs &pages);
+    bool ApplyCastOff(const ArrayOfUuidCountPairs &systems, const ArrayOfUuidCountPairs &pages);
+    ///@}
+
     /**
      * Convert the doc from score-based to page-based MEI.
      * Containers will be converted to boundaryStart / boundaryEnd.
@@ -311,6 +382,18 @@ private:
      */
     int CalcMusicFontSize();
 
+    /**
+     * @name Fill the time index from the note onsets and offsets set by the MIDI export, and search it.
+     * The notes sorted by onset are seen as an implicit binary tree in which each range [first, last) has its
+     * root in the middle. The maximum offset of each range is kept at its root for skipping the ranges in which
+     * all the notes end before the time.
+     */
+    ///@{
+    void BuildTimeIndex();
+    double BuildTimeIndexMaxOffsets(int first, int last);
+    void FindNotesAtTime(std::vector<int> *indices, double scoreTime, int first, int last) const;
+    ///@}
+
 public:
     /**
      * A copy of the header tree stored as pugi::xml_document
@@ -341,6 +424,8 @@ public:
     bool m_drawingJustifyX;
     /** flag for disabling spacing by duration */
     bool m_drawingEvenSpacing;
+    /** number of threads for the horizontal layout and the drawing preparation (0 for one per core) */
+    int m_layoutThreads;
     /** value of the linear spacing factor */
     double m_drawingSpacingLinear;
     /** value of the non linear spacing factor */
@@ -362,6 +447,9 @@ private:
      */
     Style *m_style;
 
+    /** The font resources (not owned) */
+    const Resources *m_resources;
+
     /*
      * The following values are set in the Doc::SetDrawingPage.
      * They are all current values to be used when drawing a page in a View and
@@ -394,10 +482,6 @@ private:
     int m_drawingSmuflFontSize;
     /** Lyric font size  */
     int m_drawingLyricFontSize;
-    /** Current music font */
-    FontInfo m_drawingSmuflFont;
-    /** Current lyric font */
-    FontInfo m_drawingLyricFont;
 
     /**
      * A flag to indicate whether the currentScoreDef has been set or not.
@@ -418,6 +502,44 @@ private:
      */
     bool m_midiExportDone;
 
+    /**
+     * A flag to indicate if the document has been cast off with a horizontal layout that can be reused.
+     * The widths that are not stored in the measures are kept with it.
+     */
+    bool m_castOffLayoutDone;
+    int m_castOffLabelsWidth;
+    int m_castOffAbbrLabelsWidth;
+    int m_castOffScoreDefWidth;
+
+    /**
+     * The time index filled by Doc::ExportMIDI.
+     * m_timeIndexNotes holds the played notes once, in document order. m_timeIndexByOnset holds their
+     * positions sorted by onset and m_timeIndexMaxOffsets the maximum offset of the range rooted at each of them.
+     */
+    ///@{
+    ArrayOfObjects m_timeIndexNotes;
+    std::vector<int> m_timeIndexByOnset;
+    std::vector<double> m_timeIndexMaxOffsets;
+    ///@}
+
+    /**
+     * The tempo changes written by Doc::ExportMIDI.
+     * Each entry holds the score time (ticks), the real time (ms) and the tempo (bpm) of the change.
+     */
+    std::vector<std::tuple<double, double, double> > m_tempoMap;
+    /** The number of ticks per quarter note of the MIDI file */
+    int m_midiTicksPerQuarter;
+
+    /**
+     * The uuid index of all the objects of the document.
+     * The objects with a generated uuid are indexed by its number, so that the uuid string is not built.
+     * When several objects have the same uuid, the first one registered is kept.
+     */
+    ///@{
+    std::unordered_map<std::string, Object *> m_uuidIndex;
+    std::unordered_map<unsigned int, Object *> m_generatedUuidIndex;
+    ///@}
+
     /** Page width (MEI scoredef@page.width) - currently not saved */
     int m_pageWidth;
     /** Page height (MEI scoredef@page.height) - currently not saved */
@@ -49,7 +49,7 @@ public:
      */
     ///@{
     EditorialElement();
-    EditorialElement(std::string classid);
+    EditorialElement(const char *classid);
     virtual ~EditorialElement();
     virtual void Reset();
     virtual ClassId GetClassId() const { return EDITORIAL_ELEMENT; }
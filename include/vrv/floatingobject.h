@@ -33,7 +33,7 @@ public:
      */
     ///@{
     FloatingObject();
-    FloatingObject(std::string classid);
+    FloatingObject(const char *classid);
     virtual ~FloatingObject();
     virtual void Reset();
     virtual ClassId GetClassId() const { return FLOATING_OBJECT; }
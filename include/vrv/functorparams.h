@@ -643,6 +643,7 @@ public:
  * member 4: the system width
  * member 5: the current scoreDef width
  * member 6: the current pending objects (ScoreDef, Endings, etc.) to be place at the beginning of a system
+ * member 7: a flag indicating if the measure positions and widths of the previous cast off have to be used
 **/
 
 class CastOffSystemsParams : public FunctorParams {
@@ -655,6 +656,7 @@ public:
         m_shift = 0;
         m_systemWidth = 0;
         m_currentScoreDefWidth = 0;
+        m_reuseLayout = false;
     }
     System *m_contentSystem;
     Page *m_page;
@@ -663,6 +665,7 @@ public:
     int m_systemWidth;
     int m_currentScoreDefWidth;
     ArrayOfObjects m_pendingObjects;
+    bool m_reuseLayout;
 };
 
 //----------------------------------------------------------------------------
@@ -847,6 +850,20 @@ public:
     Functor *m_functor;
 };
 
+//----------------------------------------------------------------------------
+// IndexLayerElementsParams
+//----------------------------------------------------------------------------
+
+/**
+ * member 0: a pointer to the index of the current system
+ **/
+
+class IndexLayerElementsParams : public FunctorParams {
+public:
+    IndexLayerElementsParams() { m_layerElementXs = NULL; }
+    MapOfLayerElementXs *m_layerElementXs;
+};
+
 //----------------------------------------------------------------------------
 // JustifyXParams
 //----------------------------------------------------------------------------
@@ -1006,6 +1023,7 @@ public:
 /**
  * member 0: the IntTree* for staff/layer/verse
  * member 1: the IntTree* for staff/layer
+ * member 2: the layers in document order for each staff/layer @n pair
 **/
 
 class PrepareProcessingListsParams : public FunctorParams {
@@ -1013,6 +1031,7 @@ public:
     PrepareProcessingListsParams() {}
     IntTree m_verseTree;
     IntTree m_layerTree;
+    MapOfLayersByStaffLayerN m_layers;
 };
 
 //----------------------------------------------------------------------------
@@ -1037,13 +1056,13 @@ public:
 //----------------------------------------------------------------------------
 
 /**
- * member 0: std::vector< Object*>* that holds the current elements to match
+ * member 0: MapOfPointingInterClassIdPairsByUuid holding the elements of the measure waiting for the referenced uuid
  **/
 
 class PrepareTimePointingParams : public FunctorParams {
 public:
     PrepareTimePointingParams() {}
-    ArrayOfPointingInterClassIdPairs m_timePointingInterfaces;
+    MapOfPointingInterClassIdPairsByUuid m_timePointingInterfaces;
 };
 
 //----------------------------------------------------------------------------
@@ -1051,15 +1070,19 @@ public:
 //----------------------------------------------------------------------------
 
 /**
- * member 0: std::vector< Object*>* that holds the current elements to match
- * member 1: bool* fillList for indicating whether the elements have to be stacked or not
+ * member 0: ArrayOfSpanningInterClassIdPairs holding all the elements with a @startid or @endid to match
+ * member 1: MapOfSpanningInterClassIdPairsByUuid holding the elements still waiting for the referenced uuid
+ * member 2: MapOfSpanningInterClassIdPairsByUuid the same for the dir, dynam and harm of the current measure
+ * member 3: MapOfLayerElementsByUuid holding the layer elements already processed
 **/
 
 class PrepareTimeSpanningParams : public FunctorParams {
 public:
-    PrepareTimeSpanningParams() { m_fillList = true; }
+    PrepareTimeSpanningParams() {}
     ArrayOfSpanningInterClassIdPairs m_timeSpanningInterfaces;
-    bool m_fillList;
+    MapOfSpanningInterClassIdPairsByUuid m_pendingInterfaces;
+    MapOfSpanningInterClassIdPairsByUuid m_measurePendingInterfaces;
+    MapOfLayerElementsByUuid m_layerElements;
 };
 
 //----------------------------------------------------------------------------
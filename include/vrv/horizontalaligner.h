@@ -58,6 +58,8 @@ enum AlignmentType {
 #define BARLINE_REFERENCES -1
 #define TSTAMP_REFERENCES -2
 
+typedef std::map<std::pair<AlignmentType, double>, int> MapOfAlignmentXRels;
+
 //----------------------------------------------------------------------------
 // Alignment
 //----------------------------------------------------------------------------
@@ -437,6 +439,16 @@ public:
      */
     void AdjustProportionally(const ArrayOfAdjustmentTuples &adjustments);
 
+    /**
+     * @name Store and restore the x positions of the alignments by type and time.
+     * Alignments that are not stored are left untouched when restoring.
+     * Used for casting off the document again without laying it out horizontally (see Measure::CastOffSystems)
+     */
+    ///@{
+    void StoreXRels(MapOfAlignmentXRels &xRels) const;
+    void RestoreXRels(const MapOfAlignmentXRels &xRels);
+    ///@}
+
     /**
      * Push all the ALIGNMENT_GRACENOTE and ALIGNMENT_CONTAINER to the right.
      * This is necessary to make sure they align with the next alignment content.
@@ -424,7 +424,7 @@ private:
     // m_layer == current layer, or NULL.
     vrv::Layer *m_layer = NULL;
 
-    int m_currentlayer;
+    int m_currentlayer = -1;
 
     // m_layertokens == Humdrum **kern tokens for each staff/layer to be
     // converted.
@@ -460,22 +460,22 @@ private:
 
     // m_measureIndex == state variable for keeping track of the
     // current measure number being converted.
-    int m_measureIndex;
+    int m_measureIndex = 0;
 
     // m_harm == state variable for keeping track of whether or not
     // the file to convert contains **mxhm spines that should be
     // converted into <harm> element in the MEI conversion.
-    bool m_harm;
+    bool m_harm = false;
 
     // m_fb == state variable for keeping track of whether or not
     // the file to convert contains **Bnum spines that should be
     // converted into <harm> element in the MEI conversion.
-    bool m_fb;
+    bool m_fb = false;
 
     // m_leftbarstyle is a barline left-hand style to store in the next measure.
     // When processing a measure, this variable should be checked and used
     // in @left="style" for the measure.
-    data_BARRENDITION m_leftbarstyle;
+    data_BARRENDITION m_leftbarstyle = BARRENDITION_NONE;
 
     // m_signifiers == a list of user defined signfiers in **kern spine data
     // which indicate non-standard **kern parametesr that can be converted
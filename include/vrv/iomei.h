@@ -60,6 +60,7 @@ class Layer;
 class LayerElement;
 class Lem;
 class Measure;
+class MeiMeasureScan;
 class Mensur;
 class MeterSig;
 class Mordent;
@@ -108,6 +109,43 @@ class Tuplet;
 class Unclear;
 class Verse;
 
+//----------------------------------------------------------------------------
+// MeiStreamWriter
+//----------------------------------------------------------------------------
+
+/**
+ * This class buffers the MEI streamed by MeiOutput and writes it to the output stream by chunks.
+ * It is used as pugixml writer for the completed nodes, the start and end tags being appended directly.
+ */
+class MeiStreamWriter : public pugi::xml_writer {
+public:
+    /** @name Constructors and destructor */
+    ///@{
+    MeiStreamWriter();
+    virtual ~MeiStreamWriter();
+    ///@}
+
+    /**
+     * Set the output stream (NULL for none) and clear the buffer.
+     */
+    void SetStream(std::ostream *stream);
+
+    /**
+     * Append data to the buffer, which is written to the stream when full.
+     */
+    virtual void write(const void *data, size_t size);
+    void Write(const std::string &data) { this->write(data.c_str(), data.size()); }
+
+    /**
+     * Write the remaining content of the buffer to the stream.
+     */
+    void Flush();
+
+private:
+    std::ostream *m_stream;
+    std::string m_buffer;
+};
+
 //----------------------------------------------------------------------------
 // MeiOutput
 //----------------------------------------------------------------------------
@@ -316,11 +354,32 @@ private:
     std::string DocTypeToStr(DocType type);
     ///@}
 
+    /**
+     * @name Methods for streaming the MEI tree to the output while it is being built.
+     * Completed nodes are written and removed from the tree, and the start tags of their ancestors are written the
+     * first time they are needed. The output is identical to saving the full tree with pugixml.
+     * Nodes within layer, text and control elements are written with the element since they can still be changed
+     * by objects representing attributes or contain mixed content.
+     */
+    ///@{
+    void StreamNodes(pugi::xml_node parent);
+    void StreamNodeEnd(pugi::xml_node node);
+    void StreamNode(pugi::xml_node node, int depth);
+    void StreamStartTag(pugi::xml_node node, int depth);
+    bool IsInlineObject(Object *object);
+    ///@}
+
 public:
     //
 private:
     std::string m_filename;
     std::ostringstream m_streamStringOutput;
+    /** The writer for the output stream (a file or m_streamStringOutput) */
+    MeiStreamWriter m_streamWriter;
+    /** The elements for which the start tag has been written (from the root) */
+    std::vector<pugi::xml_node> m_streamedNodes;
+    /** The nesting level of the layer, text and control elements being written */
+    int m_inlineDepth;
     bool m_writeToStreamString;
     int m_page;
     bool m_scoreBasedMEI;
@@ -365,13 +424,28 @@ public:
     /**
      * Set the XPath query for selecting a specific <mdiv>
      * Only one mdiv can be selected. This also works differently that <app> and <choice> selection because only the
-     * selected mdiv will be loaded.
+     * selected mdiv will be loaded. Whenever the query can be resolved on the <mdiv> elements and their attributes
+     * only, the other <mdiv> are not parsed at all (see MeiMdivScan).
      */
     virtual void SetMdivXPathQuery(std::string &xPathQuery) { m_mdivXPathQuery = xPathQuery; }
 
 private:
     bool ReadMei(pugi::xml_node root);
 
+    /**
+     * Parse the buffer and read it.
+     * Unless xPath queries are set, the content of the <measure> elements is parsed only when each of them is read,
+     * so that the xml tree of the complete document is never in memory together with the object tree.
+     */
+    bool ReadMeiBuffer(std::string const &mei);
+
+    /**
+     * Select the <mdiv> with the xPath query by scanning the buffer and fill a buffer with only that <mdiv>.
+     * The query is reset when the selection succeeded since it is not necessary anymore.
+     * Return false when the query cannot be resolved by the scan, in which case the full buffer has to be read.
+     */
+    bool SelectMdiv(std::string const &mei, std::string &buffer);
+
     /**
      * @name Methods for reading MEI score-based elements
      */
@@ -506,7 +580,7 @@ private:
     ///@}
 
     /**
-     * @name Methods for reading MEI LayerElement, EidtorialElement and interfaces
+     * @name Methods for reading MEI LayerElement, EidtorialElement and other base classes
      */
     ///@{
     bool ReadControlElement(pugi::xml_node element, ControlElement *object);
@@ -515,14 +589,6 @@ private:
     bool ReadScoreDefElement(pugi::xml_node element, ScoreDefElement *object);
     bool ReadSystemElement(pugi::xml_node element, SystemElement *object);
     bool ReadTextElement(pugi::xml_node element, TextElement *object);
-
-    bool ReadDurationInterface(pugi::xml_node element, DurationInterface *interface);
-    bool ReadPitchInterface(pugi::xml_node element, PitchInterface *interface);
-    bool ReadPositionInterface(pugi::xml_node element, PositionInterface *interface);
-    bool ReadScoreDefInterface(pugi::xml_node element, ScoreDefInterface *interface);
-    bool ReadTextDirInterface(pugi::xml_node element, TextDirInterface *interface);
-    bool ReadTimePointInterface(pugi::xml_node element, TimePointInterface *interface);
-    bool ReadTimeSpanningInterface(pugi::xml_node element, TimeSpanningInterface *interface);
     ///@}
 
     /**
@@ -533,15 +599,22 @@ private:
     ///@}
 
     /**
-     * Write unsupported attributes and store them in Object::m_unsupported (not tested)
+     * Read all the attributes of an element in a single pass (see Att::SetAttribute).
+     * Attributes not supported by the object are stored in Object::m_unsupported, unless they are read by the
+     * calling method itself (see MeiInput::IsReadAttributeName).
      */
-    void ReadUnsupportedAttr(pugi::xml_node element, Object *object);
+    void ReadAttributes(pugi::xml_node element, Object *object);
 
     /**
      * Returns true if the element is name is an editorial element (e.g., "app", "supplied", etc.)
      */
     bool IsEditorialElementName(std::string elementName);
 
+    /**
+     * Returns true if the attribute is read by the MeiInput methods themselves (e.g., "xml:id", "ulx", etc.)
+     */
+    bool IsReadAttributeName(std::string attributeName);
+
     /**
      * Read score-based MEI.
      * The data is read into an object, which is then converted to page-based MEI.
@@ -589,6 +662,12 @@ private:
      */
     std::string m_mdivXPathQuery;
 
+    /**
+     * The scan of the buffer being read when the content of the <measure> elements is parsed incrementally.
+     * NULL when the complete document is parsed (see MeiInput::ReadMeiBuffer).
+     */
+    MeiMeasureScan *m_measureScan;
+
     /**
      * A flag indicating wheather we are reading page-based or score-based MEI
      */
@@ -604,10 +683,141 @@ private:
      */
     bool IsAllowed(std::string element, Object *filterParent);
 
+    /**
+     * Remove a node that has been read and return its next sibling.
+     * The file is read in a single pass and this releases the memory of the xml tree measure by measure, so that it
+     * does not have to be kept entirely in memory together with the object tree.
+     */
+    pugi::xml_node ReleaseMeiNode(pugi::xml_node node);
+
     /**
      * A static array for storing the implemented editorial elements
      */
     static std::vector<std::string> s_editorialElementNames;
+
+    /**
+     * A static array for storing the attributes read by the MeiInput methods and not through the attribute classes
+     */
+    static std::vector<std::string> s_readAttributeNames;
+};
+
+//----------------------------------------------------------------------------
+// MeiBufferScan
+//----------------------------------------------------------------------------
+
+/**
+ * This is a base class for scanning a MEI buffer tag by tag without parsing it.
+ */
+class MeiBufferScan {
+public:
+    // constructors and destructors
+    MeiBufferScan() {}
+    virtual ~MeiBufferScan() {}
+
+protected:
+    /**
+     * Find the next opening or closing tag from pos. Comments, cdata, processing instructions and doctype are skipped.
+     * The start and end positions of the tag, its name and its type are set, and pos is moved after it.
+     * Return false when there is no tag anymore, with pos set to std::string::npos if the buffer is not well formed.
+     */
+    static bool FindNextTag(std::string const &mei, size_t &pos, size_t &start, size_t &end, std::string &name,
+        bool &isClosing, bool &isEmpty);
+};
+
+//----------------------------------------------------------------------------
+// MeiMdivScan
+//----------------------------------------------------------------------------
+
+/**
+ * This class scans a MEI buffer for its <mdiv> elements without parsing the rest of the document.
+ * It builds a skeleton document with only <mei>, <music>, <body> and the <mdiv> elements with their attributes, and
+ * keeps the position of each <mdiv> in the buffer. This is used for listing the movements and for loading only the
+ * selected <mdiv>.
+ */
+class MeiMdivScan : public MeiBufferScan {
+public:
+    // constructors and destructors
+    MeiMdivScan();
+    virtual ~MeiMdivScan() {}
+
+    /**
+     * Scan the buffer. Return false if no <mdiv> within a <body> could be found or if the buffer is not well formed.
+     */
+    bool Scan(std::string const &mei);
+
+    /**
+     * Return the <body> node of the skeleton.
+     * Empty if the scan failed.
+     */
+    pugi::xml_node GetBody() const { return m_body; }
+
+    /**
+     * Return the <mdiv> nodes of the skeleton in document order.
+     */
+    pugi::xpath_node_set GetMdivs() const { return m_skeleton.select_nodes("//mdiv"); }
+
+    /**
+     * Return a copy of the buffer with the selected <mdiv> as the only child of <body>.
+     * The <mdiv> has to be a node of the skeleton. Return false if it is not.
+     */
+    bool GetBufferWithMdiv(std::string const &mei, pugi::xml_node mdiv, std::string &buffer) const;
+
+    /**
+     * Return an xPath query (relative to the <body>) for selecting the <mdiv>.
+     */
+    std::string GetMdivXPathQuery(pugi::xml_node mdiv) const;
+
+private:
+    pugi::xml_document m_skeleton;
+    pugi::xml_node m_body;
+    /** The start and the end positions of the content of the <body> in the buffer */
+    size_t m_bodyStart;
+    size_t m_bodyEnd;
+    /** The start and the end positions of the <mdiv> elements in the buffer, in document order */
+    std::vector<std::pair<size_t, size_t> > m_mdivRanges;
+};
+
+//----------------------------------------------------------------------------
+// MeiMeasureScan
+//----------------------------------------------------------------------------
+
+/**
+ * This class scans a MEI buffer for its <measure> elements without parsing the rest of the document.
+ * It builds a skeleton buffer where the <measure> elements are kept with their attributes but without their content,
+ * and keeps the position of each <measure> in the buffer. The skeleton is parsed instead of the buffer and the content
+ * of each <measure> is parsed only when it is read (see MeiInput::ReadMeiMeasure).
+ */
+class MeiMeasureScan : public MeiBufferScan {
+public:
+    // constructors and destructors
+    MeiMeasureScan();
+    virtual ~MeiMeasureScan() {}
+
+    /**
+     * Scan the buffer and build the skeleton. Return false if the buffer is not well formed.
+     * The buffer has to remain unchanged for as long as the scan is used.
+     */
+    bool Scan(std::string const &mei);
+
+    /**
+     * Parse the skeleton into the document. Return false if it fails.
+     * The skeleton buffer is released.
+     */
+    bool LoadSkeleton(pugi::xml_document &skeleton, unsigned int options);
+
+    /**
+     * Parse the complete <measure> into the document if the node is a <measure> of the skeleton.
+     * Return false if it is not, or if it has no content.
+     */
+    bool LoadMeasure(pugi::xml_node measure, pugi::xml_document &measureDoc, unsigned int options);
+
+private:
+    std::string const *m_buffer;
+    std::string m_skeletonBuffer;
+    /** The start and the end positions of the <measure> elements in the buffer, in document order (npos if empty) */
+    std::vector<std::pair<size_t, size_t> > m_measureRanges;
+    /** The position of each <measure> of the skeleton in m_measureRanges */
+    std::map<pugi::xml_node, int> m_measureNodes;
 };
 
 } // namespace vrv
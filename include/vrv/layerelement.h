@@ -37,7 +37,7 @@ public:
      */
     ///@{
     LayerElement();
-    LayerElement(std::string classid);
+    LayerElement(const char *classid);
     virtual ~LayerElement();
     virtual void Reset();
     virtual ClassId GetClassId() const { return LAYER_ELEMENT; }
@@ -239,6 +239,11 @@ public:
      */
     virtual int FindTimeSpanningLayerElements(FunctorParams *functorParams);
 
+    /**
+     * See Object::IndexLayerElements
+     */
+    virtual int IndexLayerElements(FunctorParams *functorParams);
+
     /**
      * See Object::GenerateMIDI
      */
@@ -343,6 +343,16 @@ protected:
      */
     int m_drawingXRel;
 
+    /**
+     * @name The X relative position, the width and the alignment positions when the document was last cast off
+     * They are kept by Measure::CastOffSystems for casting off the document again without laying it out
+     */
+    ///@{
+    int m_castOffXRel;
+    int m_castOffWidth;
+    MapOfAlignmentXRels m_castOffAlignmentXRels;
+    ///@}
+
 private:
     bool m_measuredMusic;
 
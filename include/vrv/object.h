@@ -8,6 +8,8 @@
 #ifndef __VRV_OBJECT_H__
 #define __VRV_OBJECT_H__
 
+#include <atomic>
+#include <bitset>
 #include <cstdlib>
 #include <ctime>
 #include <iterator>
@@ -80,7 +82,7 @@ public:
      */
     ///@{
     Object();
-    Object(std::string classid);
+    Object(const char *classid);
     virtual ~Object();
     virtual ClassId GetClassId() const;
     virtual std::string GetClassName() const { return "[MISSING]"; }
@@ -201,10 +203,36 @@ public:
      */
     virtual Object *Clone() const;
 
-    std::string GetUuid() const { return m_uuid; }
+    /**
+     * @name Getter, setter and generation of uuids.
+     * Generated uuids are stored as a number and the string is built only when GetUuid is called.
+     * The generation is deterministic for a given seed (0 for seeding with the current time) and thread-safe.
+     * Each thread has its own sequence, which is restarted for each document (see Doc::Reset) so that the uuids of a
+     * document do not depend on the documents loaded before or concurrently.
+     * GenerateUuidStr returns a new uuid with a prefix, for uuids that are not stored in an object.
+     * UuidStrToNumber returns the number of a uuid that has the form of a generated one (false otherwise).
+     */
+    ///@{
+    std::string GetUuid() const;
     void SetUuid(std::string uuid);
     void ResetUuid();
+    bool HasGeneratedUuid() const { return m_uuid.empty(); }
+    unsigned int GetUuidNumber() const { return m_uuidNumber; }
     static void SeedUuid(unsigned int seed = 0);
+    static void RestartUuidSequence();
+    static std::string GenerateUuidStr(const std::string &prefix);
+    static bool UuidStrToNumber(const std::string &uuid, unsigned int &number);
+    ///@}
+
+    /**
+     * @name Registration of the object and its children in the uuid index of a document.
+     * Objects are added when attached to a parent already registered and removed when deleted.
+     * They are not removed when detached, so Doc::GetUuidIndexed only returns candidates.
+     */
+    ///@{
+    void AddToUuidIndex(Doc *doc);
+    void RemoveFromUuidIndex();
+    ///@}
 
     std::string GetComment() const { return m_comment; }
     void SetComment(std::string comment) { m_comment = comment; }
@@ -264,6 +292,13 @@ public:
      */
     void SetParent(Object *parent);
 
+    /**
+     * Set the parent of an Object owned by it as a member and not as a child (e.g., the aligners of a measure).
+     * The Object is not added to the uuid index since it cannot be reached through the children of its parent.
+     * The current parent is expected to be NULL.
+     */
+    void SetMemberParent(Object *parent);
+
     /**
      * Reset the parent of the Object.
      * The current parent is not expected to be NULL.
@@ -323,6 +358,8 @@ public:
     /**
      * Look for a child with the specified uuid (returns NULL if not found)
      * This method is a wrapper for the Object::FindByUuid functor.
+     * When the object is registered in the uuid index of a document and the deepness is unlimited, the index is
+     * used instead.
      */
     Object *FindChildByUuid(std::string uuid, int deepness = UNLIMITED_DEPTH, bool direction = FORWARD);
 
@@ -471,6 +508,11 @@ public:
      */
     virtual int FindTimeSpanningLayerElements(FunctorParams *) { return FUNCTOR_CONTINUE; }
 
+    /**
+     * Index the layer elements of each system by drawing x (see System::GetLayerElementsBetween)
+     */
+    virtual int IndexLayerElements(FunctorParams *) { return FUNCTOR_CONTINUE; }
+
     /**
      * Retrieve the minimum left and maximum right for an alignment.
      * Used in GraceAligner::GetGraceGroupLeft and GraceAligner::GetGraceGroupRight
@@ -924,10 +966,31 @@ private:
      */
     void GenerateUuid();
 
+    /**
+     * Check that the object is attached as a child (direct or not) to the ancestor.
+     * Children of hidden editorial elements are not considered as attached.
+     * Only the parents are looked at, since the objects that are not children of their parent are not indexed
+     * (see Object::SetMemberParent).
+     */
+    bool IsAttachedTo(const Object *ancestor) const;
+
     /**
      * Initialisation method taking a uuid prefix argument.
      */
-    void Init(std::string);
+    void Init(const char *classid);
+
+    /**
+     * Set the uuid (either as string or as generated number) and update the uuid index.
+     */
+    void StoreUuid(const std::string &uuid, unsigned int uuidNumber);
+
+    /**
+     * @name Return the next number for a generated uuid and convert it to a string with the prefix.
+     */
+    ///@{
+    static unsigned int GenerateUuidNumber();
+    static std::string UuidNumberToStr(const char *prefix, unsigned int number);
+    ///@}
 
 public:
     /**
@@ -950,13 +1013,21 @@ private:
     Object *m_parent;
 
     /**
-     * Members for storing / generating uuids
+     * Members for storing / generating uuids.
+     * The uuid is stored as string only when it was set (e.g., from the input file) and is empty otherwise.
+     * The classid is the prefix of the generated uuids and points to the string literal given by the class.
      */
     ///@{
     std::string m_uuid;
-    std::string m_classid;
+    unsigned int m_uuidNumber;
+    const char *m_classid;
     ///@}
 
+    /**
+     * The document in which uuid index the object is registered (if any)
+     */
+    Doc *m_uuidIndexDoc;
+
     /**
      * A reference object do not own children.
      * Destructor will not delete them.
@@ -1004,9 +1075,9 @@ private:
     bool m_isAttribute;
 
     /**
-     * A static counter for uuid generation.
+     * A static counter of the objects created, for seeding the uuid generation with the first one.
      */
-    static unsigned long s_objectCounter;
+    static std::atomic<unsigned long> s_objectCounter;
 };
 
 //----------------------------------------------------------------------------
@@ -1132,9 +1203,38 @@ public:
     // override function "Call"
     virtual void Call(Object *ptr, FunctorParams *functorParams);
 
+    /**
+     * Restrict the processing to the classes the functor acts on and to the containers that can hold them.
+     * The functor is then called only on objects of one of the classIds and the children are processed only
+     * for objects of one of the containerIds, which prunes the other subtrees.
+     * A base id (e.g., LAYER_ELEMENT) stands for all the classes of its range and the children of
+     * editorial elements are always processed. Nothing is restricted by default.
+     */
+    void SetClassIds(const std::vector<ClassId> &classIds, const std::vector<ClassId> &containerIds);
+
+    /**
+     * @name Check if the functor is called on an object and if its children are processed
+     */
+    ///@{
+    bool IsCalledFor(const Object *object) const
+    {
+        return (!m_hasClassIds || m_classIds.test(object->GetClassId()));
+    }
+    bool IsContainer(const Object *object) const
+    {
+        return (!m_hasClassIds || m_containerIds.test(object->GetClassId()));
+    }
+    ///@}
+
 private:
     //
 public:
+    /**
+     * The classes that can hold layer elements, from the document down to the layer elements themselves.
+     * To be passed as containerIds for functors acting only on layer elements, staves or layers.
+     */
+    static const std::vector<ClassId> s_layerElementContainerIds;
+
     /**
      * The return code of the functor.
      * FUNCTOR_CONTINUE: continue processing
@@ -1149,6 +1249,13 @@ public:
     bool m_visibleOnly;
 
 private:
+    /**
+     * The classes the functor is called on and the classes for which the children are processed.
+     * Used only if m_hasClassIds is true (see Functor::SetClassIds).
+     */
+    bool m_hasClassIds;
+    std::bitset<UNSPECIFIED + 1> m_classIds;
+    std::bitset<UNSPECIFIED + 1> m_containerIds;
 };
 
 //----------------------------------------------------------------------------
@@ -8,6 +8,10 @@
 #ifndef __VRV_PAGE_H__
 #define __VRV_PAGE_H__
 
+#include <functional>
+
+//----------------------------------------------------------------------------
+
 #include "object.h"
 #include "scoredef.h"
 
@@ -144,6 +148,14 @@ private:
      */
     void AdjustSylSpacingByVerse(PrepareProcessingListsParams &listsParams, Doc *doc);
 
+    /**
+     * Process the measures of the page concurrently with the layout threads of the document.
+     * The measures are split into contiguous chunks and processMeasures is called once for each
+     * of them, so that every worker uses its own functors and functor params.
+     * This can only be used for functors that do not read or modify anything outside the measure.
+     */
+    void ProcessMeasures(Doc *doc, const std::function<void(const ArrayOfObjects &measures)> &processMeasures);
+
     //
 public:
     /** Page width (MEI scoredef@page.width). Saved if != -1 */
@@ -11,28 +11,96 @@
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <map>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 //----------------------------------------------------------------------------
 
 #include "devicecontext.h"
 
+namespace vrv {
+
+class SvgElement;
+
+/**
+ * A child of a SvgElement: either an element that can still have children or an element already serialized.
+ */
+struct SvgChild {
+    SvgElement *m_element;
+    std::string m_content;
+};
+
 //----------------------------------------------------------------------------
+// SvgElement
+//----------------------------------------------------------------------------
+
+/**
+ * This class represents an element of the SVG being written that can have children (e.g., <g> or <text>).
+ * Elements without children (e.g., <path>) are serialized as soon as they are drawn.
+ * The serialization is the same as the one of pugixml with a tab indentation.
+ */
+class SvgElement {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    SvgElement(const std::string &name, SvgElement *parent);
+    virtual ~SvgElement();
+    ///@}
 
-#include "pugixml.hpp"
+    /**
+     * Add a child element. A <g> is added after all the other children and any other element before the first <g>.
+     */
+    SvgElement *AppendElement(const std::string &name);
 
-namespace vrv {
+    /**
+     * @name Add a serialized child element before the first <g> or before all the children
+     */
+    ///@{
+    void AppendContent(const std::string &content);
+    void PrependContent(const std::string &content);
+    ///@}
+
+    /**
+     * Serialize the element and its children (without the indentation of the first line)
+     */
+    void Serialize(std::string &output) const;
+
+    /**
+     * Serialize a child at the depth of the children of the element (new line and indentation included)
+     */
+    void SerializeChild(const SvgChild &child, std::string &output) const;
+
+public:
+    /** The name of the element */
+    std::string m_name;
+    /** The serialized attributes */
+    std::string m_attributes;
+    /** The depth in the SVG (0 for the root <svg>) */
+    int m_depth;
+    /** The parent element (NULL for the root <svg>) */
+    SvgElement *m_parent;
+    /** The children before the first <g> and the <g> children */
+    std::list<SvgChild> m_children;
+    std::list<SvgChild> m_gChildren;
+    /** A flag indicating that the start tag and the previous children have already been written to the output */
+    bool m_streamed;
+};
 
 //----------------------------------------------------------------------------
-// BBoxDeviceContext
+// SvgDeviceContext
 //----------------------------------------------------------------------------
 
 /**
  * This class implements a drawing context for generating SVG files.
  * The music font is embedded by incorporating ./data/[fontname]/[glyph].xml glyphs within
  * the SVG file.
+ * The SVG is written directly to a buffer: each system is written as soon as it is drawn and only the elements of the
+ * system being drawn are kept in memory.
  */
 class SvgDeviceContext : public DeviceContext {
 public:
@@ -71,6 +139,15 @@ public:
      */
     std::string GetStringSVG(bool xml_declaration = false);
 
+    /**
+     * @name Write the SVG into a string or a stream.
+     * Add the xml tag if necessary. The SVG is moved to an empty string without being copied.
+     */
+    ///@{
+    void WriteSVG(std::string &output, bool xml_declaration = false);
+    void WriteSVG(std::ostream &output, bool xml_declaration = false);
+    ///@}
+
     /**
      * @name Drawing methods
      */
@@ -169,7 +246,32 @@ private:
 
     std::string GetColour(int colour);
 
-    pugi::xml_node AppendChild(std::string name);
+    /**
+     * Add a serialized element to the current element
+     */
+    void AppendChild(const std::string &element);
+
+    /**
+     * @name Start and close an element that can have children
+     */
+    ///@{
+    void StartElement(const std::string &name);
+    void CloseElement();
+    ///@}
+
+    /**
+     * @name Methods for writing the elements to the output as soon as they cannot be changed anymore
+     */
+    ///@{
+    /** Write the start tag of the element and the children of its ancestors preceding it */
+    void StreamElement(SvgElement *element);
+    /** Write the element and remove it from its parent */
+    void FlushElement(SvgElement *element);
+    /** Write the remaining children and the end tag of a streamed element and remove it from its parent */
+    void EndStreamedElement(SvgElement *element);
+    /** Write and remove the children of the element preceding the one given (all of them if NULL) */
+    void WriteChildren(SvgElement *element, SvgElement *until);
+    ///@}
 
 public:
     //
@@ -181,26 +283,29 @@ private:
      */
     bool m_vrvTextFont;
 
-    // we use a std::stringstream because we want to prepend the <defs> which will know only when we reach the end of
-    // the page
+    // the output buffer - we want to prepend the <defs> which will know only when we reach the end of the page
     // some viewer seem to support to have the <defs> at the end, but some do not (pdf2svg, for example)
-    // for this reason, the full svg is finally written a string from the destructor or when Flush() is called
-    std::ostringstream m_outdata;
+    // for this reason, the beginning of the buffer is reserved and the header is inserted there by Commit()
+    std::string m_outdata;
 
     bool m_committed; // did we flushed the file?
     int m_width, m_height;
     int m_originX, m_originY;
     double m_userScaleX, m_userScaleY;
 
-    // holds the list of glyphs from the smufl font used so far
+    // holds the list of glyphs from the smufl font used so far (in order of appearance)
     // they will be added at the end of the file as <defs>
-    std::vector<std::string> m_smufl_glyphs;
-
-    // pugixml data
-    pugi::xml_document m_svgDoc;
-    pugi::xml_node m_svgNode;
-    pugi::xml_node m_currentNode;
-    std::list<pugi::xml_node> m_svgNodeStack;
+    std::vector<const Glyph *> m_smufl_glyphs;
+    // the same glyphs for checking in constant time if a glyph has already been added
+    std::unordered_set<const Glyph *> m_smufl_glyphs_set;
+
+    // the root <svg>, the page margin <g> and the elements being drawn
+    SvgElement *m_svgElement;
+    SvgElement *m_pageMarginElement;
+    SvgElement *m_currentElement;
+    std::list<SvgElement *> m_svgElementStack;
+    // the <g> elements with an id that can be resumed
+    std::map<std::string, SvgElement *> m_graphicIds;
 };
 
 } // namespace vrv
@@ -18,6 +18,7 @@ namespace vrv {
 class BoundaryEnd;
 class DeviceContext;
 class Ending;
+class LayerElement;
 class Measure;
 class ScoreDef;
 class Staff;
@@ -100,6 +101,15 @@ public:
     void SetDrawingScoreDef(ScoreDef *drawingScoreDef);
     ///@}
 
+    /**
+     * Fill the layer elements of the staff and layer @n with a drawing x between minPos and maxPos (excluded).
+     * The elements are in document order and the look up stops at the first one after maxPos, as with
+     * Object::FindTimeSpanningLayerElements. Return false when the index is not available because the layout of the
+     * system is not done.
+     */
+    bool GetLayerElementsBetween(
+        std::vector<LayerElement *> *elements, int staffN, int layerN, int minPos, int maxPos) const;
+
     //----------//
     // Functors //
     //----------//
@@ -119,6 +129,11 @@ public:
      */
     virtual int ResetVerticalAlignment(FunctorParams *functorParams);
 
+    /**
+     * See Object::ResetDrawing
+     */
+    virtual int ResetDrawing(FunctorParams *functorParams);
+
     /**
      * See Object::ApplyPPUFactor
      */
@@ -168,6 +183,11 @@ public:
      */
     virtual int AdjustFloatingPostioners(FunctorParams *functorParams);
 
+    /**
+     * See Object::IndexLayerElements
+     */
+    virtual int IndexLayerElements(FunctorParams *functorParams);
+
     /**
      * See Object::CastOffPages
      */
@@ -231,6 +251,13 @@ protected:
 
 private:
     ScoreDef *m_drawingScoreDef;
+
+    /**
+     * The layer elements by staff and layer @n in document order, with the running maximum of their drawing x.
+     * Filled once the horizontal layout is done and reset with it.
+     */
+    MapOfLayerElementXs m_layerElementXs;
+    bool m_layerElementXsDone;
 };
 
 } // namespace vrv
@@ -8,6 +8,7 @@
 #ifndef __VRV_TOOLKIT_H__
 #define __VRV_TOOLKIT_H__
 
+#include <stdint.h>
 #include <string>
 
 //----------------------------------------------------------------------------
@@ -26,8 +27,52 @@
 
 namespace vrv {
 
+class SvgDeviceContext;
+
 enum FileFormat { UNKNOWN = 0, AUTO, MEI, HUMDRUM, PAE, DARMS, MUSICXML, MUSICXMLHUM, MIDI };
 
+//----------------------------------------------------------------------------
+// ToolkitOptions
+//----------------------------------------------------------------------------
+
+/**
+ * This class holds the options of a Toolkit, so that they can be copied as a whole.
+ * The font and the layout cache file are kept in the Toolkit since they are not simple values.
+ */
+class ToolkitOptions {
+public:
+    ToolkitOptions();
+    virtual ~ToolkitOptions() {}
+
+public:
+    int m_scale;
+    FileFormat m_format;
+    FileFormat m_outformat;
+
+    int m_pageHeight;
+    int m_pageWidth;
+    int m_border; // to be replace by pageRightMar, pageLeftMar, pageTopMar
+    /** given in units **/
+    int m_spacingStaff;
+    int m_spacingSystem;
+
+    bool m_noLayout;
+    bool m_ignoreLayout;
+    int m_humType;
+    bool m_adjustPageHeight;
+    std::vector<std::string> m_appXPathQueries;
+    std::vector<std::string> m_choiceXPathQueries;
+    std::string m_mdivXPathQuery;
+    bool m_scoreBasedMei;
+    bool m_evenNoteSpacing;
+    int m_layoutThreads;
+    float m_spacingLinear;
+    float m_spacingNonLinear;
+    // for debugging
+    bool m_noJustification;
+    bool m_showBoundingBoxes;
+};
+
 //----------------------------------------------------------------------------
 // Toolkit
 //----------------------------------------------------------------------------
@@ -38,16 +83,23 @@ public:
      * @name Constructors and destructors
      */
     ///@{
-    /** If initFont is set to false, Resources::InitFonts will have to be called explicitely */
+    /** If initFont is set to false, SetResourcePath will have to be called explicitely */
     Toolkit(bool initFont = true);
     virtual ~Toolkit();
     ///@}
 
     /**
      * Set the resource path. To be called if the constructor had initFont=false.
-     * This needs refactoring.
+     * The fonts are loaded for this toolkit only and other toolkits are not affected.
      */
     bool SetResourcePath(const std::string &path);
+    std::string GetResourcePath() { return m_resourcePath; }
+
+    /**
+     * Copy the options and the fonts of another toolkit, for example for setting up a pool of toolkits.
+     * The layout cache file is not copied since it is meant to be used by one toolkit only.
+     */
+    void CopyOptions(const Toolkit &toolkit);
 
     /**
      * Load a file with the specified type.
@@ -107,6 +159,14 @@ public:
      */
     bool RenderToSvgFile(const std::string &filename, int pageNo = 1);
 
+    /**
+     * Render all the pages in SVG, svgs[0] being the first page.
+     * The pages are laid out one after the other and then drawn concurrently by the given number
+     * of threads (0 for one thread per core). Pages are rendered one by one if threads is 1 or
+     * if the pages have their own dimensions.
+     */
+    bool RenderAllToSvg(std::vector<std::string> &svgs, int threads = 1, bool xml_declaration = false);
+
     /**
      * Creates a midi file, opens it, and writes to it.
      * currently generates a dummy midi file.
@@ -141,13 +201,31 @@ public:
      */
     std::string GetElementAttr(const std::string &xmlId);
 
+    /**
+     * Return the <mdiv> elements of MEI data as a JSON array, without loading the data.
+     * Each <mdiv> has its attributes and an xPath query to pass to SetMdivXPathQuery for loading only that <mdiv>.
+     */
+    std::string GetMdivs(const std::string &data);
+
     /**
      * Redo the layout of the loaded data.
      * This can be called once the rendering option were changed,
      * For example with a new page (sceen) height or a new zoom level.
+     * The horizontal layout of the measures is kept unless the data was edited in between.
      */
     void RedoLayout();
 
+    /**
+     * @name Set and get the layout cache file
+     * When a file is given, LoadData looks in it for a layout snapshot (the system and page breaks) matching the
+     * data and the layout options and applies it instead of casting off the document. If there is no matching
+     * snapshot, the document is cast off and the snapshot is written to the file for the next time.
+     */
+    ///@{
+    void SetLayoutCacheFile(const std::string &filename) { m_layoutCacheFile = filename; }
+    std::string GetLayoutCacheFile() { return m_layoutCacheFile; }
+    ///@}
+
     /**
      * Redo the layout of the pitch postitions of the current drawing page.
      * Only the note vertical positions are recalculated with this method.
@@ -184,7 +262,7 @@ public:
      */
     ///@{
     bool SetBorder(int border);
-    int GetBorder() { return m_border; }
+    int GetBorder() { return m_options.m_border; }
     ///@}
 
     /**
@@ -192,7 +270,7 @@ public:
      */
     ///@{
     bool SetScale(int scale);
-    int GetScale() { return m_scale; }
+    int GetScale() { return m_options.m_scale; }
     ///@}
 
     /**
@@ -200,7 +278,7 @@ public:
      */
     ///@{
     bool SetPageHeight(int h);
-    int GetPageHeight() { return m_pageHeight; }
+    int GetPageHeight() { return m_options.m_pageHeight; }
     ///@}
 
     /**
@@ -208,7 +286,7 @@ public:
      */
     ///@{
     bool SetPageWidth(int w);
-    int GetPageWidth() { return m_pageWidth; }
+    int GetPageWidth() { return m_options.m_pageWidth; }
     ///@}
 
     /**
@@ -217,8 +295,8 @@ public:
     ///@{
     bool SetSpacingStaff(int spacingStaff);
     bool SetSpacingSystem(int spacingSystem);
-    int GetSpacingStaff() { return m_spacingStaff; }
-    int GetSpacingSystem() { return m_spacingSystem; }
+    int GetSpacingStaff() { return m_options.m_spacingStaff; }
+    int GetSpacingSystem() { return m_options.m_spacingSystem; }
     ///@}
 
     /**
@@ -226,7 +304,7 @@ public:
      */
     ///@{
     bool SetSpacingLinear(float spacingLinear);
-    float GetSpacingLinear() { return m_spacingLinear; }
+    float GetSpacingLinear() { return m_options.m_spacingLinear; }
     ///@}
 
     /**
@@ -234,7 +312,7 @@ public:
      */
     ///@{
     bool SetSpacingNonLinear(float spacingNonLinear);
-    float GetSpacingNonLinear() { return m_spacingNonLinear; }
+    float GetSpacingNonLinear() { return m_options.m_spacingNonLinear; }
     ///@}
 
     /**
@@ -242,16 +320,16 @@ public:
      * and output one single page with one single system
      */
     ///@{
-    void SetNoLayout(bool l) { m_noLayout = l; }
-    int GetNoLayout() { return m_noLayout; }
+    void SetNoLayout(bool l) { m_options.m_noLayout = l; }
+    int GetNoLayout() { return m_options.m_noLayout; }
     ///@}
 
     /**
      * @name Include type attributes when importing from Humdrum
      */
     ///@{
-    void SetHumType(int l) { m_humType = l; }
-    int GetHumType() { return m_humType; }
+    void SetHumType(int l) { m_options.m_humType = l; }
+    int GetHumType() { return m_options.m_humType; }
     ///@}
 
     /**
@@ -259,40 +337,48 @@ public:
      * and fully recalculate the layout
      */
     ///@{
-    void SetIgnoreLayout(bool l) { m_ignoreLayout = l; }
-    int GetIgnoreLayout() { return m_ignoreLayout; }
+    void SetIgnoreLayout(bool l) { m_options.m_ignoreLayout = l; }
+    int GetIgnoreLayout() { return m_options.m_ignoreLayout; }
     ///@}
 
     /**
      * @name Crop the page height to the height of the content
      */
     ///@{
-    void SetAdjustPageHeight(bool a) { m_adjustPageHeight = a; }
-    int GetAdjustPageHeight() { return m_adjustPageHeight; }
+    void SetAdjustPageHeight(bool a) { m_options.m_adjustPageHeight = a; }
+    int GetAdjustPageHeight() { return m_options.m_adjustPageHeight; }
     ///@}
 
     /**
      * @name Space notes equally and close together (normally for mensural notation)
      */
     ///@{
-    void SetEvenNoteSpacing(bool even) { m_evenNoteSpacing = even; }
-    int GetEvenNoteSpacing() { return m_evenNoteSpacing; }
+    void SetEvenNoteSpacing(bool even) { m_options.m_evenNoteSpacing = even; }
+    int GetEvenNoteSpacing() { return m_options.m_evenNoteSpacing; }
+    ///@}
+
+    /**
+     * @name Number of threads for preparing the drawing and for the horizontal layout (0 for one per core)
+     */
+    ///@{
+    void SetLayoutThreads(int threads) { m_options.m_layoutThreads = threads; }
+    int GetLayoutThreads() { return m_options.m_layoutThreads; }
     ///@}
 
     /**
      * @name Do not justify the system (for debugging purposes)
      */
     ///@{
-    void SetNoJustification(bool j) { m_noJustification = j; }
-    int GetNoJustification() { return m_noJustification; }
+    void SetNoJustification(bool j) { m_options.m_noJustification = j; }
+    int GetNoJustification() { return m_options.m_noJustification; }
     ///@}
 
     /**
      * @name Do not justify the system (for debugging purposes)
      */
     ///@{
-    void SetShowBoundingBoxes(bool b) { m_showBoundingBoxes = b; }
-    int GetShowBoundingBoxes() { return m_showBoundingBoxes; }
+    void SetShowBoundingBoxes(bool b) { m_options.m_showBoundingBoxes = b; }
+    int GetShowBoundingBoxes() { return m_options.m_showBoundingBoxes; }
     ///@}
 
     /**
@@ -301,8 +387,8 @@ public:
      */
     ///@{
     bool SetFormat(std::string const &informat);
-    void SetFormat(FileFormat format) { m_format = format; }
-    int GetFormat() { return m_format; }
+    void SetFormat(FileFormat format) { m_options.m_format = format; }
+    int GetFormat() { return m_options.m_format; }
     ///@}
 
     /**
@@ -311,8 +397,8 @@ public:
      */
     ///@{
     bool SetOutputFormat(std::string const &outformat);
-    void SetOutputFormat(FileFormat format) { m_outformat = format; }
-    int GetOutputFormat() { return m_outformat; }
+    void SetOutputFormat(FileFormat format) { m_options.m_outformat = format; }
+    int GetOutputFormat() { return m_options.m_outformat; }
     ///@}
 
     /**
@@ -327,7 +413,7 @@ public:
      */
     ///@{
     void SetAppXPathQueries(std::vector<std::string> const &xPathQueries);
-    std::vector<std::string> GetAppXPathQuery() { return m_appXPathQueries; }
+    std::vector<std::string> GetAppXPathQuery() { return m_options.m_appXPathQueries; }
     ///@}
 
     /**
@@ -335,27 +421,28 @@ public:
      */
     ///@{
     void SetChoiceXPathQueries(std::vector<std::string> const &xPathQueries);
-    std::vector<std::string> GetChoiceXPathQueries() { return m_choiceXPathQueries; }
+    std::vector<std::string> GetChoiceXPathQueries() { return m_options.m_choiceXPathQueries; }
     ///@}
 
     /**
      * @name Set and get the xPath query for selecting a <mdiv>
      */
     ///@{
-    void SetMdivXPathQuery(std::string const &xPathQuery) { m_mdivXPathQuery = xPathQuery; };
-    std::string GetMdivXPathQuery() { return m_mdivXPathQuery; };
+    void SetMdivXPathQuery(std::string const &xPathQuery) { m_options.m_mdivXPathQuery = xPathQuery; };
+    std::string GetMdivXPathQuery() { return m_options.m_mdivXPathQuery; };
     ///@}
 
     /**
      * @name Set and get the xPath query for selecting <app> (if any)
      */
     ///@{
-    void SetScoreBasedMei(bool scoreBasedMei) { m_scoreBasedMei = scoreBasedMei; }
-    bool GetScoreBasedMei() { return m_scoreBasedMei; }
+    void SetScoreBasedMei(bool scoreBasedMei) { m_options.m_scoreBasedMei = scoreBasedMei; }
+    bool GetScoreBasedMei() { return m_options.m_scoreBasedMei; }
     ///@}
 
     /**
      * @name Set a specific font
+     * The font is used by this toolkit only and other toolkits are not affected.
      */
     ///@{
     bool SetFont(std::string const &font);
@@ -379,9 +466,30 @@ public:
     ///@}
 
 private:
+    /**
+     * Render the page in a new SVG device context (to be deleted by the caller).
+     * Page number is 1-based.
+     */
+    SvgDeviceContext *RenderToSvgDeviceContext(int pageNo);
+
+    /**
+     * Create the SVG device context for the current page of the view (to be deleted by the caller).
+     */
+    SvgDeviceContext *CreateSvgDeviceContext();
+
     bool IsUTF16(const std::string &filename);
     bool LoadUTF16File(const std::string &filename);
 
+    /**
+     * @name Read and write the layout snapshot of the data in the layout cache file
+     * The snapshot key is a hash of the data, of the version and of all the options changing the layout.
+     */
+    ///@{
+    bool LoadLayoutSnapshot(const std::string &data);
+    bool SaveLayoutSnapshot(const std::string &data);
+    uint64_t GetLayoutSnapshotKey(const std::string &data);
+    ///@}
+
 protected:
 #ifdef USE_EMSCRIPTEN
     /**
@@ -399,33 +507,12 @@ public:
 private:
     Doc m_doc;
     View m_view;
-    int m_scale;
-    FileFormat m_format;
-    FileFormat m_outformat;
-
-    int m_pageHeight;
-    int m_pageWidth;
-    int m_border; // to be replace by pageRightMar, pageLeftMar, pageTopMar
-    /** given in units **/
-    int m_spacingStaff;
-    int m_spacingSystem;
-
-    bool m_noLayout;
-    bool m_ignoreLayout;
-    int m_humType = 0;
-    bool m_adjustPageHeight;
-    std::vector<std::string> m_appXPathQueries;
-    std::vector<std::string> m_choiceXPathQueries;
-    std::string m_mdivXPathQuery;
-    bool m_scoreBasedMei;
-    bool m_evenNoteSpacing;
-    float m_spacingLinear;
-    float m_spacingNonLinear;
-    // for debugging
-    bool m_noJustification;
-    bool m_showBoundingBoxes;
+    ToolkitOptions m_options;
+    std::string m_font;
+    std::string m_resourcePath;
+    std::string m_layoutCacheFile;
 
-    static char *m_humdrumBuffer;
+    char *m_humdrumBuffer;
     char *m_cString;
 };
 
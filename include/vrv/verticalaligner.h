@@ -8,6 +8,10 @@
 #ifndef __VRV_VERTICAL_ALIGNER_H__
 #define __VRV_VERTICAL_ALIGNER_H__
 
+#include <set>
+
+//----------------------------------------------------------------------------
+
 #include "atts_shared.h"
 #include "object.h"
 
@@ -18,6 +22,48 @@ class StaffAlignment;
 class SystemAligner;
 class TimestampAttr;
 
+//----------------------------------------------------------------------------
+// HorizontalBBoxIndex
+//----------------------------------------------------------------------------
+
+/**
+ * This class holds a list of bounding boxes together with an index of their content left position.
+ * It is used for retrieving the boxes overlapping horizontally with another one without looking at all of them.
+ * The boxes are grouped by content width, with widths of the same power of two in the same group, so that a
+ * single wide box (e.g., a long slur) does not widen the search among the narrow ones.
+ * The horizontal positions are expected not to change once the boxes are added.
+ */
+class HorizontalBBoxIndex {
+public:
+    // constructors and destructors
+    HorizontalBBoxIndex() { Clear(); }
+    virtual ~HorizontalBBoxIndex() {}
+
+    void Add(BoundingBox *box);
+    void Clear();
+    const ArrayOfBoundingBoxes *GetBoxes() const { return &m_boxes; }
+
+    /**
+     * Fill the array with the boxes having a horizontal content overlap with the box.
+     * They are returned in the order they were added (see BoundingBox::HorizontalContentOverlap).
+     */
+    void FindHorizontalContentOverlaps(const BoundingBox *box, ArrayOfBoundingBoxes *overlaps) const;
+
+private:
+    /** The group of a content width: 0 for 0, and n for widths from 2^(n-1) to 2^n - 1 */
+    static int GetWidthGroup(int width);
+
+public:
+    //
+private:
+    /** The boxes in the order they were added */
+    ArrayOfBoundingBoxes m_boxes;
+    /** For each width group, the content left position and the position in m_boxes of its boxes, sorted */
+    std::vector<std::set<std::pair<int, int> > > m_lefts;
+    /** For each width group, the largest content width of its boxes */
+    std::vector<int> m_maxWidths;
+};
+
 //----------------------------------------------------------------------------
 // SystemAligner
 //----------------------------------------------------------------------------
@@ -150,8 +196,8 @@ public:
      * @name Adds a bounding box to the array of overflowing objects above or below
      */
     ///@{
-    void AddBBoxAbove(BoundingBox *box) { m_overflowAboveBBoxes.push_back(box); }
-    void AddBBoxBelow(BoundingBox *box) { m_overflowBelowBBoxes.push_back(box); }
+    void AddBBoxAbove(BoundingBox *box) { m_overflowAboveBBoxes.Add(box); }
+    void AddBBoxBelow(BoundingBox *box) { m_overflowBelowBBoxes.Add(box); }
     ///@}
 
     /**
@@ -225,8 +271,8 @@ private:
     /**
      * The list of overflowing bounding boxes (e.g, LayerElement or FloatingPositioner)
      */
-    std::vector<BoundingBox *> m_overflowAboveBBoxes;
-    std::vector<BoundingBox *> m_overflowBelowBBoxes;
+    HorizontalBBoxIndex m_overflowAboveBBoxes;
+    HorizontalBBoxIndex m_overflowBelowBBoxes;
 };
 
 } // namespace vrv
@@ -16,6 +16,7 @@ namespace vrv {
 
 class Accid;
 class BarLine;
+class BBoxDeviceContext;
 class Beam;
 class BeamDrawingParams;
 class Breath;
@@ -139,6 +140,15 @@ public:
      */
     void DrawCurrentPage(DeviceContext *dc, bool background = true);
 
+    /**
+     * Draw the page pageIdx without calling Doc::SetDrawingPage.
+     * The page must have been laid out beforehand and all the pages must share the drawing
+     * dimensions of the document. The document is then only read, which means that different
+     * views can draw different pages concurrently.
+     * Defined in view_page.cpp
+     */
+    void DrawLaidOutPage(DeviceContext *dc, int pageIdx, bool background = true);
+
     /**
      * Return the pixel per unit factor of the current page (if any, 1.0 otherwise)
      */
@@ -154,11 +164,12 @@ public:
 
 protected:
     /**
-     * @name Methods for drawing System, ScoreDef, StaffDef, Staff, and Layer.
+     * @name Methods for drawing Page, System, ScoreDef, StaffDef, Staff, and Layer.
      * Additional methods for drawing braces, barlines, slurs, etc.
      * Defined in view_page.cpp
      */
     ///@{
+    void DrawPage(DeviceContext *dc, bool background);
     void DrawSystem(DeviceContext *dc, System *system);
     void DrawSystemList(DeviceContext *dc, System *system, const ClassId classId);
     void DrawScoreDef(DeviceContext *dc, ScoreDef *scoreDef, Measure *measure, int x, BarLine *barLine = NULL);
@@ -424,6 +435,12 @@ protected:
      */
     void SetScoreDefDrawingWidth(DeviceContext *dc, ScoreDef *scoreDef);
 
+    /**
+     * Return the uuid of the object to be passed as graphic id when starting or resuming its graphic.
+     * It is empty when drawing with the bounding box context, which does not use it.
+     */
+    std::string GetGraphicUuid(Object *object) const;
+
 private:
     /**
      * @name Internal methods used for calculating tuplets
@@ -497,6 +514,14 @@ protected:
      */
     ScoreDef m_drawingScoreDef;
 
+    /**
+     * The bounding box context the page is drawn with, NULL otherwise.
+     * Set in DrawPage. The basic drawing methods (glyphs, lines, rectangles, dots) update the bounding box
+     * directly from the glyph metrics and the geometry when it is the one passed to them, without pen, brush and
+     * font changes or virtual calls.
+     */
+    BBoxDeviceContext *m_bBoxDC;
+
 private:
     /** @name Internal values for storing temporary values for ligatures */
     ///@{
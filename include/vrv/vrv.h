@@ -9,7 +9,9 @@
 #define __VRV_H__
 
 #include <cstring>
+#include <functional>
 #include <map>
+#include <mutex>
 #include <stdarg.h>
 #include <stdio.h>
 #include <string>
@@ -117,13 +119,22 @@ void LogElapsedTimeEnd(const char *msg = "unspecified operation");
  */
 bool Check(Object *object);
 
+/**
+ * Split the items [0, count) into contiguous chunks, one per thread (0 for one thread per core),
+ * and call process(begin, end) for each chunk concurrently. The calling thread processes the first
+ * chunk and everything is processed by the calling thread with one thread or a single item.
+ */
+void ProcessInChunks(int count, int threads, const std::function<void(int begin, int end)> &process);
+
 //----------------------------------------------------------------------------
 // Resources
 //----------------------------------------------------------------------------
 
 /**
- * This class provides static resource values.
- * The default values can be changed by setters.
+ * This class holds a set of font resources (SMuFL music font and text font bounding boxes).
+ * A set is loaded once for a resource path and a font name and is then immutable. The sets are cached and shared
+ * (read-only) by all the documents using them, which makes it safe to use them from several threads.
+ * The default resource path can be changed by the static setter.
  */
 
 class Resources {
@@ -132,31 +143,68 @@ public:
      * @name Setters and getters for static environment variables
      */
     ///@{
-    /** Resource path */
-    static std::string GetPath() { return m_path; }
-    static void SetPath(std::string path) { m_path = path; }
-    /** Init the SMufL music and text fonts */
+    /** Default resource path */
+    static std::string GetPath();
+    static void SetPath(std::string path);
+    /** Init the SMufL music and text fonts for the default resource path */
     static bool InitFonts();
-    /** Init the text font (bounding boxes and ASCII only) */
-    static bool InitTextFont();
-    /** Select a particular font */
-    static bool SetFont(std::string fontName);
-    /** Returns the glyph (if exists) for the current SMuFL font */
-    static Glyph *GetGlyph(wchar_t smuflCode);
+    ///@}
+
+    /**
+     * @name Get a shared font resource set
+     * The set is loaded the first time it is requested and returned from the cache afterwards.
+     * The Bravura and Leipzig fonts are always loaded first and the font given (if any) is loaded on top.
+     * Returns NULL if the fonts cannot be loaded.
+     */
+    ///@{
+    static const Resources *GetResources(const std::string &fontName = "");
+    static const Resources *GetResources(const std::string &path, const std::string &fontName);
+    ///@}
+
+    /**
+     * @name Getters for the font resource set
+     */
+    ///@{
+    /** The resource path the set was loaded from */
+    std::string GetResourcePath() const { return m_resourcePath; }
+    /** The name of the font loaded on top of the default ones (empty if none) */
+    std::string GetFontName() const { return m_fontName; }
+    /** Returns the glyph (if exists) for the SMuFL font */
+    const Glyph *GetGlyph(wchar_t smuflCode) const;
     /** Returns the glyph (if exists) for the text font (bounding box and ASCII only) */
-    static Glyph *GetTextGlyph(wchar_t code);
+    const Glyph *GetTextGlyph(wchar_t code) const;
+    /**
+     * Returns the SVG definition (<symbol>) of the glyph serialized for the <defs> of a SVG file.
+     * The glyph file is read the first time only and the definition is kept in memory afterwards.
+     */
+    const std::string &GetGlyphDefs(const Glyph *glyph) const;
     ///@}
 
 private:
-    static bool LoadFont(std::string fontName);
+    Resources(const std::string &path, const std::string &fontName);
+    virtual ~Resources();
+
+    /** Load the default fonts, the font (if any) and the text font */
+    bool Load();
+    bool LoadFont(std::string fontName);
+    /** Init the text font (bounding boxes and ASCII only) */
+    bool InitTextFont();
 
 private:
     /** The path to the resources directory (e.g., for the svg/ subdirectory with fonts as XML */
-    static std::string m_path;
+    std::string m_resourcePath;
+    /** The name of the font loaded on top of the default ones */
+    std::string m_fontName;
     /** The loaded SMuFL font */
-    static std::map<wchar_t, Glyph> m_font;
+    std::map<wchar_t, Glyph> m_font;
     /** A text font used for bounding box calculations */
-    static std::map<wchar_t, Glyph> m_textFont;
+    std::map<wchar_t, Glyph> m_textFont;
+    /** The SVG definitions of the glyphs already loaded (filled lazily, hence mutable) */
+    mutable std::map<const Glyph *, std::string> m_glyphDefs;
+    mutable std::mutex m_glyphDefsMutex;
+
+    /** The default resource path */
+    static std::string s_defaultPath;
 };
 
 //----------------------------------------------------------------------------
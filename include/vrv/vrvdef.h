@@ -11,6 +11,8 @@
 #include <algorithm>
 #include <list>
 #include <map>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 //----------------------------------------------------------------------------
@@ -31,6 +33,22 @@ namespace vrv {
 
 enum MEIVersion { MEI_UNDEFINED = 0, MEI_2013, MEI_3_0_0 };
 
+//----------------------------------------------------------------------------
+// Cast redefinition
+//----------------------------------------------------------------------------
+
+/**
+ * Cast for pointers whose type is already known, typically the FunctorParams in functors, an object
+ * found with its ClassId, or an object for which the ClassId has been checked.
+ * It is checked with a dynamic_cast in debug builds and is a static_cast in release builds.
+ * It cannot be used for casting to or from an interface not in the class hierarchy (use dynamic_cast).
+ */
+#ifdef NDEBUG
+#define vrv_cast static_cast
+#else
+#define vrv_cast dynamic_cast
+#endif
+
 //----------------------------------------------------------------------------
 // Object defines
 //----------------------------------------------------------------------------
@@ -220,12 +238,26 @@ typedef std::vector<BeamElementCoord *> ArrayOfBeamElementCoords;
 
 typedef std::vector<std::pair<LayerElement *, Point> > ArrayOfLayerElementPointPairs;
 
+typedef std::vector<std::pair<LayerElement *, int> > ArrayOfLayerElementIntPairs;
+
+typedef std::map<std::pair<int, int>, ArrayOfLayerElementIntPairs> MapOfLayerElementXs;
+
+typedef std::map<std::pair<int, int>, ArrayOfObjects> MapOfLayersByStaffLayerN;
+
 typedef std::vector<std::pair<Object *, data_MEASUREBEAT> > ArrayOfObjectBeatPairs;
 
 typedef std::vector<std::pair<TimePointInterface *, ClassId> > ArrayOfPointingInterClassIdPairs;
 
 typedef std::vector<std::pair<TimeSpanningInterface *, ClassId> > ArrayOfSpanningInterClassIdPairs;
 
+typedef std::unordered_map<std::string, ArrayOfSpanningInterClassIdPairs> MapOfSpanningInterClassIdPairsByUuid;
+
+typedef std::unordered_map<std::string, ArrayOfPointingInterClassIdPairs> MapOfPointingInterClassIdPairsByUuid;
+
+typedef std::unordered_map<std::string, LayerElement *> MapOfLayerElementsByUuid;
+
+typedef std::vector<std::pair<std::string, int> > ArrayOfUuidCountPairs;
+
 typedef std::vector<FloatingPositioner *> ArrayOfFloatingPositioners;
 
 typedef std::vector<BoundingBox *> ArrayOfBoundingBoxes;
@@ -17,6 +17,7 @@
 //----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <string.h>
 
 //----------------------------------------------------------------------------
 
@@ -28,2979 +29,4454 @@ namespace vrv {
 // AttConverter
 //----------------------------------------------------------------------------
 
-std::string AttConverter::AccidentalExplicitToStr(data_ACCIDENTAL_EXPLICIT data) const
-{
-    std::string value;
-    switch (data) {
-        case ACCIDENTAL_EXPLICIT_s: value = "s"; break;
-        case ACCIDENTAL_EXPLICIT_f: value = "f"; break;
-        case ACCIDENTAL_EXPLICIT_ss: value = "ss"; break;
-        case ACCIDENTAL_EXPLICIT_x: value = "x"; break;
-        case ACCIDENTAL_EXPLICIT_ff: value = "ff"; break;
-        case ACCIDENTAL_EXPLICIT_xs: value = "xs"; break;
-        case ACCIDENTAL_EXPLICIT_sx: value = "sx"; break;
-        case ACCIDENTAL_EXPLICIT_ts: value = "ts"; break;
-        case ACCIDENTAL_EXPLICIT_tf: value = "tf"; break;
-        case ACCIDENTAL_EXPLICIT_n: value = "n"; break;
-        case ACCIDENTAL_EXPLICIT_nf: value = "nf"; break;
-        case ACCIDENTAL_EXPLICIT_ns: value = "ns"; break;
-        case ACCIDENTAL_EXPLICIT_su: value = "su"; break;
-        case ACCIDENTAL_EXPLICIT_sd: value = "sd"; break;
-        case ACCIDENTAL_EXPLICIT_fu: value = "fu"; break;
-        case ACCIDENTAL_EXPLICIT_fd: value = "fd"; break;
-        case ACCIDENTAL_EXPLICIT_nu: value = "nu"; break;
-        case ACCIDENTAL_EXPLICIT_nd: value = "nd"; break;
-        case ACCIDENTAL_EXPLICIT_1qf: value = "1qf"; break;
-        case ACCIDENTAL_EXPLICIT_3qf: value = "3qf"; break;
-        case ACCIDENTAL_EXPLICIT_1qs: value = "1qs"; break;
-        case ACCIDENTAL_EXPLICIT_3qs: value = "3qs"; break;
+const std::string &AttConverter::AccidentalExplicitToStr(data_ACCIDENTAL_EXPLICIT data) const
+{
+    static const std::string values[] = {
+        "", "s", "f", "ss", "x", "ff", "xs", "sx", "ts", "tf", "n", "nf", "ns", "su", "sd", "fu", "fd", "nu", "nd",
+        "1qf", "3qf", "1qs", "3qs"
+    };
+    switch (data) {
+        case ACCIDENTAL_EXPLICIT_s: return values[1];
+        case ACCIDENTAL_EXPLICIT_f: return values[2];
+        case ACCIDENTAL_EXPLICIT_ss: return values[3];
+        case ACCIDENTAL_EXPLICIT_x: return values[4];
+        case ACCIDENTAL_EXPLICIT_ff: return values[5];
+        case ACCIDENTAL_EXPLICIT_xs: return values[6];
+        case ACCIDENTAL_EXPLICIT_sx: return values[7];
+        case ACCIDENTAL_EXPLICIT_ts: return values[8];
+        case ACCIDENTAL_EXPLICIT_tf: return values[9];
+        case ACCIDENTAL_EXPLICIT_n: return values[10];
+        case ACCIDENTAL_EXPLICIT_nf: return values[11];
+        case ACCIDENTAL_EXPLICIT_ns: return values[12];
+        case ACCIDENTAL_EXPLICIT_su: return values[13];
+        case ACCIDENTAL_EXPLICIT_sd: return values[14];
+        case ACCIDENTAL_EXPLICIT_fu: return values[15];
+        case ACCIDENTAL_EXPLICIT_fd: return values[16];
+        case ACCIDENTAL_EXPLICIT_nu: return values[17];
+        case ACCIDENTAL_EXPLICIT_nd: return values[18];
+        case ACCIDENTAL_EXPLICIT_1qf: return values[19];
+        case ACCIDENTAL_EXPLICIT_3qf: return values[20];
+        case ACCIDENTAL_EXPLICIT_1qs: return values[21];
+        case ACCIDENTAL_EXPLICIT_3qs: return values[22];
         default:
             LogWarning("Unknown value '%d' for data.ACCIDENTAL.EXPLICIT", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_ACCIDENTAL_EXPLICIT AttConverter::StrToAccidentalExplicit(std::string value) const
-{
-    if (value == "s") return ACCIDENTAL_EXPLICIT_s;
-    if (value == "f") return ACCIDENTAL_EXPLICIT_f;
-    if (value == "ss") return ACCIDENTAL_EXPLICIT_ss;
-    if (value == "x") return ACCIDENTAL_EXPLICIT_x;
-    if (value == "ff") return ACCIDENTAL_EXPLICIT_ff;
-    if (value == "xs") return ACCIDENTAL_EXPLICIT_xs;
-    if (value == "sx") return ACCIDENTAL_EXPLICIT_sx;
-    if (value == "ts") return ACCIDENTAL_EXPLICIT_ts;
-    if (value == "tf") return ACCIDENTAL_EXPLICIT_tf;
-    if (value == "n") return ACCIDENTAL_EXPLICIT_n;
-    if (value == "nf") return ACCIDENTAL_EXPLICIT_nf;
-    if (value == "ns") return ACCIDENTAL_EXPLICIT_ns;
-    if (value == "su") return ACCIDENTAL_EXPLICIT_su;
-    if (value == "sd") return ACCIDENTAL_EXPLICIT_sd;
-    if (value == "fu") return ACCIDENTAL_EXPLICIT_fu;
-    if (value == "fd") return ACCIDENTAL_EXPLICIT_fd;
-    if (value == "nu") return ACCIDENTAL_EXPLICIT_nu;
-    if (value == "nd") return ACCIDENTAL_EXPLICIT_nd;
-    if (value == "1qf") return ACCIDENTAL_EXPLICIT_1qf;
-    if (value == "3qf") return ACCIDENTAL_EXPLICIT_3qf;
-    if (value == "1qs") return ACCIDENTAL_EXPLICIT_1qs;
-    if (value == "3qs") return ACCIDENTAL_EXPLICIT_3qs;
-    LogWarning("Unsupported value '%s' for data.ACCIDENTAL.EXPLICIT", value.c_str());
+            return values[0];
+    }
+}
+
+data_ACCIDENTAL_EXPLICIT AttConverter::StrToAccidentalExplicit(const char *value) const
+{
+    switch (strlen(value)) {
+        case 1:
+            switch (value[0]) {
+                case 's':
+                    return ACCIDENTAL_EXPLICIT_s;
+                case 'f':
+                    return ACCIDENTAL_EXPLICIT_f;
+                case 'x':
+                    return ACCIDENTAL_EXPLICIT_x;
+                case 'n':
+                    return ACCIDENTAL_EXPLICIT_n;
+            }
+            break;
+        case 2:
+            switch (value[0]) {
+                case 's':
+                    if (!memcmp(value, "ss", 2)) return ACCIDENTAL_EXPLICIT_ss;
+                    if (!memcmp(value, "sx", 2)) return ACCIDENTAL_EXPLICIT_sx;
+                    if (!memcmp(value, "su", 2)) return ACCIDENTAL_EXPLICIT_su;
+                    if (!memcmp(value, "sd", 2)) return ACCIDENTAL_EXPLICIT_sd;
+                    break;
+                case 'f':
+                    if (!memcmp(value, "ff", 2)) return ACCIDENTAL_EXPLICIT_ff;
+                    if (!memcmp(value, "fu", 2)) return ACCIDENTAL_EXPLICIT_fu;
+                    if (!memcmp(value, "fd", 2)) return ACCIDENTAL_EXPLICIT_fd;
+                    break;
+                case 'x':
+                    if (!memcmp(value, "xs", 2)) return ACCIDENTAL_EXPLICIT_xs;
+                    break;
+                case 't':
+                    if (!memcmp(value, "ts", 2)) return ACCIDENTAL_EXPLICIT_ts;
+                    if (!memcmp(value, "tf", 2)) return ACCIDENTAL_EXPLICIT_tf;
+                    break;
+                case 'n':
+                    if (!memcmp(value, "nf", 2)) return ACCIDENTAL_EXPLICIT_nf;
+                    if (!memcmp(value, "ns", 2)) return ACCIDENTAL_EXPLICIT_ns;
+                    if (!memcmp(value, "nu", 2)) return ACCIDENTAL_EXPLICIT_nu;
+                    if (!memcmp(value, "nd", 2)) return ACCIDENTAL_EXPLICIT_nd;
+                    break;
+            }
+            break;
+        case 3:
+            switch (value[0]) {
+                case '1':
+                    if (!memcmp(value, "1qf", 3)) return ACCIDENTAL_EXPLICIT_1qf;
+                    if (!memcmp(value, "1qs", 3)) return ACCIDENTAL_EXPLICIT_1qs;
+                    break;
+                case '3':
+                    if (!memcmp(value, "3qf", 3)) return ACCIDENTAL_EXPLICIT_3qf;
+                    if (!memcmp(value, "3qs", 3)) return ACCIDENTAL_EXPLICIT_3qs;
+                    break;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.ACCIDENTAL.EXPLICIT", value);
     return ACCIDENTAL_EXPLICIT_NONE;
 }
 
-std::string AttConverter::AccidentalImplicitToStr(data_ACCIDENTAL_IMPLICIT data) const
+const std::string &AttConverter::AccidentalImplicitToStr(data_ACCIDENTAL_IMPLICIT data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "s", "f", "ss", "ff", "n", "su", "sd", "fu", "fd" };
     switch (data) {
-        case ACCIDENTAL_IMPLICIT_s: value = "s"; break;
-        case ACCIDENTAL_IMPLICIT_f: value = "f"; break;
-        case ACCIDENTAL_IMPLICIT_ss: value = "ss"; break;
-        case ACCIDENTAL_IMPLICIT_ff: value = "ff"; break;
-        case ACCIDENTAL_IMPLICIT_n: value = "n"; break;
-        case ACCIDENTAL_IMPLICIT_su: value = "su"; break;
-        case ACCIDENTAL_IMPLICIT_sd: value = "sd"; break;
-        case ACCIDENTAL_IMPLICIT_fu: value = "fu"; break;
-        case ACCIDENTAL_IMPLICIT_fd: value = "fd"; break;
+        case ACCIDENTAL_IMPLICIT_s: return values[1];
+        case ACCIDENTAL_IMPLICIT_f: return values[2];
+        case ACCIDENTAL_IMPLICIT_ss: return values[3];
+        case ACCIDENTAL_IMPLICIT_ff: return values[4];
+        case ACCIDENTAL_IMPLICIT_n: return values[5];
+        case ACCIDENTAL_IMPLICIT_su: return values[6];
+        case ACCIDENTAL_IMPLICIT_sd: return values[7];
+        case ACCIDENTAL_IMPLICIT_fu: return values[8];
+        case ACCIDENTAL_IMPLICIT_fd: return values[9];
         default:
             LogWarning("Unknown value '%d' for data.ACCIDENTAL.IMPLICIT", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_ACCIDENTAL_IMPLICIT AttConverter::StrToAccidentalImplicit(std::string value) const
+data_ACCIDENTAL_IMPLICIT AttConverter::StrToAccidentalImplicit(const char *value) const
 {
-    if (value == "s") return ACCIDENTAL_IMPLICIT_s;
-    if (value == "f") return ACCIDENTAL_IMPLICIT_f;
-    if (value == "ss") return ACCIDENTAL_IMPLICIT_ss;
-    if (value == "ff") return ACCIDENTAL_IMPLICIT_ff;
-    if (value == "n") return ACCIDENTAL_IMPLICIT_n;
-    if (value == "su") return ACCIDENTAL_IMPLICIT_su;
-    if (value == "sd") return ACCIDENTAL_IMPLICIT_sd;
-    if (value == "fu") return ACCIDENTAL_IMPLICIT_fu;
-    if (value == "fd") return ACCIDENTAL_IMPLICIT_fd;
-    LogWarning("Unsupported value '%s' for data.ACCIDENTAL.IMPLICIT", value.c_str());
+    switch (strlen(value)) {
+        case 1:
+            switch (value[0]) {
+                case 's':
+                    return ACCIDENTAL_IMPLICIT_s;
+                case 'f':
+                    return ACCIDENTAL_IMPLICIT_f;
+                case 'n':
+                    return ACCIDENTAL_IMPLICIT_n;
+            }
+            break;
+        case 2:
+            switch (value[0]) {
+                case 's':
+                    if (!memcmp(value, "ss", 2)) return ACCIDENTAL_IMPLICIT_ss;
+                    if (!memcmp(value, "su", 2)) return ACCIDENTAL_IMPLICIT_su;
+                    if (!memcmp(value, "sd", 2)) return ACCIDENTAL_IMPLICIT_sd;
+                    break;
+                case 'f':
+                    if (!memcmp(value, "ff", 2)) return ACCIDENTAL_IMPLICIT_ff;
+                    if (!memcmp(value, "fu", 2)) return ACCIDENTAL_IMPLICIT_fu;
+                    if (!memcmp(value, "fd", 2)) return ACCIDENTAL_IMPLICIT_fd;
+                    break;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.ACCIDENTAL.IMPLICIT", value);
     return ACCIDENTAL_IMPLICIT_NONE;
 }
 
-std::string AttConverter::ArticulationToStr(data_ARTICULATION data) const
-{
-    std::string value;
-    switch (data) {
-        case ARTICULATION_acc: value = "acc"; break;
-        case ARTICULATION_stacc: value = "stacc"; break;
-        case ARTICULATION_ten: value = "ten"; break;
-        case ARTICULATION_stacciss: value = "stacciss"; break;
-        case ARTICULATION_marc: value = "marc"; break;
-        case ARTICULATION_marc_stacc: value = "marc-stacc"; break;
-        case ARTICULATION_spicc: value = "spicc"; break;
-        case ARTICULATION_doit: value = "doit"; break;
-        case ARTICULATION_scoop: value = "scoop"; break;
-        case ARTICULATION_rip: value = "rip"; break;
-        case ARTICULATION_plop: value = "plop"; break;
-        case ARTICULATION_fall: value = "fall"; break;
-        case ARTICULATION_longfall: value = "longfall"; break;
-        case ARTICULATION_bend: value = "bend"; break;
-        case ARTICULATION_flip: value = "flip"; break;
-        case ARTICULATION_smear: value = "smear"; break;
-        case ARTICULATION_shake: value = "shake"; break;
-        case ARTICULATION_dnbow: value = "dnbow"; break;
-        case ARTICULATION_upbow: value = "upbow"; break;
-        case ARTICULATION_harm: value = "harm"; break;
-        case ARTICULATION_snap: value = "snap"; break;
-        case ARTICULATION_fingernail: value = "fingernail"; break;
-        case ARTICULATION_ten_stacc: value = "ten-stacc"; break;
-        case ARTICULATION_damp: value = "damp"; break;
-        case ARTICULATION_dampall: value = "dampall"; break;
-        case ARTICULATION_open: value = "open"; break;
-        case ARTICULATION_stop: value = "stop"; break;
-        case ARTICULATION_dbltongue: value = "dbltongue"; break;
-        case ARTICULATION_trpltongue: value = "trpltongue"; break;
-        case ARTICULATION_heel: value = "heel"; break;
-        case ARTICULATION_toe: value = "toe"; break;
-        case ARTICULATION_tap: value = "tap"; break;
-        case ARTICULATION_lhpizz: value = "lhpizz"; break;
-        case ARTICULATION_dot: value = "dot"; break;
-        case ARTICULATION_stroke: value = "stroke"; break;
+const std::string &AttConverter::ArticulationToStr(data_ARTICULATION data) const
+{
+    static const std::string values[] = {
+        "", "acc", "stacc", "ten", "stacciss", "marc", "marc-stacc", "spicc", "doit", "scoop", "rip", "plop", "fall",
+        "longfall", "bend", "flip", "smear", "shake", "dnbow", "upbow", "harm", "snap", "fingernail", "ten-stacc",
+        "damp", "dampall", "open", "stop", "dbltongue", "trpltongue", "heel", "toe", "tap", "lhpizz", "dot", "stroke"
+    };
+    switch (data) {
+        case ARTICULATION_acc: return values[1];
+        case ARTICULATION_stacc: return values[2];
+        case ARTICULATION_ten: return values[3];
+        case ARTICULATION_stacciss: return values[4];
+        case ARTICULATION_marc: return values[5];
+        case ARTICULATION_marc_stacc: return values[6];
+        case ARTICULATION_spicc: return values[7];
+        case ARTICULATION_doit: return values[8];
+        case ARTICULATION_scoop: return values[9];
+        case ARTICULATION_rip: return values[10];
+        case ARTICULATION_plop: return values[11];
+        case ARTICULATION_fall: return values[12];
+        case ARTICULATION_longfall: return values[13];
+        case ARTICULATION_bend: return values[14];
+        case ARTICULATION_flip: return values[15];
+        case ARTICULATION_smear: return values[16];
+        case ARTICULATION_shake: return values[17];
+        case ARTICULATION_dnbow: return values[18];
+        case ARTICULATION_upbow: return values[19];
+        case ARTICULATION_harm: return values[20];
+        case ARTICULATION_snap: return values[21];
+        case ARTICULATION_fingernail: return values[22];
+        case ARTICULATION_ten_stacc: return values[23];
+        case ARTICULATION_damp: return values[24];
+        case ARTICULATION_dampall: return values[25];
+        case ARTICULATION_open: return values[26];
+        case ARTICULATION_stop: return values[27];
+        case ARTICULATION_dbltongue: return values[28];
+        case ARTICULATION_trpltongue: return values[29];
+        case ARTICULATION_heel: return values[30];
+        case ARTICULATION_toe: return values[31];
+        case ARTICULATION_tap: return values[32];
+        case ARTICULATION_lhpizz: return values[33];
+        case ARTICULATION_dot: return values[34];
+        case ARTICULATION_stroke: return values[35];
         default:
             LogWarning("Unknown value '%d' for data.ARTICULATION", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_ARTICULATION AttConverter::StrToArticulation(std::string value) const
-{
-    if (value == "acc") return ARTICULATION_acc;
-    if (value == "stacc") return ARTICULATION_stacc;
-    if (value == "ten") return ARTICULATION_ten;
-    if (value == "stacciss") return ARTICULATION_stacciss;
-    if (value == "marc") return ARTICULATION_marc;
-    if (value == "marc-stacc") return ARTICULATION_marc_stacc;
-    if (value == "spicc") return ARTICULATION_spicc;
-    if (value == "doit") return ARTICULATION_doit;
-    if (value == "scoop") return ARTICULATION_scoop;
-    if (value == "rip") return ARTICULATION_rip;
-    if (value == "plop") return ARTICULATION_plop;
-    if (value == "fall") return ARTICULATION_fall;
-    if (value == "longfall") return ARTICULATION_longfall;
-    if (value == "bend") return ARTICULATION_bend;
-    if (value == "flip") return ARTICULATION_flip;
-    if (value == "smear") return ARTICULATION_smear;
-    if (value == "shake") return ARTICULATION_shake;
-    if (value == "dnbow") return ARTICULATION_dnbow;
-    if (value == "upbow") return ARTICULATION_upbow;
-    if (value == "harm") return ARTICULATION_harm;
-    if (value == "snap") return ARTICULATION_snap;
-    if (value == "fingernail") return ARTICULATION_fingernail;
-    if (value == "ten-stacc") return ARTICULATION_ten_stacc;
-    if (value == "damp") return ARTICULATION_damp;
-    if (value == "dampall") return ARTICULATION_dampall;
-    if (value == "open") return ARTICULATION_open;
-    if (value == "stop") return ARTICULATION_stop;
-    if (value == "dbltongue") return ARTICULATION_dbltongue;
-    if (value == "trpltongue") return ARTICULATION_trpltongue;
-    if (value == "heel") return ARTICULATION_heel;
-    if (value == "toe") return ARTICULATION_toe;
-    if (value == "tap") return ARTICULATION_tap;
-    if (value == "lhpizz") return ARTICULATION_lhpizz;
-    if (value == "dot") return ARTICULATION_dot;
-    if (value == "stroke") return ARTICULATION_stroke;
-    LogWarning("Unsupported value '%s' for data.ARTICULATION", value.c_str());
+            return values[0];
+    }
+}
+
+data_ARTICULATION AttConverter::StrToArticulation(const char *value) const
+{
+    switch (strlen(value)) {
+        case 3:
+            switch (value[0]) {
+                case 'a':
+                    if (!memcmp(value, "acc", 3)) return ARTICULATION_acc;
+                    break;
+                case 't':
+                    if (!memcmp(value, "ten", 3)) return ARTICULATION_ten;
+                    if (!memcmp(value, "toe", 3)) return ARTICULATION_toe;
+                    if (!memcmp(value, "tap", 3)) return ARTICULATION_tap;
+                    break;
+                case 'r':
+                    if (!memcmp(value, "rip", 3)) return ARTICULATION_rip;
+                    break;
+                case 'd':
+                    if (!memcmp(value, "dot", 3)) return ARTICULATION_dot;
+                    break;
+            }
+            break;
+        case 4:
+            switch (value[0]) {
+                case 'm':
+                    if (!memcmp(value, "marc", 4)) return ARTICULATION_marc;
+                    break;
+                case 'd':
+                    if (!memcmp(value, "doit", 4)) return ARTICULATION_doit;
+                    if (!memcmp(value, "damp", 4)) return ARTICULATION_damp;
+                    break;
+                case 'p':
+                    if (!memcmp(value, "plop", 4)) return ARTICULATION_plop;
+                    break;
+                case 'f':
+                    if (!memcmp(value, "fall", 4)) return ARTICULATION_fall;
+                    if (!memcmp(value, "flip", 4)) return ARTICULATION_flip;
+                    break;
+                case 'b':
+                    if (!memcmp(value, "bend", 4)) return ARTICULATION_bend;
+                    break;
+                case 'h':
+                    if (!memcmp(value, "harm", 4)) return ARTICULATION_harm;
+                    if (!memcmp(value, "heel", 4)) return ARTICULATION_heel;
+                    break;
+                case 's':
+                    if (!memcmp(value, "snap", 4)) return ARTICULATION_snap;
+                    if (!memcmp(value, "stop", 4)) return ARTICULATION_stop;
+                    break;
+                case 'o':
+                    if (!memcmp(value, "open", 4)) return ARTICULATION_open;
+                    break;
+            }
+            break;
+        case 5:
+            switch (value[0]) {
+                case 's':
+                    if (!memcmp(value, "stacc", 5)) return ARTICULATION_stacc;
+                    if (!memcmp(value, "spicc", 5)) return ARTICULATION_spicc;
+                    if (!memcmp(value, "scoop", 5)) return ARTICULATION_scoop;
+                    if (!memcmp(value, "smear", 5)) return ARTICULATION_smear;
+                    if (!memcmp(value, "shake", 5)) return ARTICULATION_shake;
+                    break;
+                case 'd':
+                    if (!memcmp(value, "dnbow", 5)) return ARTICULATION_dnbow;
+                    break;
+                case 'u':
+                    if (!memcmp(value, "upbow", 5)) return ARTICULATION_upbow;
+                    break;
+            }
+            break;
+        case 6:
+            switch (value[0]) {
+                case 'l':
+                    if (!memcmp(value, "lhpizz", 6)) return ARTICULATION_lhpizz;
+                    break;
+                case 's':
+                    if (!memcmp(value, "stroke", 6)) return ARTICULATION_stroke;
+                    break;
+            }
+            break;
+        case 7:
+            if (!memcmp(value, "dampall", 7)) return ARTICULATION_dampall;
+            break;
+        case 8:
+            switch (value[0]) {
+                case 's':
+                    if (!memcmp(value, "stacciss", 8)) return ARTICULATION_stacciss;
+                    break;
+                case 'l':
+                    if (!memcmp(value, "longfall", 8)) return ARTICULATION_longfall;
+                    break;
+            }
+            break;
+        case 9:
+            switch (value[0]) {
+                case 't':
+                    if (!memcmp(value, "ten-stacc", 9)) return ARTICULATION_ten_stacc;
+                    break;
+                case 'd':
+                    if (!memcmp(value, "dbltongue", 9)) return ARTICULATION_dbltongue;
+                    break;
+            }
+            break;
+        case 10:
+            switch (value[0]) {
+                case 'm':
+                    if (!memcmp(value, "marc-stacc", 10)) return ARTICULATION_marc_stacc;
+                    break;
+                case 'f':
+                    if (!memcmp(value, "fingernail", 10)) return ARTICULATION_fingernail;
+                    break;
+                case 't':
+                    if (!memcmp(value, "trpltongue", 10)) return ARTICULATION_trpltongue;
+                    break;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.ARTICULATION", value);
     return ARTICULATION_NONE;
 }
 
-std::string AttConverter::BarplaceToStr(data_BARPLACE data) const
+const std::string &AttConverter::BarplaceToStr(data_BARPLACE data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "mensur", "staff", "takt" };
     switch (data) {
-        case BARPLACE_mensur: value = "mensur"; break;
-        case BARPLACE_staff: value = "staff"; break;
-        case BARPLACE_takt: value = "takt"; break;
+        case BARPLACE_mensur: return values[1];
+        case BARPLACE_staff: return values[2];
+        case BARPLACE_takt: return values[3];
         default:
             LogWarning("Unknown value '%d' for data.BARPLACE", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_BARPLACE AttConverter::StrToBarplace(std::string value) const
+data_BARPLACE AttConverter::StrToBarplace(const char *value) const
 {
-    if (value == "mensur") return BARPLACE_mensur;
-    if (value == "staff") return BARPLACE_staff;
-    if (value == "takt") return BARPLACE_takt;
-    LogWarning("Unsupported value '%s' for data.BARPLACE", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            if (!memcmp(value, "takt", 4)) return BARPLACE_takt;
+            break;
+        case 5:
+            if (!memcmp(value, "staff", 5)) return BARPLACE_staff;
+            break;
+        case 6:
+            if (!memcmp(value, "mensur", 6)) return BARPLACE_mensur;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.BARPLACE", value);
     return BARPLACE_NONE;
 }
 
-std::string AttConverter::BarrenditionToStr(data_BARRENDITION data) const
+const std::string &AttConverter::BarrenditionToStr(data_BARRENDITION data) const
 {
-    std::string value;
+    static const std::string values[] = {
+        "", "dashed", "dotted", "dbl", "dbldashed", "dbldotted", "end", "invis", "rptstart", "rptboth", "rptend",
+        "single"
+    };
     switch (data) {
-        case BARRENDITION_dashed: value = "dashed"; break;
-        case BARRENDITION_dotted: value = "dotted"; break;
-        case BARRENDITION_dbl: value = "dbl"; break;
-        case BARRENDITION_dbldashed: value = "dbldashed"; break;
-        case BARRENDITION_dbldotted: value = "dbldotted"; break;
-        case BARRENDITION_end: value = "end"; break;
-        case BARRENDITION_invis: value = "invis"; break;
-        case BARRENDITION_rptstart: value = "rptstart"; break;
-        case BARRENDITION_rptboth: value = "rptboth"; break;
-        case BARRENDITION_rptend: value = "rptend"; break;
-        case BARRENDITION_single: value = "single"; break;
+        case BARRENDITION_dashed: return values[1];
+        case BARRENDITION_dotted: return values[2];
+        case BARRENDITION_dbl: return values[3];
+        case BARRENDITION_dbldashed: return values[4];
+        case BARRENDITION_dbldotted: return values[5];
+        case BARRENDITION_end: return values[6];
+        case BARRENDITION_invis: return values[7];
+        case BARRENDITION_rptstart: return values[8];
+        case BARRENDITION_rptboth: return values[9];
+        case BARRENDITION_rptend: return values[10];
+        case BARRENDITION_single: return values[11];
         default:
             LogWarning("Unknown value '%d' for data.BARRENDITION", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_BARRENDITION AttConverter::StrToBarrendition(std::string value) const
+data_BARRENDITION AttConverter::StrToBarrendition(const char *value) const
 {
-    if (value == "dashed") return BARRENDITION_dashed;
-    if (value == "dotted") return BARRENDITION_dotted;
-    if (value == "dbl") return BARRENDITION_dbl;
-    if (value == "dbldashed") return BARRENDITION_dbldashed;
-    if (value == "dbldotted") return BARRENDITION_dbldotted;
-    if (value == "end") return BARRENDITION_end;
-    if (value == "invis") return BARRENDITION_invis;
-    if (value == "rptstart") return BARRENDITION_rptstart;
-    if (value == "rptboth") return BARRENDITION_rptboth;
-    if (value == "rptend") return BARRENDITION_rptend;
-    if (value == "single") return BARRENDITION_single;
-    LogWarning("Unsupported value '%s' for data.BARRENDITION", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            switch (value[0]) {
+                case 'd':
+                    if (!memcmp(value, "dbl", 3)) return BARRENDITION_dbl;
+                    break;
+                case 'e':
+                    if (!memcmp(value, "end", 3)) return BARRENDITION_end;
+                    break;
+            }
+            break;
+        case 5:
+            if (!memcmp(value, "invis", 5)) return BARRENDITION_invis;
+            break;
+        case 6:
+            switch (value[0]) {
+                case 'd':
+                    if (!memcmp(value, "dashed", 6)) return BARRENDITION_dashed;
+                    if (!memcmp(value, "dotted", 6)) return BARRENDITION_dotted;
+                    break;
+                case 'r':
+                    if (!memcmp(value, "rptend", 6)) return BARRENDITION_rptend;
+                    break;
+                case 's':
+                    if (!memcmp(value, "single", 6)) return BARRENDITION_single;
+                    break;
+            }
+            break;
+        case 7:
+            if (!memcmp(value, "rptboth", 7)) return BARRENDITION_rptboth;
+            break;
+        case 8:
+            if (!memcmp(value, "rptstart", 8)) return BARRENDITION_rptstart;
+            break;
+        case 9:
+            if (!memcmp(value, "dbldashed", 9)) return BARRENDITION_dbldashed;
+            if (!memcmp(value, "dbldotted", 9)) return BARRENDITION_dbldotted;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.BARRENDITION", value);
     return BARRENDITION_NONE;
 }
 
-std::string AttConverter::BetypeToStr(data_BETYPE data) const
+const std::string &AttConverter::BetypeToStr(data_BETYPE data) const
 {
-    std::string value;
+    static const std::string values[] = {
+        "", "byte", "smil", "midi", "mmc", "mtc", "smpte-25", "smpte-24", "smpte-df30", "smpte-ndf30", "smpte-df29.97",
+        "smpte-ndf29.97", "tcf", "time"
+    };
     switch (data) {
-        case BETYPE_byte: value = "byte"; break;
-        case BETYPE_smil: value = "smil"; break;
-        case BETYPE_midi: value = "midi"; break;
-        case BETYPE_mmc: value = "mmc"; break;
-        case BETYPE_mtc: value = "mtc"; break;
-        case BETYPE_smpte_25: value = "smpte-25"; break;
-        case BETYPE_smpte_24: value = "smpte-24"; break;
-        case BETYPE_smpte_df30: value = "smpte-df30"; break;
-        case BETYPE_smpte_ndf30: value = "smpte-ndf30"; break;
-        case BETYPE_smpte_df29_97: value = "smpte-df29.97"; break;
-        case BETYPE_smpte_ndf29_97: value = "smpte-ndf29.97"; break;
-        case BETYPE_tcf: value = "tcf"; break;
-        case BETYPE_time: value = "time"; break;
+        case BETYPE_byte: return values[1];
+        case BETYPE_smil: return values[2];
+        case BETYPE_midi: return values[3];
+        case BETYPE_mmc: return values[4];
+        case BETYPE_mtc: return values[5];
+        case BETYPE_smpte_25: return values[6];
+        case BETYPE_smpte_24: return values[7];
+        case BETYPE_smpte_df30: return values[8];
+        case BETYPE_smpte_ndf30: return values[9];
+        case BETYPE_smpte_df29_97: return values[10];
+        case BETYPE_smpte_ndf29_97: return values[11];
+        case BETYPE_tcf: return values[12];
+        case BETYPE_time: return values[13];
         default:
             LogWarning("Unknown value '%d' for data.BETYPE", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_BETYPE AttConverter::StrToBetype(std::string value) const
+data_BETYPE AttConverter::StrToBetype(const char *value) const
 {
-    if (value == "byte") return BETYPE_byte;
-    if (value == "smil") return BETYPE_smil;
-    if (value == "midi") return BETYPE_midi;
-    if (value == "mmc") return BETYPE_mmc;
-    if (value == "mtc") return BETYPE_mtc;
-    if (value == "smpte-25") return BETYPE_smpte_25;
-    if (value == "smpte-24") return BETYPE_smpte_24;
-    if (value == "smpte-df30") return BETYPE_smpte_df30;
-    if (value == "smpte-ndf30") return BETYPE_smpte_ndf30;
-    if (value == "smpte-df29.97") return BETYPE_smpte_df29_97;
-    if (value == "smpte-ndf29.97") return BETYPE_smpte_ndf29_97;
-    if (value == "tcf") return BETYPE_tcf;
-    if (value == "time") return BETYPE_time;
-    LogWarning("Unsupported value '%s' for data.BETYPE", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            switch (value[0]) {
+                case 'm':
+                    if (!memcmp(value, "mmc", 3)) return BETYPE_mmc;
+                    if (!memcmp(value, "mtc", 3)) return BETYPE_mtc;
+                    break;
+                case 't':
+                    if (!memcmp(value, "tcf", 3)) return BETYPE_tcf;
+                    break;
+            }
+            break;
+        case 4:
+            switch (value[0]) {
+                case 'b':
+                    if (!memcmp(value, "byte", 4)) return BETYPE_byte;
+                    break;
+                case 's':
+                    if (!memcmp(value, "smil", 4)) return BETYPE_smil;
+                    break;
+                case 'm':
+                    if (!memcmp(value, "midi", 4)) return BETYPE_midi;
+                    break;
+                case 't':
+                    if (!memcmp(value, "time", 4)) return BETYPE_time;
+                    break;
+            }
+            break;
+        case 8:
+            if (!memcmp(value, "smpte-25", 8)) return BETYPE_smpte_25;
+            if (!memcmp(value, "smpte-24", 8)) return BETYPE_smpte_24;
+            break;
+        case 10:
+            if (!memcmp(value, "smpte-df30", 10)) return BETYPE_smpte_df30;
+            break;
+        case 11:
+            if (!memcmp(value, "smpte-ndf30", 11)) return BETYPE_smpte_ndf30;
+            break;
+        case 13:
+            if (!memcmp(value, "smpte-df29.97", 13)) return BETYPE_smpte_df29_97;
+            break;
+        case 14:
+            if (!memcmp(value, "smpte-ndf29.97", 14)) return BETYPE_smpte_ndf29_97;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.BETYPE", value);
     return BETYPE_NONE;
 }
 
-std::string AttConverter::BooleanToStr(data_BOOLEAN data) const
+const std::string &AttConverter::BooleanToStr(data_BOOLEAN data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "true", "false" };
     switch (data) {
-        case BOOLEAN_true: value = "true"; break;
-        case BOOLEAN_false: value = "false"; break;
+        case BOOLEAN_true: return values[1];
+        case BOOLEAN_false: return values[2];
         default:
             LogWarning("Unknown value '%d' for data.BOOLEAN", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_BOOLEAN AttConverter::StrToBoolean(std::string value) const
+data_BOOLEAN AttConverter::StrToBoolean(const char *value) const
 {
-    if (value == "true") return BOOLEAN_true;
-    if (value == "false") return BOOLEAN_false;
-    LogWarning("Unsupported value '%s' for data.BOOLEAN", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            if (!memcmp(value, "true", 4)) return BOOLEAN_true;
+            break;
+        case 5:
+            if (!memcmp(value, "false", 5)) return BOOLEAN_false;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.BOOLEAN", value);
     return BOOLEAN_NONE;
 }
 
-std::string AttConverter::CertaintyToStr(data_CERTAINTY data) const
+const std::string &AttConverter::CertaintyToStr(data_CERTAINTY data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "high", "medium", "low", "unknown" };
     switch (data) {
-        case CERTAINTY_high: value = "high"; break;
-        case CERTAINTY_medium: value = "medium"; break;
-        case CERTAINTY_low: value = "low"; break;
-        case CERTAINTY_unknown: value = "unknown"; break;
+        case CERTAINTY_high: return values[1];
+        case CERTAINTY_medium: return values[2];
+        case CERTAINTY_low: return values[3];
+        case CERTAINTY_unknown: return values[4];
         default:
             LogWarning("Unknown value '%d' for data.CERTAINTY", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_CERTAINTY AttConverter::StrToCertainty(std::string value) const
+data_CERTAINTY AttConverter::StrToCertainty(const char *value) const
 {
-    if (value == "high") return CERTAINTY_high;
-    if (value == "medium") return CERTAINTY_medium;
-    if (value == "low") return CERTAINTY_low;
-    if (value == "unknown") return CERTAINTY_unknown;
-    LogWarning("Unsupported value '%s' for data.CERTAINTY", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            if (!memcmp(value, "low", 3)) return CERTAINTY_low;
+            break;
+        case 4:
+            if (!memcmp(value, "high", 4)) return CERTAINTY_high;
+            break;
+        case 6:
+            if (!memcmp(value, "medium", 6)) return CERTAINTY_medium;
+            break;
+        case 7:
+            if (!memcmp(value, "unknown", 7)) return CERTAINTY_unknown;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.CERTAINTY", value);
     return CERTAINTY_NONE;
 }
 
-std::string AttConverter::ClefshapeToStr(data_CLEFSHAPE data) const
+const std::string &AttConverter::ClefshapeToStr(data_CLEFSHAPE data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "G", "GG", "F", "C", "perc", "TAB" };
     switch (data) {
-        case CLEFSHAPE_G: value = "G"; break;
-        case CLEFSHAPE_GG: value = "GG"; break;
-        case CLEFSHAPE_F: value = "F"; break;
-        case CLEFSHAPE_C: value = "C"; break;
-        case CLEFSHAPE_perc: value = "perc"; break;
-        case CLEFSHAPE_TAB: value = "TAB"; break;
+        case CLEFSHAPE_G: return values[1];
+        case CLEFSHAPE_GG: return values[2];
+        case CLEFSHAPE_F: return values[3];
+        case CLEFSHAPE_C: return values[4];
+        case CLEFSHAPE_perc: return values[5];
+        case CLEFSHAPE_TAB: return values[6];
         default:
             LogWarning("Unknown value '%d' for data.CLEFSHAPE", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_CLEFSHAPE AttConverter::StrToClefshape(std::string value) const
+data_CLEFSHAPE AttConverter::StrToClefshape(const char *value) const
 {
-    if (value == "G") return CLEFSHAPE_G;
-    if (value == "GG") return CLEFSHAPE_GG;
-    if (value == "F") return CLEFSHAPE_F;
-    if (value == "C") return CLEFSHAPE_C;
-    if (value == "perc") return CLEFSHAPE_perc;
-    if (value == "TAB") return CLEFSHAPE_TAB;
-    LogWarning("Unsupported value '%s' for data.CLEFSHAPE", value.c_str());
+    switch (strlen(value)) {
+        case 1:
+            switch (value[0]) {
+                case 'G':
+                    return CLEFSHAPE_G;
+                case 'F':
+                    return CLEFSHAPE_F;
+                case 'C':
+                    return CLEFSHAPE_C;
+            }
+            break;
+        case 2:
+            if (!memcmp(value, "GG", 2)) return CLEFSHAPE_GG;
+            break;
+        case 3:
+            if (!memcmp(value, "TAB", 3)) return CLEFSHAPE_TAB;
+            break;
+        case 4:
+            if (!memcmp(value, "perc", 4)) return CLEFSHAPE_perc;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.CLEFSHAPE", value);
     return CLEFSHAPE_NONE;
 }
 
-std::string AttConverter::ClusterToStr(data_CLUSTER data) const
+const std::string &AttConverter::ClusterToStr(data_CLUSTER data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "white", "black", "chromatic" };
     switch (data) {
-        case CLUSTER_white: value = "white"; break;
-        case CLUSTER_black: value = "black"; break;
-        case CLUSTER_chromatic: value = "chromatic"; break;
+        case CLUSTER_white: return values[1];
+        case CLUSTER_black: return values[2];
+        case CLUSTER_chromatic: return values[3];
         default:
             LogWarning("Unknown value '%d' for data.CLUSTER", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_CLUSTER AttConverter::StrToCluster(std::string value) const
+data_CLUSTER AttConverter::StrToCluster(const char *value) const
 {
-    if (value == "white") return CLUSTER_white;
-    if (value == "black") return CLUSTER_black;
-    if (value == "chromatic") return CLUSTER_chromatic;
-    LogWarning("Unsupported value '%s' for data.CLUSTER", value.c_str());
+    switch (strlen(value)) {
+        case 5:
+            switch (value[0]) {
+                case 'w':
+                    if (!memcmp(value, "white", 5)) return CLUSTER_white;
+                    break;
+                case 'b':
+                    if (!memcmp(value, "black", 5)) return CLUSTER_black;
+                    break;
+            }
+            break;
+        case 9:
+            if (!memcmp(value, "chromatic", 9)) return CLUSTER_chromatic;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.CLUSTER", value);
     return CLUSTER_NONE;
 }
 
-std::string AttConverter::ColornamesToStr(data_COLORNAMES data) const
+const std::string &AttConverter::ColornamesToStr(data_COLORNAMES data) const
 {
-    std::string value;
+    static const std::string values[] = {
+        "", "aqua", "black", "blue", "fuchsia", "gray", "green", "lime", "maroon", "navy", "olive", "purple", "red",
+        "silver", "teal", "white", "yellow"
+    };
     switch (data) {
-        case COLORNAMES_aqua: value = "aqua"; break;
-        case COLORNAMES_black: value = "black"; break;
-        case COLORNAMES_blue: value = "blue"; break;
-        case COLORNAMES_fuchsia: value = "fuchsia"; break;
-        case COLORNAMES_gray: value = "gray"; break;
-        case COLORNAMES_green: value = "green"; break;
-        case COLORNAMES_lime: value = "lime"; break;
-        case COLORNAMES_maroon: value = "maroon"; break;
-        case COLORNAMES_navy: value = "navy"; break;
-        case COLORNAMES_olive: value = "olive"; break;
-        case COLORNAMES_purple: value = "purple"; break;
-        case COLORNAMES_red: value = "red"; break;
-        case COLORNAMES_silver: value = "silver"; break;
-        case COLORNAMES_teal: value = "teal"; break;
-        case COLORNAMES_white: value = "white"; break;
-        case COLORNAMES_yellow: value = "yellow"; break;
+        case COLORNAMES_aqua: return values[1];
+        case COLORNAMES_black: return values[2];
+        case COLORNAMES_blue: return values[3];
+        case COLORNAMES_fuchsia: return values[4];
+        case COLORNAMES_gray: return values[5];
+        case COLORNAMES_green: return values[6];
+        case COLORNAMES_lime: return values[7];
+        case COLORNAMES_maroon: return values[8];
+        case COLORNAMES_navy: return values[9];
+        case COLORNAMES_olive: return values[10];
+        case COLORNAMES_purple: return values[11];
+        case COLORNAMES_red: return values[12];
+        case COLORNAMES_silver: return values[13];
+        case COLORNAMES_teal: return values[14];
+        case COLORNAMES_white: return values[15];
+        case COLORNAMES_yellow: return values[16];
         default:
             LogWarning("Unknown value '%d' for data.COLORNAMES", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_COLORNAMES AttConverter::StrToColornames(std::string value) const
-{
-    if (value == "aqua") return COLORNAMES_aqua;
-    if (value == "black") return COLORNAMES_black;
-    if (value == "blue") return COLORNAMES_blue;
-    if (value == "fuchsia") return COLORNAMES_fuchsia;
-    if (value == "gray") return COLORNAMES_gray;
-    if (value == "green") return COLORNAMES_green;
-    if (value == "lime") return COLORNAMES_lime;
-    if (value == "maroon") return COLORNAMES_maroon;
-    if (value == "navy") return COLORNAMES_navy;
-    if (value == "olive") return COLORNAMES_olive;
-    if (value == "purple") return COLORNAMES_purple;
-    if (value == "red") return COLORNAMES_red;
-    if (value == "silver") return COLORNAMES_silver;
-    if (value == "teal") return COLORNAMES_teal;
-    if (value == "white") return COLORNAMES_white;
-    if (value == "yellow") return COLORNAMES_yellow;
-    LogWarning("Unsupported value '%s' for data.COLORNAMES", value.c_str());
+            return values[0];
+    }
+}
+
+data_COLORNAMES AttConverter::StrToColornames(const char *value) const
+{
+    switch (strlen(value)) {
+        case 3:
+            if (!memcmp(value, "red", 3)) return COLORNAMES_red;
+            break;
+        case 4:
+            switch (value[0]) {
+                case 'a':
+                    if (!memcmp(value, "aqua", 4)) return COLORNAMES_aqua;
+                    break;
+                case 'b':
+                    if (!memcmp(value, "blue", 4)) return COLORNAMES_blue;
+                    break;
+                case 'g':
+                    if (!memcmp(value, "gray", 4)) return COLORNAMES_gray;
+                    break;
+                case 'l':
+                    if (!memcmp(value, "lime", 4)) return COLORNAMES_lime;
+                    break;
+                case 'n':
+                    if (!memcmp(value, "navy", 4)) return COLORNAMES_navy;
+                    break;
+                case 't':
+                    if (!memcmp(value, "teal", 4)) return COLORNAMES_teal;
+                    break;
+            }
+            break;
+        case 5:
+            switch (value[0]) {
+                case 'b':
+                    if (!memcmp(value, "black", 5)) return COLORNAMES_black;
+                    break;
+                case 'g':
+                    if (!memcmp(value, "green", 5)) return COLORNAMES_green;
+                    break;
+                case 'o':
+                    if (!memcmp(value, "olive", 5)) return COLORNAMES_olive;
+                    break;
+                case 'w':
+                    if (!memcmp(value, "white", 5)) return COLORNAMES_white;
+                    break;
+            }
+            break;
+        case 6:
+            switch (value[0]) {
+                case 'm':
+                    if (!memcmp(value, "maroon", 6)) return COLORNAMES_maroon;
+                    break;
+                case 'p':
+                    if (!memcmp(value, "purple", 6)) return COLORNAMES_purple;
+                    break;
+                case 's':
+                    if (!memcmp(value, "silver", 6)) return COLORNAMES_silver;
+                    break;
+                case 'y':
+                    if (!memcmp(value, "yellow", 6)) return COLORNAMES_yellow;
+                    break;
+            }
+            break;
+        case 7:
+            if (!memcmp(value, "fuchsia", 7)) return COLORNAMES_fuchsia;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.COLORNAMES", value);
     return COLORNAMES_NONE;
 }
 
-std::string AttConverter::EnclosureToStr(data_ENCLOSURE data) const
+const std::string &AttConverter::EnclosureToStr(data_ENCLOSURE data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "paren", "brack" };
     switch (data) {
-        case ENCLOSURE_paren: value = "paren"; break;
-        case ENCLOSURE_brack: value = "brack"; break;
+        case ENCLOSURE_paren: return values[1];
+        case ENCLOSURE_brack: return values[2];
         default:
             LogWarning("Unknown value '%d' for data.ENCLOSURE", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_ENCLOSURE AttConverter::StrToEnclosure(std::string value) const
+data_ENCLOSURE AttConverter::StrToEnclosure(const char *value) const
 {
-    if (value == "paren") return ENCLOSURE_paren;
-    if (value == "brack") return ENCLOSURE_brack;
-    LogWarning("Unsupported value '%s' for data.ENCLOSURE", value.c_str());
+    switch (strlen(value)) {
+        case 5:
+            switch (value[0]) {
+                case 'p':
+                    if (!memcmp(value, "paren", 5)) return ENCLOSURE_paren;
+                    break;
+                case 'b':
+                    if (!memcmp(value, "brack", 5)) return ENCLOSURE_brack;
+                    break;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.ENCLOSURE", value);
     return ENCLOSURE_NONE;
 }
 
-std::string AttConverter::FillToStr(data_FILL data) const
+const std::string &AttConverter::FillToStr(data_FILL data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "void", "solid", "top", "bottom", "left", "right" };
     switch (data) {
-        case FILL_void: value = "void"; break;
-        case FILL_solid: value = "solid"; break;
-        case FILL_top: value = "top"; break;
-        case FILL_bottom: value = "bottom"; break;
-        case FILL_left: value = "left"; break;
-        case FILL_right: value = "right"; break;
+        case FILL_void: return values[1];
+        case FILL_solid: return values[2];
+        case FILL_top: return values[3];
+        case FILL_bottom: return values[4];
+        case FILL_left: return values[5];
+        case FILL_right: return values[6];
         default:
             LogWarning("Unknown value '%d' for data.FILL", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_FILL AttConverter::StrToFill(std::string value) const
+data_FILL AttConverter::StrToFill(const char *value) const
 {
-    if (value == "void") return FILL_void;
-    if (value == "solid") return FILL_solid;
-    if (value == "top") return FILL_top;
-    if (value == "bottom") return FILL_bottom;
-    if (value == "left") return FILL_left;
-    if (value == "right") return FILL_right;
-    LogWarning("Unsupported value '%s' for data.FILL", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            if (!memcmp(value, "top", 3)) return FILL_top;
+            break;
+        case 4:
+            switch (value[0]) {
+                case 'v':
+                    if (!memcmp(value, "void", 4)) return FILL_void;
+                    break;
+                case 'l':
+                    if (!memcmp(value, "left", 4)) return FILL_left;
+                    break;
+            }
+            break;
+        case 5:
+            switch (value[0]) {
+                case 's':
+                    if (!memcmp(value, "solid", 5)) return FILL_solid;
+                    break;
+                case 'r':
+                    if (!memcmp(value, "right", 5)) return FILL_right;
+                    break;
+            }
+            break;
+        case 6:
+            if (!memcmp(value, "bottom", 6)) return FILL_bottom;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.FILL", value);
     return FILL_NONE;
 }
 
-std::string AttConverter::FontsizetermToStr(data_FONTSIZETERM data) const
+const std::string &AttConverter::FontsizetermToStr(data_FONTSIZETERM data) const
 {
-    std::string value;
+    static const std::string values[] = {
+        "", "xx-small", "x-small", "small", "medium", "large", "x-large", "xx-large", "smaller", "larger"
+    };
     switch (data) {
-        case FONTSIZETERM_xx_small: value = "xx-small"; break;
-        case FONTSIZETERM_x_small: value = "x-small"; break;
-        case FONTSIZETERM_small: value = "small"; break;
-        case FONTSIZETERM_medium: value = "medium"; break;
-        case FONTSIZETERM_large: value = "large"; break;
-        case FONTSIZETERM_x_large: value = "x-large"; break;
-        case FONTSIZETERM_xx_large: value = "xx-large"; break;
-        case FONTSIZETERM_smaller: value = "smaller"; break;
-        case FONTSIZETERM_larger: value = "larger"; break;
+        case FONTSIZETERM_xx_small: return values[1];
+        case FONTSIZETERM_x_small: return values[2];
+        case FONTSIZETERM_small: return values[3];
+        case FONTSIZETERM_medium: return values[4];
+        case FONTSIZETERM_large: return values[5];
+        case FONTSIZETERM_x_large: return values[6];
+        case FONTSIZETERM_xx_large: return values[7];
+        case FONTSIZETERM_smaller: return values[8];
+        case FONTSIZETERM_larger: return values[9];
         default:
             LogWarning("Unknown value '%d' for data.FONTSIZETERM", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_FONTSIZETERM AttConverter::StrToFontsizeterm(std::string value) const
+data_FONTSIZETERM AttConverter::StrToFontsizeterm(const char *value) const
 {
-    if (value == "xx-small") return FONTSIZETERM_xx_small;
-    if (value == "x-small") return FONTSIZETERM_x_small;
-    if (value == "small") return FONTSIZETERM_small;
-    if (value == "medium") return FONTSIZETERM_medium;
-    if (value == "large") return FONTSIZETERM_large;
-    if (value == "x-large") return FONTSIZETERM_x_large;
-    if (value == "xx-large") return FONTSIZETERM_xx_large;
-    if (value == "smaller") return FONTSIZETERM_smaller;
-    if (value == "larger") return FONTSIZETERM_larger;
-    LogWarning("Unsupported value '%s' for data.FONTSIZETERM", value.c_str());
+    switch (strlen(value)) {
+        case 5:
+            switch (value[0]) {
+                case 's':
+                    if (!memcmp(value, "small", 5)) return FONTSIZETERM_small;
+                    break;
+                case 'l':
+                    if (!memcmp(value, "large", 5)) return FONTSIZETERM_large;
+                    break;
+            }
+            break;
+        case 6:
+            switch (value[0]) {
+                case 'm':
+                    if (!memcmp(value, "medium", 6)) return FONTSIZETERM_medium;
+                    break;
+                case 'l':
+                    if (!memcmp(value, "larger", 6)) return FONTSIZETERM_larger;
+                    break;
+            }
+            break;
+        case 7:
+            switch (value[0]) {
+                case 'x':
+                    if (!memcmp(value, "x-small", 7)) return FONTSIZETERM_x_small;
+                    if (!memcmp(value, "x-large", 7)) return FONTSIZETERM_x_large;
+                    break;
+                case 's':
+                    if (!memcmp(value, "smaller", 7)) return FONTSIZETERM_smaller;
+                    break;
+            }
+            break;
+        case 8:
+            if (!memcmp(value, "xx-small", 8)) return FONTSIZETERM_xx_small;
+            if (!memcmp(value, "xx-large", 8)) return FONTSIZETERM_xx_large;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.FONTSIZETERM", value);
     return FONTSIZETERM_NONE;
 }
 
-std::string AttConverter::FontstyleToStr(data_FONTSTYLE data) const
+const std::string &AttConverter::FontstyleToStr(data_FONTSTYLE data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "italic", "normal", "oblique" };
     switch (data) {
-        case FONTSTYLE_italic: value = "italic"; break;
-        case FONTSTYLE_normal: value = "normal"; break;
-        case FONTSTYLE_oblique: value = "oblique"; break;
+        case FONTSTYLE_italic: return values[1];
+        case FONTSTYLE_normal: return values[2];
+        case FONTSTYLE_oblique: return values[3];
         default:
             LogWarning("Unknown value '%d' for data.FONTSTYLE", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_FONTSTYLE AttConverter::StrToFontstyle(std::string value) const
+data_FONTSTYLE AttConverter::StrToFontstyle(const char *value) const
 {
-    if (value == "italic") return FONTSTYLE_italic;
-    if (value == "normal") return FONTSTYLE_normal;
-    if (value == "oblique") return FONTSTYLE_oblique;
-    LogWarning("Unsupported value '%s' for data.FONTSTYLE", value.c_str());
+    switch (strlen(value)) {
+        case 6:
+            switch (value[0]) {
+                case 'i':
+                    if (!memcmp(value, "italic", 6)) return FONTSTYLE_italic;
+                    break;
+                case 'n':
+                    if (!memcmp(value, "normal", 6)) return FONTSTYLE_normal;
+                    break;
+            }
+            break;
+        case 7:
+            if (!memcmp(value, "oblique", 7)) return FONTSTYLE_oblique;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.FONTSTYLE", value);
     return FONTSTYLE_NONE;
 }
 
-std::string AttConverter::FontweightToStr(data_FONTWEIGHT data) const
+const std::string &AttConverter::FontweightToStr(data_FONTWEIGHT data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "bold", "normal" };
     switch (data) {
-        case FONTWEIGHT_bold: value = "bold"; break;
-        case FONTWEIGHT_normal: value = "normal"; break;
+        case FONTWEIGHT_bold: return values[1];
+        case FONTWEIGHT_normal: return values[2];
         default:
             LogWarning("Unknown value '%d' for data.FONTWEIGHT", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_FONTWEIGHT AttConverter::StrToFontweight(std::string value) const
+data_FONTWEIGHT AttConverter::StrToFontweight(const char *value) const
 {
-    if (value == "bold") return FONTWEIGHT_bold;
-    if (value == "normal") return FONTWEIGHT_normal;
-    LogWarning("Unsupported value '%s' for data.FONTWEIGHT", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            if (!memcmp(value, "bold", 4)) return FONTWEIGHT_bold;
+            break;
+        case 6:
+            if (!memcmp(value, "normal", 6)) return FONTWEIGHT_normal;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.FONTWEIGHT", value);
     return FONTWEIGHT_NONE;
 }
 
-std::string AttConverter::GlissandoToStr(data_GLISSANDO data) const
+const std::string &AttConverter::GlissandoToStr(data_GLISSANDO data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "i", "m", "t" };
     switch (data) {
-        case GLISSANDO_i: value = "i"; break;
-        case GLISSANDO_m: value = "m"; break;
-        case GLISSANDO_t: value = "t"; break;
+        case GLISSANDO_i: return values[1];
+        case GLISSANDO_m: return values[2];
+        case GLISSANDO_t: return values[3];
         default:
             LogWarning("Unknown value '%d' for data.GLISSANDO", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_GLISSANDO AttConverter::StrToGlissando(std::string value) const
+data_GLISSANDO AttConverter::StrToGlissando(const char *value) const
 {
-    if (value == "i") return GLISSANDO_i;
-    if (value == "m") return GLISSANDO_m;
-    if (value == "t") return GLISSANDO_t;
-    LogWarning("Unsupported value '%s' for data.GLISSANDO", value.c_str());
+    switch (strlen(value)) {
+        case 1:
+            switch (value[0]) {
+                case 'i':
+                    return GLISSANDO_i;
+                case 'm':
+                    return GLISSANDO_m;
+                case 't':
+                    return GLISSANDO_t;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.GLISSANDO", value);
     return GLISSANDO_NONE;
 }
 
-std::string AttConverter::GraceToStr(data_GRACE data) const
+const std::string &AttConverter::GraceToStr(data_GRACE data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "acc", "unacc", "unknown" };
     switch (data) {
-        case GRACE_acc: value = "acc"; break;
-        case GRACE_unacc: value = "unacc"; break;
-        case GRACE_unknown: value = "unknown"; break;
+        case GRACE_acc: return values[1];
+        case GRACE_unacc: return values[2];
+        case GRACE_unknown: return values[3];
         default:
             LogWarning("Unknown value '%d' for data.GRACE", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_GRACE AttConverter::StrToGrace(std::string value) const
+data_GRACE AttConverter::StrToGrace(const char *value) const
 {
-    if (value == "acc") return GRACE_acc;
-    if (value == "unacc") return GRACE_unacc;
-    if (value == "unknown") return GRACE_unknown;
-    LogWarning("Unsupported value '%s' for data.GRACE", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            if (!memcmp(value, "acc", 3)) return GRACE_acc;
+            break;
+        case 5:
+            if (!memcmp(value, "unacc", 5)) return GRACE_unacc;
+            break;
+        case 7:
+            if (!memcmp(value, "unknown", 7)) return GRACE_unknown;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.GRACE", value);
     return GRACE_NONE;
 }
 
-std::string AttConverter::HeadshapeListToStr(data_HEADSHAPE_list data) const
+const std::string &AttConverter::HeadshapeListToStr(data_HEADSHAPE_list data) const
 {
-    std::string value;
+    static const std::string values[] = {
+        "", "quarter", "half", "whole", "backslash", "circle", "+", "diamond", "isotriangle", "oval", "piewedge",
+        "rectangle", "rtriangle", "semicircle", "slash", "square", "x"
+    };
     switch (data) {
-        case HEADSHAPE_list_quarter: value = "quarter"; break;
-        case HEADSHAPE_list_half: value = "half"; break;
-        case HEADSHAPE_list_whole: value = "whole"; break;
-        case HEADSHAPE_list_backslash: value = "backslash"; break;
-        case HEADSHAPE_list_circle: value = "circle"; break;
-        case HEADSHAPE_list_plus: value = "+"; break;
-        case HEADSHAPE_list_diamond: value = "diamond"; break;
-        case HEADSHAPE_list_isotriangle: value = "isotriangle"; break;
-        case HEADSHAPE_list_oval: value = "oval"; break;
-        case HEADSHAPE_list_piewedge: value = "piewedge"; break;
-        case HEADSHAPE_list_rectangle: value = "rectangle"; break;
-        case HEADSHAPE_list_rtriangle: value = "rtriangle"; break;
-        case HEADSHAPE_list_semicircle: value = "semicircle"; break;
-        case HEADSHAPE_list_slash: value = "slash"; break;
-        case HEADSHAPE_list_square: value = "square"; break;
-        case HEADSHAPE_list_x: value = "x"; break;
+        case HEADSHAPE_list_quarter: return values[1];
+        case HEADSHAPE_list_half: return values[2];
+        case HEADSHAPE_list_whole: return values[3];
+        case HEADSHAPE_list_backslash: return values[4];
+        case HEADSHAPE_list_circle: return values[5];
+        case HEADSHAPE_list_plus: return values[6];
+        case HEADSHAPE_list_diamond: return values[7];
+        case HEADSHAPE_list_isotriangle: return values[8];
+        case HEADSHAPE_list_oval: return values[9];
+        case HEADSHAPE_list_piewedge: return values[10];
+        case HEADSHAPE_list_rectangle: return values[11];
+        case HEADSHAPE_list_rtriangle: return values[12];
+        case HEADSHAPE_list_semicircle: return values[13];
+        case HEADSHAPE_list_slash: return values[14];
+        case HEADSHAPE_list_square: return values[15];
+        case HEADSHAPE_list_x: return values[16];
         default:
             LogWarning("Unknown value '%d' for data.HEADSHAPE.list", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_HEADSHAPE_list AttConverter::StrToHeadshapeList(std::string value) const
-{
-    if (value == "quarter") return HEADSHAPE_list_quarter;
-    if (value == "half") return HEADSHAPE_list_half;
-    if (value == "whole") return HEADSHAPE_list_whole;
-    if (value == "backslash") return HEADSHAPE_list_backslash;
-    if (value == "circle") return HEADSHAPE_list_circle;
-    if (value == "+") return HEADSHAPE_list_plus;
-    if (value == "diamond") return HEADSHAPE_list_diamond;
-    if (value == "isotriangle") return HEADSHAPE_list_isotriangle;
-    if (value == "oval") return HEADSHAPE_list_oval;
-    if (value == "piewedge") return HEADSHAPE_list_piewedge;
-    if (value == "rectangle") return HEADSHAPE_list_rectangle;
-    if (value == "rtriangle") return HEADSHAPE_list_rtriangle;
-    if (value == "semicircle") return HEADSHAPE_list_semicircle;
-    if (value == "slash") return HEADSHAPE_list_slash;
-    if (value == "square") return HEADSHAPE_list_square;
-    if (value == "x") return HEADSHAPE_list_x;
-    LogWarning("Unsupported value '%s' for data.HEADSHAPE.list", value.c_str());
+            return values[0];
+    }
+}
+
+data_HEADSHAPE_list AttConverter::StrToHeadshapeList(const char *value) const
+{
+    switch (strlen(value)) {
+        case 1:
+            switch (value[0]) {
+                case '+':
+                    return HEADSHAPE_list_plus;
+                case 'x':
+                    return HEADSHAPE_list_x;
+            }
+            break;
+        case 4:
+            switch (value[0]) {
+                case 'h':
+                    if (!memcmp(value, "half", 4)) return HEADSHAPE_list_half;
+                    break;
+                case 'o':
+                    if (!memcmp(value, "oval", 4)) return HEADSHAPE_list_oval;
+                    break;
+            }
+            break;
+        case 5:
+            switch (value[0]) {
+                case 'w':
+                    if (!memcmp(value, "whole", 5)) return HEADSHAPE_list_whole;
+                    break;
+                case 's':
+                    if (!memcmp(value, "slash", 5)) return HEADSHAPE_list_slash;
+                    break;
+            }
+            break;
+        case 6:
+            switch (value[0]) {
+                case 'c':
+                    if (!memcmp(value, "circle", 6)) return HEADSHAPE_list_circle;
+                    break;
+                case 's':
+                    if (!memcmp(value, "square", 6)) return HEADSHAPE_list_square;
+                    break;
+            }
+            break;
+        case 7:
+            switch (value[0]) {
+                case 'q':
+                    if (!memcmp(value, "quarter", 7)) return HEADSHAPE_list_quarter;
+                    break;
+                case 'd':
+                    if (!memcmp(value, "diamond", 7)) return HEADSHAPE_list_diamond;
+                    break;
+            }
+            break;
+        case 8:
+            if (!memcmp(value, "piewedge", 8)) return HEADSHAPE_list_piewedge;
+            break;
+        case 9:
+            switch (value[0]) {
+                case 'b':
+                    if (!memcmp(value, "backslash", 9)) return HEADSHAPE_list_backslash;
+                    break;
+                case 'r':
+                    if (!memcmp(value, "rectangle", 9)) return HEADSHAPE_list_rectangle;
+                    if (!memcmp(value, "rtriangle", 9)) return HEADSHAPE_list_rtriangle;
+                    break;
+            }
+            break;
+        case 10:
+            if (!memcmp(value, "semicircle", 10)) return HEADSHAPE_list_semicircle;
+            break;
+        case 11:
+            if (!memcmp(value, "isotriangle", 11)) return HEADSHAPE_list_isotriangle;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.HEADSHAPE.list", value);
     return HEADSHAPE_list_NONE;
 }
 
-std::string AttConverter::HorizontalalignmentToStr(data_HORIZONTALALIGNMENT data) const
+const std::string &AttConverter::HorizontalalignmentToStr(data_HORIZONTALALIGNMENT data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "left", "right", "center", "justify" };
     switch (data) {
-        case HORIZONTALALIGNMENT_left: value = "left"; break;
-        case HORIZONTALALIGNMENT_right: value = "right"; break;
-        case HORIZONTALALIGNMENT_center: value = "center"; break;
-        case HORIZONTALALIGNMENT_justify: value = "justify"; break;
+        case HORIZONTALALIGNMENT_left: return values[1];
+        case HORIZONTALALIGNMENT_right: return values[2];
+        case HORIZONTALALIGNMENT_center: return values[3];
+        case HORIZONTALALIGNMENT_justify: return values[4];
         default:
             LogWarning("Unknown value '%d' for data.HORIZONTALALIGNMENT", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_HORIZONTALALIGNMENT AttConverter::StrToHorizontalalignment(std::string value) const
+data_HORIZONTALALIGNMENT AttConverter::StrToHorizontalalignment(const char *value) const
 {
-    if (value == "left") return HORIZONTALALIGNMENT_left;
-    if (value == "right") return HORIZONTALALIGNMENT_right;
-    if (value == "center") return HORIZONTALALIGNMENT_center;
-    if (value == "justify") return HORIZONTALALIGNMENT_justify;
-    LogWarning("Unsupported value '%s' for data.HORIZONTALALIGNMENT", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            if (!memcmp(value, "left", 4)) return HORIZONTALALIGNMENT_left;
+            break;
+        case 5:
+            if (!memcmp(value, "right", 5)) return HORIZONTALALIGNMENT_right;
+            break;
+        case 6:
+            if (!memcmp(value, "center", 6)) return HORIZONTALALIGNMENT_center;
+            break;
+        case 7:
+            if (!memcmp(value, "justify", 7)) return HORIZONTALALIGNMENT_justify;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.HORIZONTALALIGNMENT", value);
     return HORIZONTALALIGNMENT_NONE;
 }
 
-std::string AttConverter::IneumeformToStr(data_INEUMEFORM data) const
+const std::string &AttConverter::IneumeformToStr(data_INEUMEFORM data) const
 {
-    std::string value;
+    static const std::string values[] = {
+        "", "liquescent1", "liquescent2", "tied", "tiedliquescent1", "tiedliquescent2"
+    };
     switch (data) {
-        case INEUMEFORM_liquescent1: value = "liquescent1"; break;
-        case INEUMEFORM_liquescent2: value = "liquescent2"; break;
-        case INEUMEFORM_tied: value = "tied"; break;
-        case INEUMEFORM_tiedliquescent1: value = "tiedliquescent1"; break;
-        case INEUMEFORM_tiedliquescent2: value = "tiedliquescent2"; break;
+        case INEUMEFORM_liquescent1: return values[1];
+        case INEUMEFORM_liquescent2: return values[2];
+        case INEUMEFORM_tied: return values[3];
+        case INEUMEFORM_tiedliquescent1: return values[4];
+        case INEUMEFORM_tiedliquescent2: return values[5];
         default:
             LogWarning("Unknown value '%d' for data.INEUMEFORM", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_INEUMEFORM AttConverter::StrToIneumeform(std::string value) const
+data_INEUMEFORM AttConverter::StrToIneumeform(const char *value) const
 {
-    if (value == "liquescent1") return INEUMEFORM_liquescent1;
-    if (value == "liquescent2") return INEUMEFORM_liquescent2;
-    if (value == "tied") return INEUMEFORM_tied;
-    if (value == "tiedliquescent1") return INEUMEFORM_tiedliquescent1;
-    if (value == "tiedliquescent2") return INEUMEFORM_tiedliquescent2;
-    LogWarning("Unsupported value '%s' for data.INEUMEFORM", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            if (!memcmp(value, "tied", 4)) return INEUMEFORM_tied;
+            break;
+        case 11:
+            if (!memcmp(value, "liquescent1", 11)) return INEUMEFORM_liquescent1;
+            if (!memcmp(value, "liquescent2", 11)) return INEUMEFORM_liquescent2;
+            break;
+        case 15:
+            if (!memcmp(value, "tiedliquescent1", 15)) return INEUMEFORM_tiedliquescent1;
+            if (!memcmp(value, "tiedliquescent2", 15)) return INEUMEFORM_tiedliquescent2;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.INEUMEFORM", value);
     return INEUMEFORM_NONE;
 }
 
-std::string AttConverter::IneumenameToStr(data_INEUMENAME data) const
+const std::string &AttConverter::IneumenameToStr(data_INEUMENAME data) const
 {
-    std::string value;
+    static const std::string values[] = {
+        "", "pessubpunctis", "climacus", "scandicus", "bistropha", "tristropha", "pressusminor", "pressusmaior"
+    };
     switch (data) {
-        case INEUMENAME_pessubpunctis: value = "pessubpunctis"; break;
-        case INEUMENAME_climacus: value = "climacus"; break;
-        case INEUMENAME_scandicus: value = "scandicus"; break;
-        case INEUMENAME_bistropha: value = "bistropha"; break;
-        case INEUMENAME_tristropha: value = "tristropha"; break;
-        case INEUMENAME_pressusminor: value = "pressusminor"; break;
-        case INEUMENAME_pressusmaior: value = "pressusmaior"; break;
+        case INEUMENAME_pessubpunctis: return values[1];
+        case INEUMENAME_climacus: return values[2];
+        case INEUMENAME_scandicus: return values[3];
+        case INEUMENAME_bistropha: return values[4];
+        case INEUMENAME_tristropha: return values[5];
+        case INEUMENAME_pressusminor: return values[6];
+        case INEUMENAME_pressusmaior: return values[7];
         default:
             LogWarning("Unknown value '%d' for data.INEUMENAME", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_INEUMENAME AttConverter::StrToIneumename(std::string value) const
+data_INEUMENAME AttConverter::StrToIneumename(const char *value) const
 {
-    if (value == "pessubpunctis") return INEUMENAME_pessubpunctis;
-    if (value == "climacus") return INEUMENAME_climacus;
-    if (value == "scandicus") return INEUMENAME_scandicus;
-    if (value == "bistropha") return INEUMENAME_bistropha;
-    if (value == "tristropha") return INEUMENAME_tristropha;
-    if (value == "pressusminor") return INEUMENAME_pressusminor;
-    if (value == "pressusmaior") return INEUMENAME_pressusmaior;
-    LogWarning("Unsupported value '%s' for data.INEUMENAME", value.c_str());
+    switch (strlen(value)) {
+        case 8:
+            if (!memcmp(value, "climacus", 8)) return INEUMENAME_climacus;
+            break;
+        case 9:
+            switch (value[0]) {
+                case 's':
+                    if (!memcmp(value, "scandicus", 9)) return INEUMENAME_scandicus;
+                    break;
+                case 'b':
+                    if (!memcmp(value, "bistropha", 9)) return INEUMENAME_bistropha;
+                    break;
+            }
+            break;
+        case 10:
+            if (!memcmp(value, "tristropha", 10)) return INEUMENAME_tristropha;
+            break;
+        case 12:
+            if (!memcmp(value, "pressusminor", 12)) return INEUMENAME_pressusminor;
+            if (!memcmp(value, "pressusmaior", 12)) return INEUMENAME_pressusmaior;
+            break;
+        case 13:
+            if (!memcmp(value, "pessubpunctis", 13)) return INEUMENAME_pessubpunctis;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.INEUMENAME", value);
     return INEUMENAME_NONE;
 }
 
-std::string AttConverter::LayerschemeToStr(data_LAYERSCHEME data) const
+const std::string &AttConverter::LayerschemeToStr(data_LAYERSCHEME data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "1", "2o", "2f", "3o", "3f" };
     switch (data) {
-        case LAYERSCHEME_1: value = "1"; break;
-        case LAYERSCHEME_2o: value = "2o"; break;
-        case LAYERSCHEME_2f: value = "2f"; break;
-        case LAYERSCHEME_3o: value = "3o"; break;
-        case LAYERSCHEME_3f: value = "3f"; break;
+        case LAYERSCHEME_1: return values[1];
+        case LAYERSCHEME_2o: return values[2];
+        case LAYERSCHEME_2f: return values[3];
+        case LAYERSCHEME_3o: return values[4];
+        case LAYERSCHEME_3f: return values[5];
         default:
             LogWarning("Unknown value '%d' for data.LAYERSCHEME", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_LAYERSCHEME AttConverter::StrToLayerscheme(std::string value) const
+data_LAYERSCHEME AttConverter::StrToLayerscheme(const char *value) const
 {
-    if (value == "1") return LAYERSCHEME_1;
-    if (value == "2o") return LAYERSCHEME_2o;
-    if (value == "2f") return LAYERSCHEME_2f;
-    if (value == "3o") return LAYERSCHEME_3o;
-    if (value == "3f") return LAYERSCHEME_3f;
-    LogWarning("Unsupported value '%s' for data.LAYERSCHEME", value.c_str());
+    switch (strlen(value)) {
+        case 1:
+            if (!memcmp(value, "1", 1)) return LAYERSCHEME_1;
+            break;
+        case 2:
+            switch (value[0]) {
+                case '2':
+                    if (!memcmp(value, "2o", 2)) return LAYERSCHEME_2o;
+                    if (!memcmp(value, "2f", 2)) return LAYERSCHEME_2f;
+                    break;
+                case '3':
+                    if (!memcmp(value, "3o", 2)) return LAYERSCHEME_3o;
+                    if (!memcmp(value, "3f", 2)) return LAYERSCHEME_3f;
+                    break;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.LAYERSCHEME", value);
     return LAYERSCHEME_NONE;
 }
 
-std::string AttConverter::LigatureformToStr(data_LIGATUREFORM data) const
+const std::string &AttConverter::LigatureformToStr(data_LIGATUREFORM data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "recta", "obliqua" };
     switch (data) {
-        case LIGATUREFORM_recta: value = "recta"; break;
-        case LIGATUREFORM_obliqua: value = "obliqua"; break;
+        case LIGATUREFORM_recta: return values[1];
+        case LIGATUREFORM_obliqua: return values[2];
         default:
             LogWarning("Unknown value '%d' for data.LIGATUREFORM", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_LIGATUREFORM AttConverter::StrToLigatureform(std::string value) const
+data_LIGATUREFORM AttConverter::StrToLigatureform(const char *value) const
 {
-    if (value == "recta") return LIGATUREFORM_recta;
-    if (value == "obliqua") return LIGATUREFORM_obliqua;
-    LogWarning("Unsupported value '%s' for data.LIGATUREFORM", value.c_str());
+    switch (strlen(value)) {
+        case 5:
+            if (!memcmp(value, "recta", 5)) return LIGATUREFORM_recta;
+            break;
+        case 7:
+            if (!memcmp(value, "obliqua", 7)) return LIGATUREFORM_obliqua;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.LIGATUREFORM", value);
     return LIGATUREFORM_NONE;
 }
 
-std::string AttConverter::LineformToStr(data_LINEFORM data) const
+const std::string &AttConverter::LineformToStr(data_LINEFORM data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "dashed", "dotted", "solid", "wavy" };
     switch (data) {
-        case LINEFORM_dashed: value = "dashed"; break;
-        case LINEFORM_dotted: value = "dotted"; break;
-        case LINEFORM_solid: value = "solid"; break;
-        case LINEFORM_wavy: value = "wavy"; break;
+        case LINEFORM_dashed: return values[1];
+        case LINEFORM_dotted: return values[2];
+        case LINEFORM_solid: return values[3];
+        case LINEFORM_wavy: return values[4];
         default:
             LogWarning("Unknown value '%d' for data.LINEFORM", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_LINEFORM AttConverter::StrToLineform(std::string value) const
+data_LINEFORM AttConverter::StrToLineform(const char *value) const
 {
-    if (value == "dashed") return LINEFORM_dashed;
-    if (value == "dotted") return LINEFORM_dotted;
-    if (value == "solid") return LINEFORM_solid;
-    if (value == "wavy") return LINEFORM_wavy;
-    LogWarning("Unsupported value '%s' for data.LINEFORM", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            if (!memcmp(value, "wavy", 4)) return LINEFORM_wavy;
+            break;
+        case 5:
+            if (!memcmp(value, "solid", 5)) return LINEFORM_solid;
+            break;
+        case 6:
+            if (!memcmp(value, "dashed", 6)) return LINEFORM_dashed;
+            if (!memcmp(value, "dotted", 6)) return LINEFORM_dotted;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.LINEFORM", value);
     return LINEFORM_NONE;
 }
 
-std::string AttConverter::LinestartendsymbolToStr(data_LINESTARTENDSYMBOL data) const
+const std::string &AttConverter::LinestartendsymbolToStr(data_LINESTARTENDSYMBOL data) const
 {
-    std::string value;
+    static const std::string values[] = {
+        "", "angledown", "angleup", "angleright", "angleleft", "arrow", "arrowopen", "arrowwhite", "harpoonleft",
+        "harpoonright", "none"
+    };
     switch (data) {
-        case LINESTARTENDSYMBOL_angledown: value = "angledown"; break;
-        case LINESTARTENDSYMBOL_angleup: value = "angleup"; break;
-        case LINESTARTENDSYMBOL_angleright: value = "angleright"; break;
-        case LINESTARTENDSYMBOL_angleleft: value = "angleleft"; break;
-        case LINESTARTENDSYMBOL_arrow: value = "arrow"; break;
-        case LINESTARTENDSYMBOL_arrowopen: value = "arrowopen"; break;
-        case LINESTARTENDSYMBOL_arrowwhite: value = "arrowwhite"; break;
-        case LINESTARTENDSYMBOL_harpoonleft: value = "harpoonleft"; break;
-        case LINESTARTENDSYMBOL_harpoonright: value = "harpoonright"; break;
-        case LINESTARTENDSYMBOL_none: value = "none"; break;
+        case LINESTARTENDSYMBOL_angledown: return values[1];
+        case LINESTARTENDSYMBOL_angleup: return values[2];
+        case LINESTARTENDSYMBOL_angleright: return values[3];
+        case LINESTARTENDSYMBOL_angleleft: return values[4];
+        case LINESTARTENDSYMBOL_arrow: return values[5];
+        case LINESTARTENDSYMBOL_arrowopen: return values[6];
+        case LINESTARTENDSYMBOL_arrowwhite: return values[7];
+        case LINESTARTENDSYMBOL_harpoonleft: return values[8];
+        case LINESTARTENDSYMBOL_harpoonright: return values[9];
+        case LINESTARTENDSYMBOL_none: return values[10];
         default:
             LogWarning("Unknown value '%d' for data.LINESTARTENDSYMBOL", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_LINESTARTENDSYMBOL AttConverter::StrToLinestartendsymbol(std::string value) const
+data_LINESTARTENDSYMBOL AttConverter::StrToLinestartendsymbol(const char *value) const
 {
-    if (value == "angledown") return LINESTARTENDSYMBOL_angledown;
-    if (value == "angleup") return LINESTARTENDSYMBOL_angleup;
-    if (value == "angleright") return LINESTARTENDSYMBOL_angleright;
-    if (value == "angleleft") return LINESTARTENDSYMBOL_angleleft;
-    if (value == "arrow") return LINESTARTENDSYMBOL_arrow;
-    if (value == "arrowopen") return LINESTARTENDSYMBOL_arrowopen;
-    if (value == "arrowwhite") return LINESTARTENDSYMBOL_arrowwhite;
-    if (value == "harpoonleft") return LINESTARTENDSYMBOL_harpoonleft;
-    if (value == "harpoonright") return LINESTARTENDSYMBOL_harpoonright;
-    if (value == "none") return LINESTARTENDSYMBOL_none;
-    LogWarning("Unsupported value '%s' for data.LINESTARTENDSYMBOL", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            if (!memcmp(value, "none", 4)) return LINESTARTENDSYMBOL_none;
+            break;
+        case 5:
+            if (!memcmp(value, "arrow", 5)) return LINESTARTENDSYMBOL_arrow;
+            break;
+        case 7:
+            if (!memcmp(value, "angleup", 7)) return LINESTARTENDSYMBOL_angleup;
+            break;
+        case 9:
+            if (!memcmp(value, "angledown", 9)) return LINESTARTENDSYMBOL_angledown;
+            if (!memcmp(value, "angleleft", 9)) return LINESTARTENDSYMBOL_angleleft;
+            if (!memcmp(value, "arrowopen", 9)) return LINESTARTENDSYMBOL_arrowopen;
+            break;
+        case 10:
+            if (!memcmp(value, "angleright", 10)) return LINESTARTENDSYMBOL_angleright;
+            if (!memcmp(value, "arrowwhite", 10)) return LINESTARTENDSYMBOL_arrowwhite;
+            break;
+        case 11:
+            if (!memcmp(value, "harpoonleft", 11)) return LINESTARTENDSYMBOL_harpoonleft;
+            break;
+        case 12:
+            if (!memcmp(value, "harpoonright", 12)) return LINESTARTENDSYMBOL_harpoonright;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.LINESTARTENDSYMBOL", value);
     return LINESTARTENDSYMBOL_NONE;
 }
 
-std::string AttConverter::LinewidthtermToStr(data_LINEWIDTHTERM data) const
+const std::string &AttConverter::LinewidthtermToStr(data_LINEWIDTHTERM data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "narrow", "medium", "wide" };
     switch (data) {
-        case LINEWIDTHTERM_narrow: value = "narrow"; break;
-        case LINEWIDTHTERM_medium: value = "medium"; break;
-        case LINEWIDTHTERM_wide: value = "wide"; break;
+        case LINEWIDTHTERM_narrow: return values[1];
+        case LINEWIDTHTERM_medium: return values[2];
+        case LINEWIDTHTERM_wide: return values[3];
         default:
             LogWarning("Unknown value '%d' for data.LINEWIDTHTERM", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_LINEWIDTHTERM AttConverter::StrToLinewidthterm(std::string value) const
+data_LINEWIDTHTERM AttConverter::StrToLinewidthterm(const char *value) const
 {
-    if (value == "narrow") return LINEWIDTHTERM_narrow;
-    if (value == "medium") return LINEWIDTHTERM_medium;
-    if (value == "wide") return LINEWIDTHTERM_wide;
-    LogWarning("Unsupported value '%s' for data.LINEWIDTHTERM", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            if (!memcmp(value, "wide", 4)) return LINEWIDTHTERM_wide;
+            break;
+        case 6:
+            switch (value[0]) {
+                case 'n':
+                    if (!memcmp(value, "narrow", 6)) return LINEWIDTHTERM_narrow;
+                    break;
+                case 'm':
+                    if (!memcmp(value, "medium", 6)) return LINEWIDTHTERM_medium;
+                    break;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.LINEWIDTHTERM", value);
     return LINEWIDTHTERM_NONE;
 }
 
-std::string AttConverter::MelodicfunctionToStr(data_MELODICFUNCTION data) const
-{
-    std::string value;
-    switch (data) {
-        case MELODICFUNCTION_aln: value = "aln"; break;
-        case MELODICFUNCTION_ant: value = "ant"; break;
-        case MELODICFUNCTION_app: value = "app"; break;
-        case MELODICFUNCTION_apt: value = "apt"; break;
-        case MELODICFUNCTION_arp: value = "arp"; break;
-        case MELODICFUNCTION_arp7: value = "arp7"; break;
-        case MELODICFUNCTION_aun: value = "aun"; break;
-        case MELODICFUNCTION_chg: value = "chg"; break;
-        case MELODICFUNCTION_cln: value = "cln"; break;
-        case MELODICFUNCTION_ct: value = "ct"; break;
-        case MELODICFUNCTION_ct7: value = "ct7"; break;
-        case MELODICFUNCTION_cun: value = "cun"; break;
-        case MELODICFUNCTION_cup: value = "cup"; break;
-        case MELODICFUNCTION_et: value = "et"; break;
-        case MELODICFUNCTION_ln: value = "ln"; break;
-        case MELODICFUNCTION_ped: value = "ped"; break;
-        case MELODICFUNCTION_rep: value = "rep"; break;
-        case MELODICFUNCTION_ret: value = "ret"; break;
-        case MELODICFUNCTION_23ret: value = "23ret"; break;
-        case MELODICFUNCTION_78ret: value = "78ret"; break;
-        case MELODICFUNCTION_sus: value = "sus"; break;
-        case MELODICFUNCTION_43sus: value = "43sus"; break;
-        case MELODICFUNCTION_98sus: value = "98sus"; break;
-        case MELODICFUNCTION_76sus: value = "76sus"; break;
-        case MELODICFUNCTION_un: value = "un"; break;
-        case MELODICFUNCTION_un7: value = "un7"; break;
-        case MELODICFUNCTION_upt: value = "upt"; break;
-        case MELODICFUNCTION_upt7: value = "upt7"; break;
+const std::string &AttConverter::MelodicfunctionToStr(data_MELODICFUNCTION data) const
+{
+    static const std::string values[] = {
+        "", "aln", "ant", "app", "apt", "arp", "arp7", "aun", "chg", "cln", "ct", "ct7", "cun", "cup", "et", "ln",
+        "ped", "rep", "ret", "23ret", "78ret", "sus", "43sus", "98sus", "76sus", "un", "un7", "upt", "upt7"
+    };
+    switch (data) {
+        case MELODICFUNCTION_aln: return values[1];
+        case MELODICFUNCTION_ant: return values[2];
+        case MELODICFUNCTION_app: return values[3];
+        case MELODICFUNCTION_apt: return values[4];
+        case MELODICFUNCTION_arp: return values[5];
+        case MELODICFUNCTION_arp7: return values[6];
+        case MELODICFUNCTION_aun: return values[7];
+        case MELODICFUNCTION_chg: return values[8];
+        case MELODICFUNCTION_cln: return values[9];
+        case MELODICFUNCTION_ct: return values[10];
+        case MELODICFUNCTION_ct7: return values[11];
+        case MELODICFUNCTION_cun: return values[12];
+        case MELODICFUNCTION_cup: return values[13];
+        case MELODICFUNCTION_et: return values[14];
+        case MELODICFUNCTION_ln: return values[15];
+        case MELODICFUNCTION_ped: return values[16];
+        case MELODICFUNCTION_rep: return values[17];
+        case MELODICFUNCTION_ret: return values[18];
+        case MELODICFUNCTION_23ret: return values[19];
+        case MELODICFUNCTION_78ret: return values[20];
+        case MELODICFUNCTION_sus: return values[21];
+        case MELODICFUNCTION_43sus: return values[22];
+        case MELODICFUNCTION_98sus: return values[23];
+        case MELODICFUNCTION_76sus: return values[24];
+        case MELODICFUNCTION_un: return values[25];
+        case MELODICFUNCTION_un7: return values[26];
+        case MELODICFUNCTION_upt: return values[27];
+        case MELODICFUNCTION_upt7: return values[28];
         default:
             LogWarning("Unknown value '%d' for data.MELODICFUNCTION", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_MELODICFUNCTION AttConverter::StrToMelodicfunction(std::string value) const
-{
-    if (value == "aln") return MELODICFUNCTION_aln;
-    if (value == "ant") return MELODICFUNCTION_ant;
-    if (value == "app") return MELODICFUNCTION_app;
-    if (value == "apt") return MELODICFUNCTION_apt;
-    if (value == "arp") return MELODICFUNCTION_arp;
-    if (value == "arp7") return MELODICFUNCTION_arp7;
-    if (value == "aun") return MELODICFUNCTION_aun;
-    if (value == "chg") return MELODICFUNCTION_chg;
-    if (value == "cln") return MELODICFUNCTION_cln;
-    if (value == "ct") return MELODICFUNCTION_ct;
-    if (value == "ct7") return MELODICFUNCTION_ct7;
-    if (value == "cun") return MELODICFUNCTION_cun;
-    if (value == "cup") return MELODICFUNCTION_cup;
-    if (value == "et") return MELODICFUNCTION_et;
-    if (value == "ln") return MELODICFUNCTION_ln;
-    if (value == "ped") return MELODICFUNCTION_ped;
-    if (value == "rep") return MELODICFUNCTION_rep;
-    if (value == "ret") return MELODICFUNCTION_ret;
-    if (value == "23ret") return MELODICFUNCTION_23ret;
-    if (value == "78ret") return MELODICFUNCTION_78ret;
-    if (value == "sus") return MELODICFUNCTION_sus;
-    if (value == "43sus") return MELODICFUNCTION_43sus;
-    if (value == "98sus") return MELODICFUNCTION_98sus;
-    if (value == "76sus") return MELODICFUNCTION_76sus;
-    if (value == "un") return MELODICFUNCTION_un;
-    if (value == "un7") return MELODICFUNCTION_un7;
-    if (value == "upt") return MELODICFUNCTION_upt;
-    if (value == "upt7") return MELODICFUNCTION_upt7;
-    LogWarning("Unsupported value '%s' for data.MELODICFUNCTION", value.c_str());
+            return values[0];
+    }
+}
+
+data_MELODICFUNCTION AttConverter::StrToMelodicfunction(const char *value) const
+{
+    switch (strlen(value)) {
+        case 2:
+            switch (value[0]) {
+                case 'c':
+                    if (!memcmp(value, "ct", 2)) return MELODICFUNCTION_ct;
+                    break;
+                case 'e':
+                    if (!memcmp(value, "et", 2)) return MELODICFUNCTION_et;
+                    break;
+                case 'l':
+                    if (!memcmp(value, "ln", 2)) return MELODICFUNCTION_ln;
+                    break;
+                case 'u':
+                    if (!memcmp(value, "un", 2)) return MELODICFUNCTION_un;
+                    break;
+            }
+            break;
+        case 3:
+            switch (value[0]) {
+                case 'a':
+                    if (!memcmp(value, "aln", 3)) return MELODICFUNCTION_aln;
+                    if (!memcmp(value, "ant", 3)) return MELODICFUNCTION_ant;
+                    if (!memcmp(value, "app", 3)) return MELODICFUNCTION_app;
+                    if (!memcmp(value, "apt", 3)) return MELODICFUNCTION_apt;
+                    if (!memcmp(value, "arp", 3)) return MELODICFUNCTION_arp;
+                    if (!memcmp(value, "aun", 3)) return MELODICFUNCTION_aun;
+                    break;
+                case 'c':
+                    if (!memcmp(value, "chg", 3)) return MELODICFUNCTION_chg;
+                    if (!memcmp(value, "cln", 3)) return MELODICFUNCTION_cln;
+                    if (!memcmp(value, "ct7", 3)) return MELODICFUNCTION_ct7;
+                    if (!memcmp(value, "cun", 3)) return MELODICFUNCTION_cun;
+                    if (!memcmp(value, "cup", 3)) return MELODICFUNCTION_cup;
+                    break;
+                case 'p':
+                    if (!memcmp(value, "ped", 3)) return MELODICFUNCTION_ped;
+                    break;
+                case 'r':
+                    if (!memcmp(value, "rep", 3)) return MELODICFUNCTION_rep;
+                    if (!memcmp(value, "ret", 3)) return MELODICFUNCTION_ret;
+                    break;
+                case 's':
+                    if (!memcmp(value, "sus", 3)) return MELODICFUNCTION_sus;
+                    break;
+                case 'u':
+                    if (!memcmp(value, "un7", 3)) return MELODICFUNCTION_un7;
+                    if (!memcmp(value, "upt", 3)) return MELODICFUNCTION_upt;
+                    break;
+            }
+            break;
+        case 4:
+            switch (value[0]) {
+                case 'a':
+                    if (!memcmp(value, "arp7", 4)) return MELODICFUNCTION_arp7;
+                    break;
+                case 'u':
+                    if (!memcmp(value, "upt7", 4)) return MELODICFUNCTION_upt7;
+                    break;
+            }
+            break;
+        case 5:
+            switch (value[0]) {
+                case '2':
+                    if (!memcmp(value, "23ret", 5)) return MELODICFUNCTION_23ret;
+                    break;
+                case '7':
+                    if (!memcmp(value, "78ret", 5)) return MELODICFUNCTION_78ret;
+                    if (!memcmp(value, "76sus", 5)) return MELODICFUNCTION_76sus;
+                    break;
+                case '4':
+                    if (!memcmp(value, "43sus", 5)) return MELODICFUNCTION_43sus;
+                    break;
+                case '9':
+                    if (!memcmp(value, "98sus", 5)) return MELODICFUNCTION_98sus;
+                    break;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.MELODICFUNCTION", value);
     return MELODICFUNCTION_NONE;
 }
 
-std::string AttConverter::MensurationsignToStr(data_MENSURATIONSIGN data) const
+const std::string &AttConverter::MensurationsignToStr(data_MENSURATIONSIGN data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "C", "O" };
     switch (data) {
-        case MENSURATIONSIGN_C: value = "C"; break;
-        case MENSURATIONSIGN_O: value = "O"; break;
+        case MENSURATIONSIGN_C: return values[1];
+        case MENSURATIONSIGN_O: return values[2];
         default:
             LogWarning("Unknown value '%d' for data.MENSURATIONSIGN", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_MENSURATIONSIGN AttConverter::StrToMensurationsign(std::string value) const
+data_MENSURATIONSIGN AttConverter::StrToMensurationsign(const char *value) const
 {
-    if (value == "C") return MENSURATIONSIGN_C;
-    if (value == "O") return MENSURATIONSIGN_O;
-    LogWarning("Unsupported value '%s' for data.MENSURATIONSIGN", value.c_str());
+    switch (strlen(value)) {
+        case 1:
+            switch (value[0]) {
+                case 'C':
+                    return MENSURATIONSIGN_C;
+                case 'O':
+                    return MENSURATIONSIGN_O;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.MENSURATIONSIGN", value);
     return MENSURATIONSIGN_NONE;
 }
 
-std::string AttConverter::MetersignToStr(data_METERSIGN data) const
+const std::string &AttConverter::MetersignToStr(data_METERSIGN data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "common", "cut" };
     switch (data) {
-        case METERSIGN_common: value = "common"; break;
-        case METERSIGN_cut: value = "cut"; break;
+        case METERSIGN_common: return values[1];
+        case METERSIGN_cut: return values[2];
         default:
             LogWarning("Unknown value '%d' for data.METERSIGN", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_METERSIGN AttConverter::StrToMetersign(std::string value) const
+data_METERSIGN AttConverter::StrToMetersign(const char *value) const
 {
-    if (value == "common") return METERSIGN_common;
-    if (value == "cut") return METERSIGN_cut;
-    LogWarning("Unsupported value '%s' for data.METERSIGN", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            if (!memcmp(value, "cut", 3)) return METERSIGN_cut;
+            break;
+        case 6:
+            if (!memcmp(value, "common", 6)) return METERSIGN_common;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.METERSIGN", value);
     return METERSIGN_NONE;
 }
 
-std::string AttConverter::MidinamesToStr(data_MIDINAMES data) const
-{
-    std::string value;
-    switch (data) {
-        case MIDINAMES_Acoustic_Grand_Piano: value = "Acoustic_Grand_Piano"; break;
-        case MIDINAMES_Bright_Acoustic_Piano: value = "Bright_Acoustic_Piano"; break;
-        case MIDINAMES_Electric_Grand_Piano: value = "Electric_Grand_Piano"; break;
-        case MIDINAMES_Honky_tonk_Piano: value = "Honky-tonk_Piano"; break;
-        case MIDINAMES_Electric_Piano_1: value = "Electric_Piano_1"; break;
-        case MIDINAMES_Electric_Piano_2: value = "Electric_Piano_2"; break;
-        case MIDINAMES_Harpsichord: value = "Harpsichord"; break;
-        case MIDINAMES_Clavi: value = "Clavi"; break;
-        case MIDINAMES_Celesta: value = "Celesta"; break;
-        case MIDINAMES_Glockenspiel: value = "Glockenspiel"; break;
-        case MIDINAMES_Music_Box: value = "Music_Box"; break;
-        case MIDINAMES_Vibraphone: value = "Vibraphone"; break;
-        case MIDINAMES_Marimba: value = "Marimba"; break;
-        case MIDINAMES_Xylophone: value = "Xylophone"; break;
-        case MIDINAMES_Tubular_Bells: value = "Tubular_Bells"; break;
-        case MIDINAMES_Dulcimer: value = "Dulcimer"; break;
-        case MIDINAMES_Drawbar_Organ: value = "Drawbar_Organ"; break;
-        case MIDINAMES_Percussive_Organ: value = "Percussive_Organ"; break;
-        case MIDINAMES_Rock_Organ: value = "Rock_Organ"; break;
-        case MIDINAMES_Church_Organ: value = "Church_Organ"; break;
-        case MIDINAMES_Reed_Organ: value = "Reed_Organ"; break;
-        case MIDINAMES_Accordion: value = "Accordion"; break;
-        case MIDINAMES_Harmonica: value = "Harmonica"; break;
-        case MIDINAMES_Tango_Accordion: value = "Tango_Accordion"; break;
-        case MIDINAMES_Acoustic_Guitar_nylon: value = "Acoustic_Guitar_nylon"; break;
-        case MIDINAMES_Acoustic_Guitar_steel: value = "Acoustic_Guitar_steel"; break;
-        case MIDINAMES_Electric_Guitar_jazz: value = "Electric_Guitar_jazz"; break;
-        case MIDINAMES_Electric_Guitar_clean: value = "Electric_Guitar_clean"; break;
-        case MIDINAMES_Electric_Guitar_muted: value = "Electric_Guitar_muted"; break;
-        case MIDINAMES_Overdriven_Guitar: value = "Overdriven_Guitar"; break;
-        case MIDINAMES_Distortion_Guitar: value = "Distortion_Guitar"; break;
-        case MIDINAMES_Guitar_harmonics: value = "Guitar_harmonics"; break;
-        case MIDINAMES_Acoustic_Bass: value = "Acoustic_Bass"; break;
-        case MIDINAMES_Electric_Bass_finger: value = "Electric_Bass_finger"; break;
-        case MIDINAMES_Electric_Bass_pick: value = "Electric_Bass_pick"; break;
-        case MIDINAMES_Fretless_Bass: value = "Fretless_Bass"; break;
-        case MIDINAMES_Slap_Bass_1: value = "Slap_Bass_1"; break;
-        case MIDINAMES_Slap_Bass_2: value = "Slap_Bass_2"; break;
-        case MIDINAMES_Synth_Bass_1: value = "Synth_Bass_1"; break;
-        case MIDINAMES_Synth_Bass_2: value = "Synth_Bass_2"; break;
-        case MIDINAMES_Violin: value = "Violin"; break;
-        case MIDINAMES_Viola: value = "Viola"; break;
-        case MIDINAMES_Cello: value = "Cello"; break;
-        case MIDINAMES_Contrabass: value = "Contrabass"; break;
-        case MIDINAMES_Tremolo_Strings: value = "Tremolo_Strings"; break;
-        case MIDINAMES_Pizzicato_Strings: value = "Pizzicato_Strings"; break;
-        case MIDINAMES_Orchestral_Harp: value = "Orchestral_Harp"; break;
-        case MIDINAMES_Timpani: value = "Timpani"; break;
-        case MIDINAMES_String_Ensemble_1: value = "String_Ensemble_1"; break;
-        case MIDINAMES_String_Ensemble_2: value = "String_Ensemble_2"; break;
-        case MIDINAMES_SynthStrings_1: value = "SynthStrings_1"; break;
-        case MIDINAMES_SynthStrings_2: value = "SynthStrings_2"; break;
-        case MIDINAMES_Choir_Aahs: value = "Choir_Aahs"; break;
-        case MIDINAMES_Voice_Oohs: value = "Voice_Oohs"; break;
-        case MIDINAMES_Synth_Voice: value = "Synth_Voice"; break;
-        case MIDINAMES_Orchestra_Hit: value = "Orchestra_Hit"; break;
-        case MIDINAMES_Trumpet: value = "Trumpet"; break;
-        case MIDINAMES_Trombone: value = "Trombone"; break;
-        case MIDINAMES_Tuba: value = "Tuba"; break;
-        case MIDINAMES_Muted_Trumpet: value = "Muted_Trumpet"; break;
-        case MIDINAMES_French_Horn: value = "French_Horn"; break;
-        case MIDINAMES_Brass_Section: value = "Brass_Section"; break;
-        case MIDINAMES_SynthBrass_1: value = "SynthBrass_1"; break;
-        case MIDINAMES_SynthBrass_2: value = "SynthBrass_2"; break;
-        case MIDINAMES_Soprano_Sax: value = "Soprano_Sax"; break;
-        case MIDINAMES_Alto_Sax: value = "Alto_Sax"; break;
-        case MIDINAMES_Tenor_Sax: value = "Tenor_Sax"; break;
-        case MIDINAMES_Baritone_Sax: value = "Baritone_Sax"; break;
-        case MIDINAMES_Oboe: value = "Oboe"; break;
-        case MIDINAMES_English_Horn: value = "English_Horn"; break;
-        case MIDINAMES_Bassoon: value = "Bassoon"; break;
-        case MIDINAMES_Clarinet: value = "Clarinet"; break;
-        case MIDINAMES_Piccolo: value = "Piccolo"; break;
-        case MIDINAMES_Flute: value = "Flute"; break;
-        case MIDINAMES_Recorder: value = "Recorder"; break;
-        case MIDINAMES_Pan_Flute: value = "Pan_Flute"; break;
-        case MIDINAMES_Blown_Bottle: value = "Blown_Bottle"; break;
-        case MIDINAMES_Shakuhachi: value = "Shakuhachi"; break;
-        case MIDINAMES_Whistle: value = "Whistle"; break;
-        case MIDINAMES_Ocarina: value = "Ocarina"; break;
-        case MIDINAMES_Lead_1_square: value = "Lead_1_square"; break;
-        case MIDINAMES_Lead_2_sawtooth: value = "Lead_2_sawtooth"; break;
-        case MIDINAMES_Lead_3_calliope: value = "Lead_3_calliope"; break;
-        case MIDINAMES_Lead_4_chiff: value = "Lead_4_chiff"; break;
-        case MIDINAMES_Lead_5_charang: value = "Lead_5_charang"; break;
-        case MIDINAMES_Lead_6_voice: value = "Lead_6_voice"; break;
-        case MIDINAMES_Lead_7_fifths: value = "Lead_7_fifths"; break;
-        case MIDINAMES_Lead_8_bass_and_lead: value = "Lead_8_bass_and_lead"; break;
-        case MIDINAMES_Pad_1_new_age: value = "Pad_1_new_age"; break;
-        case MIDINAMES_Pad_2_warm: value = "Pad_2_warm"; break;
-        case MIDINAMES_Pad_3_polysynth: value = "Pad_3_polysynth"; break;
-        case MIDINAMES_Pad_4_choir: value = "Pad_4_choir"; break;
-        case MIDINAMES_Pad_5_bowed: value = "Pad_5_bowed"; break;
-        case MIDINAMES_Pad_6_metallic: value = "Pad_6_metallic"; break;
-        case MIDINAMES_Pad_7_halo: value = "Pad_7_halo"; break;
-        case MIDINAMES_Pad_8_sweep: value = "Pad_8_sweep"; break;
-        case MIDINAMES_FX_1_rain: value = "FX_1_rain"; break;
-        case MIDINAMES_FX_2_soundtrack: value = "FX_2_soundtrack"; break;
-        case MIDINAMES_FX_3_crystal: value = "FX_3_crystal"; break;
-        case MIDINAMES_FX_4_atmosphere: value = "FX_4_atmosphere"; break;
-        case MIDINAMES_FX_5_brightness: value = "FX_5_brightness"; break;
-        case MIDINAMES_FX_6_goblins: value = "FX_6_goblins"; break;
-        case MIDINAMES_FX_7_echoes: value = "FX_7_echoes"; break;
-        case MIDINAMES_FX_8_sci_fi: value = "FX_8_sci-fi"; break;
-        case MIDINAMES_Sitar: value = "Sitar"; break;
-        case MIDINAMES_Banjo: value = "Banjo"; break;
-        case MIDINAMES_Shamisen: value = "Shamisen"; break;
-        case MIDINAMES_Koto: value = "Koto"; break;
-        case MIDINAMES_Kalimba: value = "Kalimba"; break;
-        case MIDINAMES_Bagpipe: value = "Bagpipe"; break;
-        case MIDINAMES_Fiddle: value = "Fiddle"; break;
-        case MIDINAMES_Shanai: value = "Shanai"; break;
-        case MIDINAMES_Tinkle_Bell: value = "Tinkle_Bell"; break;
-        case MIDINAMES_Agogo: value = "Agogo"; break;
-        case MIDINAMES_Steel_Drums: value = "Steel_Drums"; break;
-        case MIDINAMES_Woodblock: value = "Woodblock"; break;
-        case MIDINAMES_Taiko_Drum: value = "Taiko_Drum"; break;
-        case MIDINAMES_Melodic_Tom: value = "Melodic_Tom"; break;
-        case MIDINAMES_Synth_Drum: value = "Synth_Drum"; break;
-        case MIDINAMES_Reverse_Cymbal: value = "Reverse_Cymbal"; break;
-        case MIDINAMES_Guitar_Fret_Noise: value = "Guitar_Fret_Noise"; break;
-        case MIDINAMES_Breath_Noise: value = "Breath_Noise"; break;
-        case MIDINAMES_Seashore: value = "Seashore"; break;
-        case MIDINAMES_Bird_Tweet: value = "Bird_Tweet"; break;
-        case MIDINAMES_Telephone_Ring: value = "Telephone_Ring"; break;
-        case MIDINAMES_Helicopter: value = "Helicopter"; break;
-        case MIDINAMES_Applause: value = "Applause"; break;
-        case MIDINAMES_Gunshot: value = "Gunshot"; break;
-        case MIDINAMES_Acoustic_Bass_Drum: value = "Acoustic_Bass_Drum"; break;
-        case MIDINAMES_Bass_Drum_1: value = "Bass_Drum_1"; break;
-        case MIDINAMES_Side_Stick: value = "Side_Stick"; break;
-        case MIDINAMES_Acoustic_Snare: value = "Acoustic_Snare"; break;
-        case MIDINAMES_Hand_Clap: value = "Hand_Clap"; break;
-        case MIDINAMES_Electric_Snare: value = "Electric_Snare"; break;
-        case MIDINAMES_Low_Floor_Tom: value = "Low_Floor_Tom"; break;
-        case MIDINAMES_Closed_Hi_Hat: value = "Closed_Hi_Hat"; break;
-        case MIDINAMES_High_Floor_Tom: value = "High_Floor_Tom"; break;
-        case MIDINAMES_Pedal_Hi_Hat: value = "Pedal_Hi-Hat"; break;
-        case MIDINAMES_Low_Tom: value = "Low_Tom"; break;
-        case MIDINAMES_Open_Hi_Hat: value = "Open_Hi-Hat"; break;
-        case MIDINAMES_Low_Mid_Tom: value = "Low-Mid_Tom"; break;
-        case MIDINAMES_Hi_Mid_Tom: value = "Hi-Mid_Tom"; break;
-        case MIDINAMES_Crash_Cymbal_1: value = "Crash_Cymbal_1"; break;
-        case MIDINAMES_High_Tom: value = "High_Tom"; break;
-        case MIDINAMES_Ride_Cymbal_1: value = "Ride_Cymbal_1"; break;
-        case MIDINAMES_Chinese_Cymbal: value = "Chinese_Cymbal"; break;
-        case MIDINAMES_Ride_Bell: value = "Ride_Bell"; break;
-        case MIDINAMES_Tambourine: value = "Tambourine"; break;
-        case MIDINAMES_Splash_Cymbal: value = "Splash_Cymbal"; break;
-        case MIDINAMES_Cowbell: value = "Cowbell"; break;
-        case MIDINAMES_Crash_Cymbal_2: value = "Crash_Cymbal_2"; break;
-        case MIDINAMES_Vibraslap: value = "Vibraslap"; break;
-        case MIDINAMES_Ride_Cymbal_2: value = "Ride_Cymbal_2"; break;
-        case MIDINAMES_Hi_Bongo: value = "Hi_Bongo"; break;
-        case MIDINAMES_Low_Bongo: value = "Low_Bongo"; break;
-        case MIDINAMES_Mute_Hi_Conga: value = "Mute_Hi_Conga"; break;
-        case MIDINAMES_Open_Hi_Conga: value = "Open_Hi_Conga"; break;
-        case MIDINAMES_Low_Conga: value = "Low_Conga"; break;
-        case MIDINAMES_High_Timbale: value = "High_Timbale"; break;
-        case MIDINAMES_Low_Timbale: value = "Low_Timbale"; break;
-        case MIDINAMES_High_Agogo: value = "High_Agogo"; break;
-        case MIDINAMES_Low_Agogo: value = "Low_Agogo"; break;
-        case MIDINAMES_Cabasa: value = "Cabasa"; break;
-        case MIDINAMES_Maracas: value = "Maracas"; break;
-        case MIDINAMES_Short_Whistle: value = "Short_Whistle"; break;
-        case MIDINAMES_Long_Whistle: value = "Long_Whistle"; break;
-        case MIDINAMES_Short_Guiro: value = "Short_Guiro"; break;
-        case MIDINAMES_Long_Guiro: value = "Long_Guiro"; break;
-        case MIDINAMES_Claves: value = "Claves"; break;
-        case MIDINAMES_Hi_Wood_Block: value = "Hi_Wood_Block"; break;
-        case MIDINAMES_Low_Wood_Block: value = "Low_Wood_Block"; break;
-        case MIDINAMES_Mute_Cuica: value = "Mute_Cuica"; break;
-        case MIDINAMES_Open_Cuica: value = "Open_Cuica"; break;
-        case MIDINAMES_Mute_Triangle: value = "Mute_Triangle"; break;
-        case MIDINAMES_Open_Triangle: value = "Open_Triangle"; break;
+const std::string &AttConverter::MidinamesToStr(data_MIDINAMES data) const
+{
+    static const std::string values[] = {
+        "", "Acoustic_Grand_Piano", "Bright_Acoustic_Piano", "Electric_Grand_Piano", "Honky-tonk_Piano",
+        "Electric_Piano_1", "Electric_Piano_2", "Harpsichord", "Clavi", "Celesta", "Glockenspiel", "Music_Box",
+        "Vibraphone", "Marimba", "Xylophone", "Tubular_Bells", "Dulcimer", "Drawbar_Organ", "Percussive_Organ",
+        "Rock_Organ", "Church_Organ", "Reed_Organ", "Accordion", "Harmonica", "Tango_Accordion",
+        "Acoustic_Guitar_nylon", "Acoustic_Guitar_steel", "Electric_Guitar_jazz", "Electric_Guitar_clean",
+        "Electric_Guitar_muted", "Overdriven_Guitar", "Distortion_Guitar", "Guitar_harmonics", "Acoustic_Bass",
+        "Electric_Bass_finger", "Electric_Bass_pick", "Fretless_Bass", "Slap_Bass_1", "Slap_Bass_2", "Synth_Bass_1",
+        "Synth_Bass_2", "Violin", "Viola", "Cello", "Contrabass", "Tremolo_Strings", "Pizzicato_Strings",
+        "Orchestral_Harp", "Timpani", "String_Ensemble_1", "String_Ensemble_2", "SynthStrings_1", "SynthStrings_2",
+        "Choir_Aahs", "Voice_Oohs", "Synth_Voice", "Orchestra_Hit", "Trumpet", "Trombone", "Tuba", "Muted_Trumpet",
+        "French_Horn", "Brass_Section", "SynthBrass_1", "SynthBrass_2", "Soprano_Sax", "Alto_Sax", "Tenor_Sax",
+        "Baritone_Sax", "Oboe", "English_Horn", "Bassoon", "Clarinet", "Piccolo", "Flute", "Recorder", "Pan_Flute",
+        "Blown_Bottle", "Shakuhachi", "Whistle", "Ocarina", "Lead_1_square", "Lead_2_sawtooth", "Lead_3_calliope",
+        "Lead_4_chiff", "Lead_5_charang", "Lead_6_voice", "Lead_7_fifths", "Lead_8_bass_and_lead", "Pad_1_new_age",
+        "Pad_2_warm", "Pad_3_polysynth", "Pad_4_choir", "Pad_5_bowed", "Pad_6_metallic", "Pad_7_halo", "Pad_8_sweep",
+        "FX_1_rain", "FX_2_soundtrack", "FX_3_crystal", "FX_4_atmosphere", "FX_5_brightness", "FX_6_goblins",
+        "FX_7_echoes", "FX_8_sci-fi", "Sitar", "Banjo", "Shamisen", "Koto", "Kalimba", "Bagpipe", "Fiddle", "Shanai",
+        "Tinkle_Bell", "Agogo", "Steel_Drums", "Woodblock", "Taiko_Drum", "Melodic_Tom", "Synth_Drum", "Reverse_Cymbal",
+        "Guitar_Fret_Noise", "Breath_Noise", "Seashore", "Bird_Tweet", "Telephone_Ring", "Helicopter", "Applause",
+        "Gunshot", "Acoustic_Bass_Drum", "Bass_Drum_1", "Side_Stick", "Acoustic_Snare", "Hand_Clap", "Electric_Snare",
+        "Low_Floor_Tom", "Closed_Hi_Hat", "High_Floor_Tom", "Pedal_Hi-Hat", "Low_Tom", "Open_Hi-Hat", "Low-Mid_Tom",
+        "Hi-Mid_Tom", "Crash_Cymbal_1", "High_Tom", "Ride_Cymbal_1", "Chinese_Cymbal", "Ride_Bell", "Tambourine",
+        "Splash_Cymbal", "Cowbell", "Crash_Cymbal_2", "Vibraslap", "Ride_Cymbal_2", "Hi_Bongo", "Low_Bongo",
+        "Mute_Hi_Conga", "Open_Hi_Conga", "Low_Conga", "High_Timbale", "Low_Timbale", "High_Agogo", "Low_Agogo",
+        "Cabasa", "Maracas", "Short_Whistle", "Long_Whistle", "Short_Guiro", "Long_Guiro", "Claves", "Hi_Wood_Block",
+        "Low_Wood_Block", "Mute_Cuica", "Open_Cuica", "Mute_Triangle", "Open_Triangle"
+    };
+    switch (data) {
+        case MIDINAMES_Acoustic_Grand_Piano: return values[1];
+        case MIDINAMES_Bright_Acoustic_Piano: return values[2];
+        case MIDINAMES_Electric_Grand_Piano: return values[3];
+        case MIDINAMES_Honky_tonk_Piano: return values[4];
+        case MIDINAMES_Electric_Piano_1: return values[5];
+        case MIDINAMES_Electric_Piano_2: return values[6];
+        case MIDINAMES_Harpsichord: return values[7];
+        case MIDINAMES_Clavi: return values[8];
+        case MIDINAMES_Celesta: return values[9];
+        case MIDINAMES_Glockenspiel: return values[10];
+        case MIDINAMES_Music_Box: return values[11];
+        case MIDINAMES_Vibraphone: return values[12];
+        case MIDINAMES_Marimba: return values[13];
+        case MIDINAMES_Xylophone: return values[14];
+        case MIDINAMES_Tubular_Bells: return values[15];
+        case MIDINAMES_Dulcimer: return values[16];
+        case MIDINAMES_Drawbar_Organ: return values[17];
+        case MIDINAMES_Percussive_Organ: return values[18];
+        case MIDINAMES_Rock_Organ: return values[19];
+        case MIDINAMES_Church_Organ: return values[20];
+        case MIDINAMES_Reed_Organ: return values[21];
+        case MIDINAMES_Accordion: return values[22];
+        case MIDINAMES_Harmonica: return values[23];
+        case MIDINAMES_Tango_Accordion: return values[24];
+        case MIDINAMES_Acoustic_Guitar_nylon: return values[25];
+        case MIDINAMES_Acoustic_Guitar_steel: return values[26];
+        case MIDINAMES_Electric_Guitar_jazz: return values[27];
+        case MIDINAMES_Electric_Guitar_clean: return values[28];
+        case MIDINAMES_Electric_Guitar_muted: return values[29];
+        case MIDINAMES_Overdriven_Guitar: return values[30];
+        case MIDINAMES_Distortion_Guitar: return values[31];
+        case MIDINAMES_Guitar_harmonics: return values[32];
+        case MIDINAMES_Acoustic_Bass: return values[33];
+        case MIDINAMES_Electric_Bass_finger: return values[34];
+        case MIDINAMES_Electric_Bass_pick: return values[35];
+        case MIDINAMES_Fretless_Bass: return values[36];
+        case MIDINAMES_Slap_Bass_1: return values[37];
+        case MIDINAMES_Slap_Bass_2: return values[38];
+        case MIDINAMES_Synth_Bass_1: return values[39];
+        case MIDINAMES_Synth_Bass_2: return values[40];
+        case MIDINAMES_Violin: return values[41];
+        case MIDINAMES_Viola: return values[42];
+        case MIDINAMES_Cello: return values[43];
+        case MIDINAMES_Contrabass: return values[44];
+        case MIDINAMES_Tremolo_Strings: return values[45];
+        case MIDINAMES_Pizzicato_Strings: return values[46];
+        case MIDINAMES_Orchestral_Harp: return values[47];
+        case MIDINAMES_Timpani: return values[48];
+        case MIDINAMES_String_Ensemble_1: return values[49];
+        case MIDINAMES_String_Ensemble_2: return values[50];
+        case MIDINAMES_SynthStrings_1: return values[51];
+        case MIDINAMES_SynthStrings_2: return values[52];
+        case MIDINAMES_Choir_Aahs: return values[53];
+        case MIDINAMES_Voice_Oohs: return values[54];
+        case MIDINAMES_Synth_Voice: return values[55];
+        case MIDINAMES_Orchestra_Hit: return values[56];
+        case MIDINAMES_Trumpet: return values[57];
+        case MIDINAMES_Trombone: return values[58];
+        case MIDINAMES_Tuba: return values[59];
+        case MIDINAMES_Muted_Trumpet: return values[60];
+        case MIDINAMES_French_Horn: return values[61];
+        case MIDINAMES_Brass_Section: return values[62];
+        case MIDINAMES_SynthBrass_1: return values[63];
+        case MIDINAMES_SynthBrass_2: return values[64];
+        case MIDINAMES_Soprano_Sax: return values[65];
+        case MIDINAMES_Alto_Sax: return values[66];
+        case MIDINAMES_Tenor_Sax: return values[67];
+        case MIDINAMES_Baritone_Sax: return values[68];
+        case MIDINAMES_Oboe: return values[69];
+        case MIDINAMES_English_Horn: return values[70];
+        case MIDINAMES_Bassoon: return values[71];
+        case MIDINAMES_Clarinet: return values[72];
+        case MIDINAMES_Piccolo: return values[73];
+        case MIDINAMES_Flute: return values[74];
+        case MIDINAMES_Recorder: return values[75];
+        case MIDINAMES_Pan_Flute: return values[76];
+        case MIDINAMES_Blown_Bottle: return values[77];
+        case MIDINAMES_Shakuhachi: return values[78];
+        case MIDINAMES_Whistle: return values[79];
+        case MIDINAMES_Ocarina: return values[80];
+        case MIDINAMES_Lead_1_square: return values[81];
+        case MIDINAMES_Lead_2_sawtooth: return values[82];
+        case MIDINAMES_Lead_3_calliope: return values[83];
+        case MIDINAMES_Lead_4_chiff: return values[84];
+        case MIDINAMES_Lead_5_charang: return values[85];
+        case MIDINAMES_Lead_6_voice: return values[86];
+        case MIDINAMES_Lead_7_fifths: return values[87];
+        case MIDINAMES_Lead_8_bass_and_lead: return values[88];
+        case MIDINAMES_Pad_1_new_age: return values[89];
+        case MIDINAMES_Pad_2_warm: return values[90];
+        case MIDINAMES_Pad_3_polysynth: return values[91];
+        case MIDINAMES_Pad_4_choir: return values[92];
+        case MIDINAMES_Pad_5_bowed: return values[93];
+        case MIDINAMES_Pad_6_metallic: return values[94];
+        case MIDINAMES_Pad_7_halo: return values[95];
+        case MIDINAMES_Pad_8_sweep: return values[96];
+        case MIDINAMES_FX_1_rain: return values[97];
+        case MIDINAMES_FX_2_soundtrack: return values[98];
+        case MIDINAMES_FX_3_crystal: return values[99];
+        case MIDINAMES_FX_4_atmosphere: return values[100];
+        case MIDINAMES_FX_5_brightness: return values[101];
+        case MIDINAMES_FX_6_goblins: return values[102];
+        case MIDINAMES_FX_7_echoes: return values[103];
+        case MIDINAMES_FX_8_sci_fi: return values[104];
+        case MIDINAMES_Sitar: return values[105];
+        case MIDINAMES_Banjo: return values[106];
+        case MIDINAMES_Shamisen: return values[107];
+        case MIDINAMES_Koto: return values[108];
+        case MIDINAMES_Kalimba: return values[109];
+        case MIDINAMES_Bagpipe: return values[110];
+        case MIDINAMES_Fiddle: return values[111];
+        case MIDINAMES_Shanai: return values[112];
+        case MIDINAMES_Tinkle_Bell: return values[113];
+        case MIDINAMES_Agogo: return values[114];
+        case MIDINAMES_Steel_Drums: return values[115];
+        case MIDINAMES_Woodblock: return values[116];
+        case MIDINAMES_Taiko_Drum: return values[117];
+        case MIDINAMES_Melodic_Tom: return values[118];
+        case MIDINAMES_Synth_Drum: return values[119];
+        case MIDINAMES_Reverse_Cymbal: return values[120];
+        case MIDINAMES_Guitar_Fret_Noise: return values[121];
+        case MIDINAMES_Breath_Noise: return values[122];
+        case MIDINAMES_Seashore: return values[123];
+        case MIDINAMES_Bird_Tweet: return values[124];
+        case MIDINAMES_Telephone_Ring: return values[125];
+        case MIDINAMES_Helicopter: return values[126];
+        case MIDINAMES_Applause: return values[127];
+        case MIDINAMES_Gunshot: return values[128];
+        case MIDINAMES_Acoustic_Bass_Drum: return values[129];
+        case MIDINAMES_Bass_Drum_1: return values[130];
+        case MIDINAMES_Side_Stick: return values[131];
+        case MIDINAMES_Acoustic_Snare: return values[132];
+        case MIDINAMES_Hand_Clap: return values[133];
+        case MIDINAMES_Electric_Snare: return values[134];
+        case MIDINAMES_Low_Floor_Tom: return values[135];
+        case MIDINAMES_Closed_Hi_Hat: return values[136];
+        case MIDINAMES_High_Floor_Tom: return values[137];
+        case MIDINAMES_Pedal_Hi_Hat: return values[138];
+        case MIDINAMES_Low_Tom: return values[139];
+        case MIDINAMES_Open_Hi_Hat: return values[140];
+        case MIDINAMES_Low_Mid_Tom: return values[141];
+        case MIDINAMES_Hi_Mid_Tom: return values[142];
+        case MIDINAMES_Crash_Cymbal_1: return values[143];
+        case MIDINAMES_High_Tom: return values[144];
+        case MIDINAMES_Ride_Cymbal_1: return values[145];
+        case MIDINAMES_Chinese_Cymbal: return values[146];
+        case MIDINAMES_Ride_Bell: return values[147];
+        case MIDINAMES_Tambourine: return values[148];
+        case MIDINAMES_Splash_Cymbal: return values[149];
+        case MIDINAMES_Cowbell: return values[150];
+        case MIDINAMES_Crash_Cymbal_2: return values[151];
+        case MIDINAMES_Vibraslap: return values[152];
+        case MIDINAMES_Ride_Cymbal_2: return values[153];
+        case MIDINAMES_Hi_Bongo: return values[154];
+        case MIDINAMES_Low_Bongo: return values[155];
+        case MIDINAMES_Mute_Hi_Conga: return values[156];
+        case MIDINAMES_Open_Hi_Conga: return values[157];
+        case MIDINAMES_Low_Conga: return values[158];
+        case MIDINAMES_High_Timbale: return values[159];
+        case MIDINAMES_Low_Timbale: return values[160];
+        case MIDINAMES_High_Agogo: return values[161];
+        case MIDINAMES_Low_Agogo: return values[162];
+        case MIDINAMES_Cabasa: return values[163];
+        case MIDINAMES_Maracas: return values[164];
+        case MIDINAMES_Short_Whistle: return values[165];
+        case MIDINAMES_Long_Whistle: return values[166];
+        case MIDINAMES_Short_Guiro: return values[167];
+        case MIDINAMES_Long_Guiro: return values[168];
+        case MIDINAMES_Claves: return values[169];
+        case MIDINAMES_Hi_Wood_Block: return values[170];
+        case MIDINAMES_Low_Wood_Block: return values[171];
+        case MIDINAMES_Mute_Cuica: return values[172];
+        case MIDINAMES_Open_Cuica: return values[173];
+        case MIDINAMES_Mute_Triangle: return values[174];
+        case MIDINAMES_Open_Triangle: return values[175];
         default:
             LogWarning("Unknown value '%d' for data.MIDINAMES", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_MIDINAMES AttConverter::StrToMidinames(std::string value) const
-{
-    if (value == "Acoustic_Grand_Piano") return MIDINAMES_Acoustic_Grand_Piano;
-    if (value == "Bright_Acoustic_Piano") return MIDINAMES_Bright_Acoustic_Piano;
-    if (value == "Electric_Grand_Piano") return MIDINAMES_Electric_Grand_Piano;
-    if (value == "Honky-tonk_Piano") return MIDINAMES_Honky_tonk_Piano;
-    if (value == "Electric_Piano_1") return MIDINAMES_Electric_Piano_1;
-    if (value == "Electric_Piano_2") return MIDINAMES_Electric_Piano_2;
-    if (value == "Harpsichord") return MIDINAMES_Harpsichord;
-    if (value == "Clavi") return MIDINAMES_Clavi;
-    if (value == "Celesta") return MIDINAMES_Celesta;
-    if (value == "Glockenspiel") return MIDINAMES_Glockenspiel;
-    if (value == "Music_Box") return MIDINAMES_Music_Box;
-    if (value == "Vibraphone") return MIDINAMES_Vibraphone;
-    if (value == "Marimba") return MIDINAMES_Marimba;
-    if (value == "Xylophone") return MIDINAMES_Xylophone;
-    if (value == "Tubular_Bells") return MIDINAMES_Tubular_Bells;
-    if (value == "Dulcimer") return MIDINAMES_Dulcimer;
-    if (value == "Drawbar_Organ") return MIDINAMES_Drawbar_Organ;
-    if (value == "Percussive_Organ") return MIDINAMES_Percussive_Organ;
-    if (value == "Rock_Organ") return MIDINAMES_Rock_Organ;
-    if (value == "Church_Organ") return MIDINAMES_Church_Organ;
-    if (value == "Reed_Organ") return MIDINAMES_Reed_Organ;
-    if (value == "Accordion") return MIDINAMES_Accordion;
-    if (value == "Harmonica") return MIDINAMES_Harmonica;
-    if (value == "Tango_Accordion") return MIDINAMES_Tango_Accordion;
-    if (value == "Acoustic_Guitar_nylon") return MIDINAMES_Acoustic_Guitar_nylon;
-    if (value == "Acoustic_Guitar_steel") return MIDINAMES_Acoustic_Guitar_steel;
-    if (value == "Electric_Guitar_jazz") return MIDINAMES_Electric_Guitar_jazz;
-    if (value == "Electric_Guitar_clean") return MIDINAMES_Electric_Guitar_clean;
-    if (value == "Electric_Guitar_muted") return MIDINAMES_Electric_Guitar_muted;
-    if (value == "Overdriven_Guitar") return MIDINAMES_Overdriven_Guitar;
-    if (value == "Distortion_Guitar") return MIDINAMES_Distortion_Guitar;
-    if (value == "Guitar_harmonics") return MIDINAMES_Guitar_harmonics;
-    if (value == "Acoustic_Bass") return MIDINAMES_Acoustic_Bass;
-    if (value == "Electric_Bass_finger") return MIDINAMES_Electric_Bass_finger;
-    if (value == "Electric_Bass_pick") return MIDINAMES_Electric_Bass_pick;
-    if (value == "Fretless_Bass") return MIDINAMES_Fretless_Bass;
-    if (value == "Slap_Bass_1") return MIDINAMES_Slap_Bass_1;
-    if (value == "Slap_Bass_2") return MIDINAMES_Slap_Bass_2;
-    if (value == "Synth_Bass_1") return MIDINAMES_Synth_Bass_1;
-    if (value == "Synth_Bass_2") return MIDINAMES_Synth_Bass_2;
-    if (value == "Violin") return MIDINAMES_Violin;
-    if (value == "Viola") return MIDINAMES_Viola;
-    if (value == "Cello") return MIDINAMES_Cello;
-    if (value == "Contrabass") return MIDINAMES_Contrabass;
-    if (value == "Tremolo_Strings") return MIDINAMES_Tremolo_Strings;
-    if (value == "Pizzicato_Strings") return MIDINAMES_Pizzicato_Strings;
-    if (value == "Orchestral_Harp") return MIDINAMES_Orchestral_Harp;
-    if (value == "Timpani") return MIDINAMES_Timpani;
-    if (value == "String_Ensemble_1") return MIDINAMES_String_Ensemble_1;
-    if (value == "String_Ensemble_2") return MIDINAMES_String_Ensemble_2;
-    if (value == "SynthStrings_1") return MIDINAMES_SynthStrings_1;
-    if (value == "SynthStrings_2") return MIDINAMES_SynthStrings_2;
-    if (value == "Choir_Aahs") return MIDINAMES_Choir_Aahs;
-    if (value == "Voice_Oohs") return MIDINAMES_Voice_Oohs;
-    if (value == "Synth_Voice") return MIDINAMES_Synth_Voice;
-    if (value == "Orchestra_Hit") return MIDINAMES_Orchestra_Hit;
-    if (value == "Trumpet") return MIDINAMES_Trumpet;
-    if (value == "Trombone") return MIDINAMES_Trombone;
-    if (value == "Tuba") return MIDINAMES_Tuba;
-    if (value == "Muted_Trumpet") return MIDINAMES_Muted_Trumpet;
-    if (value == "French_Horn") return MIDINAMES_French_Horn;
-    if (value == "Brass_Section") return MIDINAMES_Brass_Section;
-    if (value == "SynthBrass_1") return MIDINAMES_SynthBrass_1;
-    if (value == "SynthBrass_2") return MIDINAMES_SynthBrass_2;
-    if (value == "Soprano_Sax") return MIDINAMES_Soprano_Sax;
-    if (value == "Alto_Sax") return MIDINAMES_Alto_Sax;
-    if (value == "Tenor_Sax") return MIDINAMES_Tenor_Sax;
-    if (value == "Baritone_Sax") return MIDINAMES_Baritone_Sax;
-    if (value == "Oboe") return MIDINAMES_Oboe;
-    if (value == "English_Horn") return MIDINAMES_English_Horn;
-    if (value == "Bassoon") return MIDINAMES_Bassoon;
-    if (value == "Clarinet") return MIDINAMES_Clarinet;
-    if (value == "Piccolo") return MIDINAMES_Piccolo;
-    if (value == "Flute") return MIDINAMES_Flute;
-    if (value == "Recorder") return MIDINAMES_Recorder;
-    if (value == "Pan_Flute") return MIDINAMES_Pan_Flute;
-    if (value == "Blown_Bottle") return MIDINAMES_Blown_Bottle;
-    if (value == "Shakuhachi") return MIDINAMES_Shakuhachi;
-    if (value == "Whistle") return MIDINAMES_Whistle;
-    if (value == "Ocarina") return MIDINAMES_Ocarina;
-    if (value == "Lead_1_square") return MIDINAMES_Lead_1_square;
-    if (value == "Lead_2_sawtooth") return MIDINAMES_Lead_2_sawtooth;
-    if (value == "Lead_3_calliope") return MIDINAMES_Lead_3_calliope;
-    if (value == "Lead_4_chiff") return MIDINAMES_Lead_4_chiff;
-    if (value == "Lead_5_charang") return MIDINAMES_Lead_5_charang;
-    if (value == "Lead_6_voice") return MIDINAMES_Lead_6_voice;
-    if (value == "Lead_7_fifths") return MIDINAMES_Lead_7_fifths;
-    if (value == "Lead_8_bass_and_lead") return MIDINAMES_Lead_8_bass_and_lead;
-    if (value == "Pad_1_new_age") return MIDINAMES_Pad_1_new_age;
-    if (value == "Pad_2_warm") return MIDINAMES_Pad_2_warm;
-    if (value == "Pad_3_polysynth") return MIDINAMES_Pad_3_polysynth;
-    if (value == "Pad_4_choir") return MIDINAMES_Pad_4_choir;
-    if (value == "Pad_5_bowed") return MIDINAMES_Pad_5_bowed;
-    if (value == "Pad_6_metallic") return MIDINAMES_Pad_6_metallic;
-    if (value == "Pad_7_halo") return MIDINAMES_Pad_7_halo;
-    if (value == "Pad_8_sweep") return MIDINAMES_Pad_8_sweep;
-    if (value == "FX_1_rain") return MIDINAMES_FX_1_rain;
-    if (value == "FX_2_soundtrack") return MIDINAMES_FX_2_soundtrack;
-    if (value == "FX_3_crystal") return MIDINAMES_FX_3_crystal;
-    if (value == "FX_4_atmosphere") return MIDINAMES_FX_4_atmosphere;
-    if (value == "FX_5_brightness") return MIDINAMES_FX_5_brightness;
-    if (value == "FX_6_goblins") return MIDINAMES_FX_6_goblins;
-    if (value == "FX_7_echoes") return MIDINAMES_FX_7_echoes;
-    if (value == "FX_8_sci-fi") return MIDINAMES_FX_8_sci_fi;
-    if (value == "Sitar") return MIDINAMES_Sitar;
-    if (value == "Banjo") return MIDINAMES_Banjo;
-    if (value == "Shamisen") return MIDINAMES_Shamisen;
-    if (value == "Koto") return MIDINAMES_Koto;
-    if (value == "Kalimba") return MIDINAMES_Kalimba;
-    if (value == "Bagpipe") return MIDINAMES_Bagpipe;
-    if (value == "Fiddle") return MIDINAMES_Fiddle;
-    if (value == "Shanai") return MIDINAMES_Shanai;
-    if (value == "Tinkle_Bell") return MIDINAMES_Tinkle_Bell;
-    if (value == "Agogo") return MIDINAMES_Agogo;
-    if (value == "Steel_Drums") return MIDINAMES_Steel_Drums;
-    if (value == "Woodblock") return MIDINAMES_Woodblock;
-    if (value == "Taiko_Drum") return MIDINAMES_Taiko_Drum;
-    if (value == "Melodic_Tom") return MIDINAMES_Melodic_Tom;
-    if (value == "Synth_Drum") return MIDINAMES_Synth_Drum;
-    if (value == "Reverse_Cymbal") return MIDINAMES_Reverse_Cymbal;
-    if (value == "Guitar_Fret_Noise") return MIDINAMES_Guitar_Fret_Noise;
-    if (value == "Breath_Noise") return MIDINAMES_Breath_Noise;
-    if (value == "Seashore") return MIDINAMES_Seashore;
-    if (value == "Bird_Tweet") return MIDINAMES_Bird_Tweet;
-    if (value == "Telephone_Ring") return MIDINAMES_Telephone_Ring;
-    if (value == "Helicopter") return MIDINAMES_Helicopter;
-    if (value == "Applause") return MIDINAMES_Applause;
-    if (value == "Gunshot") return MIDINAMES_Gunshot;
-    if (value == "Acoustic_Bass_Drum") return MIDINAMES_Acoustic_Bass_Drum;
-    if (value == "Bass_Drum_1") return MIDINAMES_Bass_Drum_1;
-    if (value == "Side_Stick") return MIDINAMES_Side_Stick;
-    if (value == "Acoustic_Snare") return MIDINAMES_Acoustic_Snare;
-    if (value == "Hand_Clap") return MIDINAMES_Hand_Clap;
-    if (value == "Electric_Snare") return MIDINAMES_Electric_Snare;
-    if (value == "Low_Floor_Tom") return MIDINAMES_Low_Floor_Tom;
-    if (value == "Closed_Hi_Hat") return MIDINAMES_Closed_Hi_Hat;
-    if (value == "High_Floor_Tom") return MIDINAMES_High_Floor_Tom;
-    if (value == "Pedal_Hi-Hat") return MIDINAMES_Pedal_Hi_Hat;
-    if (value == "Low_Tom") return MIDINAMES_Low_Tom;
-    if (value == "Open_Hi-Hat") return MIDINAMES_Open_Hi_Hat;
-    if (value == "Low-Mid_Tom") return MIDINAMES_Low_Mid_Tom;
-    if (value == "Hi-Mid_Tom") return MIDINAMES_Hi_Mid_Tom;
-    if (value == "Crash_Cymbal_1") return MIDINAMES_Crash_Cymbal_1;
-    if (value == "High_Tom") return MIDINAMES_High_Tom;
-    if (value == "Ride_Cymbal_1") return MIDINAMES_Ride_Cymbal_1;
-    if (value == "Chinese_Cymbal") return MIDINAMES_Chinese_Cymbal;
-    if (value == "Ride_Bell") return MIDINAMES_Ride_Bell;
-    if (value == "Tambourine") return MIDINAMES_Tambourine;
-    if (value == "Splash_Cymbal") return MIDINAMES_Splash_Cymbal;
-    if (value == "Cowbell") return MIDINAMES_Cowbell;
-    if (value == "Crash_Cymbal_2") return MIDINAMES_Crash_Cymbal_2;
-    if (value == "Vibraslap") return MIDINAMES_Vibraslap;
-    if (value == "Ride_Cymbal_2") return MIDINAMES_Ride_Cymbal_2;
-    if (value == "Hi_Bongo") return MIDINAMES_Hi_Bongo;
-    if (value == "Low_Bongo") return MIDINAMES_Low_Bongo;
-    if (value == "Mute_Hi_Conga") return MIDINAMES_Mute_Hi_Conga;
-    if (value == "Open_Hi_Conga") return MIDINAMES_Open_Hi_Conga;
-    if (value == "Low_Conga") return MIDINAMES_Low_Conga;
-    if (value == "High_Timbale") return MIDINAMES_High_Timbale;
-    if (value == "Low_Timbale") return MIDINAMES_Low_Timbale;
-    if (value == "High_Agogo") return MIDINAMES_High_Agogo;
-    if (value == "Low_Agogo") return MIDINAMES_Low_Agogo;
-    if (value == "Cabasa") return MIDINAMES_Cabasa;
-    if (value == "Maracas") return MIDINAMES_Maracas;
-    if (value == "Short_Whistle") return MIDINAMES_Short_Whistle;
-    if (value == "Long_Whistle") return MIDINAMES_Long_Whistle;
-    if (value == "Short_Guiro") return MIDINAMES_Short_Guiro;
-    if (value == "Long_Guiro") return MIDINAMES_Long_Guiro;
-    if (value == "Claves") return MIDINAMES_Claves;
-    if (value == "Hi_Wood_Block") return MIDINAMES_Hi_Wood_Block;
-    if (value == "Low_Wood_Block") return MIDINAMES_Low_Wood_Block;
-    if (value == "Mute_Cuica") return MIDINAMES_Mute_Cuica;
-    if (value == "Open_Cuica") return MIDINAMES_Open_Cuica;
-    if (value == "Mute_Triangle") return MIDINAMES_Mute_Triangle;
-    if (value == "Open_Triangle") return MIDINAMES_Open_Triangle;
-    LogWarning("Unsupported value '%s' for data.MIDINAMES", value.c_str());
+            return values[0];
+    }
+}
+
+data_MIDINAMES AttConverter::StrToMidinames(const char *value) const
+{
+    switch (strlen(value)) {
+        case 4:
+            switch (value[0]) {
+                case 'T':
+                    if (!memcmp(value, "Tuba", 4)) return MIDINAMES_Tuba;
+                    break;
+                case 'O':
+                    if (!memcmp(value, "Oboe", 4)) return MIDINAMES_Oboe;
+                    break;
+                case 'K':
+                    if (!memcmp(value, "Koto", 4)) return MIDINAMES_Koto;
+                    break;
+            }
+            break;
+        case 5:
+            switch (value[0]) {
+                case 'C':
+                    if (!memcmp(value, "Clavi", 5)) return MIDINAMES_Clavi;
+                    if (!memcmp(value, "Cello", 5)) return MIDINAMES_Cello;
+                    break;
+                case 'V':
+                    if (!memcmp(value, "Viola", 5)) return MIDINAMES_Viola;
+                    break;
+                case 'F':
+                    if (!memcmp(value, "Flute", 5)) return MIDINAMES_Flute;
+                    break;
+                case 'S':
+                    if (!memcmp(value, "Sitar", 5)) return MIDINAMES_Sitar;
+                    break;
+                case 'B':
+                    if (!memcmp(value, "Banjo", 5)) return MIDINAMES_Banjo;
+                    break;
+                case 'A':
+                    if (!memcmp(value, "Agogo", 5)) return MIDINAMES_Agogo;
+                    break;
+            }
+            break;
+        case 6:
+            switch (value[0]) {
+                case 'V':
+                    if (!memcmp(value, "Violin", 6)) return MIDINAMES_Violin;
+                    break;
+                case 'F':
+                    if (!memcmp(value, "Fiddle", 6)) return MIDINAMES_Fiddle;
+                    break;
+                case 'S':
+                    if (!memcmp(value, "Shanai", 6)) return MIDINAMES_Shanai;
+                    break;
+                case 'C':
+                    if (!memcmp(value, "Cabasa", 6)) return MIDINAMES_Cabasa;
+                    if (!memcmp(value, "Claves", 6)) return MIDINAMES_Claves;
+                    break;
+            }
+            break;
+        case 7:
+            switch (value[0]) {
+                case 'C':
+                    if (!memcmp(value, "Celesta", 7)) return MIDINAMES_Celesta;
+                    if (!memcmp(value, "Cowbell", 7)) return MIDINAMES_Cowbell;
+                    break;
+                case 'M':
+                    if (!memcmp(value, "Marimba", 7)) return MIDINAMES_Marimba;
+                    if (!memcmp(value, "Maracas", 7)) return MIDINAMES_Maracas;
+                    break;
+                case 'T':
+                    if (!memcmp(value, "Timpani", 7)) return MIDINAMES_Timpani;
+                    if (!memcmp(value, "Trumpet", 7)) return MIDINAMES_Trumpet;
+                    break;
+                case 'B':
+                    if (!memcmp(value, "Bassoon", 7)) return MIDINAMES_Bassoon;
+                    if (!memcmp(value, "Bagpipe", 7)) return MIDINAMES_Bagpipe;
+                    break;
+                case 'P':
+                    if (!memcmp(value, "Piccolo", 7)) return MIDINAMES_Piccolo;
+                    break;
+                case 'W':
+                    if (!memcmp(value, "Whistle", 7)) return MIDINAMES_Whistle;
+                    break;
+                case 'O':
+                    if (!memcmp(value, "Ocarina", 7)) return MIDINAMES_Ocarina;
+                    break;
+                case 'K':
+                    if (!memcmp(value, "Kalimba", 7)) return MIDINAMES_Kalimba;
+                    break;
+                case 'G':
+                    if (!memcmp(value, "Gunshot", 7)) return MIDINAMES_Gunshot;
+                    break;
+                case 'L':
+                    if (!memcmp(value, "Low_Tom", 7)) return MIDINAMES_Low_Tom;
+                    break;
+            }
+            break;
+        case 8:
+            switch (value[0]) {
+                case 'D':
+                    if (!memcmp(value, "Dulcimer", 8)) return MIDINAMES_Dulcimer;
+                    break;
+                case 'T':
+                    if (!memcmp(value, "Trombone", 8)) return MIDINAMES_Trombone;
+                    break;
+                case 'A':
+                    if (!memcmp(value, "Alto_Sax", 8)) return MIDINAMES_Alto_Sax;
+                    if (!memcmp(value, "Applause", 8)) return MIDINAMES_Applause;
+                    break;
+                case 'C':
+                    if (!memcmp(value, "Clarinet", 8)) return MIDINAMES_Clarinet;
+                    break;
+                case 'R':
+                    if (!memcmp(value, "Recorder", 8)) return MIDINAMES_Recorder;
+                    break;
+                case 'S':
+                    if (!memcmp(value, "Shamisen", 8)) return MIDINAMES_Shamisen;
+                    if (!memcmp(value, "Seashore", 8)) return MIDINAMES_Seashore;
+                    break;
+                case 'H':
+                    if (!memcmp(value, "High_Tom", 8)) return MIDINAMES_High_Tom;
+                    if (!memcmp(value, "Hi_Bongo", 8)) return MIDINAMES_Hi_Bongo;
+                    break;
+            }
+            break;
+        case 9:
+            switch (value[0]) {
+                case 'M':
+                    if (!memcmp(value, "Music_Box", 9)) return MIDINAMES_Music_Box;
+                    break;
+                case 'X':
+                    if (!memcmp(value, "Xylophone", 9)) return MIDINAMES_Xylophone;
+                    break;
+                case 'A':
+                    if (!memcmp(value, "Accordion", 9)) return MIDINAMES_Accordion;
+                    break;
+                case 'H':
+                    if (!memcmp(value, "Harmonica", 9)) return MIDINAMES_Harmonica;
+                    if (!memcmp(value, "Hand_Clap", 9)) return MIDINAMES_Hand_Clap;
+                    break;
+                case 'T':
+                    if (!memcmp(value, "Tenor_Sax", 9)) return MIDINAMES_Tenor_Sax;
+                    break;
+                case 'P':
+                    if (!memcmp(value, "Pan_Flute", 9)) return MIDINAMES_Pan_Flute;
+                    break;
+                case 'F':
+                    if (!memcmp(value, "FX_1_rain", 9)) return MIDINAMES_FX_1_rain;
+                    break;
+                case 'W':
+                    if (!memcmp(value, "Woodblock", 9)) return MIDINAMES_Woodblock;
+                    break;
+                case 'R':
+                    if (!memcmp(value, "Ride_Bell", 9)) return MIDINAMES_Ride_Bell;
+                    break;
+                case 'V':
+                    if (!memcmp(value, "Vibraslap", 9)) return MIDINAMES_Vibraslap;
+                    break;
+                case 'L':
+                    if (!memcmp(value, "Low_Bongo", 9)) return MIDINAMES_Low_Bongo;
+                    if (!memcmp(value, "Low_Conga", 9)) return MIDINAMES_Low_Conga;
+                    if (!memcmp(value, "Low_Agogo", 9)) return MIDINAMES_Low_Agogo;
+                    break;
+            }
+            break;
+        case 10:
+            switch (value[0]) {
+                case 'V':
+                    if (!memcmp(value, "Vibraphone", 10)) return MIDINAMES_Vibraphone;
+                    if (!memcmp(value, "Voice_Oohs", 10)) return MIDINAMES_Voice_Oohs;
+                    break;
+                case 'R':
+                    if (!memcmp(value, "Rock_Organ", 10)) return MIDINAMES_Rock_Organ;
+                    if (!memcmp(value, "Reed_Organ", 10)) return MIDINAMES_Reed_Organ;
+                    break;
+                case 'C':
+                    if (!memcmp(value, "Contrabass", 10)) return MIDINAMES_Contrabass;
+                    if (!memcmp(value, "Choir_Aahs", 10)) return MIDINAMES_Choir_Aahs;
+                    break;
+                case 'S':
+                    if (!memcmp(value, "Shakuhachi", 10)) return MIDINAMES_Shakuhachi;
+                    if (!memcmp(value, "Synth_Drum", 10)) return MIDINAMES_Synth_Drum;
+                    if (!memcmp(value, "Side_Stick", 10)) return MIDINAMES_Side_Stick;
+                    break;
+                case 'P':
+                    if (!memcmp(value, "Pad_2_warm", 10)) return MIDINAMES_Pad_2_warm;
+                    if (!memcmp(value, "Pad_7_halo", 10)) return MIDINAMES_Pad_7_halo;
+                    break;
+                case 'T':
+                    if (!memcmp(value, "Taiko_Drum", 10)) return MIDINAMES_Taiko_Drum;
+                    if (!memcmp(value, "Tambourine", 10)) return MIDINAMES_Tambourine;
+                    break;
+                case 'B':
+                    if (!memcmp(value, "Bird_Tweet", 10)) return MIDINAMES_Bird_Tweet;
+                    break;
+                case 'H':
+                    if (!memcmp(value, "Helicopter", 10)) return MIDINAMES_Helicopter;
+                    if (!memcmp(value, "Hi-Mid_Tom", 10)) return MIDINAMES_Hi_Mid_Tom;
+                    if (!memcmp(value, "High_Agogo", 10)) return MIDINAMES_High_Agogo;
+                    break;
+                case 'L':
+                    if (!memcmp(value, "Long_Guiro", 10)) return MIDINAMES_Long_Guiro;
+                    break;
+                case 'M':
+                    if (!memcmp(value, "Mute_Cuica", 10)) return MIDINAMES_Mute_Cuica;
+                    break;
+                case 'O':
+                    if (!memcmp(value, "Open_Cuica", 10)) return MIDINAMES_Open_Cuica;
+                    break;
+            }
+            break;
+        case 11:
+            switch (value[0]) {
+                case 'H':
+                    if (!memcmp(value, "Harpsichord", 11)) return MIDINAMES_Harpsichord;
+                    break;
+                case 'S':
+                    if (!memcmp(value, "Slap_Bass_1", 11)) return MIDINAMES_Slap_Bass_1;
+                    if (!memcmp(value, "Slap_Bass_2", 11)) return MIDINAMES_Slap_Bass_2;
+                    if (!memcmp(value, "Synth_Voice", 11)) return MIDINAMES_Synth_Voice;
+                    if (!memcmp(value, "Soprano_Sax", 11)) return MIDINAMES_Soprano_Sax;
+                    if (!memcmp(value, "Steel_Drums", 11)) return MIDINAMES_Steel_Drums;
+                    if (!memcmp(value, "Short_Guiro", 11)) return MIDINAMES_Short_Guiro;
+                    break;
+                case 'F':
+                    if (!memcmp(value, "French_Horn", 11)) return MIDINAMES_French_Horn;
+                    if (!memcmp(value, "FX_7_echoes", 11)) return MIDINAMES_FX_7_echoes;
+                    if (!memcmp(value, "FX_8_sci-fi", 11)) return MIDINAMES_FX_8_sci_fi;
+                    break;
+                case 'P':
+                    if (!memcmp(value, "Pad_4_choir", 11)) return MIDINAMES_Pad_4_choir;
+                    if (!memcmp(value, "Pad_5_bowed", 11)) return MIDINAMES_Pad_5_bowed;
+                    if (!memcmp(value, "Pad_8_sweep", 11)) return MIDINAMES_Pad_8_sweep;
+                    break;
+                case 'T':
+                    if (!memcmp(value, "Tinkle_Bell", 11)) return MIDINAMES_Tinkle_Bell;
+                    break;
+                case 'M':
+                    if (!memcmp(value, "Melodic_Tom", 11)) return MIDINAMES_Melodic_Tom;
+                    break;
+                case 'B':
+                    if (!memcmp(value, "Bass_Drum_1", 11)) return MIDINAMES_Bass_Drum_1;
+                    break;
+                case 'O':
+                    if (!memcmp(value, "Open_Hi-Hat", 11)) return MIDINAMES_Open_Hi_Hat;
+                    break;
+                case 'L':
+                    if (!memcmp(value, "Low-Mid_Tom", 11)) return MIDINAMES_Low_Mid_Tom;
+                    if (!memcmp(value, "Low_Timbale", 11)) return MIDINAMES_Low_Timbale;
+                    break;
+            }
+            break;
+        case 12:
+            switch (value[0]) {
+                case 'G':
+                    if (!memcmp(value, "Glockenspiel", 12)) return MIDINAMES_Glockenspiel;
+                    break;
+                case 'C':
+                    if (!memcmp(value, "Church_Organ", 12)) return MIDINAMES_Church_Organ;
+                    break;
+                case 'S':
+                    if (!memcmp(value, "Synth_Bass_1", 12)) return MIDINAMES_Synth_Bass_1;
+                    if (!memcmp(value, "Synth_Bass_2", 12)) return MIDINAMES_Synth_Bass_2;
+                    if (!memcmp(value, "SynthBrass_1", 12)) return MIDINAMES_SynthBrass_1;
+                    if (!memcmp(value, "SynthBrass_2", 12)) return MIDINAMES_SynthBrass_2;
+                    break;
+                case 'B':
+                    if (!memcmp(value, "Baritone_Sax", 12)) return MIDINAMES_Baritone_Sax;
+                    if (!memcmp(value, "Blown_Bottle", 12)) return MIDINAMES_Blown_Bottle;
+                    if (!memcmp(value, "Breath_Noise", 12)) return MIDINAMES_Breath_Noise;
+                    break;
+                case 'E':
+                    if (!memcmp(value, "English_Horn", 12)) return MIDINAMES_English_Horn;
+                    break;
+                case 'L':
+                    if (!memcmp(value, "Lead_4_chiff", 12)) return MIDINAMES_Lead_4_chiff;
+                    if (!memcmp(value, "Lead_6_voice", 12)) return MIDINAMES_Lead_6_voice;
+                    if (!memcmp(value, "Long_Whistle", 12)) return MIDINAMES_Long_Whistle;
+                    break;
+                case 'F':
+                    if (!memcmp(value, "FX_3_crystal", 12)) return MIDINAMES_FX_3_crystal;
+                    if (!memcmp(value, "FX_6_goblins", 12)) return MIDINAMES_FX_6_goblins;
+                    break;
+                case 'P':
+                    if (!memcmp(value, "Pedal_Hi-Hat", 12)) return MIDINAMES_Pedal_Hi_Hat;
+                    break;
+                case 'H':
+                    if (!memcmp(value, "High_Timbale", 12)) return MIDINAMES_High_Timbale;
+                    break;
+            }
+            break;
+        case 13:
+            switch (value[0]) {
+                case 'T':
+                    if (!memcmp(value, "Tubular_Bells", 13)) return MIDINAMES_Tubular_Bells;
+                    break;
+                case 'D':
+                    if (!memcmp(value, "Drawbar_Organ", 13)) return MIDINAMES_Drawbar_Organ;
+                    break;
+                case 'A':
+                    if (!memcmp(value, "Acoustic_Bass", 13)) return MIDINAMES_Acoustic_Bass;
+                    break;
+                case 'F':
+                    if (!memcmp(value, "Fretless_Bass", 13)) return MIDINAMES_Fretless_Bass;
+                    break;
+                case 'O':
+                    if (!memcmp(value, "Orchestra_Hit", 13)) return MIDINAMES_Orchestra_Hit;
+                    if (!memcmp(value, "Open_Hi_Conga", 13)) return MIDINAMES_Open_Hi_Conga;
+                    if (!memcmp(value, "Open_Triangle", 13)) return MIDINAMES_Open_Triangle;
+                    break;
+                case 'M':
+                    if (!memcmp(value, "Muted_Trumpet", 13)) return MIDINAMES_Muted_Trumpet;
+                    if (!memcmp(value, "Mute_Hi_Conga", 13)) return MIDINAMES_Mute_Hi_Conga;
+                    if (!memcmp(value, "Mute_Triangle", 13)) return MIDINAMES_Mute_Triangle;
+                    break;
+                case 'B':
+                    if (!memcmp(value, "Brass_Section", 13)) return MIDINAMES_Brass_Section;
+                    break;
+                case 'L':
+                    if (!memcmp(value, "Lead_1_square", 13)) return MIDINAMES_Lead_1_square;
+                    if (!memcmp(value, "Lead_7_fifths", 13)) return MIDINAMES_Lead_7_fifths;
+                    if (!memcmp(value, "Low_Floor_Tom", 13)) return MIDINAMES_Low_Floor_Tom;
+                    break;
+                case 'P':
+                    if (!memcmp(value, "Pad_1_new_age", 13)) return MIDINAMES_Pad_1_new_age;
+                    break;
+                case 'C':
+                    if (!memcmp(value, "Closed_Hi_Hat", 13)) return MIDINAMES_Closed_Hi_Hat;
+                    break;
+                case 'R':
+                    if (!memcmp(value, "Ride_Cymbal_1", 13)) return MIDINAMES_Ride_Cymbal_1;
+                    if (!memcmp(value, "Ride_Cymbal_2", 13)) return MIDINAMES_Ride_Cymbal_2;
+                    break;
+                case 'S':
+                    if (!memcmp(value, "Splash_Cymbal", 13)) return MIDINAMES_Splash_Cymbal;
+                    if (!memcmp(value, "Short_Whistle", 13)) return MIDINAMES_Short_Whistle;
+                    break;
+                case 'H':
+                    if (!memcmp(value, "Hi_Wood_Block", 13)) return MIDINAMES_Hi_Wood_Block;
+                    break;
+            }
+            break;
+        case 14:
+            switch (value[0]) {
+                case 'S':
+                    if (!memcmp(value, "SynthStrings_1", 14)) return MIDINAMES_SynthStrings_1;
+                    if (!memcmp(value, "SynthStrings_2", 14)) return MIDINAMES_SynthStrings_2;
+                    break;
+                case 'L':
+                    if (!memcmp(value, "Lead_5_charang", 14)) return MIDINAMES_Lead_5_charang;
+                    if (!memcmp(value, "Low_Wood_Block", 14)) return MIDINAMES_Low_Wood_Block;
+                    break;
+                case 'P':
+                    if (!memcmp(value, "Pad_6_metallic", 14)) return MIDINAMES_Pad_6_metallic;
+                    break;
+                case 'R':
+                    if (!memcmp(value, "Reverse_Cymbal", 14)) return MIDINAMES_Reverse_Cymbal;
+                    break;
+                case 'T':
+                    if (!memcmp(value, "Telephone_Ring", 14)) return MIDINAMES_Telephone_Ring;
+                    break;
+                case 'A':
+                    if (!memcmp(value, "Acoustic_Snare", 14)) return MIDINAMES_Acoustic_Snare;
+                    break;
+                case 'E':
+                    if (!memcmp(value, "Electric_Snare", 14)) return MIDINAMES_Electric_Snare;
+                    break;
+                case 'H':
+                    if (!memcmp(value, "High_Floor_Tom", 14)) return MIDINAMES_High_Floor_Tom;
+                    break;
+                case 'C':
+                    if (!memcmp(value, "Crash_Cymbal_1", 14)) return MIDINAMES_Crash_Cymbal_1;
+                    if (!memcmp(value, "Chinese_Cymbal", 14)) return MIDINAMES_Chinese_Cymbal;
+                    if (!memcmp(value, "Crash_Cymbal_2", 14)) return MIDINAMES_Crash_Cymbal_2;
+                    break;
+            }
+            break;
+        case 15:
+            switch (value[0]) {
+                case 'T':
+                    if (!memcmp(value, "Tango_Accordion", 15)) return MIDINAMES_Tango_Accordion;
+                    if (!memcmp(value, "Tremolo_Strings", 15)) return MIDINAMES_Tremolo_Strings;
+                    break;
+                case 'O':
+                    if (!memcmp(value, "Orchestral_Harp", 15)) return MIDINAMES_Orchestral_Harp;
+                    break;
+                case 'L':
+                    if (!memcmp(value, "Lead_2_sawtooth", 15)) return MIDINAMES_Lead_2_sawtooth;
+                    if (!memcmp(value, "Lead_3_calliope", 15)) return MIDINAMES_Lead_3_calliope;
+                    break;
+                case 'P':
+                    if (!memcmp(value, "Pad_3_polysynth", 15)) return MIDINAMES_Pad_3_polysynth;
+                    break;
+                case 'F':
+                    if (!memcmp(value, "FX_2_soundtrack", 15)) return MIDINAMES_FX_2_soundtrack;
+                    if (!memcmp(value, "FX_4_atmosphere", 15)) return MIDINAMES_FX_4_atmosphere;
+                    if (!memcmp(value, "FX_5_brightness", 15)) return MIDINAMES_FX_5_brightness;
+                    break;
+            }
+            break;
+        case 16:
+            switch (value[0]) {
+                case 'H':
+                    if (!memcmp(value, "Honky-tonk_Piano", 16)) return MIDINAMES_Honky_tonk_Piano;
+                    break;
+                case 'E':
+                    if (!memcmp(value, "Electric_Piano_1", 16)) return MIDINAMES_Electric_Piano_1;
+                    if (!memcmp(value, "Electric_Piano_2", 16)) return MIDINAMES_Electric_Piano_2;
+                    break;
+                case 'P':
+                    if (!memcmp(value, "Percussive_Organ", 16)) return MIDINAMES_Percussive_Organ;
+                    break;
+                case 'G':
+                    if (!memcmp(value, "Guitar_harmonics", 16)) return MIDINAMES_Guitar_harmonics;
+                    break;
+            }
+            break;
+        case 17:
+            switch (value[0]) {
+                case 'O':
+                    if (!memcmp(value, "Overdriven_Guitar", 17)) return MIDINAMES_Overdriven_Guitar;
+                    break;
+                case 'D':
+                    if (!memcmp(value, "Distortion_Guitar", 17)) return MIDINAMES_Distortion_Guitar;
+                    break;
+                case 'P':
+                    if (!memcmp(value, "Pizzicato_Strings", 17)) return MIDINAMES_Pizzicato_Strings;
+                    break;
+                case 'S':
+                    if (!memcmp(value, "String_Ensemble_1", 17)) return MIDINAMES_String_Ensemble_1;
+                    if (!memcmp(value, "String_Ensemble_2", 17)) return MIDINAMES_String_Ensemble_2;
+                    break;
+                case 'G':
+                    if (!memcmp(value, "Guitar_Fret_Noise", 17)) return MIDINAMES_Guitar_Fret_Noise;
+                    break;
+            }
+            break;
+        case 18:
+            switch (value[0]) {
+                case 'E':
+                    if (!memcmp(value, "Electric_Bass_pick", 18)) return MIDINAMES_Electric_Bass_pick;
+                    break;
+                case 'A':
+                    if (!memcmp(value, "Acoustic_Bass_Drum", 18)) return MIDINAMES_Acoustic_Bass_Drum;
+                    break;
+            }
+            break;
+        case 20:
+            switch (value[0]) {
+                case 'A':
+                    if (!memcmp(value, "Acoustic_Grand_Piano", 20)) return MIDINAMES_Acoustic_Grand_Piano;
+                    break;
+                case 'E':
+                    if (!memcmp(value, "Electric_Grand_Piano", 20)) return MIDINAMES_Electric_Grand_Piano;
+                    if (!memcmp(value, "Electric_Guitar_jazz", 20)) return MIDINAMES_Electric_Guitar_jazz;
+                    if (!memcmp(value, "Electric_Bass_finger", 20)) return MIDINAMES_Electric_Bass_finger;
+                    break;
+                case 'L':
+                    if (!memcmp(value, "Lead_8_bass_and_lead", 20)) return MIDINAMES_Lead_8_bass_and_lead;
+                    break;
+            }
+            break;
+        case 21:
+            switch (value[0]) {
+                case 'B':
+                    if (!memcmp(value, "Bright_Acoustic_Piano", 21)) return MIDINAMES_Bright_Acoustic_Piano;
+                    break;
+                case 'A':
+                    if (!memcmp(value, "Acoustic_Guitar_nylon", 21)) return MIDINAMES_Acoustic_Guitar_nylon;
+                    if (!memcmp(value, "Acoustic_Guitar_steel", 21)) return MIDINAMES_Acoustic_Guitar_steel;
+                    break;
+                case 'E':
+                    if (!memcmp(value, "Electric_Guitar_clean", 21)) return MIDINAMES_Electric_Guitar_clean;
+                    if (!memcmp(value, "Electric_Guitar_muted", 21)) return MIDINAMES_Electric_Guitar_muted;
+                    break;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.MIDINAMES", value);
     return MIDINAMES_NONE;
 }
 
-std::string AttConverter::ModeToStr(data_MODE data) const
+const std::string &AttConverter::ModeToStr(data_MODE data) const
 {
-    std::string value;
+    static const std::string values[] = {
+        "", "major", "minor", "dorian", "phrygian", "lydian", "mixolydian", "aeolian", "locrian"
+    };
     switch (data) {
-        case MODE_major: value = "major"; break;
-        case MODE_minor: value = "minor"; break;
-        case MODE_dorian: value = "dorian"; break;
-        case MODE_phrygian: value = "phrygian"; break;
-        case MODE_lydian: value = "lydian"; break;
-        case MODE_mixolydian: value = "mixolydian"; break;
-        case MODE_aeolian: value = "aeolian"; break;
-        case MODE_locrian: value = "locrian"; break;
+        case MODE_major: return values[1];
+        case MODE_minor: return values[2];
+        case MODE_dorian: return values[3];
+        case MODE_phrygian: return values[4];
+        case MODE_lydian: return values[5];
+        case MODE_mixolydian: return values[6];
+        case MODE_aeolian: return values[7];
+        case MODE_locrian: return values[8];
         default:
             LogWarning("Unknown value '%d' for data.MODE", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_MODE AttConverter::StrToMode(std::string value) const
+data_MODE AttConverter::StrToMode(const char *value) const
 {
-    if (value == "major") return MODE_major;
-    if (value == "minor") return MODE_minor;
-    if (value == "dorian") return MODE_dorian;
-    if (value == "phrygian") return MODE_phrygian;
-    if (value == "lydian") return MODE_lydian;
-    if (value == "mixolydian") return MODE_mixolydian;
-    if (value == "aeolian") return MODE_aeolian;
-    if (value == "locrian") return MODE_locrian;
-    LogWarning("Unsupported value '%s' for data.MODE", value.c_str());
+    switch (strlen(value)) {
+        case 5:
+            if (!memcmp(value, "major", 5)) return MODE_major;
+            if (!memcmp(value, "minor", 5)) return MODE_minor;
+            break;
+        case 6:
+            switch (value[0]) {
+                case 'd':
+                    if (!memcmp(value, "dorian", 6)) return MODE_dorian;
+                    break;
+                case 'l':
+                    if (!memcmp(value, "lydian", 6)) return MODE_lydian;
+                    break;
+            }
+            break;
+        case 7:
+            switch (value[0]) {
+                case 'a':
+                    if (!memcmp(value, "aeolian", 7)) return MODE_aeolian;
+                    break;
+                case 'l':
+                    if (!memcmp(value, "locrian", 7)) return MODE_locrian;
+                    break;
+            }
+            break;
+        case 8:
+            if (!memcmp(value, "phrygian", 8)) return MODE_phrygian;
+            break;
+        case 10:
+            if (!memcmp(value, "mixolydian", 10)) return MODE_mixolydian;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.MODE", value);
     return MODE_NONE;
 }
 
-std::string AttConverter::NotationtypeToStr(data_NOTATIONTYPE data) const
+const std::string &AttConverter::NotationtypeToStr(data_NOTATIONTYPE data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "cmn", "mensural", "mensural.black", "mensural.white", "neume", "tab" };
     switch (data) {
-        case NOTATIONTYPE_cmn: value = "cmn"; break;
-        case NOTATIONTYPE_mensural: value = "mensural"; break;
-        case NOTATIONTYPE_mensural_black: value = "mensural.black"; break;
-        case NOTATIONTYPE_mensural_white: value = "mensural.white"; break;
-        case NOTATIONTYPE_neume: value = "neume"; break;
-        case NOTATIONTYPE_tab: value = "tab"; break;
+        case NOTATIONTYPE_cmn: return values[1];
+        case NOTATIONTYPE_mensural: return values[2];
+        case NOTATIONTYPE_mensural_black: return values[3];
+        case NOTATIONTYPE_mensural_white: return values[4];
+        case NOTATIONTYPE_neume: return values[5];
+        case NOTATIONTYPE_tab: return values[6];
         default:
             LogWarning("Unknown value '%d' for data.NOTATIONTYPE", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_NOTATIONTYPE AttConverter::StrToNotationtype(std::string value) const
+data_NOTATIONTYPE AttConverter::StrToNotationtype(const char *value) const
 {
-    if (value == "cmn") return NOTATIONTYPE_cmn;
-    if (value == "mensural") return NOTATIONTYPE_mensural;
-    if (value == "mensural.black") return NOTATIONTYPE_mensural_black;
-    if (value == "mensural.white") return NOTATIONTYPE_mensural_white;
-    if (value == "neume") return NOTATIONTYPE_neume;
-    if (value == "tab") return NOTATIONTYPE_tab;
-    LogWarning("Unsupported value '%s' for data.NOTATIONTYPE", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            switch (value[0]) {
+                case 'c':
+                    if (!memcmp(value, "cmn", 3)) return NOTATIONTYPE_cmn;
+                    break;
+                case 't':
+                    if (!memcmp(value, "tab", 3)) return NOTATIONTYPE_tab;
+                    break;
+            }
+            break;
+        case 5:
+            if (!memcmp(value, "neume", 5)) return NOTATIONTYPE_neume;
+            break;
+        case 8:
+            if (!memcmp(value, "mensural", 8)) return NOTATIONTYPE_mensural;
+            break;
+        case 14:
+            if (!memcmp(value, "mensural.black", 14)) return NOTATIONTYPE_mensural_black;
+            if (!memcmp(value, "mensural.white", 14)) return NOTATIONTYPE_mensural_white;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.NOTATIONTYPE", value);
     return NOTATIONTYPE_NONE;
 }
 
-std::string AttConverter::NoteheadmodifierListToStr(data_NOTEHEADMODIFIER_list data) const
+const std::string &AttConverter::NoteheadmodifierListToStr(data_NOTEHEADMODIFIER_list data) const
 {
-    std::string value;
+    static const std::string values[] = {
+        "", "slash", "backslash", "vline", "hline", "centerdot", "paren", "brack", "box", "circle", "dblwhole"
+    };
     switch (data) {
-        case NOTEHEADMODIFIER_list_slash: value = "slash"; break;
-        case NOTEHEADMODIFIER_list_backslash: value = "backslash"; break;
-        case NOTEHEADMODIFIER_list_vline: value = "vline"; break;
-        case NOTEHEADMODIFIER_list_hline: value = "hline"; break;
-        case NOTEHEADMODIFIER_list_centerdot: value = "centerdot"; break;
-        case NOTEHEADMODIFIER_list_paren: value = "paren"; break;
-        case NOTEHEADMODIFIER_list_brack: value = "brack"; break;
-        case NOTEHEADMODIFIER_list_box: value = "box"; break;
-        case NOTEHEADMODIFIER_list_circle: value = "circle"; break;
-        case NOTEHEADMODIFIER_list_dblwhole: value = "dblwhole"; break;
+        case NOTEHEADMODIFIER_list_slash: return values[1];
+        case NOTEHEADMODIFIER_list_backslash: return values[2];
+        case NOTEHEADMODIFIER_list_vline: return values[3];
+        case NOTEHEADMODIFIER_list_hline: return values[4];
+        case NOTEHEADMODIFIER_list_centerdot: return values[5];
+        case NOTEHEADMODIFIER_list_paren: return values[6];
+        case NOTEHEADMODIFIER_list_brack: return values[7];
+        case NOTEHEADMODIFIER_list_box: return values[8];
+        case NOTEHEADMODIFIER_list_circle: return values[9];
+        case NOTEHEADMODIFIER_list_dblwhole: return values[10];
         default:
             LogWarning("Unknown value '%d' for data.NOTEHEADMODIFIER.list", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_NOTEHEADMODIFIER_list AttConverter::StrToNoteheadmodifierList(std::string value) const
+data_NOTEHEADMODIFIER_list AttConverter::StrToNoteheadmodifierList(const char *value) const
 {
-    if (value == "slash") return NOTEHEADMODIFIER_list_slash;
-    if (value == "backslash") return NOTEHEADMODIFIER_list_backslash;
-    if (value == "vline") return NOTEHEADMODIFIER_list_vline;
-    if (value == "hline") return NOTEHEADMODIFIER_list_hline;
-    if (value == "centerdot") return NOTEHEADMODIFIER_list_centerdot;
-    if (value == "paren") return NOTEHEADMODIFIER_list_paren;
-    if (value == "brack") return NOTEHEADMODIFIER_list_brack;
-    if (value == "box") return NOTEHEADMODIFIER_list_box;
-    if (value == "circle") return NOTEHEADMODIFIER_list_circle;
-    if (value == "dblwhole") return NOTEHEADMODIFIER_list_dblwhole;
-    LogWarning("Unsupported value '%s' for data.NOTEHEADMODIFIER.list", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            if (!memcmp(value, "box", 3)) return NOTEHEADMODIFIER_list_box;
+            break;
+        case 5:
+            switch (value[0]) {
+                case 's':
+                    if (!memcmp(value, "slash", 5)) return NOTEHEADMODIFIER_list_slash;
+                    break;
+                case 'v':
+                    if (!memcmp(value, "vline", 5)) return NOTEHEADMODIFIER_list_vline;
+                    break;
+                case 'h':
+                    if (!memcmp(value, "hline", 5)) return NOTEHEADMODIFIER_list_hline;
+                    break;
+                case 'p':
+                    if (!memcmp(value, "paren", 5)) return NOTEHEADMODIFIER_list_paren;
+                    break;
+                case 'b':
+                    if (!memcmp(value, "brack", 5)) return NOTEHEADMODIFIER_list_brack;
+                    break;
+            }
+            break;
+        case 6:
+            if (!memcmp(value, "circle", 6)) return NOTEHEADMODIFIER_list_circle;
+            break;
+        case 8:
+            if (!memcmp(value, "dblwhole", 8)) return NOTEHEADMODIFIER_list_dblwhole;
+            break;
+        case 9:
+            switch (value[0]) {
+                case 'b':
+                    if (!memcmp(value, "backslash", 9)) return NOTEHEADMODIFIER_list_backslash;
+                    break;
+                case 'c':
+                    if (!memcmp(value, "centerdot", 9)) return NOTEHEADMODIFIER_list_centerdot;
+                    break;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.NOTEHEADMODIFIER.list", value);
     return NOTEHEADMODIFIER_list_NONE;
 }
 
-std::string AttConverter::OtherstaffToStr(data_OTHERSTAFF data) const
+const std::string &AttConverter::OtherstaffToStr(data_OTHERSTAFF data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "above", "below" };
     switch (data) {
-        case OTHERSTAFF_above: value = "above"; break;
-        case OTHERSTAFF_below: value = "below"; break;
+        case OTHERSTAFF_above: return values[1];
+        case OTHERSTAFF_below: return values[2];
         default:
             LogWarning("Unknown value '%d' for data.OTHERSTAFF", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_OTHERSTAFF AttConverter::StrToOtherstaff(std::string value) const
+data_OTHERSTAFF AttConverter::StrToOtherstaff(const char *value) const
 {
-    if (value == "above") return OTHERSTAFF_above;
-    if (value == "below") return OTHERSTAFF_below;
-    LogWarning("Unsupported value '%s' for data.OTHERSTAFF", value.c_str());
+    switch (strlen(value)) {
+        case 5:
+            switch (value[0]) {
+                case 'a':
+                    if (!memcmp(value, "above", 5)) return OTHERSTAFF_above;
+                    break;
+                case 'b':
+                    if (!memcmp(value, "below", 5)) return OTHERSTAFF_below;
+                    break;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.OTHERSTAFF", value);
     return OTHERSTAFF_NONE;
 }
 
-std::string AttConverter::PlaceToStr(data_PLACE data) const
+const std::string &AttConverter::PlaceToStr(data_PLACE data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "above", "below" };
     switch (data) {
-        case PLACE_above: value = "above"; break;
-        case PLACE_below: value = "below"; break;
+        case PLACE_above: return values[1];
+        case PLACE_below: return values[2];
         default:
             LogWarning("Unknown value '%d' for data.PLACE", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_PLACE AttConverter::StrToPlace(std::string value) const
+data_PLACE AttConverter::StrToPlace(const char *value) const
 {
-    if (value == "above") return PLACE_above;
-    if (value == "below") return PLACE_below;
-    LogWarning("Unsupported value '%s' for data.PLACE", value.c_str());
+    switch (strlen(value)) {
+        case 5:
+            switch (value[0]) {
+                case 'a':
+                    if (!memcmp(value, "above", 5)) return PLACE_above;
+                    break;
+                case 'b':
+                    if (!memcmp(value, "below", 5)) return PLACE_below;
+                    break;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.PLACE", value);
     return PLACE_NONE;
 }
 
-std::string AttConverter::RotationdirectionToStr(data_ROTATIONDIRECTION data) const
+const std::string &AttConverter::RotationdirectionToStr(data_ROTATIONDIRECTION data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "none", "down", "left", "ne", "nw", "se", "sw" };
     switch (data) {
-        case ROTATIONDIRECTION_none: value = "none"; break;
-        case ROTATIONDIRECTION_down: value = "down"; break;
-        case ROTATIONDIRECTION_left: value = "left"; break;
-        case ROTATIONDIRECTION_ne: value = "ne"; break;
-        case ROTATIONDIRECTION_nw: value = "nw"; break;
-        case ROTATIONDIRECTION_se: value = "se"; break;
-        case ROTATIONDIRECTION_sw: value = "sw"; break;
+        case ROTATIONDIRECTION_none: return values[1];
+        case ROTATIONDIRECTION_down: return values[2];
+        case ROTATIONDIRECTION_left: return values[3];
+        case ROTATIONDIRECTION_ne: return values[4];
+        case ROTATIONDIRECTION_nw: return values[5];
+        case ROTATIONDIRECTION_se: return values[6];
+        case ROTATIONDIRECTION_sw: return values[7];
         default:
             LogWarning("Unknown value '%d' for data.ROTATIONDIRECTION", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_ROTATIONDIRECTION AttConverter::StrToRotationdirection(std::string value) const
-{
-    if (value == "none") return ROTATIONDIRECTION_none;
-    if (value == "down") return ROTATIONDIRECTION_down;
-    if (value == "left") return ROTATIONDIRECTION_left;
-    if (value == "ne") return ROTATIONDIRECTION_ne;
-    if (value == "nw") return ROTATIONDIRECTION_nw;
-    if (value == "se") return ROTATIONDIRECTION_se;
-    if (value == "sw") return ROTATIONDIRECTION_sw;
-    LogWarning("Unsupported value '%s' for data.ROTATIONDIRECTION", value.c_str());
+data_ROTATIONDIRECTION AttConverter::StrToRotationdirection(const char *value) const
+{
+    switch (strlen(value)) {
+        case 2:
+            switch (value[0]) {
+                case 'n':
+                    if (!memcmp(value, "ne", 2)) return ROTATIONDIRECTION_ne;
+                    if (!memcmp(value, "nw", 2)) return ROTATIONDIRECTION_nw;
+                    break;
+                case 's':
+                    if (!memcmp(value, "se", 2)) return ROTATIONDIRECTION_se;
+                    if (!memcmp(value, "sw", 2)) return ROTATIONDIRECTION_sw;
+                    break;
+            }
+            break;
+        case 4:
+            switch (value[0]) {
+                case 'n':
+                    if (!memcmp(value, "none", 4)) return ROTATIONDIRECTION_none;
+                    break;
+                case 'd':
+                    if (!memcmp(value, "down", 4)) return ROTATIONDIRECTION_down;
+                    break;
+                case 'l':
+                    if (!memcmp(value, "left", 4)) return ROTATIONDIRECTION_left;
+                    break;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.ROTATIONDIRECTION", value);
     return ROTATIONDIRECTION_NONE;
 }
 
-std::string AttConverter::SizeToStr(data_SIZE data) const
+const std::string &AttConverter::SizeToStr(data_SIZE data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "normal", "cue" };
     switch (data) {
-        case SIZE_normal: value = "normal"; break;
-        case SIZE_cue: value = "cue"; break;
+        case SIZE_normal: return values[1];
+        case SIZE_cue: return values[2];
         default:
             LogWarning("Unknown value '%d' for data.SIZE", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_SIZE AttConverter::StrToSize(std::string value) const
+data_SIZE AttConverter::StrToSize(const char *value) const
 {
-    if (value == "normal") return SIZE_normal;
-    if (value == "cue") return SIZE_cue;
-    LogWarning("Unsupported value '%s' for data.SIZE", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            if (!memcmp(value, "cue", 3)) return SIZE_cue;
+            break;
+        case 6:
+            if (!memcmp(value, "normal", 6)) return SIZE_normal;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.SIZE", value);
     return SIZE_NONE;
 }
 
-std::string AttConverter::StaffrelToStr(data_STAFFREL data) const
+const std::string &AttConverter::StaffrelToStr(data_STAFFREL data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "above", "below", "within" };
     switch (data) {
-        case STAFFREL_above: value = "above"; break;
-        case STAFFREL_below: value = "below"; break;
-        case STAFFREL_within: value = "within"; break;
+        case STAFFREL_above: return values[1];
+        case STAFFREL_below: return values[2];
+        case STAFFREL_within: return values[3];
         default:
             LogWarning("Unknown value '%d' for data.STAFFREL", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_STAFFREL AttConverter::StrToStaffrel(std::string value) const
+data_STAFFREL AttConverter::StrToStaffrel(const char *value) const
 {
-    if (value == "above") return STAFFREL_above;
-    if (value == "below") return STAFFREL_below;
-    if (value == "within") return STAFFREL_within;
-    LogWarning("Unsupported value '%s' for data.STAFFREL", value.c_str());
+    switch (strlen(value)) {
+        case 5:
+            switch (value[0]) {
+                case 'a':
+                    if (!memcmp(value, "above", 5)) return STAFFREL_above;
+                    break;
+                case 'b':
+                    if (!memcmp(value, "below", 5)) return STAFFREL_below;
+                    break;
+            }
+            break;
+        case 6:
+            if (!memcmp(value, "within", 6)) return STAFFREL_within;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.STAFFREL", value);
     return STAFFREL_NONE;
 }
 
-std::string AttConverter::StemmodifierToStr(data_STEMMODIFIER data) const
+const std::string &AttConverter::StemmodifierToStr(data_STEMMODIFIER data) const
 {
-    std::string value;
+    static const std::string values[] = {
+        "", "none", "1slash", "2slash", "3slash", "4slash", "5slash", "6slash", "sprech", "z"
+    };
     switch (data) {
-        case STEMMODIFIER_none: value = "none"; break;
-        case STEMMODIFIER_1slash: value = "1slash"; break;
-        case STEMMODIFIER_2slash: value = "2slash"; break;
-        case STEMMODIFIER_3slash: value = "3slash"; break;
-        case STEMMODIFIER_4slash: value = "4slash"; break;
-        case STEMMODIFIER_5slash: value = "5slash"; break;
-        case STEMMODIFIER_6slash: value = "6slash"; break;
-        case STEMMODIFIER_sprech: value = "sprech"; break;
-        case STEMMODIFIER_z: value = "z"; break;
+        case STEMMODIFIER_none: return values[1];
+        case STEMMODIFIER_1slash: return values[2];
+        case STEMMODIFIER_2slash: return values[3];
+        case STEMMODIFIER_3slash: return values[4];
+        case STEMMODIFIER_4slash: return values[5];
+        case STEMMODIFIER_5slash: return values[6];
+        case STEMMODIFIER_6slash: return values[7];
+        case STEMMODIFIER_sprech: return values[8];
+        case STEMMODIFIER_z: return values[9];
         default:
             LogWarning("Unknown value '%d' for data.STEMMODIFIER", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_STEMMODIFIER AttConverter::StrToStemmodifier(std::string value) const
+data_STEMMODIFIER AttConverter::StrToStemmodifier(const char *value) const
 {
-    if (value == "none") return STEMMODIFIER_none;
-    if (value == "1slash") return STEMMODIFIER_1slash;
-    if (value == "2slash") return STEMMODIFIER_2slash;
-    if (value == "3slash") return STEMMODIFIER_3slash;
-    if (value == "4slash") return STEMMODIFIER_4slash;
-    if (value == "5slash") return STEMMODIFIER_5slash;
-    if (value == "6slash") return STEMMODIFIER_6slash;
-    if (value == "sprech") return STEMMODIFIER_sprech;
-    if (value == "z") return STEMMODIFIER_z;
-    LogWarning("Unsupported value '%s' for data.STEMMODIFIER", value.c_str());
+    switch (strlen(value)) {
+        case 1:
+            if (!memcmp(value, "z", 1)) return STEMMODIFIER_z;
+            break;
+        case 4:
+            if (!memcmp(value, "none", 4)) return STEMMODIFIER_none;
+            break;
+        case 6:
+            switch (value[0]) {
+                case '1':
+                    if (!memcmp(value, "1slash", 6)) return STEMMODIFIER_1slash;
+                    break;
+                case '2':
+                    if (!memcmp(value, "2slash", 6)) return STEMMODIFIER_2slash;
+                    break;
+                case '3':
+                    if (!memcmp(value, "3slash", 6)) return STEMMODIFIER_3slash;
+                    break;
+                case '4':
+                    if (!memcmp(value, "4slash", 6)) return STEMMODIFIER_4slash;
+                    break;
+                case '5':
+                    if (!memcmp(value, "5slash", 6)) return STEMMODIFIER_5slash;
+                    break;
+                case '6':
+                    if (!memcmp(value, "6slash", 6)) return STEMMODIFIER_6slash;
+                    break;
+                case 's':
+                    if (!memcmp(value, "sprech", 6)) return STEMMODIFIER_sprech;
+                    break;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.STEMMODIFIER", value);
     return STEMMODIFIER_NONE;
 }
 
-std::string AttConverter::StempositionToStr(data_STEMPOSITION data) const
+const std::string &AttConverter::StempositionToStr(data_STEMPOSITION data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "left", "right", "center" };
     switch (data) {
-        case STEMPOSITION_left: value = "left"; break;
-        case STEMPOSITION_right: value = "right"; break;
-        case STEMPOSITION_center: value = "center"; break;
+        case STEMPOSITION_left: return values[1];
+        case STEMPOSITION_right: return values[2];
+        case STEMPOSITION_center: return values[3];
         default:
             LogWarning("Unknown value '%d' for data.STEMPOSITION", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_STEMPOSITION AttConverter::StrToStemposition(std::string value) const
+data_STEMPOSITION AttConverter::StrToStemposition(const char *value) const
 {
-    if (value == "left") return STEMPOSITION_left;
-    if (value == "right") return STEMPOSITION_right;
-    if (value == "center") return STEMPOSITION_center;
-    LogWarning("Unsupported value '%s' for data.STEMPOSITION", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            if (!memcmp(value, "left", 4)) return STEMPOSITION_left;
+            break;
+        case 5:
+            if (!memcmp(value, "right", 5)) return STEMPOSITION_right;
+            break;
+        case 6:
+            if (!memcmp(value, "center", 6)) return STEMPOSITION_center;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.STEMPOSITION", value);
     return STEMPOSITION_NONE;
 }
 
-std::string AttConverter::TemperamentToStr(data_TEMPERAMENT data) const
+const std::string &AttConverter::TemperamentToStr(data_TEMPERAMENT data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "equal", "just", "mean", "pythagorean" };
     switch (data) {
-        case TEMPERAMENT_equal: value = "equal"; break;
-        case TEMPERAMENT_just: value = "just"; break;
-        case TEMPERAMENT_mean: value = "mean"; break;
-        case TEMPERAMENT_pythagorean: value = "pythagorean"; break;
+        case TEMPERAMENT_equal: return values[1];
+        case TEMPERAMENT_just: return values[2];
+        case TEMPERAMENT_mean: return values[3];
+        case TEMPERAMENT_pythagorean: return values[4];
         default:
             LogWarning("Unknown value '%d' for data.TEMPERAMENT", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_TEMPERAMENT AttConverter::StrToTemperament(std::string value) const
+data_TEMPERAMENT AttConverter::StrToTemperament(const char *value) const
 {
-    if (value == "equal") return TEMPERAMENT_equal;
-    if (value == "just") return TEMPERAMENT_just;
-    if (value == "mean") return TEMPERAMENT_mean;
-    if (value == "pythagorean") return TEMPERAMENT_pythagorean;
-    LogWarning("Unsupported value '%s' for data.TEMPERAMENT", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            switch (value[0]) {
+                case 'j':
+                    if (!memcmp(value, "just", 4)) return TEMPERAMENT_just;
+                    break;
+                case 'm':
+                    if (!memcmp(value, "mean", 4)) return TEMPERAMENT_mean;
+                    break;
+            }
+            break;
+        case 5:
+            if (!memcmp(value, "equal", 5)) return TEMPERAMENT_equal;
+            break;
+        case 11:
+            if (!memcmp(value, "pythagorean", 11)) return TEMPERAMENT_pythagorean;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.TEMPERAMENT", value);
     return TEMPERAMENT_NONE;
 }
 
-std::string AttConverter::TextrenditionlistToStr(data_TEXTRENDITIONLIST data) const
-{
-    std::string value;
-    switch (data) {
-        case TEXTRENDITIONLIST_italic: value = "italic"; break;
-        case TEXTRENDITIONLIST_oblique: value = "oblique"; break;
-        case TEXTRENDITIONLIST_smcaps: value = "smcaps"; break;
-        case TEXTRENDITIONLIST_bold: value = "bold"; break;
-        case TEXTRENDITIONLIST_bolder: value = "bolder"; break;
-        case TEXTRENDITIONLIST_lighter: value = "lighter"; break;
-        case TEXTRENDITIONLIST_box: value = "box"; break;
-        case TEXTRENDITIONLIST_circle: value = "circle"; break;
-        case TEXTRENDITIONLIST_dbox: value = "dbox"; break;
-        case TEXTRENDITIONLIST_tbox: value = "tbox"; break;
-        case TEXTRENDITIONLIST_bslash: value = "bslash"; break;
-        case TEXTRENDITIONLIST_fslash: value = "fslash"; break;
-        case TEXTRENDITIONLIST_line_through: value = "line-through"; break;
-        case TEXTRENDITIONLIST_none: value = "none"; break;
-        case TEXTRENDITIONLIST_overline: value = "overline"; break;
-        case TEXTRENDITIONLIST_overstrike: value = "overstrike"; break;
-        case TEXTRENDITIONLIST_strike: value = "strike"; break;
-        case TEXTRENDITIONLIST_sub: value = "sub"; break;
-        case TEXTRENDITIONLIST_sup: value = "sup"; break;
-        case TEXTRENDITIONLIST_underline: value = "underline"; break;
-        case TEXTRENDITIONLIST_ltr: value = "ltr"; break;
-        case TEXTRENDITIONLIST_rtl: value = "rtl"; break;
-        case TEXTRENDITIONLIST_lro: value = "lro"; break;
-        case TEXTRENDITIONLIST_rlo: value = "rlo"; break;
+const std::string &AttConverter::TextrenditionlistToStr(data_TEXTRENDITIONLIST data) const
+{
+    static const std::string values[] = {
+        "", "italic", "oblique", "smcaps", "bold", "bolder", "lighter", "box", "circle", "dbox", "tbox", "bslash",
+        "fslash", "line-through", "none", "overline", "overstrike", "strike", "sub", "sup", "underline", "ltr", "rtl",
+        "lro", "rlo"
+    };
+    switch (data) {
+        case TEXTRENDITIONLIST_italic: return values[1];
+        case TEXTRENDITIONLIST_oblique: return values[2];
+        case TEXTRENDITIONLIST_smcaps: return values[3];
+        case TEXTRENDITIONLIST_bold: return values[4];
+        case TEXTRENDITIONLIST_bolder: return values[5];
+        case TEXTRENDITIONLIST_lighter: return values[6];
+        case TEXTRENDITIONLIST_box: return values[7];
+        case TEXTRENDITIONLIST_circle: return values[8];
+        case TEXTRENDITIONLIST_dbox: return values[9];
+        case TEXTRENDITIONLIST_tbox: return values[10];
+        case TEXTRENDITIONLIST_bslash: return values[11];
+        case TEXTRENDITIONLIST_fslash: return values[12];
+        case TEXTRENDITIONLIST_line_through: return values[13];
+        case TEXTRENDITIONLIST_none: return values[14];
+        case TEXTRENDITIONLIST_overline: return values[15];
+        case TEXTRENDITIONLIST_overstrike: return values[16];
+        case TEXTRENDITIONLIST_strike: return values[17];
+        case TEXTRENDITIONLIST_sub: return values[18];
+        case TEXTRENDITIONLIST_sup: return values[19];
+        case TEXTRENDITIONLIST_underline: return values[20];
+        case TEXTRENDITIONLIST_ltr: return values[21];
+        case TEXTRENDITIONLIST_rtl: return values[22];
+        case TEXTRENDITIONLIST_lro: return values[23];
+        case TEXTRENDITIONLIST_rlo: return values[24];
         default:
             LogWarning("Unknown value '%d' for data.TEXTRENDITIONLIST", data);
-            value = "";
-            break;
-    }
-    return value;
-}
-
-data_TEXTRENDITIONLIST AttConverter::StrToTextrenditionlist(std::string value) const
-{
-    if (value == "italic") return TEXTRENDITIONLIST_italic;
-    if (value == "oblique") return TEXTRENDITIONLIST_oblique;
-    if (value == "smcaps") return TEXTRENDITIONLIST_smcaps;
-    if (value == "bold") return TEXTRENDITIONLIST_bold;
-    if (value == "bolder") return TEXTRENDITIONLIST_bolder;
-    if (value == "lighter") return TEXTRENDITIONLIST_lighter;
-    if (value == "box") return TEXTRENDITIONLIST_box;
-    if (value == "circle") return TEXTRENDITIONLIST_circle;
-    if (value == "dbox") return TEXTRENDITIONLIST_dbox;
-    if (value == "tbox") return TEXTRENDITIONLIST_tbox;
-    if (value == "bslash") return TEXTRENDITIONLIST_bslash;
-    if (value == "fslash") return TEXTRENDITIONLIST_fslash;
-    if (value == "line-through") return TEXTRENDITIONLIST_line_through;
-    if (value == "none") return TEXTRENDITIONLIST_none;
-    if (value == "overline") return TEXTRENDITIONLIST_overline;
-    if (value == "overstrike") return TEXTRENDITIONLIST_overstrike;
-    if (value == "strike") return TEXTRENDITIONLIST_strike;
-    if (value == "sub") return TEXTRENDITIONLIST_sub;
-    if (value == "sup") return TEXTRENDITIONLIST_sup;
-    if (value == "underline") return TEXTRENDITIONLIST_underline;
-    if (value == "ltr") return TEXTRENDITIONLIST_ltr;
-    if (value == "rtl") return TEXTRENDITIONLIST_rtl;
-    if (value == "lro") return TEXTRENDITIONLIST_lro;
-    if (value == "rlo") return TEXTRENDITIONLIST_rlo;
-    LogWarning("Unsupported value '%s' for data.TEXTRENDITIONLIST", value.c_str());
+            return values[0];
+    }
+}
+
+data_TEXTRENDITIONLIST AttConverter::StrToTextrenditionlist(const char *value) const
+{
+    switch (strlen(value)) {
+        case 3:
+            switch (value[0]) {
+                case 'b':
+                    if (!memcmp(value, "box", 3)) return TEXTRENDITIONLIST_box;
+                    break;
+                case 's':
+                    if (!memcmp(value, "sub", 3)) return TEXTRENDITIONLIST_sub;
+                    if (!memcmp(value, "sup", 3)) return TEXTRENDITIONLIST_sup;
+                    break;
+                case 'l':
+                    if (!memcmp(value, "ltr", 3)) return TEXTRENDITIONLIST_ltr;
+                    if (!memcmp(value, "lro", 3)) return TEXTRENDITIONLIST_lro;
+                    break;
+                case 'r':
+                    if (!memcmp(value, "rtl", 3)) return TEXTRENDITIONLIST_rtl;
+                    if (!memcmp(value, "rlo", 3)) return TEXTRENDITIONLIST_rlo;
+                    break;
+            }
+            break;
+        case 4:
+            switch (value[0]) {
+                case 'b':
+                    if (!memcmp(value, "bold", 4)) return TEXTRENDITIONLIST_bold;
+                    break;
+                case 'd':
+                    if (!memcmp(value, "dbox", 4)) return TEXTRENDITIONLIST_dbox;
+                    break;
+                case 't':
+                    if (!memcmp(value, "tbox", 4)) return TEXTRENDITIONLIST_tbox;
+                    break;
+                case 'n':
+                    if (!memcmp(value, "none", 4)) return TEXTRENDITIONLIST_none;
+                    break;
+            }
+            break;
+        case 6:
+            switch (value[0]) {
+                case 'i':
+                    if (!memcmp(value, "italic", 6)) return TEXTRENDITIONLIST_italic;
+                    break;
+                case 's':
+                    if (!memcmp(value, "smcaps", 6)) return TEXTRENDITIONLIST_smcaps;
+                    if (!memcmp(value, "strike", 6)) return TEXTRENDITIONLIST_strike;
+                    break;
+                case 'b':
+                    if (!memcmp(value, "bolder", 6)) return TEXTRENDITIONLIST_bolder;
+                    if (!memcmp(value, "bslash", 6)) return TEXTRENDITIONLIST_bslash;
+                    break;
+                case 'c':
+                    if (!memcmp(value, "circle", 6)) return TEXTRENDITIONLIST_circle;
+                    break;
+                case 'f':
+                    if (!memcmp(value, "fslash", 6)) return TEXTRENDITIONLIST_fslash;
+                    break;
+            }
+            break;
+        case 7:
+            switch (value[0]) {
+                case 'o':
+                    if (!memcmp(value, "oblique", 7)) return TEXTRENDITIONLIST_oblique;
+                    break;
+                case 'l':
+                    if (!memcmp(value, "lighter", 7)) return TEXTRENDITIONLIST_lighter;
+                    break;
+            }
+            break;
+        case 8:
+            if (!memcmp(value, "overline", 8)) return TEXTRENDITIONLIST_overline;
+            break;
+        case 9:
+            if (!memcmp(value, "underline", 9)) return TEXTRENDITIONLIST_underline;
+            break;
+        case 10:
+            if (!memcmp(value, "overstrike", 10)) return TEXTRENDITIONLIST_overstrike;
+            break;
+        case 12:
+            if (!memcmp(value, "line-through", 12)) return TEXTRENDITIONLIST_line_through;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.TEXTRENDITIONLIST", value);
     return TEXTRENDITIONLIST_NONE;
 }
 
-std::string AttConverter::UneumeformToStr(data_UNEUMEFORM data) const
+const std::string &AttConverter::UneumeformToStr(data_UNEUMEFORM data) const
 {
-    std::string value;
+    static const std::string values[] = {
+        "", "liquescent1", "liquescent2", "liquescent3", "quilismatic", "rectangular", "rhombic", "tied"
+    };
     switch (data) {
-        case UNEUMEFORM_liquescent1: value = "liquescent1"; break;
-        case UNEUMEFORM_liquescent2: value = "liquescent2"; break;
-        case UNEUMEFORM_liquescent3: value = "liquescent3"; break;
-        case UNEUMEFORM_quilismatic: value = "quilismatic"; break;
-        case UNEUMEFORM_rectangular: value = "rectangular"; break;
-        case UNEUMEFORM_rhombic: value = "rhombic"; break;
-        case UNEUMEFORM_tied: value = "tied"; break;
+        case UNEUMEFORM_liquescent1: return values[1];
+        case UNEUMEFORM_liquescent2: return values[2];
+        case UNEUMEFORM_liquescent3: return values[3];
+        case UNEUMEFORM_quilismatic: return values[4];
+        case UNEUMEFORM_rectangular: return values[5];
+        case UNEUMEFORM_rhombic: return values[6];
+        case UNEUMEFORM_tied: return values[7];
         default:
             LogWarning("Unknown value '%d' for data.UNEUMEFORM", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_UNEUMEFORM AttConverter::StrToUneumeform(std::string value) const
+data_UNEUMEFORM AttConverter::StrToUneumeform(const char *value) const
 {
-    if (value == "liquescent1") return UNEUMEFORM_liquescent1;
-    if (value == "liquescent2") return UNEUMEFORM_liquescent2;
-    if (value == "liquescent3") return UNEUMEFORM_liquescent3;
-    if (value == "quilismatic") return UNEUMEFORM_quilismatic;
-    if (value == "rectangular") return UNEUMEFORM_rectangular;
-    if (value == "rhombic") return UNEUMEFORM_rhombic;
-    if (value == "tied") return UNEUMEFORM_tied;
-    LogWarning("Unsupported value '%s' for data.UNEUMEFORM", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            if (!memcmp(value, "tied", 4)) return UNEUMEFORM_tied;
+            break;
+        case 7:
+            if (!memcmp(value, "rhombic", 7)) return UNEUMEFORM_rhombic;
+            break;
+        case 11:
+            switch (value[0]) {
+                case 'l':
+                    if (!memcmp(value, "liquescent1", 11)) return UNEUMEFORM_liquescent1;
+                    if (!memcmp(value, "liquescent2", 11)) return UNEUMEFORM_liquescent2;
+                    if (!memcmp(value, "liquescent3", 11)) return UNEUMEFORM_liquescent3;
+                    break;
+                case 'q':
+                    if (!memcmp(value, "quilismatic", 11)) return UNEUMEFORM_quilismatic;
+                    break;
+                case 'r':
+                    if (!memcmp(value, "rectangular", 11)) return UNEUMEFORM_rectangular;
+                    break;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.UNEUMEFORM", value);
     return UNEUMEFORM_NONE;
 }
 
-std::string AttConverter::UneumenameToStr(data_UNEUMENAME data) const
+const std::string &AttConverter::UneumenameToStr(data_UNEUMENAME data) const
 {
-    std::string value;
+    static const std::string values[] = {
+        "", "punctum", "virga", "pes", "clivis", "torculus", "torculusresupinus", "porrectus", "porrectusflexus",
+        "apostropha", "oriscus", "pressusmaior", "pressusminor", "virgastrata"
+    };
     switch (data) {
-        case UNEUMENAME_punctum: value = "punctum"; break;
-        case UNEUMENAME_virga: value = "virga"; break;
-        case UNEUMENAME_pes: value = "pes"; break;
-        case UNEUMENAME_clivis: value = "clivis"; break;
-        case UNEUMENAME_torculus: value = "torculus"; break;
-        case UNEUMENAME_torculusresupinus: value = "torculusresupinus"; break;
-        case UNEUMENAME_porrectus: value = "porrectus"; break;
-        case UNEUMENAME_porrectusflexus: value = "porrectusflexus"; break;
-        case UNEUMENAME_apostropha: value = "apostropha"; break;
-        case UNEUMENAME_oriscus: value = "oriscus"; break;
-        case UNEUMENAME_pressusmaior: value = "pressusmaior"; break;
-        case UNEUMENAME_pressusminor: value = "pressusminor"; break;
-        case UNEUMENAME_virgastrata: value = "virgastrata"; break;
+        case UNEUMENAME_punctum: return values[1];
+        case UNEUMENAME_virga: return values[2];
+        case UNEUMENAME_pes: return values[3];
+        case UNEUMENAME_clivis: return values[4];
+        case UNEUMENAME_torculus: return values[5];
+        case UNEUMENAME_torculusresupinus: return values[6];
+        case UNEUMENAME_porrectus: return values[7];
+        case UNEUMENAME_porrectusflexus: return values[8];
+        case UNEUMENAME_apostropha: return values[9];
+        case UNEUMENAME_oriscus: return values[10];
+        case UNEUMENAME_pressusmaior: return values[11];
+        case UNEUMENAME_pressusminor: return values[12];
+        case UNEUMENAME_virgastrata: return values[13];
         default:
             LogWarning("Unknown value '%d' for data.UNEUMENAME", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-data_UNEUMENAME AttConverter::StrToUneumename(std::string value) const
+data_UNEUMENAME AttConverter::StrToUneumename(const char *value) const
 {
-    if (value == "punctum") return UNEUMENAME_punctum;
-    if (value == "virga") return UNEUMENAME_virga;
-    if (value == "pes") return UNEUMENAME_pes;
-    if (value == "clivis") return UNEUMENAME_clivis;
-    if (value == "torculus") return UNEUMENAME_torculus;
-    if (value == "torculusresupinus") return UNEUMENAME_torculusresupinus;
-    if (value == "porrectus") return UNEUMENAME_porrectus;
-    if (value == "porrectusflexus") return UNEUMENAME_porrectusflexus;
-    if (value == "apostropha") return UNEUMENAME_apostropha;
-    if (value == "oriscus") return UNEUMENAME_oriscus;
-    if (value == "pressusmaior") return UNEUMENAME_pressusmaior;
-    if (value == "pressusminor") return UNEUMENAME_pressusminor;
-    if (value == "virgastrata") return UNEUMENAME_virgastrata;
-    LogWarning("Unsupported value '%s' for data.UNEUMENAME", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            if (!memcmp(value, "pes", 3)) return UNEUMENAME_pes;
+            break;
+        case 5:
+            if (!memcmp(value, "virga", 5)) return UNEUMENAME_virga;
+            break;
+        case 6:
+            if (!memcmp(value, "clivis", 6)) return UNEUMENAME_clivis;
+            break;
+        case 7:
+            switch (value[0]) {
+                case 'p':
+                    if (!memcmp(value, "punctum", 7)) return UNEUMENAME_punctum;
+                    break;
+                case 'o':
+                    if (!memcmp(value, "oriscus", 7)) return UNEUMENAME_oriscus;
+                    break;
+            }
+            break;
+        case 8:
+            if (!memcmp(value, "torculus", 8)) return UNEUMENAME_torculus;
+            break;
+        case 9:
+            if (!memcmp(value, "porrectus", 9)) return UNEUMENAME_porrectus;
+            break;
+        case 10:
+            if (!memcmp(value, "apostropha", 10)) return UNEUMENAME_apostropha;
+            break;
+        case 11:
+            if (!memcmp(value, "virgastrata", 11)) return UNEUMENAME_virgastrata;
+            break;
+        case 12:
+            if (!memcmp(value, "pressusmaior", 12)) return UNEUMENAME_pressusmaior;
+            if (!memcmp(value, "pressusminor", 12)) return UNEUMENAME_pressusminor;
+            break;
+        case 15:
+            if (!memcmp(value, "porrectusflexus", 15)) return UNEUMENAME_porrectusflexus;
+            break;
+        case 17:
+            if (!memcmp(value, "torculusresupinus", 17)) return UNEUMENAME_torculusresupinus;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for data.UNEUMENAME", value);
     return UNEUMENAME_NONE;
 }
 
-std::string AttConverter::AccidLogFuncToStr(accidLog_FUNC data) const
+const std::string &AttConverter::AccidLogFuncToStr(accidLog_FUNC data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "caution", "edit" };
     switch (data) {
-        case accidLog_FUNC_caution: value = "caution"; break;
-        case accidLog_FUNC_edit: value = "edit"; break;
+        case accidLog_FUNC_caution: return values[1];
+        case accidLog_FUNC_edit: return values[2];
         default:
             LogWarning("Unknown value '%d' for att.accid.log@func", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-accidLog_FUNC AttConverter::StrToAccidLogFunc(std::string value) const
+accidLog_FUNC AttConverter::StrToAccidLogFunc(const char *value) const
 {
-    if (value == "caution") return accidLog_FUNC_caution;
-    if (value == "edit") return accidLog_FUNC_edit;
-    LogWarning("Unsupported value '%s' for att.accid.log@func", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            if (!memcmp(value, "edit", 4)) return accidLog_FUNC_edit;
+            break;
+        case 7:
+            if (!memcmp(value, "caution", 7)) return accidLog_FUNC_caution;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.accid.log@func", value);
     return accidLog_FUNC_NONE;
 }
 
-std::string AttConverter::ArpegLogOrderToStr(arpegLog_ORDER data) const
+const std::string &AttConverter::ArpegLogOrderToStr(arpegLog_ORDER data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "up", "down", "nonarp" };
     switch (data) {
-        case arpegLog_ORDER_up: value = "up"; break;
-        case arpegLog_ORDER_down: value = "down"; break;
-        case arpegLog_ORDER_nonarp: value = "nonarp"; break;
+        case arpegLog_ORDER_up: return values[1];
+        case arpegLog_ORDER_down: return values[2];
+        case arpegLog_ORDER_nonarp: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.arpeg.log@order", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-arpegLog_ORDER AttConverter::StrToArpegLogOrder(std::string value) const
+arpegLog_ORDER AttConverter::StrToArpegLogOrder(const char *value) const
 {
-    if (value == "up") return arpegLog_ORDER_up;
-    if (value == "down") return arpegLog_ORDER_down;
-    if (value == "nonarp") return arpegLog_ORDER_nonarp;
-    LogWarning("Unsupported value '%s' for att.arpeg.log@order", value.c_str());
+    switch (strlen(value)) {
+        case 2:
+            if (!memcmp(value, "up", 2)) return arpegLog_ORDER_up;
+            break;
+        case 4:
+            if (!memcmp(value, "down", 4)) return arpegLog_ORDER_down;
+            break;
+        case 6:
+            if (!memcmp(value, "nonarp", 6)) return arpegLog_ORDER_nonarp;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.arpeg.log@order", value);
     return arpegLog_ORDER_NONE;
 }
 
-std::string AttConverter::BTremLogFormToStr(bTremLog_FORM data) const
+const std::string &AttConverter::BTremLogFormToStr(bTremLog_FORM data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "meas", "unmeas" };
     switch (data) {
-        case bTremLog_FORM_meas: value = "meas"; break;
-        case bTremLog_FORM_unmeas: value = "unmeas"; break;
+        case bTremLog_FORM_meas: return values[1];
+        case bTremLog_FORM_unmeas: return values[2];
         default:
             LogWarning("Unknown value '%d' for att.bTrem.log@form", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-bTremLog_FORM AttConverter::StrToBTremLogForm(std::string value) const
+bTremLog_FORM AttConverter::StrToBTremLogForm(const char *value) const
 {
-    if (value == "meas") return bTremLog_FORM_meas;
-    if (value == "unmeas") return bTremLog_FORM_unmeas;
-    LogWarning("Unsupported value '%s' for att.bTrem.log@form", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            if (!memcmp(value, "meas", 4)) return bTremLog_FORM_meas;
+            break;
+        case 6:
+            if (!memcmp(value, "unmeas", 6)) return bTremLog_FORM_unmeas;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.bTrem.log@form", value);
     return bTremLog_FORM_NONE;
 }
 
-std::string AttConverter::BeamingVisBeamrendToStr(beamingVis_BEAMREND data) const
+const std::string &AttConverter::BeamingVisBeamrendToStr(beamingVis_BEAMREND data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "acc", "rit", "norm" };
     switch (data) {
-        case beamingVis_BEAMREND_acc: value = "acc"; break;
-        case beamingVis_BEAMREND_rit: value = "rit"; break;
-        case beamingVis_BEAMREND_norm: value = "norm"; break;
+        case beamingVis_BEAMREND_acc: return values[1];
+        case beamingVis_BEAMREND_rit: return values[2];
+        case beamingVis_BEAMREND_norm: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.beaming.vis@beam.rend", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-beamingVis_BEAMREND AttConverter::StrToBeamingVisBeamrend(std::string value) const
+beamingVis_BEAMREND AttConverter::StrToBeamingVisBeamrend(const char *value) const
 {
-    if (value == "acc") return beamingVis_BEAMREND_acc;
-    if (value == "rit") return beamingVis_BEAMREND_rit;
-    if (value == "norm") return beamingVis_BEAMREND_norm;
-    LogWarning("Unsupported value '%s' for att.beaming.vis@beam.rend", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            switch (value[0]) {
+                case 'a':
+                    if (!memcmp(value, "acc", 3)) return beamingVis_BEAMREND_acc;
+                    break;
+                case 'r':
+                    if (!memcmp(value, "rit", 3)) return beamingVis_BEAMREND_rit;
+                    break;
+            }
+            break;
+        case 4:
+            if (!memcmp(value, "norm", 4)) return beamingVis_BEAMREND_norm;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.beaming.vis@beam.rend", value);
     return beamingVis_BEAMREND_NONE;
 }
 
-std::string AttConverter::BeamrendFormToStr(beamrend_FORM data) const
+const std::string &AttConverter::BeamrendFormToStr(beamrend_FORM data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "acc", "mixed", "rit", "norm" };
     switch (data) {
-        case beamrend_FORM_acc: value = "acc"; break;
-        case beamrend_FORM_mixed: value = "mixed"; break;
-        case beamrend_FORM_rit: value = "rit"; break;
-        case beamrend_FORM_norm: value = "norm"; break;
+        case beamrend_FORM_acc: return values[1];
+        case beamrend_FORM_mixed: return values[2];
+        case beamrend_FORM_rit: return values[3];
+        case beamrend_FORM_norm: return values[4];
         default:
             LogWarning("Unknown value '%d' for att.beamrend@form", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-beamrend_FORM AttConverter::StrToBeamrendForm(std::string value) const
+beamrend_FORM AttConverter::StrToBeamrendForm(const char *value) const
 {
-    if (value == "acc") return beamrend_FORM_acc;
-    if (value == "mixed") return beamrend_FORM_mixed;
-    if (value == "rit") return beamrend_FORM_rit;
-    if (value == "norm") return beamrend_FORM_norm;
-    LogWarning("Unsupported value '%s' for att.beamrend@form", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            switch (value[0]) {
+                case 'a':
+                    if (!memcmp(value, "acc", 3)) return beamrend_FORM_acc;
+                    break;
+                case 'r':
+                    if (!memcmp(value, "rit", 3)) return beamrend_FORM_rit;
+                    break;
+            }
+            break;
+        case 4:
+            if (!memcmp(value, "norm", 4)) return beamrend_FORM_norm;
+            break;
+        case 5:
+            if (!memcmp(value, "mixed", 5)) return beamrend_FORM_mixed;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.beamrend@form", value);
     return beamrend_FORM_NONE;
 }
 
-std::string AttConverter::CurvatureCurvedirToStr(curvature_CURVEDIR data) const
+const std::string &AttConverter::CurvatureCurvedirToStr(curvature_CURVEDIR data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "above", "below", "mixed" };
     switch (data) {
-        case curvature_CURVEDIR_above: value = "above"; break;
-        case curvature_CURVEDIR_below: value = "below"; break;
-        case curvature_CURVEDIR_mixed: value = "mixed"; break;
+        case curvature_CURVEDIR_above: return values[1];
+        case curvature_CURVEDIR_below: return values[2];
+        case curvature_CURVEDIR_mixed: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.curvature@curvedir", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-curvature_CURVEDIR AttConverter::StrToCurvatureCurvedir(std::string value) const
-{
-    if (value == "above") return curvature_CURVEDIR_above;
-    if (value == "below") return curvature_CURVEDIR_below;
-    if (value == "mixed") return curvature_CURVEDIR_mixed;
-    LogWarning("Unsupported value '%s' for att.curvature@curvedir", value.c_str());
+curvature_CURVEDIR AttConverter::StrToCurvatureCurvedir(const char *value) const
+{
+    switch (strlen(value)) {
+        case 5:
+            switch (value[0]) {
+                case 'a':
+                    if (!memcmp(value, "above", 5)) return curvature_CURVEDIR_above;
+                    break;
+                case 'b':
+                    if (!memcmp(value, "below", 5)) return curvature_CURVEDIR_below;
+                    break;
+                case 'm':
+                    if (!memcmp(value, "mixed", 5)) return curvature_CURVEDIR_mixed;
+                    break;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.curvature@curvedir", value);
     return curvature_CURVEDIR_NONE;
 }
 
-std::string AttConverter::CutoutCutoutToStr(cutout_CUTOUT data) const
+const std::string &AttConverter::CutoutCutoutToStr(cutout_CUTOUT data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "cutout" };
     switch (data) {
-        case cutout_CUTOUT_cutout: value = "cutout"; break;
+        case cutout_CUTOUT_cutout: return values[1];
         default:
             LogWarning("Unknown value '%d' for att.cutout@cutout", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-cutout_CUTOUT AttConverter::StrToCutoutCutout(std::string value) const
+cutout_CUTOUT AttConverter::StrToCutoutCutout(const char *value) const
 {
-    if (value == "cutout") return cutout_CUTOUT_cutout;
-    LogWarning("Unsupported value '%s' for att.cutout@cutout", value.c_str());
+    switch (strlen(value)) {
+        case 6:
+            if (!memcmp(value, "cutout", 6)) return cutout_CUTOUT_cutout;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.cutout@cutout", value);
     return cutout_CUTOUT_NONE;
 }
 
-std::string AttConverter::DotLogFormToStr(dotLog_FORM data) const
+const std::string &AttConverter::DotLogFormToStr(dotLog_FORM data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "aug", "div" };
     switch (data) {
-        case dotLog_FORM_aug: value = "aug"; break;
-        case dotLog_FORM_div: value = "div"; break;
+        case dotLog_FORM_aug: return values[1];
+        case dotLog_FORM_div: return values[2];
         default:
             LogWarning("Unknown value '%d' for att.dot.log@form", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-dotLog_FORM AttConverter::StrToDotLogForm(std::string value) const
+dotLog_FORM AttConverter::StrToDotLogForm(const char *value) const
 {
-    if (value == "aug") return dotLog_FORM_aug;
-    if (value == "div") return dotLog_FORM_div;
-    LogWarning("Unsupported value '%s' for att.dot.log@form", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            switch (value[0]) {
+                case 'a':
+                    if (!memcmp(value, "aug", 3)) return dotLog_FORM_aug;
+                    break;
+                case 'd':
+                    if (!memcmp(value, "div", 3)) return dotLog_FORM_div;
+                    break;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.dot.log@form", value);
     return dotLog_FORM_NONE;
 }
 
-std::string AttConverter::EndingsEndingrendToStr(endings_ENDINGREND data) const
+const std::string &AttConverter::EndingsEndingrendToStr(endings_ENDINGREND data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "top", "barred", "grouped" };
     switch (data) {
-        case endings_ENDINGREND_top: value = "top"; break;
-        case endings_ENDINGREND_barred: value = "barred"; break;
-        case endings_ENDINGREND_grouped: value = "grouped"; break;
+        case endings_ENDINGREND_top: return values[1];
+        case endings_ENDINGREND_barred: return values[2];
+        case endings_ENDINGREND_grouped: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.endings@ending.rend", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-endings_ENDINGREND AttConverter::StrToEndingsEndingrend(std::string value) const
+endings_ENDINGREND AttConverter::StrToEndingsEndingrend(const char *value) const
 {
-    if (value == "top") return endings_ENDINGREND_top;
-    if (value == "barred") return endings_ENDINGREND_barred;
-    if (value == "grouped") return endings_ENDINGREND_grouped;
-    LogWarning("Unsupported value '%s' for att.endings@ending.rend", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            if (!memcmp(value, "top", 3)) return endings_ENDINGREND_top;
+            break;
+        case 6:
+            if (!memcmp(value, "barred", 6)) return endings_ENDINGREND_barred;
+            break;
+        case 7:
+            if (!memcmp(value, "grouped", 7)) return endings_ENDINGREND_grouped;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.endings@ending.rend", value);
     return endings_ENDINGREND_NONE;
 }
 
-std::string AttConverter::FTremLogFormToStr(fTremLog_FORM data) const
+const std::string &AttConverter::FTremLogFormToStr(fTremLog_FORM data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "meas", "unmeas" };
     switch (data) {
-        case fTremLog_FORM_meas: value = "meas"; break;
-        case fTremLog_FORM_unmeas: value = "unmeas"; break;
+        case fTremLog_FORM_meas: return values[1];
+        case fTremLog_FORM_unmeas: return values[2];
         default:
             LogWarning("Unknown value '%d' for att.fTrem.log@form", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-fTremLog_FORM AttConverter::StrToFTremLogForm(std::string value) const
+fTremLog_FORM AttConverter::StrToFTremLogForm(const char *value) const
 {
-    if (value == "meas") return fTremLog_FORM_meas;
-    if (value == "unmeas") return fTremLog_FORM_unmeas;
-    LogWarning("Unsupported value '%s' for att.fTrem.log@form", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            if (!memcmp(value, "meas", 4)) return fTremLog_FORM_meas;
+            break;
+        case 6:
+            if (!memcmp(value, "unmeas", 6)) return fTremLog_FORM_unmeas;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.fTrem.log@form", value);
     return fTremLog_FORM_NONE;
 }
 
-std::string AttConverter::FermataVisFormToStr(fermataVis_FORM data) const
+const std::string &AttConverter::FermataVisFormToStr(fermataVis_FORM data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "inv", "norm" };
     switch (data) {
-        case fermataVis_FORM_inv: value = "inv"; break;
-        case fermataVis_FORM_norm: value = "norm"; break;
+        case fermataVis_FORM_inv: return values[1];
+        case fermataVis_FORM_norm: return values[2];
         default:
             LogWarning("Unknown value '%d' for att.fermata.vis@form", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-fermataVis_FORM AttConverter::StrToFermataVisForm(std::string value) const
+fermataVis_FORM AttConverter::StrToFermataVisForm(const char *value) const
 {
-    if (value == "inv") return fermataVis_FORM_inv;
-    if (value == "norm") return fermataVis_FORM_norm;
-    LogWarning("Unsupported value '%s' for att.fermata.vis@form", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            if (!memcmp(value, "inv", 3)) return fermataVis_FORM_inv;
+            break;
+        case 4:
+            if (!memcmp(value, "norm", 4)) return fermataVis_FORM_norm;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.fermata.vis@form", value);
     return fermataVis_FORM_NONE;
 }
 
-std::string AttConverter::FermataVisShapeToStr(fermataVis_SHAPE data) const
+const std::string &AttConverter::FermataVisShapeToStr(fermataVis_SHAPE data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "curved", "square", "angular" };
     switch (data) {
-        case fermataVis_SHAPE_curved: value = "curved"; break;
-        case fermataVis_SHAPE_square: value = "square"; break;
-        case fermataVis_SHAPE_angular: value = "angular"; break;
+        case fermataVis_SHAPE_curved: return values[1];
+        case fermataVis_SHAPE_square: return values[2];
+        case fermataVis_SHAPE_angular: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.fermata.vis@shape", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-fermataVis_SHAPE AttConverter::StrToFermataVisShape(std::string value) const
+fermataVis_SHAPE AttConverter::StrToFermataVisShape(const char *value) const
 {
-    if (value == "curved") return fermataVis_SHAPE_curved;
-    if (value == "square") return fermataVis_SHAPE_square;
-    if (value == "angular") return fermataVis_SHAPE_angular;
-    LogWarning("Unsupported value '%s' for att.fermata.vis@shape", value.c_str());
+    switch (strlen(value)) {
+        case 6:
+            switch (value[0]) {
+                case 'c':
+                    if (!memcmp(value, "curved", 6)) return fermataVis_SHAPE_curved;
+                    break;
+                case 's':
+                    if (!memcmp(value, "square", 6)) return fermataVis_SHAPE_square;
+                    break;
+            }
+            break;
+        case 7:
+            if (!memcmp(value, "angular", 7)) return fermataVis_SHAPE_angular;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.fermata.vis@shape", value);
     return fermataVis_SHAPE_NONE;
 }
 
-std::string AttConverter::HairpinLogFormToStr(hairpinLog_FORM data) const
+const std::string &AttConverter::HairpinLogFormToStr(hairpinLog_FORM data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "cres", "dim" };
     switch (data) {
-        case hairpinLog_FORM_cres: value = "cres"; break;
-        case hairpinLog_FORM_dim: value = "dim"; break;
+        case hairpinLog_FORM_cres: return values[1];
+        case hairpinLog_FORM_dim: return values[2];
         default:
             LogWarning("Unknown value '%d' for att.hairpin.log@form", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-hairpinLog_FORM AttConverter::StrToHairpinLogForm(std::string value) const
+hairpinLog_FORM AttConverter::StrToHairpinLogForm(const char *value) const
 {
-    if (value == "cres") return hairpinLog_FORM_cres;
-    if (value == "dim") return hairpinLog_FORM_dim;
-    LogWarning("Unsupported value '%s' for att.hairpin.log@form", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            if (!memcmp(value, "dim", 3)) return hairpinLog_FORM_dim;
+            break;
+        case 4:
+            if (!memcmp(value, "cres", 4)) return hairpinLog_FORM_cres;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.hairpin.log@form", value);
     return hairpinLog_FORM_NONE;
 }
 
-std::string AttConverter::HarmVisRendgridToStr(harmVis_RENDGRID data) const
+const std::string &AttConverter::HarmVisRendgridToStr(harmVis_RENDGRID data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "grid", "gridtext", "text" };
     switch (data) {
-        case harmVis_RENDGRID_grid: value = "grid"; break;
-        case harmVis_RENDGRID_gridtext: value = "gridtext"; break;
-        case harmVis_RENDGRID_text: value = "text"; break;
+        case harmVis_RENDGRID_grid: return values[1];
+        case harmVis_RENDGRID_gridtext: return values[2];
+        case harmVis_RENDGRID_text: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.harm.vis@rendgrid", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-harmVis_RENDGRID AttConverter::StrToHarmVisRendgrid(std::string value) const
+harmVis_RENDGRID AttConverter::StrToHarmVisRendgrid(const char *value) const
 {
-    if (value == "grid") return harmVis_RENDGRID_grid;
-    if (value == "gridtext") return harmVis_RENDGRID_gridtext;
-    if (value == "text") return harmVis_RENDGRID_text;
-    LogWarning("Unsupported value '%s' for att.harm.vis@rendgrid", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            switch (value[0]) {
+                case 'g':
+                    if (!memcmp(value, "grid", 4)) return harmVis_RENDGRID_grid;
+                    break;
+                case 't':
+                    if (!memcmp(value, "text", 4)) return harmVis_RENDGRID_text;
+                    break;
+            }
+            break;
+        case 8:
+            if (!memcmp(value, "gridtext", 8)) return harmVis_RENDGRID_gridtext;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.harm.vis@rendgrid", value);
     return harmVis_RENDGRID_NONE;
 }
 
-std::string AttConverter::HarpPedalLogAToStr(harpPedalLog_A data) const
+const std::string &AttConverter::HarpPedalLogAToStr(harpPedalLog_A data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "f", "n", "s" };
     switch (data) {
-        case harpPedalLog_A_f: value = "f"; break;
-        case harpPedalLog_A_n: value = "n"; break;
-        case harpPedalLog_A_s: value = "s"; break;
+        case harpPedalLog_A_f: return values[1];
+        case harpPedalLog_A_n: return values[2];
+        case harpPedalLog_A_s: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.harpPedal.log@a", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-harpPedalLog_A AttConverter::StrToHarpPedalLogA(std::string value) const
+harpPedalLog_A AttConverter::StrToHarpPedalLogA(const char *value) const
 {
-    if (value == "f") return harpPedalLog_A_f;
-    if (value == "n") return harpPedalLog_A_n;
-    if (value == "s") return harpPedalLog_A_s;
-    LogWarning("Unsupported value '%s' for att.harpPedal.log@a", value.c_str());
+    switch (strlen(value)) {
+        case 1:
+            switch (value[0]) {
+                case 'f':
+                    return harpPedalLog_A_f;
+                case 'n':
+                    return harpPedalLog_A_n;
+                case 's':
+                    return harpPedalLog_A_s;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.harpPedal.log@a", value);
     return harpPedalLog_A_NONE;
 }
 
-std::string AttConverter::HarpPedalLogBToStr(harpPedalLog_B data) const
+const std::string &AttConverter::HarpPedalLogBToStr(harpPedalLog_B data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "f", "n", "s" };
     switch (data) {
-        case harpPedalLog_B_f: value = "f"; break;
-        case harpPedalLog_B_n: value = "n"; break;
-        case harpPedalLog_B_s: value = "s"; break;
+        case harpPedalLog_B_f: return values[1];
+        case harpPedalLog_B_n: return values[2];
+        case harpPedalLog_B_s: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.harpPedal.log@b", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-harpPedalLog_B AttConverter::StrToHarpPedalLogB(std::string value) const
+harpPedalLog_B AttConverter::StrToHarpPedalLogB(const char *value) const
 {
-    if (value == "f") return harpPedalLog_B_f;
-    if (value == "n") return harpPedalLog_B_n;
-    if (value == "s") return harpPedalLog_B_s;
-    LogWarning("Unsupported value '%s' for att.harpPedal.log@b", value.c_str());
+    switch (strlen(value)) {
+        case 1:
+            switch (value[0]) {
+                case 'f':
+                    return harpPedalLog_B_f;
+                case 'n':
+                    return harpPedalLog_B_n;
+                case 's':
+                    return harpPedalLog_B_s;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.harpPedal.log@b", value);
     return harpPedalLog_B_NONE;
 }
 
-std::string AttConverter::HarpPedalLogCToStr(harpPedalLog_C data) const
+const std::string &AttConverter::HarpPedalLogCToStr(harpPedalLog_C data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "f", "n", "s" };
     switch (data) {
-        case harpPedalLog_C_f: value = "f"; break;
-        case harpPedalLog_C_n: value = "n"; break;
-        case harpPedalLog_C_s: value = "s"; break;
+        case harpPedalLog_C_f: return values[1];
+        case harpPedalLog_C_n: return values[2];
+        case harpPedalLog_C_s: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.harpPedal.log@c", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-harpPedalLog_C AttConverter::StrToHarpPedalLogC(std::string value) const
+harpPedalLog_C AttConverter::StrToHarpPedalLogC(const char *value) const
 {
-    if (value == "f") return harpPedalLog_C_f;
-    if (value == "n") return harpPedalLog_C_n;
-    if (value == "s") return harpPedalLog_C_s;
-    LogWarning("Unsupported value '%s' for att.harpPedal.log@c", value.c_str());
+    switch (strlen(value)) {
+        case 1:
+            switch (value[0]) {
+                case 'f':
+                    return harpPedalLog_C_f;
+                case 'n':
+                    return harpPedalLog_C_n;
+                case 's':
+                    return harpPedalLog_C_s;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.harpPedal.log@c", value);
     return harpPedalLog_C_NONE;
 }
 
-std::string AttConverter::HarpPedalLogDToStr(harpPedalLog_D data) const
+const std::string &AttConverter::HarpPedalLogDToStr(harpPedalLog_D data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "f", "n", "s" };
     switch (data) {
-        case harpPedalLog_D_f: value = "f"; break;
-        case harpPedalLog_D_n: value = "n"; break;
-        case harpPedalLog_D_s: value = "s"; break;
+        case harpPedalLog_D_f: return values[1];
+        case harpPedalLog_D_n: return values[2];
+        case harpPedalLog_D_s: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.harpPedal.log@d", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-harpPedalLog_D AttConverter::StrToHarpPedalLogD(std::string value) const
+harpPedalLog_D AttConverter::StrToHarpPedalLogD(const char *value) const
 {
-    if (value == "f") return harpPedalLog_D_f;
-    if (value == "n") return harpPedalLog_D_n;
-    if (value == "s") return harpPedalLog_D_s;
-    LogWarning("Unsupported value '%s' for att.harpPedal.log@d", value.c_str());
+    switch (strlen(value)) {
+        case 1:
+            switch (value[0]) {
+                case 'f':
+                    return harpPedalLog_D_f;
+                case 'n':
+                    return harpPedalLog_D_n;
+                case 's':
+                    return harpPedalLog_D_s;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.harpPedal.log@d", value);
     return harpPedalLog_D_NONE;
 }
 
-std::string AttConverter::HarpPedalLogEToStr(harpPedalLog_E data) const
+const std::string &AttConverter::HarpPedalLogEToStr(harpPedalLog_E data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "f", "n", "s" };
     switch (data) {
-        case harpPedalLog_E_f: value = "f"; break;
-        case harpPedalLog_E_n: value = "n"; break;
-        case harpPedalLog_E_s: value = "s"; break;
+        case harpPedalLog_E_f: return values[1];
+        case harpPedalLog_E_n: return values[2];
+        case harpPedalLog_E_s: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.harpPedal.log@e", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-harpPedalLog_E AttConverter::StrToHarpPedalLogE(std::string value) const
+harpPedalLog_E AttConverter::StrToHarpPedalLogE(const char *value) const
 {
-    if (value == "f") return harpPedalLog_E_f;
-    if (value == "n") return harpPedalLog_E_n;
-    if (value == "s") return harpPedalLog_E_s;
-    LogWarning("Unsupported value '%s' for att.harpPedal.log@e", value.c_str());
+    switch (strlen(value)) {
+        case 1:
+            switch (value[0]) {
+                case 'f':
+                    return harpPedalLog_E_f;
+                case 'n':
+                    return harpPedalLog_E_n;
+                case 's':
+                    return harpPedalLog_E_s;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.harpPedal.log@e", value);
     return harpPedalLog_E_NONE;
 }
 
-std::string AttConverter::HarpPedalLogFToStr(harpPedalLog_F data) const
+const std::string &AttConverter::HarpPedalLogFToStr(harpPedalLog_F data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "f", "n", "s" };
     switch (data) {
-        case harpPedalLog_F_f: value = "f"; break;
-        case harpPedalLog_F_n: value = "n"; break;
-        case harpPedalLog_F_s: value = "s"; break;
+        case harpPedalLog_F_f: return values[1];
+        case harpPedalLog_F_n: return values[2];
+        case harpPedalLog_F_s: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.harpPedal.log@f", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-harpPedalLog_F AttConverter::StrToHarpPedalLogF(std::string value) const
+harpPedalLog_F AttConverter::StrToHarpPedalLogF(const char *value) const
 {
-    if (value == "f") return harpPedalLog_F_f;
-    if (value == "n") return harpPedalLog_F_n;
-    if (value == "s") return harpPedalLog_F_s;
-    LogWarning("Unsupported value '%s' for att.harpPedal.log@f", value.c_str());
+    switch (strlen(value)) {
+        case 1:
+            switch (value[0]) {
+                case 'f':
+                    return harpPedalLog_F_f;
+                case 'n':
+                    return harpPedalLog_F_n;
+                case 's':
+                    return harpPedalLog_F_s;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.harpPedal.log@f", value);
     return harpPedalLog_F_NONE;
 }
 
-std::string AttConverter::HarpPedalLogGToStr(harpPedalLog_G data) const
+const std::string &AttConverter::HarpPedalLogGToStr(harpPedalLog_G data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "f", "n", "s" };
     switch (data) {
-        case harpPedalLog_G_f: value = "f"; break;
-        case harpPedalLog_G_n: value = "n"; break;
-        case harpPedalLog_G_s: value = "s"; break;
+        case harpPedalLog_G_f: return values[1];
+        case harpPedalLog_G_n: return values[2];
+        case harpPedalLog_G_s: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.harpPedal.log@g", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-harpPedalLog_G AttConverter::StrToHarpPedalLogG(std::string value) const
+harpPedalLog_G AttConverter::StrToHarpPedalLogG(const char *value) const
 {
-    if (value == "f") return harpPedalLog_G_f;
-    if (value == "n") return harpPedalLog_G_n;
-    if (value == "s") return harpPedalLog_G_s;
-    LogWarning("Unsupported value '%s' for att.harpPedal.log@g", value.c_str());
+    switch (strlen(value)) {
+        case 1:
+            switch (value[0]) {
+                case 'f':
+                    return harpPedalLog_G_f;
+                case 'n':
+                    return harpPedalLog_G_n;
+                case 's':
+                    return harpPedalLog_G_s;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.harpPedal.log@g", value);
     return harpPedalLog_G_NONE;
 }
 
-std::string AttConverter::MeiversionMeiversionToStr(meiversion_MEIVERSION data) const
+const std::string &AttConverter::MeiversionMeiversionToStr(meiversion_MEIVERSION data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "3.0.0" };
     switch (data) {
-        case meiversion_MEIVERSION_3_0_0: value = "3.0.0"; break;
+        case meiversion_MEIVERSION_3_0_0: return values[1];
         default:
             LogWarning("Unknown value '%d' for att.meiversion@meiversion", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-meiversion_MEIVERSION AttConverter::StrToMeiversionMeiversion(std::string value) const
+meiversion_MEIVERSION AttConverter::StrToMeiversionMeiversion(const char *value) const
 {
-    if (value == "3.0.0") return meiversion_MEIVERSION_3_0_0;
-    LogWarning("Unsupported value '%s' for att.meiversion@meiversion", value.c_str());
+    switch (strlen(value)) {
+        case 5:
+            if (!memcmp(value, "3.0.0", 5)) return meiversion_MEIVERSION_3_0_0;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.meiversion@meiversion", value);
     return meiversion_MEIVERSION_NONE;
 }
 
-std::string AttConverter::MensurVisFormToStr(mensurVis_FORM data) const
+const std::string &AttConverter::MensurVisFormToStr(mensurVis_FORM data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "horizontal", "vertical" };
     switch (data) {
-        case mensurVis_FORM_horizontal: value = "horizontal"; break;
-        case mensurVis_FORM_vertical: value = "vertical"; break;
+        case mensurVis_FORM_horizontal: return values[1];
+        case mensurVis_FORM_vertical: return values[2];
         default:
             LogWarning("Unknown value '%d' for att.mensur.vis@form", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-mensurVis_FORM AttConverter::StrToMensurVisForm(std::string value) const
+mensurVis_FORM AttConverter::StrToMensurVisForm(const char *value) const
 {
-    if (value == "horizontal") return mensurVis_FORM_horizontal;
-    if (value == "vertical") return mensurVis_FORM_vertical;
-    LogWarning("Unsupported value '%s' for att.mensur.vis@form", value.c_str());
+    switch (strlen(value)) {
+        case 8:
+            if (!memcmp(value, "vertical", 8)) return mensurVis_FORM_vertical;
+            break;
+        case 10:
+            if (!memcmp(value, "horizontal", 10)) return mensurVis_FORM_horizontal;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.mensur.vis@form", value);
     return mensurVis_FORM_NONE;
 }
 
-std::string AttConverter::MensuralVisMensurformToStr(mensuralVis_MENSURFORM data) const
+const std::string &AttConverter::MensuralVisMensurformToStr(mensuralVis_MENSURFORM data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "horizontal", "vertical" };
     switch (data) {
-        case mensuralVis_MENSURFORM_horizontal: value = "horizontal"; break;
-        case mensuralVis_MENSURFORM_vertical: value = "vertical"; break;
+        case mensuralVis_MENSURFORM_horizontal: return values[1];
+        case mensuralVis_MENSURFORM_vertical: return values[2];
         default:
             LogWarning("Unknown value '%d' for att.mensural.vis@mensur.form", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-mensuralVis_MENSURFORM AttConverter::StrToMensuralVisMensurform(std::string value) const
+mensuralVis_MENSURFORM AttConverter::StrToMensuralVisMensurform(const char *value) const
 {
-    if (value == "horizontal") return mensuralVis_MENSURFORM_horizontal;
-    if (value == "vertical") return mensuralVis_MENSURFORM_vertical;
-    LogWarning("Unsupported value '%s' for att.mensural.vis@mensur.form", value.c_str());
+    switch (strlen(value)) {
+        case 8:
+            if (!memcmp(value, "vertical", 8)) return mensuralVis_MENSURFORM_vertical;
+            break;
+        case 10:
+            if (!memcmp(value, "horizontal", 10)) return mensuralVis_MENSURFORM_horizontal;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.mensural.vis@mensur.form", value);
     return mensuralVis_MENSURFORM_NONE;
 }
 
-std::string AttConverter::MeterSigVisFormToStr(meterSigVis_FORM data) const
+const std::string &AttConverter::MeterSigVisFormToStr(meterSigVis_FORM data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "num", "denomsym", "norm", "invis" };
     switch (data) {
-        case meterSigVis_FORM_num: value = "num"; break;
-        case meterSigVis_FORM_denomsym: value = "denomsym"; break;
-        case meterSigVis_FORM_norm: value = "norm"; break;
-        case meterSigVis_FORM_invis: value = "invis"; break;
+        case meterSigVis_FORM_num: return values[1];
+        case meterSigVis_FORM_denomsym: return values[2];
+        case meterSigVis_FORM_norm: return values[3];
+        case meterSigVis_FORM_invis: return values[4];
         default:
             LogWarning("Unknown value '%d' for att.meterSig.vis@form", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-meterSigVis_FORM AttConverter::StrToMeterSigVisForm(std::string value) const
+meterSigVis_FORM AttConverter::StrToMeterSigVisForm(const char *value) const
 {
-    if (value == "num") return meterSigVis_FORM_num;
-    if (value == "denomsym") return meterSigVis_FORM_denomsym;
-    if (value == "norm") return meterSigVis_FORM_norm;
-    if (value == "invis") return meterSigVis_FORM_invis;
-    LogWarning("Unsupported value '%s' for att.meterSig.vis@form", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            if (!memcmp(value, "num", 3)) return meterSigVis_FORM_num;
+            break;
+        case 4:
+            if (!memcmp(value, "norm", 4)) return meterSigVis_FORM_norm;
+            break;
+        case 5:
+            if (!memcmp(value, "invis", 5)) return meterSigVis_FORM_invis;
+            break;
+        case 8:
+            if (!memcmp(value, "denomsym", 8)) return meterSigVis_FORM_denomsym;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.meterSig.vis@form", value);
     return meterSigVis_FORM_NONE;
 }
 
-std::string AttConverter::MeterSigDefaultVisMeterrendToStr(meterSigDefaultVis_METERREND data) const
+const std::string &AttConverter::MeterSigDefaultVisMeterrendToStr(meterSigDefaultVis_METERREND data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "num", "denomsym", "norm", "invis" };
     switch (data) {
-        case meterSigDefaultVis_METERREND_num: value = "num"; break;
-        case meterSigDefaultVis_METERREND_denomsym: value = "denomsym"; break;
-        case meterSigDefaultVis_METERREND_norm: value = "norm"; break;
-        case meterSigDefaultVis_METERREND_invis: value = "invis"; break;
+        case meterSigDefaultVis_METERREND_num: return values[1];
+        case meterSigDefaultVis_METERREND_denomsym: return values[2];
+        case meterSigDefaultVis_METERREND_norm: return values[3];
+        case meterSigDefaultVis_METERREND_invis: return values[4];
         default:
             LogWarning("Unknown value '%d' for att.meterSigDefault.vis@meter.rend", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-meterSigDefaultVis_METERREND AttConverter::StrToMeterSigDefaultVisMeterrend(std::string value) const
+meterSigDefaultVis_METERREND AttConverter::StrToMeterSigDefaultVisMeterrend(const char *value) const
 {
-    if (value == "num") return meterSigDefaultVis_METERREND_num;
-    if (value == "denomsym") return meterSigDefaultVis_METERREND_denomsym;
-    if (value == "norm") return meterSigDefaultVis_METERREND_norm;
-    if (value == "invis") return meterSigDefaultVis_METERREND_invis;
-    LogWarning("Unsupported value '%s' for att.meterSigDefault.vis@meter.rend", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            if (!memcmp(value, "num", 3)) return meterSigDefaultVis_METERREND_num;
+            break;
+        case 4:
+            if (!memcmp(value, "norm", 4)) return meterSigDefaultVis_METERREND_norm;
+            break;
+        case 5:
+            if (!memcmp(value, "invis", 5)) return meterSigDefaultVis_METERREND_invis;
+            break;
+        case 8:
+            if (!memcmp(value, "denomsym", 8)) return meterSigDefaultVis_METERREND_denomsym;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.meterSigDefault.vis@meter.rend", value);
     return meterSigDefaultVis_METERREND_NONE;
 }
 
-std::string AttConverter::MeterSigGrpLogFuncToStr(meterSigGrpLog_FUNC data) const
+const std::string &AttConverter::MeterSigGrpLogFuncToStr(meterSigGrpLog_FUNC data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "alternating", "interchanging", "mixed" };
     switch (data) {
-        case meterSigGrpLog_FUNC_alternating: value = "alternating"; break;
-        case meterSigGrpLog_FUNC_interchanging: value = "interchanging"; break;
-        case meterSigGrpLog_FUNC_mixed: value = "mixed"; break;
+        case meterSigGrpLog_FUNC_alternating: return values[1];
+        case meterSigGrpLog_FUNC_interchanging: return values[2];
+        case meterSigGrpLog_FUNC_mixed: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.meterSigGrp.log@func", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-meterSigGrpLog_FUNC AttConverter::StrToMeterSigGrpLogFunc(std::string value) const
+meterSigGrpLog_FUNC AttConverter::StrToMeterSigGrpLogFunc(const char *value) const
 {
-    if (value == "alternating") return meterSigGrpLog_FUNC_alternating;
-    if (value == "interchanging") return meterSigGrpLog_FUNC_interchanging;
-    if (value == "mixed") return meterSigGrpLog_FUNC_mixed;
-    LogWarning("Unsupported value '%s' for att.meterSigGrp.log@func", value.c_str());
+    switch (strlen(value)) {
+        case 5:
+            if (!memcmp(value, "mixed", 5)) return meterSigGrpLog_FUNC_mixed;
+            break;
+        case 11:
+            if (!memcmp(value, "alternating", 11)) return meterSigGrpLog_FUNC_alternating;
+            break;
+        case 13:
+            if (!memcmp(value, "interchanging", 13)) return meterSigGrpLog_FUNC_interchanging;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.meterSigGrp.log@func", value);
     return meterSigGrpLog_FUNC_NONE;
 }
 
-std::string AttConverter::MeterconformanceMetconToStr(meterconformance_METCON data) const
+const std::string &AttConverter::MeterconformanceMetconToStr(meterconformance_METCON data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "c", "i", "o" };
     switch (data) {
-        case meterconformance_METCON_c: value = "c"; break;
-        case meterconformance_METCON_i: value = "i"; break;
-        case meterconformance_METCON_o: value = "o"; break;
+        case meterconformance_METCON_c: return values[1];
+        case meterconformance_METCON_i: return values[2];
+        case meterconformance_METCON_o: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.meterconformance@metcon", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-meterconformance_METCON AttConverter::StrToMeterconformanceMetcon(std::string value) const
+meterconformance_METCON AttConverter::StrToMeterconformanceMetcon(const char *value) const
 {
-    if (value == "c") return meterconformance_METCON_c;
-    if (value == "i") return meterconformance_METCON_i;
-    if (value == "o") return meterconformance_METCON_o;
-    LogWarning("Unsupported value '%s' for att.meterconformance@metcon", value.c_str());
+    switch (strlen(value)) {
+        case 1:
+            switch (value[0]) {
+                case 'c':
+                    return meterconformance_METCON_c;
+                case 'i':
+                    return meterconformance_METCON_i;
+                case 'o':
+                    return meterconformance_METCON_o;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.meterconformance@metcon", value);
     return meterconformance_METCON_NONE;
 }
 
-std::string AttConverter::MordentLogFormToStr(mordentLog_FORM data) const
+const std::string &AttConverter::MordentLogFormToStr(mordentLog_FORM data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "inv", "norm" };
     switch (data) {
-        case mordentLog_FORM_inv: value = "inv"; break;
-        case mordentLog_FORM_norm: value = "norm"; break;
+        case mordentLog_FORM_inv: return values[1];
+        case mordentLog_FORM_norm: return values[2];
         default:
             LogWarning("Unknown value '%d' for att.mordent.log@form", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-mordentLog_FORM AttConverter::StrToMordentLogForm(std::string value) const
+mordentLog_FORM AttConverter::StrToMordentLogForm(const char *value) const
 {
-    if (value == "inv") return mordentLog_FORM_inv;
-    if (value == "norm") return mordentLog_FORM_norm;
-    LogWarning("Unsupported value '%s' for att.mordent.log@form", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            if (!memcmp(value, "inv", 3)) return mordentLog_FORM_inv;
+            break;
+        case 4:
+            if (!memcmp(value, "norm", 4)) return mordentLog_FORM_norm;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.mordent.log@form", value);
     return mordentLog_FORM_NONE;
 }
 
-std::string AttConverter::NoteLogMensuralLigToStr(noteLogMensural_LIG data) const
+const std::string &AttConverter::NoteLogMensuralLigToStr(noteLogMensural_LIG data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "recta", "obliqua" };
     switch (data) {
-        case noteLogMensural_LIG_recta: value = "recta"; break;
-        case noteLogMensural_LIG_obliqua: value = "obliqua"; break;
+        case noteLogMensural_LIG_recta: return values[1];
+        case noteLogMensural_LIG_obliqua: return values[2];
         default:
             LogWarning("Unknown value '%d' for att.note.log.mensural@lig", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-noteLogMensural_LIG AttConverter::StrToNoteLogMensuralLig(std::string value) const
+noteLogMensural_LIG AttConverter::StrToNoteLogMensuralLig(const char *value) const
 {
-    if (value == "recta") return noteLogMensural_LIG_recta;
-    if (value == "obliqua") return noteLogMensural_LIG_obliqua;
-    LogWarning("Unsupported value '%s' for att.note.log.mensural@lig", value.c_str());
+    switch (strlen(value)) {
+        case 5:
+            if (!memcmp(value, "recta", 5)) return noteLogMensural_LIG_recta;
+            break;
+        case 7:
+            if (!memcmp(value, "obliqua", 7)) return noteLogMensural_LIG_obliqua;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.note.log.mensural@lig", value);
     return noteLogMensural_LIG_NONE;
 }
 
-std::string AttConverter::OctaveLogCollToStr(octaveLog_COLL data) const
+const std::string &AttConverter::OctaveLogCollToStr(octaveLog_COLL data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "coll" };
     switch (data) {
-        case octaveLog_COLL_coll: value = "coll"; break;
+        case octaveLog_COLL_coll: return values[1];
         default:
             LogWarning("Unknown value '%d' for att.octave.log@coll", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-octaveLog_COLL AttConverter::StrToOctaveLogColl(std::string value) const
+octaveLog_COLL AttConverter::StrToOctaveLogColl(const char *value) const
 {
-    if (value == "coll") return octaveLog_COLL_coll;
-    LogWarning("Unsupported value '%s' for att.octave.log@coll", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            if (!memcmp(value, "coll", 4)) return octaveLog_COLL_coll;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.octave.log@coll", value);
     return octaveLog_COLL_NONE;
 }
 
-std::string AttConverter::PbVisFoliumToStr(pbVis_FOLIUM data) const
+const std::string &AttConverter::PbVisFoliumToStr(pbVis_FOLIUM data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "verso", "recto" };
     switch (data) {
-        case pbVis_FOLIUM_verso: value = "verso"; break;
-        case pbVis_FOLIUM_recto: value = "recto"; break;
+        case pbVis_FOLIUM_verso: return values[1];
+        case pbVis_FOLIUM_recto: return values[2];
         default:
             LogWarning("Unknown value '%d' for att.pb.vis@folium", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-pbVis_FOLIUM AttConverter::StrToPbVisFolium(std::string value) const
+pbVis_FOLIUM AttConverter::StrToPbVisFolium(const char *value) const
 {
-    if (value == "verso") return pbVis_FOLIUM_verso;
-    if (value == "recto") return pbVis_FOLIUM_recto;
-    LogWarning("Unsupported value '%s' for att.pb.vis@folium", value.c_str());
+    switch (strlen(value)) {
+        case 5:
+            switch (value[0]) {
+                case 'v':
+                    if (!memcmp(value, "verso", 5)) return pbVis_FOLIUM_verso;
+                    break;
+                case 'r':
+                    if (!memcmp(value, "recto", 5)) return pbVis_FOLIUM_recto;
+                    break;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.pb.vis@folium", value);
     return pbVis_FOLIUM_NONE;
 }
 
-std::string AttConverter::PedalLogDirToStr(pedalLog_DIR data) const
+const std::string &AttConverter::PedalLogDirToStr(pedalLog_DIR data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "down", "up", "half", "bounce" };
     switch (data) {
-        case pedalLog_DIR_down: value = "down"; break;
-        case pedalLog_DIR_up: value = "up"; break;
-        case pedalLog_DIR_half: value = "half"; break;
-        case pedalLog_DIR_bounce: value = "bounce"; break;
+        case pedalLog_DIR_down: return values[1];
+        case pedalLog_DIR_up: return values[2];
+        case pedalLog_DIR_half: return values[3];
+        case pedalLog_DIR_bounce: return values[4];
         default:
             LogWarning("Unknown value '%d' for att.pedal.log@dir", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-pedalLog_DIR AttConverter::StrToPedalLogDir(std::string value) const
+pedalLog_DIR AttConverter::StrToPedalLogDir(const char *value) const
 {
-    if (value == "down") return pedalLog_DIR_down;
-    if (value == "up") return pedalLog_DIR_up;
-    if (value == "half") return pedalLog_DIR_half;
-    if (value == "bounce") return pedalLog_DIR_bounce;
-    LogWarning("Unsupported value '%s' for att.pedal.log@dir", value.c_str());
+    switch (strlen(value)) {
+        case 2:
+            if (!memcmp(value, "up", 2)) return pedalLog_DIR_up;
+            break;
+        case 4:
+            switch (value[0]) {
+                case 'd':
+                    if (!memcmp(value, "down", 4)) return pedalLog_DIR_down;
+                    break;
+                case 'h':
+                    if (!memcmp(value, "half", 4)) return pedalLog_DIR_half;
+                    break;
+            }
+            break;
+        case 6:
+            if (!memcmp(value, "bounce", 6)) return pedalLog_DIR_bounce;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.pedal.log@dir", value);
     return pedalLog_DIR_NONE;
 }
 
-std::string AttConverter::PedalVisFormToStr(pedalVis_FORM data) const
+const std::string &AttConverter::PedalVisFormToStr(pedalVis_FORM data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "line", "pedstar", "altpedstar" };
     switch (data) {
-        case pedalVis_FORM_line: value = "line"; break;
-        case pedalVis_FORM_pedstar: value = "pedstar"; break;
-        case pedalVis_FORM_altpedstar: value = "altpedstar"; break;
+        case pedalVis_FORM_line: return values[1];
+        case pedalVis_FORM_pedstar: return values[2];
+        case pedalVis_FORM_altpedstar: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.pedal.vis@form", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-pedalVis_FORM AttConverter::StrToPedalVisForm(std::string value) const
+pedalVis_FORM AttConverter::StrToPedalVisForm(const char *value) const
 {
-    if (value == "line") return pedalVis_FORM_line;
-    if (value == "pedstar") return pedalVis_FORM_pedstar;
-    if (value == "altpedstar") return pedalVis_FORM_altpedstar;
-    LogWarning("Unsupported value '%s' for att.pedal.vis@form", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            if (!memcmp(value, "line", 4)) return pedalVis_FORM_line;
+            break;
+        case 7:
+            if (!memcmp(value, "pedstar", 7)) return pedalVis_FORM_pedstar;
+            break;
+        case 10:
+            if (!memcmp(value, "altpedstar", 10)) return pedalVis_FORM_altpedstar;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.pedal.vis@form", value);
     return pedalVis_FORM_NONE;
 }
 
-std::string AttConverter::PianopedalsPedalstyleToStr(pianopedals_PEDALSTYLE data) const
+const std::string &AttConverter::PianopedalsPedalstyleToStr(pianopedals_PEDALSTYLE data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "line", "pedstar", "altpedstar" };
     switch (data) {
-        case pianopedals_PEDALSTYLE_line: value = "line"; break;
-        case pianopedals_PEDALSTYLE_pedstar: value = "pedstar"; break;
-        case pianopedals_PEDALSTYLE_altpedstar: value = "altpedstar"; break;
+        case pianopedals_PEDALSTYLE_line: return values[1];
+        case pianopedals_PEDALSTYLE_pedstar: return values[2];
+        case pianopedals_PEDALSTYLE_altpedstar: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.pianopedals@pedal.style", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-pianopedals_PEDALSTYLE AttConverter::StrToPianopedalsPedalstyle(std::string value) const
+pianopedals_PEDALSTYLE AttConverter::StrToPianopedalsPedalstyle(const char *value) const
 {
-    if (value == "line") return pianopedals_PEDALSTYLE_line;
-    if (value == "pedstar") return pianopedals_PEDALSTYLE_pedstar;
-    if (value == "altpedstar") return pianopedals_PEDALSTYLE_altpedstar;
-    LogWarning("Unsupported value '%s' for att.pianopedals@pedal.style", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            if (!memcmp(value, "line", 4)) return pianopedals_PEDALSTYLE_line;
+            break;
+        case 7:
+            if (!memcmp(value, "pedstar", 7)) return pianopedals_PEDALSTYLE_pedstar;
+            break;
+        case 10:
+            if (!memcmp(value, "altpedstar", 10)) return pianopedals_PEDALSTYLE_altpedstar;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.pianopedals@pedal.style", value);
     return pianopedals_PEDALSTYLE_NONE;
 }
 
-std::string AttConverter::PointingXlinkactuateToStr(pointing_XLINKACTUATE data) const
+const std::string &AttConverter::PointingXlinkactuateToStr(pointing_XLINKACTUATE data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "onLoad", "onRequest", "none", "other" };
     switch (data) {
-        case pointing_XLINKACTUATE_onLoad: value = "onLoad"; break;
-        case pointing_XLINKACTUATE_onRequest: value = "onRequest"; break;
-        case pointing_XLINKACTUATE_none: value = "none"; break;
-        case pointing_XLINKACTUATE_other: value = "other"; break;
+        case pointing_XLINKACTUATE_onLoad: return values[1];
+        case pointing_XLINKACTUATE_onRequest: return values[2];
+        case pointing_XLINKACTUATE_none: return values[3];
+        case pointing_XLINKACTUATE_other: return values[4];
         default:
             LogWarning("Unknown value '%d' for att.pointing@xlink:actuate", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-pointing_XLINKACTUATE AttConverter::StrToPointingXlinkactuate(std::string value) const
+pointing_XLINKACTUATE AttConverter::StrToPointingXlinkactuate(const char *value) const
 {
-    if (value == "onLoad") return pointing_XLINKACTUATE_onLoad;
-    if (value == "onRequest") return pointing_XLINKACTUATE_onRequest;
-    if (value == "none") return pointing_XLINKACTUATE_none;
-    if (value == "other") return pointing_XLINKACTUATE_other;
-    LogWarning("Unsupported value '%s' for att.pointing@xlink:actuate", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            if (!memcmp(value, "none", 4)) return pointing_XLINKACTUATE_none;
+            break;
+        case 5:
+            if (!memcmp(value, "other", 5)) return pointing_XLINKACTUATE_other;
+            break;
+        case 6:
+            if (!memcmp(value, "onLoad", 6)) return pointing_XLINKACTUATE_onLoad;
+            break;
+        case 9:
+            if (!memcmp(value, "onRequest", 9)) return pointing_XLINKACTUATE_onRequest;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.pointing@xlink:actuate", value);
     return pointing_XLINKACTUATE_NONE;
 }
 
-std::string AttConverter::PointingXlinkshowToStr(pointing_XLINKSHOW data) const
+const std::string &AttConverter::PointingXlinkshowToStr(pointing_XLINKSHOW data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "new", "replace", "embed", "none", "other" };
     switch (data) {
-        case pointing_XLINKSHOW_new: value = "new"; break;
-        case pointing_XLINKSHOW_replace: value = "replace"; break;
-        case pointing_XLINKSHOW_embed: value = "embed"; break;
-        case pointing_XLINKSHOW_none: value = "none"; break;
-        case pointing_XLINKSHOW_other: value = "other"; break;
+        case pointing_XLINKSHOW_new: return values[1];
+        case pointing_XLINKSHOW_replace: return values[2];
+        case pointing_XLINKSHOW_embed: return values[3];
+        case pointing_XLINKSHOW_none: return values[4];
+        case pointing_XLINKSHOW_other: return values[5];
         default:
             LogWarning("Unknown value '%d' for att.pointing@xlink:show", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-pointing_XLINKSHOW AttConverter::StrToPointingXlinkshow(std::string value) const
+pointing_XLINKSHOW AttConverter::StrToPointingXlinkshow(const char *value) const
 {
-    if (value == "new") return pointing_XLINKSHOW_new;
-    if (value == "replace") return pointing_XLINKSHOW_replace;
-    if (value == "embed") return pointing_XLINKSHOW_embed;
-    if (value == "none") return pointing_XLINKSHOW_none;
-    if (value == "other") return pointing_XLINKSHOW_other;
-    LogWarning("Unsupported value '%s' for att.pointing@xlink:show", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            if (!memcmp(value, "new", 3)) return pointing_XLINKSHOW_new;
+            break;
+        case 4:
+            if (!memcmp(value, "none", 4)) return pointing_XLINKSHOW_none;
+            break;
+        case 5:
+            switch (value[0]) {
+                case 'e':
+                    if (!memcmp(value, "embed", 5)) return pointing_XLINKSHOW_embed;
+                    break;
+                case 'o':
+                    if (!memcmp(value, "other", 5)) return pointing_XLINKSHOW_other;
+                    break;
+            }
+            break;
+        case 7:
+            if (!memcmp(value, "replace", 7)) return pointing_XLINKSHOW_replace;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.pointing@xlink:show", value);
     return pointing_XLINKSHOW_NONE;
 }
 
-std::string AttConverter::RegularmethodMethodToStr(regularmethod_METHOD data) const
+const std::string &AttConverter::RegularmethodMethodToStr(regularmethod_METHOD data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "silent", "tags" };
     switch (data) {
-        case regularmethod_METHOD_silent: value = "silent"; break;
-        case regularmethod_METHOD_tags: value = "tags"; break;
+        case regularmethod_METHOD_silent: return values[1];
+        case regularmethod_METHOD_tags: return values[2];
         default:
             LogWarning("Unknown value '%d' for att.regularmethod@method", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-regularmethod_METHOD AttConverter::StrToRegularmethodMethod(std::string value) const
+regularmethod_METHOD AttConverter::StrToRegularmethodMethod(const char *value) const
 {
-    if (value == "silent") return regularmethod_METHOD_silent;
-    if (value == "tags") return regularmethod_METHOD_tags;
-    LogWarning("Unsupported value '%s' for att.regularmethod@method", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            if (!memcmp(value, "tags", 4)) return regularmethod_METHOD_tags;
+            break;
+        case 6:
+            if (!memcmp(value, "silent", 6)) return regularmethod_METHOD_silent;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.regularmethod@method", value);
     return regularmethod_METHOD_NONE;
 }
 
-std::string AttConverter::RehearsalRehencloseToStr(rehearsal_REHENCLOSE data) const
+const std::string &AttConverter::RehearsalRehencloseToStr(rehearsal_REHENCLOSE data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "box", "circle", "none" };
     switch (data) {
-        case rehearsal_REHENCLOSE_box: value = "box"; break;
-        case rehearsal_REHENCLOSE_circle: value = "circle"; break;
-        case rehearsal_REHENCLOSE_none: value = "none"; break;
+        case rehearsal_REHENCLOSE_box: return values[1];
+        case rehearsal_REHENCLOSE_circle: return values[2];
+        case rehearsal_REHENCLOSE_none: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.rehearsal@reh.enclose", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-rehearsal_REHENCLOSE AttConverter::StrToRehearsalRehenclose(std::string value) const
+rehearsal_REHENCLOSE AttConverter::StrToRehearsalRehenclose(const char *value) const
 {
-    if (value == "box") return rehearsal_REHENCLOSE_box;
-    if (value == "circle") return rehearsal_REHENCLOSE_circle;
-    if (value == "none") return rehearsal_REHENCLOSE_none;
-    LogWarning("Unsupported value '%s' for att.rehearsal@reh.enclose", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            if (!memcmp(value, "box", 3)) return rehearsal_REHENCLOSE_box;
+            break;
+        case 4:
+            if (!memcmp(value, "none", 4)) return rehearsal_REHENCLOSE_none;
+            break;
+        case 6:
+            if (!memcmp(value, "circle", 6)) return rehearsal_REHENCLOSE_circle;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.rehearsal@reh.enclose", value);
     return rehearsal_REHENCLOSE_NONE;
 }
 
-std::string AttConverter::SbVisFormToStr(sbVis_FORM data) const
+const std::string &AttConverter::SbVisFormToStr(sbVis_FORM data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "hash" };
     switch (data) {
-        case sbVis_FORM_hash: value = "hash"; break;
+        case sbVis_FORM_hash: return values[1];
         default:
             LogWarning("Unknown value '%d' for att.sb.vis@form", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-sbVis_FORM AttConverter::StrToSbVisForm(std::string value) const
+sbVis_FORM AttConverter::StrToSbVisForm(const char *value) const
 {
-    if (value == "hash") return sbVis_FORM_hash;
-    LogWarning("Unsupported value '%s' for att.sb.vis@form", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            if (!memcmp(value, "hash", 4)) return sbVis_FORM_hash;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.sb.vis@form", value);
     return sbVis_FORM_NONE;
 }
 
-std::string AttConverter::StaffgroupingsymSymbolToStr(staffgroupingsym_SYMBOL data) const
+const std::string &AttConverter::StaffgroupingsymSymbolToStr(staffgroupingsym_SYMBOL data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "brace", "bracket", "bracketsq", "line", "none" };
     switch (data) {
-        case staffgroupingsym_SYMBOL_brace: value = "brace"; break;
-        case staffgroupingsym_SYMBOL_bracket: value = "bracket"; break;
-        case staffgroupingsym_SYMBOL_bracketsq: value = "bracketsq"; break;
-        case staffgroupingsym_SYMBOL_line: value = "line"; break;
-        case staffgroupingsym_SYMBOL_none: value = "none"; break;
+        case staffgroupingsym_SYMBOL_brace: return values[1];
+        case staffgroupingsym_SYMBOL_bracket: return values[2];
+        case staffgroupingsym_SYMBOL_bracketsq: return values[3];
+        case staffgroupingsym_SYMBOL_line: return values[4];
+        case staffgroupingsym_SYMBOL_none: return values[5];
         default:
             LogWarning("Unknown value '%d' for att.staffgroupingsym@symbol", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-staffgroupingsym_SYMBOL AttConverter::StrToStaffgroupingsymSymbol(std::string value) const
+staffgroupingsym_SYMBOL AttConverter::StrToStaffgroupingsymSymbol(const char *value) const
 {
-    if (value == "brace") return staffgroupingsym_SYMBOL_brace;
-    if (value == "bracket") return staffgroupingsym_SYMBOL_bracket;
-    if (value == "bracketsq") return staffgroupingsym_SYMBOL_bracketsq;
-    if (value == "line") return staffgroupingsym_SYMBOL_line;
-    if (value == "none") return staffgroupingsym_SYMBOL_none;
-    LogWarning("Unsupported value '%s' for att.staffgroupingsym@symbol", value.c_str());
+    switch (strlen(value)) {
+        case 4:
+            switch (value[0]) {
+                case 'l':
+                    if (!memcmp(value, "line", 4)) return staffgroupingsym_SYMBOL_line;
+                    break;
+                case 'n':
+                    if (!memcmp(value, "none", 4)) return staffgroupingsym_SYMBOL_none;
+                    break;
+            }
+            break;
+        case 5:
+            if (!memcmp(value, "brace", 5)) return staffgroupingsym_SYMBOL_brace;
+            break;
+        case 7:
+            if (!memcmp(value, "bracket", 7)) return staffgroupingsym_SYMBOL_bracket;
+            break;
+        case 9:
+            if (!memcmp(value, "bracketsq", 9)) return staffgroupingsym_SYMBOL_bracketsq;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.staffgroupingsym@symbol", value);
     return staffgroupingsym_SYMBOL_NONE;
 }
 
-std::string AttConverter::SylLogConToStr(sylLog_CON data) const
+const std::string &AttConverter::SylLogConToStr(sylLog_CON data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "s", "d", "u", "t", "c", "v", "i", "b" };
     switch (data) {
-        case sylLog_CON_s: value = "s"; break;
-        case sylLog_CON_d: value = "d"; break;
-        case sylLog_CON_u: value = "u"; break;
-        case sylLog_CON_t: value = "t"; break;
-        case sylLog_CON_c: value = "c"; break;
-        case sylLog_CON_v: value = "v"; break;
-        case sylLog_CON_i: value = "i"; break;
-        case sylLog_CON_b: value = "b"; break;
+        case sylLog_CON_s: return values[1];
+        case sylLog_CON_d: return values[2];
+        case sylLog_CON_u: return values[3];
+        case sylLog_CON_t: return values[4];
+        case sylLog_CON_c: return values[5];
+        case sylLog_CON_v: return values[6];
+        case sylLog_CON_i: return values[7];
+        case sylLog_CON_b: return values[8];
         default:
             LogWarning("Unknown value '%d' for att.syl.log@con", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-sylLog_CON AttConverter::StrToSylLogCon(std::string value) const
-{
-    if (value == "s") return sylLog_CON_s;
-    if (value == "d") return sylLog_CON_d;
-    if (value == "u") return sylLog_CON_u;
-    if (value == "t") return sylLog_CON_t;
-    if (value == "c") return sylLog_CON_c;
-    if (value == "v") return sylLog_CON_v;
-    if (value == "i") return sylLog_CON_i;
-    if (value == "b") return sylLog_CON_b;
-    LogWarning("Unsupported value '%s' for att.syl.log@con", value.c_str());
+sylLog_CON AttConverter::StrToSylLogCon(const char *value) const
+{
+    switch (strlen(value)) {
+        case 1:
+            switch (value[0]) {
+                case 's':
+                    return sylLog_CON_s;
+                case 'd':
+                    return sylLog_CON_d;
+                case 'u':
+                    return sylLog_CON_u;
+                case 't':
+                    return sylLog_CON_t;
+                case 'c':
+                    return sylLog_CON_c;
+                case 'v':
+                    return sylLog_CON_v;
+                case 'i':
+                    return sylLog_CON_i;
+                case 'b':
+                    return sylLog_CON_b;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.syl.log@con", value);
     return sylLog_CON_NONE;
 }
 
-std::string AttConverter::SylLogWordposToStr(sylLog_WORDPOS data) const
+const std::string &AttConverter::SylLogWordposToStr(sylLog_WORDPOS data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "i", "m", "t" };
     switch (data) {
-        case sylLog_WORDPOS_i: value = "i"; break;
-        case sylLog_WORDPOS_m: value = "m"; break;
-        case sylLog_WORDPOS_t: value = "t"; break;
+        case sylLog_WORDPOS_i: return values[1];
+        case sylLog_WORDPOS_m: return values[2];
+        case sylLog_WORDPOS_t: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.syl.log@wordpos", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-sylLog_WORDPOS AttConverter::StrToSylLogWordpos(std::string value) const
+sylLog_WORDPOS AttConverter::StrToSylLogWordpos(const char *value) const
 {
-    if (value == "i") return sylLog_WORDPOS_i;
-    if (value == "m") return sylLog_WORDPOS_m;
-    if (value == "t") return sylLog_WORDPOS_t;
-    LogWarning("Unsupported value '%s' for att.syl.log@wordpos", value.c_str());
+    switch (strlen(value)) {
+        case 1:
+            switch (value[0]) {
+                case 'i':
+                    return sylLog_WORDPOS_i;
+                case 'm':
+                    return sylLog_WORDPOS_m;
+                case 't':
+                    return sylLog_WORDPOS_t;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.syl.log@wordpos", value);
     return sylLog_WORDPOS_NONE;
 }
 
-std::string AttConverter::TargetevalEvaluateToStr(targeteval_EVALUATE data) const
+const std::string &AttConverter::TargetevalEvaluateToStr(targeteval_EVALUATE data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "all", "one", "none" };
     switch (data) {
-        case targeteval_EVALUATE_all: value = "all"; break;
-        case targeteval_EVALUATE_one: value = "one"; break;
-        case targeteval_EVALUATE_none: value = "none"; break;
+        case targeteval_EVALUATE_all: return values[1];
+        case targeteval_EVALUATE_one: return values[2];
+        case targeteval_EVALUATE_none: return values[3];
         default:
             LogWarning("Unknown value '%d' for att.targeteval@evaluate", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-targeteval_EVALUATE AttConverter::StrToTargetevalEvaluate(std::string value) const
+targeteval_EVALUATE AttConverter::StrToTargetevalEvaluate(const char *value) const
 {
-    if (value == "all") return targeteval_EVALUATE_all;
-    if (value == "one") return targeteval_EVALUATE_one;
-    if (value == "none") return targeteval_EVALUATE_none;
-    LogWarning("Unsupported value '%s' for att.targeteval@evaluate", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            switch (value[0]) {
+                case 'a':
+                    if (!memcmp(value, "all", 3)) return targeteval_EVALUATE_all;
+                    break;
+                case 'o':
+                    if (!memcmp(value, "one", 3)) return targeteval_EVALUATE_one;
+                    break;
+            }
+            break;
+        case 4:
+            if (!memcmp(value, "none", 4)) return targeteval_EVALUATE_none;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.targeteval@evaluate", value);
     return targeteval_EVALUATE_NONE;
 }
 
-std::string AttConverter::TempoLogFuncToStr(tempoLog_FUNC data) const
+const std::string &AttConverter::TempoLogFuncToStr(tempoLog_FUNC data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "continuous", "instantaneous", "metricmod", "precedente" };
     switch (data) {
-        case tempoLog_FUNC_continuous: value = "continuous"; break;
-        case tempoLog_FUNC_instantaneous: value = "instantaneous"; break;
-        case tempoLog_FUNC_metricmod: value = "metricmod"; break;
-        case tempoLog_FUNC_precedente: value = "precedente"; break;
+        case tempoLog_FUNC_continuous: return values[1];
+        case tempoLog_FUNC_instantaneous: return values[2];
+        case tempoLog_FUNC_metricmod: return values[3];
+        case tempoLog_FUNC_precedente: return values[4];
         default:
             LogWarning("Unknown value '%d' for att.tempo.log@func", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-tempoLog_FUNC AttConverter::StrToTempoLogFunc(std::string value) const
+tempoLog_FUNC AttConverter::StrToTempoLogFunc(const char *value) const
 {
-    if (value == "continuous") return tempoLog_FUNC_continuous;
-    if (value == "instantaneous") return tempoLog_FUNC_instantaneous;
-    if (value == "metricmod") return tempoLog_FUNC_metricmod;
-    if (value == "precedente") return tempoLog_FUNC_precedente;
-    LogWarning("Unsupported value '%s' for att.tempo.log@func", value.c_str());
+    switch (strlen(value)) {
+        case 9:
+            if (!memcmp(value, "metricmod", 9)) return tempoLog_FUNC_metricmod;
+            break;
+        case 10:
+            switch (value[0]) {
+                case 'c':
+                    if (!memcmp(value, "continuous", 10)) return tempoLog_FUNC_continuous;
+                    break;
+                case 'p':
+                    if (!memcmp(value, "precedente", 10)) return tempoLog_FUNC_precedente;
+                    break;
+            }
+            break;
+        case 13:
+            if (!memcmp(value, "instantaneous", 13)) return tempoLog_FUNC_instantaneous;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.tempo.log@func", value);
     return tempoLog_FUNC_NONE;
 }
 
-std::string AttConverter::TupletVisNumformatToStr(tupletVis_NUMFORMAT data) const
+const std::string &AttConverter::TupletVisNumformatToStr(tupletVis_NUMFORMAT data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "count", "ratio" };
     switch (data) {
-        case tupletVis_NUMFORMAT_count: value = "count"; break;
-        case tupletVis_NUMFORMAT_ratio: value = "ratio"; break;
+        case tupletVis_NUMFORMAT_count: return values[1];
+        case tupletVis_NUMFORMAT_ratio: return values[2];
         default:
             LogWarning("Unknown value '%d' for att.tuplet.vis@num.format", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-tupletVis_NUMFORMAT AttConverter::StrToTupletVisNumformat(std::string value) const
+tupletVis_NUMFORMAT AttConverter::StrToTupletVisNumformat(const char *value) const
 {
-    if (value == "count") return tupletVis_NUMFORMAT_count;
-    if (value == "ratio") return tupletVis_NUMFORMAT_ratio;
-    LogWarning("Unsupported value '%s' for att.tuplet.vis@num.format", value.c_str());
+    switch (strlen(value)) {
+        case 5:
+            switch (value[0]) {
+                case 'c':
+                    if (!memcmp(value, "count", 5)) return tupletVis_NUMFORMAT_count;
+                    break;
+                case 'r':
+                    if (!memcmp(value, "ratio", 5)) return tupletVis_NUMFORMAT_ratio;
+                    break;
+            }
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.tuplet.vis@num.format", value);
     return tupletVis_NUMFORMAT_NONE;
 }
 
-std::string AttConverter::TurnLogFormToStr(turnLog_FORM data) const
+const std::string &AttConverter::TurnLogFormToStr(turnLog_FORM data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "inv", "norm" };
     switch (data) {
-        case turnLog_FORM_inv: value = "inv"; break;
-        case turnLog_FORM_norm: value = "norm"; break;
+        case turnLog_FORM_inv: return values[1];
+        case turnLog_FORM_norm: return values[2];
         default:
             LogWarning("Unknown value '%d' for att.turn.log@form", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-turnLog_FORM AttConverter::StrToTurnLogForm(std::string value) const
+turnLog_FORM AttConverter::StrToTurnLogForm(const char *value) const
 {
-    if (value == "inv") return turnLog_FORM_inv;
-    if (value == "norm") return turnLog_FORM_norm;
-    LogWarning("Unsupported value '%s' for att.turn.log@form", value.c_str());
+    switch (strlen(value)) {
+        case 3:
+            if (!memcmp(value, "inv", 3)) return turnLog_FORM_inv;
+            break;
+        case 4:
+            if (!memcmp(value, "norm", 4)) return turnLog_FORM_norm;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.turn.log@form", value);
     return turnLog_FORM_NONE;
 }
 
-std::string AttConverter::WhitespaceXmlspaceToStr(whitespace_XMLSPACE data) const
+const std::string &AttConverter::WhitespaceXmlspaceToStr(whitespace_XMLSPACE data) const
 {
-    std::string value;
+    static const std::string values[] = { "", "default", "preserve" };
     switch (data) {
-        case whitespace_XMLSPACE_default: value = "default"; break;
-        case whitespace_XMLSPACE_preserve: value = "preserve"; break;
+        case whitespace_XMLSPACE_default: return values[1];
+        case whitespace_XMLSPACE_preserve: return values[2];
         default:
             LogWarning("Unknown value '%d' for att.whitespace@xml:space", data);
-            value = "";
-            break;
+            return values[0];
     }
-    return value;
 }
 
-whitespace_XMLSPACE AttConverter::StrToWhitespaceXmlspace(std::string value) const
+whitespace_XMLSPACE AttConverter::StrToWhitespaceXmlspace(const char *value) const
 {
-    if (value == "default") return whitespace_XMLSPACE_default;
-    if (value == "preserve") return whitespace_XMLSPACE_preserve;
-    LogWarning("Unsupported value '%s' for att.whitespace@xml:space", value.c_str());
+    switch (strlen(value)) {
+        case 7:
+            if (!memcmp(value, "default", 7)) return whitespace_XMLSPACE_default;
+            break;
+        case 8:
+            if (!memcmp(value, "preserve", 8)) return whitespace_XMLSPACE_preserve;
+            break;
+    }
+    LogWarning("Unsupported value '%s' for att.whitespace@xml:space", value);
     return whitespace_XMLSPACE_NONE;
 }
 
@@ -481,7 +481,7 @@ bool Att::SetAnalysis(Object *element, std::string attrType, std::string attrVal
         AttMelodicfunction *att = dynamic_cast<AttMelodicfunction *>(element);
         assert(att);
         if (attrType == "mfunc") {
-            att->SetMfunc(att->StrToMelodicfunction(attrValue));
+            att->SetMfunc(att->StrToMelodicfunction(attrValue.c_str()));
             return true;
         }
     }
@@ -573,4 +573,68 @@ void Att::GetAnalysis(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillAnalysisSetters(MapOfAttSetters *setters)
+{
+    (*setters)["copyof"].push_back(std::make_pair(ATT_COMMONANL, [](Object *element, const char *attrValue) {
+        AttCommonAnl *att = dynamic_cast<AttCommonAnl *>(element);
+        assert(att);
+        att->SetCopyof(att->StrToStr(attrValue));
+    }));
+    (*setters)["corresp"].push_back(std::make_pair(ATT_COMMONANL, [](Object *element, const char *attrValue) {
+        AttCommonAnl *att = dynamic_cast<AttCommonAnl *>(element);
+        assert(att);
+        att->SetCorresp(att->StrToStr(attrValue));
+    }));
+    (*setters)["next"].push_back(std::make_pair(ATT_COMMONANL, [](Object *element, const char *attrValue) {
+        AttCommonAnl *att = dynamic_cast<AttCommonAnl *>(element);
+        assert(att);
+        att->SetNext(att->StrToStr(attrValue));
+    }));
+    (*setters)["prev"].push_back(std::make_pair(ATT_COMMONANL, [](Object *element, const char *attrValue) {
+        AttCommonAnl *att = dynamic_cast<AttCommonAnl *>(element);
+        assert(att);
+        att->SetPrev(att->StrToStr(attrValue));
+    }));
+    (*setters)["sameas"].push_back(std::make_pair(ATT_COMMONANL, [](Object *element, const char *attrValue) {
+        AttCommonAnl *att = dynamic_cast<AttCommonAnl *>(element);
+        assert(att);
+        att->SetSameas(att->StrToStr(attrValue));
+    }));
+    (*setters)["synch"].push_back(std::make_pair(ATT_COMMONANL, [](Object *element, const char *attrValue) {
+        AttCommonAnl *att = dynamic_cast<AttCommonAnl *>(element);
+        assert(att);
+        att->SetSynch(att->StrToStr(attrValue));
+    }));
+    (*setters)["deg"].push_back(std::make_pair(ATT_HARMONICFUNCTION, [](Object *element, const char *attrValue) {
+        AttHarmonicfunction *att = dynamic_cast<AttHarmonicfunction *>(element);
+        assert(att);
+        att->SetDeg(att->StrToScaledegree(attrValue));
+    }));
+    (*setters)["inth"].push_back(std::make_pair(ATT_INTERVALHARMONIC, [](Object *element, const char *attrValue) {
+        AttIntervalharmonic *att = dynamic_cast<AttIntervalharmonic *>(element);
+        assert(att);
+        att->SetInth(att->StrToIntervalHarmonic(attrValue));
+    }));
+    (*setters)["intm"].push_back(std::make_pair(ATT_INTERVALMELODIC, [](Object *element, const char *attrValue) {
+        AttIntervalmelodic *att = dynamic_cast<AttIntervalmelodic *>(element);
+        assert(att);
+        att->SetIntm(att->StrToIntervalMelodic(attrValue));
+    }));
+    (*setters)["mfunc"].push_back(std::make_pair(ATT_MELODICFUNCTION, [](Object *element, const char *attrValue) {
+        AttMelodicfunction *att = dynamic_cast<AttMelodicfunction *>(element);
+        assert(att);
+        att->SetMfunc(att->StrToMelodicfunction(attrValue));
+    }));
+    (*setters)["pclass"].push_back(std::make_pair(ATT_PITCHCLASS, [](Object *element, const char *attrValue) {
+        AttPitchclass *att = dynamic_cast<AttPitchclass *>(element);
+        assert(att);
+        att->SetPclass(att->StrToPitchclass(attrValue));
+    }));
+    (*setters)["psolfa"].push_back(std::make_pair(ATT_SOLFA, [](Object *element, const char *attrValue) {
+        AttSolfa *att = dynamic_cast<AttSolfa *>(element);
+        assert(att);
+        att->SetPsolfa(att->StrToStr(attrValue));
+    }));
+}
+
 } // vrv namespace
@@ -1943,7 +1943,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttArpegLog *att = dynamic_cast<AttArpegLog *>(element);
         assert(att);
         if (attrType == "order") {
-            att->SetOrder(att->StrToArpegLogOrder(attrValue));
+            att->SetOrder(att->StrToArpegLogOrder(attrValue.c_str()));
             return true;
         }
     }
@@ -1951,7 +1951,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttArpegVis *att = dynamic_cast<AttArpegVis *>(element);
         assert(att);
         if (attrType == "arrow") {
-            att->SetArrow(att->StrToBoolean(attrValue));
+            att->SetArrow(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -1959,7 +1959,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttBTremLog *att = dynamic_cast<AttBTremLog *>(element);
         assert(att);
         if (attrType == "form") {
-            att->SetForm(att->StrToBTremLogForm(attrValue));
+            att->SetForm(att->StrToBTremLogForm(attrValue.c_str()));
             return true;
         }
     }
@@ -1975,7 +1975,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttBeamedwith *att = dynamic_cast<AttBeamedwith *>(element);
         assert(att);
         if (attrType == "beam.with") {
-            att->SetBeamWith(att->StrToOtherstaff(attrValue));
+            att->SetBeamWith(att->StrToOtherstaff(attrValue.c_str()));
             return true;
         }
     }
@@ -1987,7 +1987,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
             return true;
         }
         if (attrType == "beam.rests") {
-            att->SetBeamRests(att->StrToBoolean(attrValue));
+            att->SetBeamRests(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -1995,7 +1995,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttBeamrend *att = dynamic_cast<AttBeamrend *>(element);
         assert(att);
         if (attrType == "form") {
-            att->SetForm(att->StrToBeamrendForm(attrValue));
+            att->SetForm(att->StrToBeamrendForm(attrValue.c_str()));
             return true;
         }
         if (attrType == "slope") {
@@ -2039,7 +2039,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttCutout *att = dynamic_cast<AttCutout *>(element);
         assert(att);
         if (attrType == "cutout") {
-            att->SetCutout(att->StrToCutoutCutout(attrValue));
+            att->SetCutout(att->StrToCutoutCutout(attrValue.c_str()));
             return true;
         }
     }
@@ -2047,7 +2047,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttExpandable *att = dynamic_cast<AttExpandable *>(element);
         assert(att);
         if (attrType == "expand") {
-            att->SetExpand(att->StrToBoolean(attrValue));
+            att->SetExpand(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -2055,7 +2055,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttFTremLog *att = dynamic_cast<AttFTremLog *>(element);
         assert(att);
         if (attrType == "form") {
-            att->SetForm(att->StrToFTremLogForm(attrValue));
+            att->SetForm(att->StrToFTremLogForm(attrValue.c_str()));
             return true;
         }
     }
@@ -2063,11 +2063,11 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttFermataVis *att = dynamic_cast<AttFermataVis *>(element);
         assert(att);
         if (attrType == "form") {
-            att->SetForm(att->StrToFermataVisForm(attrValue));
+            att->SetForm(att->StrToFermataVisForm(attrValue.c_str()));
             return true;
         }
         if (attrType == "shape") {
-            att->SetShape(att->StrToFermataVisShape(attrValue));
+            att->SetShape(att->StrToFermataVisShape(attrValue.c_str()));
             return true;
         }
     }
@@ -2075,7 +2075,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttGraced *att = dynamic_cast<AttGraced *>(element);
         assert(att);
         if (attrType == "grace") {
-            att->SetGrace(att->StrToGrace(attrValue));
+            att->SetGrace(att->StrToGrace(attrValue.c_str()));
             return true;
         }
         if (attrType == "grace.time") {
@@ -2087,11 +2087,11 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttHairpinLog *att = dynamic_cast<AttHairpinLog *>(element);
         assert(att);
         if (attrType == "form") {
-            att->SetForm(att->StrToHairpinLogForm(attrValue));
+            att->SetForm(att->StrToHairpinLogForm(attrValue.c_str()));
             return true;
         }
         if (attrType == "niente") {
-            att->SetNiente(att->StrToBoolean(attrValue));
+            att->SetNiente(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -2107,31 +2107,31 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttHarpPedalLog *att = dynamic_cast<AttHarpPedalLog *>(element);
         assert(att);
         if (attrType == "c") {
-            att->SetC(att->StrToHarpPedalLogC(attrValue));
+            att->SetC(att->StrToHarpPedalLogC(attrValue.c_str()));
             return true;
         }
         if (attrType == "d") {
-            att->SetD(att->StrToHarpPedalLogD(attrValue));
+            att->SetD(att->StrToHarpPedalLogD(attrValue.c_str()));
             return true;
         }
         if (attrType == "e") {
-            att->SetE(att->StrToHarpPedalLogE(attrValue));
+            att->SetE(att->StrToHarpPedalLogE(attrValue.c_str()));
             return true;
         }
         if (attrType == "f") {
-            att->SetF(att->StrToHarpPedalLogF(attrValue));
+            att->SetF(att->StrToHarpPedalLogF(attrValue.c_str()));
             return true;
         }
         if (attrType == "g") {
-            att->SetG(att->StrToHarpPedalLogG(attrValue));
+            att->SetG(att->StrToHarpPedalLogG(attrValue.c_str()));
             return true;
         }
         if (attrType == "a") {
-            att->SetA(att->StrToHarpPedalLogA(attrValue));
+            att->SetA(att->StrToHarpPedalLogA(attrValue.c_str()));
             return true;
         }
         if (attrType == "b") {
-            att->SetB(att->StrToHarpPedalLogB(attrValue));
+            att->SetB(att->StrToHarpPedalLogB(attrValue.c_str()));
             return true;
         }
     }
@@ -2139,7 +2139,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttLvpresent *att = dynamic_cast<AttLvpresent *>(element);
         assert(att);
         if (attrType == "lv") {
-            att->SetLv(att->StrToBoolean(attrValue));
+            att->SetLv(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -2147,7 +2147,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttMeterSigGrpLog *att = dynamic_cast<AttMeterSigGrpLog *>(element);
         assert(att);
         if (attrType == "func") {
-            att->SetFunc(att->StrToMeterSigGrpLogFunc(attrValue));
+            att->SetFunc(att->StrToMeterSigGrpLogFunc(attrValue.c_str()));
             return true;
         }
     }
@@ -2155,7 +2155,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttMultiRestVis *att = dynamic_cast<AttMultiRestVis *>(element);
         assert(att);
         if (attrType == "block") {
-            att->SetBlock(att->StrToBoolean(attrValue));
+            att->SetBlock(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -2163,7 +2163,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttNoteGesCmn *att = dynamic_cast<AttNoteGesCmn *>(element);
         assert(att);
         if (attrType == "gliss") {
-            att->SetGliss(att->StrToGlissando(attrValue));
+            att->SetGliss(att->StrToGlissando(attrValue.c_str()));
             return true;
         }
     }
@@ -2179,11 +2179,11 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttNumberplacement *att = dynamic_cast<AttNumberplacement *>(element);
         assert(att);
         if (attrType == "num.place") {
-            att->SetNumPlace(att->StrToPlace(attrValue));
+            att->SetNumPlace(att->StrToPlace(attrValue.c_str()));
             return true;
         }
         if (attrType == "num.visible") {
-            att->SetNumVisible(att->StrToBoolean(attrValue));
+            att->SetNumVisible(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -2191,7 +2191,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttOctaveLog *att = dynamic_cast<AttOctaveLog *>(element);
         assert(att);
         if (attrType == "coll") {
-            att->SetColl(att->StrToOctaveLogColl(attrValue));
+            att->SetColl(att->StrToOctaveLogColl(attrValue.c_str()));
             return true;
         }
     }
@@ -2199,7 +2199,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttPedalLog *att = dynamic_cast<AttPedalLog *>(element);
         assert(att);
         if (attrType == "dir") {
-            att->SetDir(att->StrToPedalLogDir(attrValue));
+            att->SetDir(att->StrToPedalLogDir(attrValue.c_str()));
             return true;
         }
     }
@@ -2207,7 +2207,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttPedalVis *att = dynamic_cast<AttPedalVis *>(element);
         assert(att);
         if (attrType == "form") {
-            att->SetForm(att->StrToPedalVisForm(attrValue));
+            att->SetForm(att->StrToPedalVisForm(attrValue.c_str()));
             return true;
         }
     }
@@ -2215,7 +2215,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttPianopedals *att = dynamic_cast<AttPianopedals *>(element);
         assert(att);
         if (attrType == "pedal.style") {
-            att->SetPedalStyle(att->StrToPianopedalsPedalstyle(attrValue));
+            att->SetPedalStyle(att->StrToPianopedalsPedalstyle(attrValue.c_str()));
             return true;
         }
     }
@@ -2223,7 +2223,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttRehearsal *att = dynamic_cast<AttRehearsal *>(element);
         assert(att);
         if (attrType == "reh.enclose") {
-            att->SetRehEnclose(att->StrToRehearsalRehenclose(attrValue));
+            att->SetRehEnclose(att->StrToRehearsalRehenclose(attrValue.c_str()));
             return true;
         }
     }
@@ -2231,7 +2231,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttScoreDefVisCmn *att = dynamic_cast<AttScoreDefVisCmn *>(element);
         assert(att);
         if (attrType == "grid.show") {
-            att->SetGridShow(att->StrToBoolean(attrValue));
+            att->SetGridShow(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -2239,7 +2239,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttSlurrend *att = dynamic_cast<AttSlurrend *>(element);
         assert(att);
         if (attrType == "slur.lform") {
-            att->SetSlurLform(att->StrToLineform(attrValue));
+            att->SetSlurLform(att->StrToLineform(attrValue.c_str()));
             return true;
         }
         if (attrType == "slur.lwidth") {
@@ -2251,7 +2251,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttStemsCmn *att = dynamic_cast<AttStemsCmn *>(element);
         assert(att);
         if (attrType == "stem.with") {
-            att->SetStemWith(att->StrToOtherstaff(attrValue));
+            att->SetStemWith(att->StrToOtherstaff(attrValue.c_str()));
             return true;
         }
     }
@@ -2259,7 +2259,7 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttTierend *att = dynamic_cast<AttTierend *>(element);
         assert(att);
         if (attrType == "tie.lform") {
-            att->SetTieLform(att->StrToLineform(attrValue));
+            att->SetTieLform(att->StrToLineform(attrValue.c_str()));
             return true;
         }
         if (attrType == "tie.lwidth") {
@@ -2279,19 +2279,19 @@ bool Att::SetCmn(Object *element, std::string attrType, std::string attrValue)
         AttTupletVis *att = dynamic_cast<AttTupletVis *>(element);
         assert(att);
         if (attrType == "bracket.place") {
-            att->SetBracketPlace(att->StrToPlace(attrValue));
+            att->SetBracketPlace(att->StrToPlace(attrValue.c_str()));
             return true;
         }
         if (attrType == "bracket.visible") {
-            att->SetBracketVisible(att->StrToBoolean(attrValue));
+            att->SetBracketVisible(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
         if (attrType == "dur.visible") {
-            att->SetDurVisible(att->StrToBoolean(attrValue));
+            att->SetDurVisible(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
         if (attrType == "num.format") {
-            att->SetNumFormat(att->StrToTupletVisNumformat(attrValue));
+            att->SetNumFormat(att->StrToTupletVisNumformat(attrValue.c_str()));
             return true;
         }
     }
@@ -2606,4 +2606,273 @@ void Att::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillCmnSetters(MapOfAttSetters *setters)
+{
+    (*setters)["order"].push_back(std::make_pair(ATT_ARPEGLOG, [](Object *element, const char *attrValue) {
+        AttArpegLog *att = dynamic_cast<AttArpegLog *>(element);
+        assert(att);
+        att->SetOrder(att->StrToArpegLogOrder(attrValue));
+    }));
+    (*setters)["arrow"].push_back(std::make_pair(ATT_ARPEGVIS, [](Object *element, const char *attrValue) {
+        AttArpegVis *att = dynamic_cast<AttArpegVis *>(element);
+        assert(att);
+        att->SetArrow(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["form"].push_back(std::make_pair(ATT_BTREMLOG, [](Object *element, const char *attrValue) {
+        AttBTremLog *att = dynamic_cast<AttBTremLog *>(element);
+        assert(att);
+        att->SetForm(att->StrToBTremLogForm(attrValue));
+    }));
+    (*setters)["beam"].push_back(std::make_pair(ATT_BEAMED, [](Object *element, const char *attrValue) {
+        AttBeamed *att = dynamic_cast<AttBeamed *>(element);
+        assert(att);
+        att->SetBeam(att->StrToStr(attrValue));
+    }));
+    (*setters)["beam.with"].push_back(std::make_pair(ATT_BEAMEDWITH, [](Object *element, const char *attrValue) {
+        AttBeamedwith *att = dynamic_cast<AttBeamedwith *>(element);
+        assert(att);
+        att->SetBeamWith(att->StrToOtherstaff(attrValue));
+    }));
+    (*setters)["beam.group"].push_back(std::make_pair(ATT_BEAMINGLOG, [](Object *element, const char *attrValue) {
+        AttBeamingLog *att = dynamic_cast<AttBeamingLog *>(element);
+        assert(att);
+        att->SetBeamGroup(att->StrToStr(attrValue));
+    }));
+    (*setters)["beam.rests"].push_back(std::make_pair(ATT_BEAMINGLOG, [](Object *element, const char *attrValue) {
+        AttBeamingLog *att = dynamic_cast<AttBeamingLog *>(element);
+        assert(att);
+        att->SetBeamRests(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["form"].push_back(std::make_pair(ATT_BEAMREND, [](Object *element, const char *attrValue) {
+        AttBeamrend *att = dynamic_cast<AttBeamrend *>(element);
+        assert(att);
+        att->SetForm(att->StrToBeamrendForm(attrValue));
+    }));
+    (*setters)["slope"].push_back(std::make_pair(ATT_BEAMREND, [](Object *element, const char *attrValue) {
+        AttBeamrend *att = dynamic_cast<AttBeamrend *>(element);
+        assert(att);
+        att->SetSlope(att->StrToDbl(attrValue));
+    }));
+    (*setters)["breaksec"].push_back(std::make_pair(ATT_BEAMSECONDARY, [](Object *element, const char *attrValue) {
+        AttBeamsecondary *att = dynamic_cast<AttBeamsecondary *>(element);
+        assert(att);
+        att->SetBreaksec(att->StrToInt(attrValue));
+    }));
+    (*setters)["beatDef"].push_back(std::make_pair(ATT_BEATRPTLOG, [](Object *element, const char *attrValue) {
+        AttBeatRptLog *att = dynamic_cast<AttBeatRptLog *>(element);
+        assert(att);
+        att->SetBeatDef(att->StrToDuration(attrValue));
+    }));
+    (*setters)["form"].push_back(std::make_pair(ATT_BEATRPTVIS, [](Object *element, const char *attrValue) {
+        AttBeatRptVis *att = dynamic_cast<AttBeatRptVis *>(element);
+        assert(att);
+        att->SetForm(att->StrToBeatrptRend(attrValue));
+    }));
+    (*setters)["amount"].push_back(std::make_pair(ATT_BENDGES, [](Object *element, const char *attrValue) {
+        AttBendGes *att = dynamic_cast<AttBendGes *>(element);
+        assert(att);
+        att->SetAmount(att->StrToDbl(attrValue));
+    }));
+    (*setters)["cutout"].push_back(std::make_pair(ATT_CUTOUT, [](Object *element, const char *attrValue) {
+        AttCutout *att = dynamic_cast<AttCutout *>(element);
+        assert(att);
+        att->SetCutout(att->StrToCutoutCutout(attrValue));
+    }));
+    (*setters)["expand"].push_back(std::make_pair(ATT_EXPANDABLE, [](Object *element, const char *attrValue) {
+        AttExpandable *att = dynamic_cast<AttExpandable *>(element);
+        assert(att);
+        att->SetExpand(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["form"].push_back(std::make_pair(ATT_FTREMLOG, [](Object *element, const char *attrValue) {
+        AttFTremLog *att = dynamic_cast<AttFTremLog *>(element);
+        assert(att);
+        att->SetForm(att->StrToFTremLogForm(attrValue));
+    }));
+    (*setters)["form"].push_back(std::make_pair(ATT_FERMATAVIS, [](Object *element, const char *attrValue) {
+        AttFermataVis *att = dynamic_cast<AttFermataVis *>(element);
+        assert(att);
+        att->SetForm(att->StrToFermataVisForm(attrValue));
+    }));
+    (*setters)["shape"].push_back(std::make_pair(ATT_FERMATAVIS, [](Object *element, const char *attrValue) {
+        AttFermataVis *att = dynamic_cast<AttFermataVis *>(element);
+        assert(att);
+        att->SetShape(att->StrToFermataVisShape(attrValue));
+    }));
+    (*setters)["grace"].push_back(std::make_pair(ATT_GRACED, [](Object *element, const char *attrValue) {
+        AttGraced *att = dynamic_cast<AttGraced *>(element);
+        assert(att);
+        att->SetGrace(att->StrToGrace(attrValue));
+    }));
+    (*setters)["grace.time"].push_back(std::make_pair(ATT_GRACED, [](Object *element, const char *attrValue) {
+        AttGraced *att = dynamic_cast<AttGraced *>(element);
+        assert(att);
+        att->SetGraceTime(att->StrToPercent(attrValue));
+    }));
+    (*setters)["form"].push_back(std::make_pair(ATT_HAIRPINLOG, [](Object *element, const char *attrValue) {
+        AttHairpinLog *att = dynamic_cast<AttHairpinLog *>(element);
+        assert(att);
+        att->SetForm(att->StrToHairpinLogForm(attrValue));
+    }));
+    (*setters)["niente"].push_back(std::make_pair(ATT_HAIRPINLOG, [](Object *element, const char *attrValue) {
+        AttHairpinLog *att = dynamic_cast<AttHairpinLog *>(element);
+        assert(att);
+        att->SetNiente(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["opening"].push_back(std::make_pair(ATT_HAIRPINVIS, [](Object *element, const char *attrValue) {
+        AttHairpinVis *att = dynamic_cast<AttHairpinVis *>(element);
+        assert(att);
+        att->SetOpening(att->StrToStr(attrValue));
+    }));
+    (*setters)["c"].push_back(std::make_pair(ATT_HARPPEDALLOG, [](Object *element, const char *attrValue) {
+        AttHarpPedalLog *att = dynamic_cast<AttHarpPedalLog *>(element);
+        assert(att);
+        att->SetC(att->StrToHarpPedalLogC(attrValue));
+    }));
+    (*setters)["d"].push_back(std::make_pair(ATT_HARPPEDALLOG, [](Object *element, const char *attrValue) {
+        AttHarpPedalLog *att = dynamic_cast<AttHarpPedalLog *>(element);
+        assert(att);
+        att->SetD(att->StrToHarpPedalLogD(attrValue));
+    }));
+    (*setters)["e"].push_back(std::make_pair(ATT_HARPPEDALLOG, [](Object *element, const char *attrValue) {
+        AttHarpPedalLog *att = dynamic_cast<AttHarpPedalLog *>(element);
+        assert(att);
+        att->SetE(att->StrToHarpPedalLogE(attrValue));
+    }));
+    (*setters)["f"].push_back(std::make_pair(ATT_HARPPEDALLOG, [](Object *element, const char *attrValue) {
+        AttHarpPedalLog *att = dynamic_cast<AttHarpPedalLog *>(element);
+        assert(att);
+        att->SetF(att->StrToHarpPedalLogF(attrValue));
+    }));
+    (*setters)["g"].push_back(std::make_pair(ATT_HARPPEDALLOG, [](Object *element, const char *attrValue) {
+        AttHarpPedalLog *att = dynamic_cast<AttHarpPedalLog *>(element);
+        assert(att);
+        att->SetG(att->StrToHarpPedalLogG(attrValue));
+    }));
+    (*setters)["a"].push_back(std::make_pair(ATT_HARPPEDALLOG, [](Object *element, const char *attrValue) {
+        AttHarpPedalLog *att = dynamic_cast<AttHarpPedalLog *>(element);
+        assert(att);
+        att->SetA(att->StrToHarpPedalLogA(attrValue));
+    }));
+    (*setters)["b"].push_back(std::make_pair(ATT_HARPPEDALLOG, [](Object *element, const char *attrValue) {
+        AttHarpPedalLog *att = dynamic_cast<AttHarpPedalLog *>(element);
+        assert(att);
+        att->SetB(att->StrToHarpPedalLogB(attrValue));
+    }));
+    (*setters)["lv"].push_back(std::make_pair(ATT_LVPRESENT, [](Object *element, const char *attrValue) {
+        AttLvpresent *att = dynamic_cast<AttLvpresent *>(element);
+        assert(att);
+        att->SetLv(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["func"].push_back(std::make_pair(ATT_METERSIGGRPLOG, [](Object *element, const char *attrValue) {
+        AttMeterSigGrpLog *att = dynamic_cast<AttMeterSigGrpLog *>(element);
+        assert(att);
+        att->SetFunc(att->StrToMeterSigGrpLogFunc(attrValue));
+    }));
+    (*setters)["block"].push_back(std::make_pair(ATT_MULTIRESTVIS, [](Object *element, const char *attrValue) {
+        AttMultiRestVis *att = dynamic_cast<AttMultiRestVis *>(element);
+        assert(att);
+        att->SetBlock(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["gliss"].push_back(std::make_pair(ATT_NOTEGESCMN, [](Object *element, const char *attrValue) {
+        AttNoteGesCmn *att = dynamic_cast<AttNoteGesCmn *>(element);
+        assert(att);
+        att->SetGliss(att->StrToGlissando(attrValue));
+    }));
+    (*setters)["num"].push_back(std::make_pair(ATT_NUMBERED, [](Object *element, const char *attrValue) {
+        AttNumbered *att = dynamic_cast<AttNumbered *>(element);
+        assert(att);
+        att->SetNum(att->StrToInt(attrValue));
+    }));
+    (*setters)["num.place"].push_back(std::make_pair(ATT_NUMBERPLACEMENT, [](Object *element, const char *attrValue) {
+        AttNumberplacement *att = dynamic_cast<AttNumberplacement *>(element);
+        assert(att);
+        att->SetNumPlace(att->StrToPlace(attrValue));
+    }));
+    (*setters)["num.visible"].push_back(std::make_pair(ATT_NUMBERPLACEMENT, [](Object *element, const char *attrValue) {
+        AttNumberplacement *att = dynamic_cast<AttNumberplacement *>(element);
+        assert(att);
+        att->SetNumVisible(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["coll"].push_back(std::make_pair(ATT_OCTAVELOG, [](Object *element, const char *attrValue) {
+        AttOctaveLog *att = dynamic_cast<AttOctaveLog *>(element);
+        assert(att);
+        att->SetColl(att->StrToOctaveLogColl(attrValue));
+    }));
+    (*setters)["dir"].push_back(std::make_pair(ATT_PEDALLOG, [](Object *element, const char *attrValue) {
+        AttPedalLog *att = dynamic_cast<AttPedalLog *>(element);
+        assert(att);
+        att->SetDir(att->StrToPedalLogDir(attrValue));
+    }));
+    (*setters)["form"].push_back(std::make_pair(ATT_PEDALVIS, [](Object *element, const char *attrValue) {
+        AttPedalVis *att = dynamic_cast<AttPedalVis *>(element);
+        assert(att);
+        att->SetForm(att->StrToPedalVisForm(attrValue));
+    }));
+    (*setters)["pedal.style"].push_back(std::make_pair(ATT_PIANOPEDALS, [](Object *element, const char *attrValue) {
+        AttPianopedals *att = dynamic_cast<AttPianopedals *>(element);
+        assert(att);
+        att->SetPedalStyle(att->StrToPianopedalsPedalstyle(attrValue));
+    }));
+    (*setters)["reh.enclose"].push_back(std::make_pair(ATT_REHEARSAL, [](Object *element, const char *attrValue) {
+        AttRehearsal *att = dynamic_cast<AttRehearsal *>(element);
+        assert(att);
+        att->SetRehEnclose(att->StrToRehearsalRehenclose(attrValue));
+    }));
+    (*setters)["grid.show"].push_back(std::make_pair(ATT_SCOREDEFVISCMN, [](Object *element, const char *attrValue) {
+        AttScoreDefVisCmn *att = dynamic_cast<AttScoreDefVisCmn *>(element);
+        assert(att);
+        att->SetGridShow(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["slur.lform"].push_back(std::make_pair(ATT_SLURREND, [](Object *element, const char *attrValue) {
+        AttSlurrend *att = dynamic_cast<AttSlurrend *>(element);
+        assert(att);
+        att->SetSlurLform(att->StrToLineform(attrValue));
+    }));
+    (*setters)["slur.lwidth"].push_back(std::make_pair(ATT_SLURREND, [](Object *element, const char *attrValue) {
+        AttSlurrend *att = dynamic_cast<AttSlurrend *>(element);
+        assert(att);
+        att->SetSlurLwidth(att->StrToStr(attrValue));
+    }));
+    (*setters)["stem.with"].push_back(std::make_pair(ATT_STEMSCMN, [](Object *element, const char *attrValue) {
+        AttStemsCmn *att = dynamic_cast<AttStemsCmn *>(element);
+        assert(att);
+        att->SetStemWith(att->StrToOtherstaff(attrValue));
+    }));
+    (*setters)["tie.lform"].push_back(std::make_pair(ATT_TIEREND, [](Object *element, const char *attrValue) {
+        AttTierend *att = dynamic_cast<AttTierend *>(element);
+        assert(att);
+        att->SetTieLform(att->StrToLineform(attrValue));
+    }));
+    (*setters)["tie.lwidth"].push_back(std::make_pair(ATT_TIEREND, [](Object *element, const char *attrValue) {
+        AttTierend *att = dynamic_cast<AttTierend *>(element);
+        assert(att);
+        att->SetTieLwidth(att->StrToStr(attrValue));
+    }));
+    (*setters)["measperf"].push_back(std::make_pair(ATT_TREMMEASURED, [](Object *element, const char *attrValue) {
+        AttTremmeasured *att = dynamic_cast<AttTremmeasured *>(element);
+        assert(att);
+        att->SetMeasperf(att->StrToDuration(attrValue));
+    }));
+    (*setters)["bracket.place"].push_back(std::make_pair(ATT_TUPLETVIS, [](Object *element, const char *attrValue) {
+        AttTupletVis *att = dynamic_cast<AttTupletVis *>(element);
+        assert(att);
+        att->SetBracketPlace(att->StrToPlace(attrValue));
+    }));
+    (*setters)["bracket.visible"].push_back(std::make_pair(ATT_TUPLETVIS, [](Object *element, const char *attrValue) {
+        AttTupletVis *att = dynamic_cast<AttTupletVis *>(element);
+        assert(att);
+        att->SetBracketVisible(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["dur.visible"].push_back(std::make_pair(ATT_TUPLETVIS, [](Object *element, const char *attrValue) {
+        AttTupletVis *att = dynamic_cast<AttTupletVis *>(element);
+        assert(att);
+        att->SetDurVisible(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["num.format"].push_back(std::make_pair(ATT_TUPLETVIS, [](Object *element, const char *attrValue) {
+        AttTupletVis *att = dynamic_cast<AttTupletVis *>(element);
+        assert(att);
+        att->SetNumFormat(att->StrToTupletVisNumformat(attrValue));
+    }));
+}
+
 } // vrv namespace
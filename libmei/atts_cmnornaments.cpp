@@ -261,11 +261,11 @@ bool Att::SetCmnornaments(Object *element, std::string attrType, std::string att
         AttMordentLog *att = dynamic_cast<AttMordentLog *>(element);
         assert(att);
         if (attrType == "form") {
-            att->SetForm(att->StrToMordentLogForm(attrValue));
+            att->SetForm(att->StrToMordentLogForm(attrValue.c_str()));
             return true;
         }
         if (attrType == "long") {
-            att->SetLong(att->StrToBoolean(attrValue));
+            att->SetLong(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -281,11 +281,11 @@ bool Att::SetCmnornaments(Object *element, std::string attrType, std::string att
         AttOrnamentaccid *att = dynamic_cast<AttOrnamentaccid *>(element);
         assert(att);
         if (attrType == "accidupper") {
-            att->SetAccidupper(att->StrToAccidentalExplicit(attrValue));
+            att->SetAccidupper(att->StrToAccidentalExplicit(attrValue.c_str()));
             return true;
         }
         if (attrType == "accidlower") {
-            att->SetAccidlower(att->StrToAccidentalExplicit(attrValue));
+            att->SetAccidlower(att->StrToAccidentalExplicit(attrValue.c_str()));
             return true;
         }
     }
@@ -293,11 +293,11 @@ bool Att::SetCmnornaments(Object *element, std::string attrType, std::string att
         AttTurnLog *att = dynamic_cast<AttTurnLog *>(element);
         assert(att);
         if (attrType == "delayed") {
-            att->SetDelayed(att->StrToBoolean(attrValue));
+            att->SetDelayed(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
         if (attrType == "form") {
-            att->SetForm(att->StrToTurnLogForm(attrValue));
+            att->SetForm(att->StrToTurnLogForm(attrValue.c_str()));
             return true;
         }
     }
@@ -346,4 +346,43 @@ void Att::GetCmnornaments(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillCmnornamentsSetters(MapOfAttSetters *setters)
+{
+    (*setters)["form"].push_back(std::make_pair(ATT_MORDENTLOG, [](Object *element, const char *attrValue) {
+        AttMordentLog *att = dynamic_cast<AttMordentLog *>(element);
+        assert(att);
+        att->SetForm(att->StrToMordentLogForm(attrValue));
+    }));
+    (*setters)["long"].push_back(std::make_pair(ATT_MORDENTLOG, [](Object *element, const char *attrValue) {
+        AttMordentLog *att = dynamic_cast<AttMordentLog *>(element);
+        assert(att);
+        att->SetLong(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["ornam"].push_back(std::make_pair(ATT_ORNAM, [](Object *element, const char *attrValue) {
+        AttOrnam *att = dynamic_cast<AttOrnam *>(element);
+        assert(att);
+        att->SetOrnam(att->StrToStr(attrValue));
+    }));
+    (*setters)["accidupper"].push_back(std::make_pair(ATT_ORNAMENTACCID, [](Object *element, const char *attrValue) {
+        AttOrnamentaccid *att = dynamic_cast<AttOrnamentaccid *>(element);
+        assert(att);
+        att->SetAccidupper(att->StrToAccidentalExplicit(attrValue));
+    }));
+    (*setters)["accidlower"].push_back(std::make_pair(ATT_ORNAMENTACCID, [](Object *element, const char *attrValue) {
+        AttOrnamentaccid *att = dynamic_cast<AttOrnamentaccid *>(element);
+        assert(att);
+        att->SetAccidlower(att->StrToAccidentalExplicit(attrValue));
+    }));
+    (*setters)["delayed"].push_back(std::make_pair(ATT_TURNLOG, [](Object *element, const char *attrValue) {
+        AttTurnLog *att = dynamic_cast<AttTurnLog *>(element);
+        assert(att);
+        att->SetDelayed(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["form"].push_back(std::make_pair(ATT_TURNLOG, [](Object *element, const char *attrValue) {
+        AttTurnLog *att = dynamic_cast<AttTurnLog *>(element);
+        assert(att);
+        att->SetForm(att->StrToTurnLogForm(attrValue));
+    }));
+}
+
 } // vrv namespace
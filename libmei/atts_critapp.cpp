@@ -158,4 +158,18 @@ void Att::GetCritapp(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillCritappSetters(MapOfAttSetters *setters)
+{
+    (*setters)["cause"].push_back(std::make_pair(ATT_CRIT, [](Object *element, const char *attrValue) {
+        AttCrit *att = dynamic_cast<AttCrit *>(element);
+        assert(att);
+        att->SetCause(att->StrToStr(attrValue));
+    }));
+    (*setters)["source"].push_back(std::make_pair(ATT_SOURCE, [](Object *element, const char *attrValue) {
+        AttSource *att = dynamic_cast<AttSource *>(element);
+        assert(att);
+        att->SetSource(att->StrToStr(attrValue));
+    }));
+}
+
 } // vrv namespace
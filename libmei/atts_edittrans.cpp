@@ -239,7 +239,7 @@ bool Att::SetEdittrans(Object *element, std::string attrType, std::string attrVa
         AttEvidence *att = dynamic_cast<AttEvidence *>(element);
         assert(att);
         if (attrType == "cert") {
-            att->SetCert(att->StrToCertainty(attrValue));
+            att->SetCert(att->StrToCertainty(attrValue.c_str()));
             return true;
         }
         if (attrType == "evidence") {
@@ -302,4 +302,33 @@ void Att::GetEdittrans(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillEdittransSetters(MapOfAttSetters *setters)
+{
+    (*setters)["agent"].push_back(std::make_pair(ATT_AGENTIDENT, [](Object *element, const char *attrValue) {
+        AttAgentident *att = dynamic_cast<AttAgentident *>(element);
+        assert(att);
+        att->SetAgent(att->StrToStr(attrValue));
+    }));
+    (*setters)["cert"].push_back(std::make_pair(ATT_EVIDENCE, [](Object *element, const char *attrValue) {
+        AttEvidence *att = dynamic_cast<AttEvidence *>(element);
+        assert(att);
+        att->SetCert(att->StrToCertainty(attrValue));
+    }));
+    (*setters)["evidence"].push_back(std::make_pair(ATT_EVIDENCE, [](Object *element, const char *attrValue) {
+        AttEvidence *att = dynamic_cast<AttEvidence *>(element);
+        assert(att);
+        att->SetEvidence(att->StrToStr(attrValue));
+    }));
+    (*setters)["extent"].push_back(std::make_pair(ATT_EXTENT, [](Object *element, const char *attrValue) {
+        AttExtent *att = dynamic_cast<AttExtent *>(element);
+        assert(att);
+        att->SetExtent(att->StrToStr(attrValue));
+    }));
+    (*setters)["reason"].push_back(std::make_pair(ATT_REASONIDENT, [](Object *element, const char *attrValue) {
+        AttReasonident *att = dynamic_cast<AttReasonident *>(element);
+        assert(att);
+        att->SetReason(att->StrToStr(attrValue));
+    }));
+}
+
 } // vrv namespace
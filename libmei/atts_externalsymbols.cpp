@@ -119,4 +119,18 @@ void Att::GetExternalsymbols(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillExternalsymbolsSetters(MapOfAttSetters *setters)
+{
+    (*setters)["glyphname"].push_back(std::make_pair(ATT_EXTSYM, [](Object *element, const char *attrValue) {
+        AttExtsym *att = dynamic_cast<AttExtsym *>(element);
+        assert(att);
+        att->SetGlyphname(att->StrToStr(attrValue));
+    }));
+    (*setters)["glyphnum"].push_back(std::make_pair(ATT_EXTSYM, [](Object *element, const char *attrValue) {
+        AttExtsym *att = dynamic_cast<AttExtsym *>(element);
+        assert(att);
+        att->SetGlyphnum(att->StrToWcharT(attrValue));
+    }));
+}
+
 } // vrv namespace
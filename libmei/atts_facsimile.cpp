@@ -97,4 +97,13 @@ void Att::GetFacsimile(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillFacsimileSetters(MapOfAttSetters *setters)
+{
+    (*setters)["facs"].push_back(std::make_pair(ATT_FACSIMILE, [](Object *element, const char *attrValue) {
+        AttFacsimile *att = dynamic_cast<AttFacsimile *>(element);
+        assert(att);
+        att->SetFacs(att->StrToUris(attrValue));
+    }));
+}
+
 } // vrv namespace
@@ -119,4 +119,18 @@ void Att::GetFigtable(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillFigtableSetters(MapOfAttSetters *setters)
+{
+    (*setters)["colspan"].push_back(std::make_pair(ATT_TABULAR, [](Object *element, const char *attrValue) {
+        AttTabular *att = dynamic_cast<AttTabular *>(element);
+        assert(att);
+        att->SetColspan(att->StrToInt(attrValue));
+    }));
+    (*setters)["rowspan"].push_back(std::make_pair(ATT_TABULAR, [](Object *element, const char *attrValue) {
+        AttTabular *att = dynamic_cast<AttTabular *>(element);
+        assert(att);
+        att->SetRowspan(att->StrToInt(attrValue));
+    }));
+}
+
 } // vrv namespace
@@ -186,7 +186,7 @@ bool Att::SetHarmony(Object *element, std::string attrType, std::string attrValu
         AttHarmVis *att = dynamic_cast<AttHarmVis *>(element);
         assert(att);
         if (attrType == "rendgrid") {
-            att->SetRendgrid(att->StrToHarmVisRendgrid(attrValue));
+            att->SetRendgrid(att->StrToHarmVisRendgrid(attrValue.c_str()));
             return true;
         }
     }
@@ -219,4 +219,23 @@ void Att::GetHarmony(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillHarmonySetters(MapOfAttSetters *setters)
+{
+    (*setters)["fret"].push_back(std::make_pair(ATT_FRETLOCATION, [](Object *element, const char *attrValue) {
+        AttFretlocation *att = dynamic_cast<AttFretlocation *>(element);
+        assert(att);
+        att->SetFret(att->StrToFret(attrValue));
+    }));
+    (*setters)["chordref"].push_back(std::make_pair(ATT_HARMLOG, [](Object *element, const char *attrValue) {
+        AttHarmLog *att = dynamic_cast<AttHarmLog *>(element);
+        assert(att);
+        att->SetChordref(att->StrToStr(attrValue));
+    }));
+    (*setters)["rendgrid"].push_back(std::make_pair(ATT_HARMVIS, [](Object *element, const char *attrValue) {
+        AttHarmVis *att = dynamic_cast<AttHarmVis *>(element);
+        assert(att);
+        att->SetRendgrid(att->StrToHarmVisRendgrid(attrValue));
+    }));
+}
+
 } // vrv namespace
@@ -78,7 +78,7 @@ bool Att::SetHeader(Object *element, std::string attrType, std::string attrValue
         AttRegularmethod *att = dynamic_cast<AttRegularmethod *>(element);
         assert(att);
         if (attrType == "method") {
-            att->SetMethod(att->StrToRegularmethodMethod(attrValue));
+            att->SetMethod(att->StrToRegularmethodMethod(attrValue.c_str()));
             return true;
         }
     }
@@ -97,4 +97,13 @@ void Att::GetHeader(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillHeaderSetters(MapOfAttSetters *setters)
+{
+    (*setters)["method"].push_back(std::make_pair(ATT_REGULARMETHOD, [](Object *element, const char *attrValue) {
+        AttRegularmethod *att = dynamic_cast<AttRegularmethod *>(element);
+        assert(att);
+        att->SetMethod(att->StrToRegularmethodMethod(attrValue));
+    }));
+}
+
 } // vrv namespace
@@ -93,7 +93,7 @@ bool Att::SetLyrics(Object *element, std::string attrType, std::string attrValue
         AttVerseLog *att = dynamic_cast<AttVerseLog *>(element);
         assert(att);
         if (attrType == "refrain") {
-            att->SetRefrain(att->StrToBoolean(attrValue));
+            att->SetRefrain(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
         if (attrType == "rhythm") {
@@ -119,4 +119,18 @@ void Att::GetLyrics(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillLyricsSetters(MapOfAttSetters *setters)
+{
+    (*setters)["refrain"].push_back(std::make_pair(ATT_VERSELOG, [](Object *element, const char *attrValue) {
+        AttVerseLog *att = dynamic_cast<AttVerseLog *>(element);
+        assert(att);
+        att->SetRefrain(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["rhythm"].push_back(std::make_pair(ATT_VERSELOG, [](Object *element, const char *attrValue) {
+        AttVerseLog *att = dynamic_cast<AttVerseLog *>(element);
+        assert(att);
+        att->SetRhythm(att->StrToStr(attrValue));
+    }));
+}
+
 } // vrv namespace
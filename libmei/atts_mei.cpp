@@ -93,7 +93,7 @@ bool Att::SetMei(Object *element, std::string attrType, std::string attrValue)
         AttNotationtype *att = dynamic_cast<AttNotationtype *>(element);
         assert(att);
         if (attrType == "notationtype") {
-            att->SetNotationtype(att->StrToNotationtype(attrValue));
+            att->SetNotationtype(att->StrToNotationtype(attrValue.c_str()));
             return true;
         }
         if (attrType == "notationsubtype") {
@@ -119,4 +119,19 @@ void Att::GetMei(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillMeiSetters(MapOfAttSetters *setters)
+{
+    (*setters)["notationtype"].push_back(std::make_pair(ATT_NOTATIONTYPE, [](Object *element, const char *attrValue) {
+        AttNotationtype *att = dynamic_cast<AttNotationtype *>(element);
+        assert(att);
+        att->SetNotationtype(att->StrToNotationtype(attrValue));
+    }));
+    (*setters)["notationsubtype"].push_back(
+        std::make_pair(ATT_NOTATIONTYPE, [](Object *element, const char *attrValue) {
+            AttNotationtype *att = dynamic_cast<AttNotationtype *>(element);
+            assert(att);
+            att->SetNotationsubtype(att->StrToStr(attrValue));
+        }));
+}
+
 } // vrv namespace
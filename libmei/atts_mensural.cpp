@@ -534,7 +534,7 @@ bool Att::SetMensural(Object *element, std::string attrType, std::string attrVal
         AttLigatureLog *att = dynamic_cast<AttLigatureLog *>(element);
         assert(att);
         if (attrType == "form") {
-            att->SetForm(att->StrToLigatureform(attrValue));
+            att->SetForm(att->StrToLigatureform(attrValue.c_str()));
             return true;
         }
     }
@@ -542,7 +542,7 @@ bool Att::SetMensural(Object *element, std::string attrType, std::string attrVal
         AttMensurVis *att = dynamic_cast<AttMensurVis *>(element);
         assert(att);
         if (attrType == "form") {
-            att->SetForm(att->StrToMensurVisForm(attrValue));
+            att->SetForm(att->StrToMensurVisForm(attrValue.c_str()));
             return true;
         }
         if (attrType == "orient") {
@@ -554,11 +554,11 @@ bool Att::SetMensural(Object *element, std::string attrType, std::string attrVal
         AttMensuralLog *att = dynamic_cast<AttMensuralLog *>(element);
         assert(att);
         if (attrType == "mensur.dot") {
-            att->SetMensurDot(att->StrToBoolean(attrValue));
+            att->SetMensurDot(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
         if (attrType == "mensur.sign") {
-            att->SetMensurSign(att->StrToMensurationsign(attrValue));
+            att->SetMensurSign(att->StrToMensurationsign(attrValue.c_str()));
             return true;
         }
         if (attrType == "mensur.slash") {
@@ -602,7 +602,7 @@ bool Att::SetMensural(Object *element, std::string attrType, std::string attrVal
             return true;
         }
         if (attrType == "mensur.form") {
-            att->SetMensurForm(att->StrToMensuralVisMensurform(attrValue));
+            att->SetMensurForm(att->StrToMensuralVisMensurform(attrValue.c_str()));
             return true;
         }
         if (attrType == "mensur.loc") {
@@ -614,7 +614,7 @@ bool Att::SetMensural(Object *element, std::string attrType, std::string attrVal
             return true;
         }
         if (attrType == "mensur.size") {
-            att->SetMensurSize(att->StrToSize(attrValue));
+            att->SetMensurSize(att->StrToSize(attrValue.c_str()));
             return true;
         }
     }
@@ -622,7 +622,7 @@ bool Att::SetMensural(Object *element, std::string attrType, std::string attrVal
         AttNoteLogMensural *att = dynamic_cast<AttNoteLogMensural *>(element);
         assert(att);
         if (attrType == "lig") {
-            att->SetLig(att->StrToNoteLogMensuralLig(attrValue));
+            att->SetLig(att->StrToNoteLogMensuralLig(attrValue.c_str()));
             return true;
         }
     }
@@ -727,4 +727,103 @@ void Att::GetMensural(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillMensuralSetters(MapOfAttSetters *setters)
+{
+    (*setters)["form"].push_back(std::make_pair(ATT_LIGATURELOG, [](Object *element, const char *attrValue) {
+        AttLigatureLog *att = dynamic_cast<AttLigatureLog *>(element);
+        assert(att);
+        att->SetForm(att->StrToLigatureform(attrValue));
+    }));
+    (*setters)["form"].push_back(std::make_pair(ATT_MENSURVIS, [](Object *element, const char *attrValue) {
+        AttMensurVis *att = dynamic_cast<AttMensurVis *>(element);
+        assert(att);
+        att->SetForm(att->StrToMensurVisForm(attrValue));
+    }));
+    (*setters)["orient"].push_back(std::make_pair(ATT_MENSURVIS, [](Object *element, const char *attrValue) {
+        AttMensurVis *att = dynamic_cast<AttMensurVis *>(element);
+        assert(att);
+        att->SetOrient(att->StrToOrientation(attrValue));
+    }));
+    (*setters)["mensur.dot"].push_back(std::make_pair(ATT_MENSURALLOG, [](Object *element, const char *attrValue) {
+        AttMensuralLog *att = dynamic_cast<AttMensuralLog *>(element);
+        assert(att);
+        att->SetMensurDot(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["mensur.sign"].push_back(std::make_pair(ATT_MENSURALLOG, [](Object *element, const char *attrValue) {
+        AttMensuralLog *att = dynamic_cast<AttMensuralLog *>(element);
+        assert(att);
+        att->SetMensurSign(att->StrToMensurationsign(attrValue));
+    }));
+    (*setters)["mensur.slash"].push_back(std::make_pair(ATT_MENSURALLOG, [](Object *element, const char *attrValue) {
+        AttMensuralLog *att = dynamic_cast<AttMensuralLog *>(element);
+        assert(att);
+        att->SetMensurSlash(att->StrToInt(attrValue));
+    }));
+    (*setters)["proport.num"].push_back(std::make_pair(ATT_MENSURALLOG, [](Object *element, const char *attrValue) {
+        AttMensuralLog *att = dynamic_cast<AttMensuralLog *>(element);
+        assert(att);
+        att->SetProportNum(att->StrToInt(attrValue));
+    }));
+    (*setters)["proport.numbase"].push_back(std::make_pair(ATT_MENSURALLOG, [](Object *element, const char *attrValue) {
+        AttMensuralLog *att = dynamic_cast<AttMensuralLog *>(element);
+        assert(att);
+        att->SetProportNumbase(att->StrToInt(attrValue));
+    }));
+    (*setters)["modusmaior"].push_back(std::make_pair(ATT_MENSURALSHARED, [](Object *element, const char *attrValue) {
+        AttMensuralShared *att = dynamic_cast<AttMensuralShared *>(element);
+        assert(att);
+        att->SetModusmaior(att->StrToModusmaior(attrValue));
+    }));
+    (*setters)["modusminor"].push_back(std::make_pair(ATT_MENSURALSHARED, [](Object *element, const char *attrValue) {
+        AttMensuralShared *att = dynamic_cast<AttMensuralShared *>(element);
+        assert(att);
+        att->SetModusminor(att->StrToModusminor(attrValue));
+    }));
+    (*setters)["prolatio"].push_back(std::make_pair(ATT_MENSURALSHARED, [](Object *element, const char *attrValue) {
+        AttMensuralShared *att = dynamic_cast<AttMensuralShared *>(element);
+        assert(att);
+        att->SetProlatio(att->StrToProlatio(attrValue));
+    }));
+    (*setters)["tempus"].push_back(std::make_pair(ATT_MENSURALSHARED, [](Object *element, const char *attrValue) {
+        AttMensuralShared *att = dynamic_cast<AttMensuralShared *>(element);
+        assert(att);
+        att->SetTempus(att->StrToTempus(attrValue));
+    }));
+    (*setters)["mensur.color"].push_back(std::make_pair(ATT_MENSURALVIS, [](Object *element, const char *attrValue) {
+        AttMensuralVis *att = dynamic_cast<AttMensuralVis *>(element);
+        assert(att);
+        att->SetMensurColor(att->StrToStr(attrValue));
+    }));
+    (*setters)["mensur.form"].push_back(std::make_pair(ATT_MENSURALVIS, [](Object *element, const char *attrValue) {
+        AttMensuralVis *att = dynamic_cast<AttMensuralVis *>(element);
+        assert(att);
+        att->SetMensurForm(att->StrToMensuralVisMensurform(attrValue));
+    }));
+    (*setters)["mensur.loc"].push_back(std::make_pair(ATT_MENSURALVIS, [](Object *element, const char *attrValue) {
+        AttMensuralVis *att = dynamic_cast<AttMensuralVis *>(element);
+        assert(att);
+        att->SetMensurLoc(att->StrToInt(attrValue));
+    }));
+    (*setters)["mensur.orient"].push_back(std::make_pair(ATT_MENSURALVIS, [](Object *element, const char *attrValue) {
+        AttMensuralVis *att = dynamic_cast<AttMensuralVis *>(element);
+        assert(att);
+        att->SetMensurOrient(att->StrToOrientation(attrValue));
+    }));
+    (*setters)["mensur.size"].push_back(std::make_pair(ATT_MENSURALVIS, [](Object *element, const char *attrValue) {
+        AttMensuralVis *att = dynamic_cast<AttMensuralVis *>(element);
+        assert(att);
+        att->SetMensurSize(att->StrToSize(attrValue));
+    }));
+    (*setters)["lig"].push_back(std::make_pair(ATT_NOTELOGMENSURAL, [](Object *element, const char *attrValue) {
+        AttNoteLogMensural *att = dynamic_cast<AttNoteLogMensural *>(element);
+        assert(att);
+        att->SetLig(att->StrToNoteLogMensuralLig(attrValue));
+    }));
+    (*setters)["spaces"].push_back(std::make_pair(ATT_RESTVISMENSURAL, [](Object *element, const char *attrValue) {
+        AttRestVisMensural *att = dynamic_cast<AttRestVisMensural *>(element);
+        assert(att);
+        att->SetSpaces(att->StrToInt(attrValue));
+    }));
+}
+
 } // vrv namespace
@@ -529,7 +529,7 @@ bool Att::SetMidi(Object *element, std::string attrType, std::string attrValue)
             return true;
         }
         if (attrType == "midi.instrname") {
-            att->SetMidiInstrname(att->StrToMidinames(attrValue));
+            att->SetMidiInstrname(att->StrToMidinames(attrValue.c_str()));
             return true;
         }
         if (attrType == "midi.pan") {
@@ -678,4 +678,85 @@ void Att::GetMidi(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillMidiSetters(MapOfAttSetters *setters)
+{
+    (*setters)["midi.channel"].push_back(std::make_pair(ATT_CHANNELIZED, [](Object *element, const char *attrValue) {
+        AttChannelized *att = dynamic_cast<AttChannelized *>(element);
+        assert(att);
+        att->SetMidiChannel(att->StrToMidichannel(attrValue));
+    }));
+    (*setters)["midi.duty"].push_back(std::make_pair(ATT_CHANNELIZED, [](Object *element, const char *attrValue) {
+        AttChannelized *att = dynamic_cast<AttChannelized *>(element);
+        assert(att);
+        att->SetMidiDuty(att->StrToPercent(attrValue));
+    }));
+    (*setters)["midi.port"].push_back(std::make_pair(ATT_CHANNELIZED, [](Object *element, const char *attrValue) {
+        AttChannelized *att = dynamic_cast<AttChannelized *>(element);
+        assert(att);
+        att->SetMidiPort(att->StrToMidivalue(attrValue));
+    }));
+    (*setters)["midi.track"].push_back(std::make_pair(ATT_CHANNELIZED, [](Object *element, const char *attrValue) {
+        AttChannelized *att = dynamic_cast<AttChannelized *>(element);
+        assert(att);
+        att->SetMidiTrack(att->StrToInt(attrValue));
+    }));
+    (*setters)["midi.instrnum"].push_back(
+        std::make_pair(ATT_MIDIINSTRUMENT, [](Object *element, const char *attrValue) {
+            AttMidiinstrument *att = dynamic_cast<AttMidiinstrument *>(element);
+            assert(att);
+            att->SetMidiInstrnum(att->StrToMidivalue(attrValue));
+        }));
+    (*setters)["midi.instrname"].push_back(
+        std::make_pair(ATT_MIDIINSTRUMENT, [](Object *element, const char *attrValue) {
+            AttMidiinstrument *att = dynamic_cast<AttMidiinstrument *>(element);
+            assert(att);
+            att->SetMidiInstrname(att->StrToMidinames(attrValue));
+        }));
+    (*setters)["midi.pan"].push_back(std::make_pair(ATT_MIDIINSTRUMENT, [](Object *element, const char *attrValue) {
+        AttMidiinstrument *att = dynamic_cast<AttMidiinstrument *>(element);
+        assert(att);
+        att->SetMidiPan(att->StrToMidivalue(attrValue));
+    }));
+    (*setters)["midi.volume"].push_back(std::make_pair(ATT_MIDIINSTRUMENT, [](Object *element, const char *attrValue) {
+        AttMidiinstrument *att = dynamic_cast<AttMidiinstrument *>(element);
+        assert(att);
+        att->SetMidiVolume(att->StrToMidivalue(attrValue));
+    }));
+    (*setters)["num"].push_back(std::make_pair(ATT_MIDINUMBER, [](Object *element, const char *attrValue) {
+        AttMidinumber *att = dynamic_cast<AttMidinumber *>(element);
+        assert(att);
+        att->SetNum(att->StrToInt(attrValue));
+    }));
+    (*setters)["midi.bpm"].push_back(std::make_pair(ATT_MIDITEMPO, [](Object *element, const char *attrValue) {
+        AttMiditempo *att = dynamic_cast<AttMiditempo *>(element);
+        assert(att);
+        att->SetMidiBpm(att->StrToMidibpm(attrValue));
+    }));
+    (*setters)["midi.mspb"].push_back(std::make_pair(ATT_MIDITEMPO, [](Object *element, const char *attrValue) {
+        AttMiditempo *att = dynamic_cast<AttMiditempo *>(element);
+        assert(att);
+        att->SetMidiMspb(att->StrToMidimspb(attrValue));
+    }));
+    (*setters)["val"].push_back(std::make_pair(ATT_MIDIVALUE, [](Object *element, const char *attrValue) {
+        AttMidivalue *att = dynamic_cast<AttMidivalue *>(element);
+        assert(att);
+        att->SetVal(att->StrToMidivalue(attrValue));
+    }));
+    (*setters)["val2"].push_back(std::make_pair(ATT_MIDIVALUE2, [](Object *element, const char *attrValue) {
+        AttMidivalue2 *att = dynamic_cast<AttMidivalue2 *>(element);
+        assert(att);
+        att->SetVal2(att->StrToMidivalue(attrValue));
+    }));
+    (*setters)["vel"].push_back(std::make_pair(ATT_MIDIVELOCITY, [](Object *element, const char *attrValue) {
+        AttMidivelocity *att = dynamic_cast<AttMidivelocity *>(element);
+        assert(att);
+        att->SetVel(att->StrToMidivalue(attrValue));
+    }));
+    (*setters)["ppq"].push_back(std::make_pair(ATT_TIMEBASE, [](Object *element, const char *attrValue) {
+        AttTimebase *att = dynamic_cast<AttTimebase *>(element);
+        assert(att);
+        att->SetPpq(att->StrToInt(attrValue));
+    }));
+}
+
 } // vrv namespace
@@ -154,11 +154,11 @@ bool Att::SetNeumes(Object *element, std::string attrType, std::string attrValue
         AttIneumeLog *att = dynamic_cast<AttIneumeLog *>(element);
         assert(att);
         if (attrType == "form") {
-            att->SetForm(att->StrToIneumeform(attrValue));
+            att->SetForm(att->StrToIneumeform(attrValue.c_str()));
             return true;
         }
         if (attrType == "name") {
-            att->SetName(att->StrToIneumename(attrValue));
+            att->SetName(att->StrToIneumename(attrValue.c_str()));
             return true;
         }
     }
@@ -166,11 +166,11 @@ bool Att::SetNeumes(Object *element, std::string attrType, std::string attrValue
         AttUneumeLog *att = dynamic_cast<AttUneumeLog *>(element);
         assert(att);
         if (attrType == "form") {
-            att->SetForm(att->StrToUneumeform(attrValue));
+            att->SetForm(att->StrToUneumeform(attrValue.c_str()));
             return true;
         }
         if (attrType == "name") {
-            att->SetName(att->StrToUneumename(attrValue));
+            att->SetName(att->StrToUneumename(attrValue.c_str()));
             return true;
         }
     }
@@ -202,4 +202,28 @@ void Att::GetNeumes(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillNeumesSetters(MapOfAttSetters *setters)
+{
+    (*setters)["form"].push_back(std::make_pair(ATT_INEUMELOG, [](Object *element, const char *attrValue) {
+        AttIneumeLog *att = dynamic_cast<AttIneumeLog *>(element);
+        assert(att);
+        att->SetForm(att->StrToIneumeform(attrValue));
+    }));
+    (*setters)["name"].push_back(std::make_pair(ATT_INEUMELOG, [](Object *element, const char *attrValue) {
+        AttIneumeLog *att = dynamic_cast<AttIneumeLog *>(element);
+        assert(att);
+        att->SetName(att->StrToIneumename(attrValue));
+    }));
+    (*setters)["form"].push_back(std::make_pair(ATT_UNEUMELOG, [](Object *element, const char *attrValue) {
+        AttUneumeLog *att = dynamic_cast<AttUneumeLog *>(element);
+        assert(att);
+        att->SetForm(att->StrToUneumeform(attrValue));
+    }));
+    (*setters)["name"].push_back(std::make_pair(ATT_UNEUMELOG, [](Object *element, const char *attrValue) {
+        AttUneumeLog *att = dynamic_cast<AttUneumeLog *>(element);
+        assert(att);
+        att->SetName(att->StrToUneumename(attrValue));
+    }));
+}
+
 } // vrv namespace
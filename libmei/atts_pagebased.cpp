@@ -97,4 +97,13 @@ void Att::GetPagebased(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillPagebasedSetters(MapOfAttSetters *setters)
+{
+    (*setters)["surface"].push_back(std::make_pair(ATT_SURFACE, [](Object *element, const char *attrValue) {
+        AttSurface *att = dynamic_cast<AttSurface *>(element);
+        assert(att);
+        att->SetSurface(att->StrToStr(attrValue));
+    }));
+}
+
 } // vrv namespace
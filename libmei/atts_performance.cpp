@@ -97,4 +97,13 @@ void Att::GetPerformance(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillPerformanceSetters(MapOfAttSetters *setters)
+{
+    (*setters)["when"].push_back(std::make_pair(ATT_ALIGNMENT, [](Object *element, const char *attrValue) {
+        AttAlignment *att = dynamic_cast<AttAlignment *>(element);
+        assert(att);
+        att->SetWhen(att->StrToStr(attrValue));
+    }));
+}
+
 } // vrv namespace
@@ -8472,7 +8472,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttAccidLog *att = dynamic_cast<AttAccidLog *>(element);
         assert(att);
         if (attrType == "func") {
-            att->SetFunc(att->StrToAccidLogFunc(attrValue));
+            att->SetFunc(att->StrToAccidLogFunc(attrValue.c_str()));
             return true;
         }
     }
@@ -8480,7 +8480,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttAccidental *att = dynamic_cast<AttAccidental *>(element);
         assert(att);
         if (attrType == "accid") {
-            att->SetAccid(att->StrToAccidentalExplicit(attrValue));
+            att->SetAccid(att->StrToAccidentalExplicit(attrValue.c_str()));
             return true;
         }
     }
@@ -8488,7 +8488,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttAccidentalPerformed *att = dynamic_cast<AttAccidentalPerformed *>(element);
         assert(att);
         if (attrType == "accid.ges") {
-            att->SetAccidGes(att->StrToAccidentalImplicit(attrValue));
+            att->SetAccidGes(att->StrToAccidentalImplicit(attrValue.c_str()));
             return true;
         }
     }
@@ -8504,7 +8504,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttArticulationPerformed *att = dynamic_cast<AttArticulationPerformed *>(element);
         assert(att);
         if (attrType == "artic.ges") {
-            att->SetArticGes(att->StrToArticulation(attrValue));
+            att->SetArticGes(att->StrToArticulation(attrValue.c_str()));
             return true;
         }
     }
@@ -8532,7 +8532,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttBarLineLog *att = dynamic_cast<AttBarLineLog *>(element);
         assert(att);
         if (attrType == "form") {
-            att->SetForm(att->StrToBarrendition(attrValue));
+            att->SetForm(att->StrToBarrendition(attrValue.c_str()));
             return true;
         }
     }
@@ -8540,7 +8540,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttBarplacement *att = dynamic_cast<AttBarplacement *>(element);
         assert(att);
         if (attrType == "barplace") {
-            att->SetBarplace(att->StrToBarplace(attrValue));
+            att->SetBarplace(att->StrToBarplace(attrValue.c_str()));
             return true;
         }
         if (attrType == "taktplace") {
@@ -8556,7 +8556,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
             return true;
         }
         if (attrType == "beam.rend") {
-            att->SetBeamRend(att->StrToBeamingVisBeamrend(attrValue));
+            att->SetBeamRend(att->StrToBeamingVisBeamrend(attrValue.c_str()));
             return true;
         }
         if (attrType == "beam.slope") {
@@ -8592,7 +8592,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttChordVis *att = dynamic_cast<AttChordVis *>(element);
         assert(att);
         if (attrType == "cluster") {
-            att->SetCluster(att->StrToCluster(attrValue));
+            att->SetCluster(att->StrToCluster(attrValue.c_str()));
             return true;
         }
     }
@@ -8608,7 +8608,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttClefLog *att = dynamic_cast<AttClefLog *>(element);
         assert(att);
         if (attrType == "cautionary") {
-            att->SetCautionary(att->StrToBoolean(attrValue));
+            att->SetCautionary(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -8616,7 +8616,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttCleffingLog *att = dynamic_cast<AttCleffingLog *>(element);
         assert(att);
         if (attrType == "clef.shape") {
-            att->SetClefShape(att->StrToClefshape(attrValue));
+            att->SetClefShape(att->StrToClefshape(attrValue.c_str()));
             return true;
         }
         if (attrType == "clef.line") {
@@ -8628,7 +8628,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
             return true;
         }
         if (attrType == "clef.dis.place") {
-            att->SetClefDisPlace(att->StrToPlace(attrValue));
+            att->SetClefDisPlace(att->StrToPlace(attrValue.c_str()));
             return true;
         }
     }
@@ -8640,7 +8640,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
             return true;
         }
         if (attrType == "clef.visible") {
-            att->SetClefVisible(att->StrToBoolean(attrValue));
+            att->SetClefVisible(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -8648,7 +8648,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttClefshape *att = dynamic_cast<AttClefshape *>(element);
         assert(att);
         if (attrType == "shape") {
-            att->SetShape(att->StrToClefshape(attrValue));
+            att->SetShape(att->StrToClefshape(attrValue.c_str()));
             return true;
         }
     }
@@ -8664,7 +8664,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttColoration *att = dynamic_cast<AttColoration *>(element);
         assert(att);
         if (attrType == "colored") {
-            att->SetColored(att->StrToBoolean(attrValue));
+            att->SetColored(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -8720,7 +8720,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
             return true;
         }
         if (attrType == "curvedir") {
-            att->SetCurvedir(att->StrToCurvatureCurvedir(attrValue));
+            att->SetCurvedir(att->StrToCurvatureCurvedir(attrValue.c_str()));
             return true;
         }
     }
@@ -8728,7 +8728,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttCurverend *att = dynamic_cast<AttCurverend *>(element);
         assert(att);
         if (attrType == "lform") {
-            att->SetLform(att->StrToLineform(attrValue));
+            att->SetLform(att->StrToLineform(attrValue.c_str()));
             return true;
         }
         if (attrType == "lwidth") {
@@ -8804,7 +8804,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttDotLog *att = dynamic_cast<AttDotLog *>(element);
         assert(att);
         if (attrType == "form") {
-            att->SetForm(att->StrToDotLogForm(attrValue));
+            att->SetForm(att->StrToDotLogForm(attrValue.c_str()));
             return true;
         }
     }
@@ -8864,7 +8864,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttEnclosingchars *att = dynamic_cast<AttEnclosingchars *>(element);
         assert(att);
         if (attrType == "enclose") {
-            att->SetEnclose(att->StrToEnclosure(attrValue));
+            att->SetEnclose(att->StrToEnclosure(attrValue.c_str()));
             return true;
         }
     }
@@ -8872,7 +8872,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttEndings *att = dynamic_cast<AttEndings *>(element);
         assert(att);
         if (attrType == "ending.rend") {
-            att->SetEndingRend(att->StrToEndingsEndingrend(attrValue));
+            att->SetEndingRend(att->StrToEndingsEndingrend(attrValue.c_str()));
             return true;
         }
     }
@@ -8880,7 +8880,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttExtender *att = dynamic_cast<AttExtender *>(element);
         assert(att);
         if (attrType == "extender") {
-            att->SetExtender(att->StrToBoolean(attrValue));
+            att->SetExtender(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -8888,7 +8888,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttFermatapresent *att = dynamic_cast<AttFermatapresent *>(element);
         assert(att);
         if (attrType == "fermata") {
-            att->SetFermata(att->StrToPlace(attrValue));
+            att->SetFermata(att->StrToPlace(attrValue.c_str()));
             return true;
         }
     }
@@ -8928,7 +8928,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttHorizontalalign *att = dynamic_cast<AttHorizontalalign *>(element);
         assert(att);
         if (attrType == "halign") {
-            att->SetHalign(att->StrToHorizontalalignment(attrValue));
+            att->SetHalign(att->StrToHorizontalalignment(attrValue.c_str()));
             return true;
         }
     }
@@ -8968,7 +8968,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
             return true;
         }
         if (attrType == "mode") {
-            att->SetMode(att->StrToMode(attrValue));
+            att->SetMode(att->StrToMode(attrValue.c_str()));
             return true;
         }
     }
@@ -8976,7 +8976,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttKeySigVis *att = dynamic_cast<AttKeySigVis *>(element);
         assert(att);
         if (attrType == "sig.showchange") {
-            att->SetSigShowchange(att->StrToBoolean(attrValue));
+            att->SetSigShowchange(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -8984,11 +8984,11 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttKeySigDefaultLog *att = dynamic_cast<AttKeySigDefaultLog *>(element);
         assert(att);
         if (attrType == "key.accid") {
-            att->SetKeyAccid(att->StrToAccidentalImplicit(attrValue));
+            att->SetKeyAccid(att->StrToAccidentalImplicit(attrValue.c_str()));
             return true;
         }
         if (attrType == "key.mode") {
-            att->SetKeyMode(att->StrToMode(attrValue));
+            att->SetKeyMode(att->StrToMode(attrValue.c_str()));
             return true;
         }
         if (attrType == "key.pname") {
@@ -9008,11 +9008,11 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttKeySigDefaultVis *att = dynamic_cast<AttKeySigDefaultVis *>(element);
         assert(att);
         if (attrType == "key.sig.show") {
-            att->SetKeySigShow(att->StrToBoolean(attrValue));
+            att->SetKeySigShow(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
         if (attrType == "key.sig.showchange") {
-            att->SetKeySigShowchange(att->StrToBoolean(attrValue));
+            att->SetKeySigShowchange(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -9056,7 +9056,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttLineVis *att = dynamic_cast<AttLineVis *>(element);
         assert(att);
         if (attrType == "form") {
-            att->SetForm(att->StrToLineform(attrValue));
+            att->SetForm(att->StrToLineform(attrValue.c_str()));
             return true;
         }
         if (attrType == "width") {
@@ -9064,7 +9064,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
             return true;
         }
         if (attrType == "endsym") {
-            att->SetEndsym(att->StrToLinestartendsymbol(attrValue));
+            att->SetEndsym(att->StrToLinestartendsymbol(attrValue.c_str()));
             return true;
         }
         if (attrType == "endsymsize") {
@@ -9072,7 +9072,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
             return true;
         }
         if (attrType == "startsym") {
-            att->SetStartsym(att->StrToLinestartendsymbol(attrValue));
+            att->SetStartsym(att->StrToLinestartendsymbol(attrValue.c_str()));
             return true;
         }
         if (attrType == "startsymsize") {
@@ -9092,7 +9092,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttLinerend *att = dynamic_cast<AttLinerend *>(element);
         assert(att);
         if (attrType == "lendsym") {
-            att->SetLendsym(att->StrToLinestartendsymbol(attrValue));
+            att->SetLendsym(att->StrToLinestartendsymbol(attrValue.c_str()));
             return true;
         }
         if (attrType == "lendsymsize") {
@@ -9100,7 +9100,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
             return true;
         }
         if (attrType == "lstartsym") {
-            att->SetLstartsym(att->StrToLinestartendsymbol(attrValue));
+            att->SetLstartsym(att->StrToLinestartendsymbol(attrValue.c_str()));
             return true;
         }
         if (attrType == "lstartsymsize") {
@@ -9112,7 +9112,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttLinerendBase *att = dynamic_cast<AttLinerendBase *>(element);
         assert(att);
         if (attrType == "lform") {
-            att->SetLform(att->StrToLineform(attrValue));
+            att->SetLform(att->StrToLineform(attrValue.c_str()));
             return true;
         }
         if (attrType == "lwidth") {
@@ -9140,11 +9140,11 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
             return true;
         }
         if (attrType == "lyric.style") {
-            att->SetLyricStyle(att->StrToFontstyle(attrValue));
+            att->SetLyricStyle(att->StrToFontstyle(attrValue.c_str()));
             return true;
         }
         if (attrType == "lyric.weight") {
-            att->SetLyricWeight(att->StrToFontweight(attrValue));
+            att->SetLyricWeight(att->StrToFontweight(attrValue.c_str()));
             return true;
         }
     }
@@ -9152,11 +9152,11 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttMeasureLog *att = dynamic_cast<AttMeasureLog *>(element);
         assert(att);
         if (attrType == "left") {
-            att->SetLeft(att->StrToBarrendition(attrValue));
+            att->SetLeft(att->StrToBarrendition(attrValue.c_str()));
             return true;
         }
         if (attrType == "right") {
-            att->SetRight(att->StrToBarrendition(attrValue));
+            att->SetRight(att->StrToBarrendition(attrValue.c_str()));
             return true;
         }
     }
@@ -9172,7 +9172,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttMeasurenumbers *att = dynamic_cast<AttMeasurenumbers *>(element);
         assert(att);
         if (attrType == "mnum.visible") {
-            att->SetMnumVisible(att->StrToBoolean(attrValue));
+            att->SetMnumVisible(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -9188,7 +9188,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
             return true;
         }
         if (attrType == "betype") {
-            att->SetBetype(att->StrToBetype(attrValue));
+            att->SetBetype(att->StrToBetype(attrValue.c_str()));
             return true;
         }
     }
@@ -9204,7 +9204,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttMeiversion *att = dynamic_cast<AttMeiversion *>(element);
         assert(att);
         if (attrType == "meiversion") {
-            att->SetMeiversion(att->StrToMeiversionMeiversion(attrValue));
+            att->SetMeiversion(att->StrToMeiversionMeiversion(attrValue.c_str()));
             return true;
         }
     }
@@ -9212,11 +9212,11 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttMensurLog *att = dynamic_cast<AttMensurLog *>(element);
         assert(att);
         if (attrType == "dot") {
-            att->SetDot(att->StrToBoolean(attrValue));
+            att->SetDot(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
         if (attrType == "sign") {
-            att->SetSign(att->StrToMensurationsign(attrValue));
+            att->SetSign(att->StrToMensurationsign(attrValue.c_str()));
             return true;
         }
     }
@@ -9228,7 +9228,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
             return true;
         }
         if (attrType == "sym") {
-            att->SetSym(att->StrToMetersign(attrValue));
+            att->SetSym(att->StrToMetersign(attrValue.c_str()));
             return true;
         }
         if (attrType == "unit") {
@@ -9240,7 +9240,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttMeterSigVis *att = dynamic_cast<AttMeterSigVis *>(element);
         assert(att);
         if (attrType == "form") {
-            att->SetForm(att->StrToMeterSigVisForm(attrValue));
+            att->SetForm(att->StrToMeterSigVisForm(attrValue.c_str()));
             return true;
         }
     }
@@ -9260,15 +9260,15 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttMeterSigDefaultVis *att = dynamic_cast<AttMeterSigDefaultVis *>(element);
         assert(att);
         if (attrType == "meter.rend") {
-            att->SetMeterRend(att->StrToMeterSigDefaultVisMeterrend(attrValue));
+            att->SetMeterRend(att->StrToMeterSigDefaultVisMeterrend(attrValue.c_str()));
             return true;
         }
         if (attrType == "meter.showchange") {
-            att->SetMeterShowchange(att->StrToBoolean(attrValue));
+            att->SetMeterShowchange(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
         if (attrType == "meter.sym") {
-            att->SetMeterSym(att->StrToMetersign(attrValue));
+            att->SetMeterSym(att->StrToMetersign(attrValue.c_str()));
             return true;
         }
     }
@@ -9276,7 +9276,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttMeterconformance *att = dynamic_cast<AttMeterconformance *>(element);
         assert(att);
         if (attrType == "metcon") {
-            att->SetMetcon(att->StrToMeterconformanceMetcon(attrValue));
+            att->SetMetcon(att->StrToMeterconformanceMetcon(attrValue.c_str()));
             return true;
         }
     }
@@ -9284,11 +9284,11 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttMeterconformanceBar *att = dynamic_cast<AttMeterconformanceBar *>(element);
         assert(att);
         if (attrType == "metcon") {
-            att->SetMetcon(att->StrToBoolean(attrValue));
+            att->SetMetcon(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
         if (attrType == "control") {
-            att->SetControl(att->StrToBoolean(attrValue));
+            att->SetControl(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -9312,7 +9312,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttMultinummeasures *att = dynamic_cast<AttMultinummeasures *>(element);
         assert(att);
         if (attrType == "multi.number") {
-            att->SetMultiNumber(att->StrToBoolean(attrValue));
+            att->SetMultiNumber(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -9364,7 +9364,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
             return true;
         }
         if (attrType == "head.fill") {
-            att->SetHeadFill(att->StrToFill(attrValue));
+            att->SetHeadFill(att->StrToFill(attrValue.c_str()));
             return true;
         }
         if (attrType == "head.fillcolor") {
@@ -9380,11 +9380,11 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
             return true;
         }
         if (attrType == "head.shape") {
-            att->SetHeadShape(att->StrToHeadshapeList(attrValue));
+            att->SetHeadShape(att->StrToHeadshapeList(attrValue.c_str()));
             return true;
         }
         if (attrType == "head.visible") {
-            att->SetHeadVisible(att->StrToBoolean(attrValue));
+            att->SetHeadVisible(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -9412,7 +9412,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
             return true;
         }
         if (attrType == "dis.place") {
-            att->SetDisPlace(att->StrToPlace(attrValue));
+            att->SetDisPlace(att->StrToPlace(attrValue.c_str()));
             return true;
         }
     }
@@ -9420,7 +9420,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttOnelinestaff *att = dynamic_cast<AttOnelinestaff *>(element);
         assert(att);
         if (attrType == "ontheline") {
-            att->SetOntheline(att->StrToBoolean(attrValue));
+            att->SetOntheline(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -9428,7 +9428,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttOptimization *att = dynamic_cast<AttOptimization *>(element);
         assert(att);
         if (attrType == "optimize") {
-            att->SetOptimize(att->StrToBoolean(attrValue));
+            att->SetOptimize(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -9520,7 +9520,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttPbVis *att = dynamic_cast<AttPbVis *>(element);
         assert(att);
         if (attrType == "folium") {
-            att->SetFolium(att->StrToPbVisFolium(attrValue));
+            att->SetFolium(att->StrToPbVisFolium(attrValue.c_str()));
             return true;
         }
     }
@@ -9536,7 +9536,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttPlacement *att = dynamic_cast<AttPlacement *>(element);
         assert(att);
         if (attrType == "place") {
-            att->SetPlace(att->StrToStaffrel(attrValue));
+            att->SetPlace(att->StrToStaffrel(attrValue.c_str()));
             return true;
         }
     }
@@ -9584,7 +9584,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttRelativesize *att = dynamic_cast<AttRelativesize *>(element);
         assert(att);
         if (attrType == "size") {
-            att->SetSize(att->StrToSize(attrValue));
+            att->SetSize(att->StrToSize(attrValue.c_str()));
             return true;
         }
     }
@@ -9600,7 +9600,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttSbVis *att = dynamic_cast<AttSbVis *>(element);
         assert(att);
         if (attrType == "form") {
-            att->SetForm(att->StrToSbVisForm(attrValue));
+            att->SetForm(att->StrToSbVisForm(attrValue.c_str()));
             return true;
         }
     }
@@ -9624,7 +9624,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
             return true;
         }
         if (attrType == "tune.temper") {
-            att->SetTuneTemper(att->StrToTemperament(attrValue));
+            att->SetTuneTemper(att->StrToTemperament(attrValue.c_str()));
             return true;
         }
     }
@@ -9640,7 +9640,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttSectionVis *att = dynamic_cast<AttSectionVis *>(element);
         assert(att);
         if (attrType == "restart") {
-            att->SetRestart(att->StrToBoolean(attrValue));
+            att->SetRestart(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -9672,7 +9672,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttSpaceVis *att = dynamic_cast<AttSpaceVis *>(element);
         assert(att);
         if (attrType == "compressable") {
-            att->SetCompressable(att->StrToBoolean(attrValue));
+            att->SetCompressable(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -9708,11 +9708,11 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttStaffDefVis *att = dynamic_cast<AttStaffDefVis *>(element);
         assert(att);
         if (attrType == "grid.show") {
-            att->SetGridShow(att->StrToBoolean(attrValue));
+            att->SetGridShow(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
         if (attrType == "layerscheme") {
-            att->SetLayerscheme(att->StrToLayerscheme(attrValue));
+            att->SetLayerscheme(att->StrToLayerscheme(attrValue.c_str()));
             return true;
         }
         if (attrType == "lines") {
@@ -9724,7 +9724,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
             return true;
         }
         if (attrType == "lines.visible") {
-            att->SetLinesVisible(att->StrToBoolean(attrValue));
+            att->SetLinesVisible(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
         if (attrType == "spacing") {
@@ -9736,7 +9736,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttStaffGrpVis *att = dynamic_cast<AttStaffGrpVis *>(element);
         assert(att);
         if (attrType == "barthru") {
-            att->SetBarthru(att->StrToBoolean(attrValue));
+            att->SetBarthru(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -9744,7 +9744,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttStaffgroupingsym *att = dynamic_cast<AttStaffgroupingsym *>(element);
         assert(att);
         if (attrType == "symbol") {
-            att->SetSymbol(att->StrToStaffgroupingsymSymbol(attrValue));
+            att->SetSymbol(att->StrToStaffgroupingsymSymbol(attrValue.c_str()));
             return true;
         }
     }
@@ -9804,11 +9804,11 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
             return true;
         }
         if (attrType == "stem.mod") {
-            att->SetStemMod(att->StrToStemmodifier(attrValue));
+            att->SetStemMod(att->StrToStemmodifier(attrValue.c_str()));
             return true;
         }
         if (attrType == "stem.pos") {
-            att->SetStemPos(att->StrToStemposition(attrValue));
+            att->SetStemPos(att->StrToStemposition(attrValue.c_str()));
             return true;
         }
         if (attrType == "stem.x") {
@@ -9824,11 +9824,11 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttSylLog *att = dynamic_cast<AttSylLog *>(element);
         assert(att);
         if (attrType == "con") {
-            att->SetCon(att->StrToSylLogCon(attrValue));
+            att->SetCon(att->StrToSylLogCon(attrValue.c_str()));
             return true;
         }
         if (attrType == "wordpos") {
-            att->SetWordpos(att->StrToSylLogWordpos(attrValue));
+            att->SetWordpos(att->StrToSylLogWordpos(attrValue.c_str()));
             return true;
         }
     }
@@ -9844,7 +9844,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttSystems *att = dynamic_cast<AttSystems *>(element);
         assert(att);
         if (attrType == "system.leftline") {
-            att->SetSystemLeftline(att->StrToBoolean(attrValue));
+            att->SetSystemLeftline(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
         if (attrType == "system.leftmar") {
@@ -9864,7 +9864,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttTargeteval *att = dynamic_cast<AttTargeteval *>(element);
         assert(att);
         if (attrType == "evaluate") {
-            att->SetEvaluate(att->StrToTargetevalEvaluate(attrValue));
+            att->SetEvaluate(att->StrToTargetevalEvaluate(attrValue.c_str()));
             return true;
         }
     }
@@ -9872,7 +9872,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttTempoLog *att = dynamic_cast<AttTempoLog *>(element);
         assert(att);
         if (attrType == "func") {
-            att->SetFunc(att->StrToTempoLogFunc(attrValue));
+            att->SetFunc(att->StrToTempoLogFunc(attrValue.c_str()));
             return true;
         }
     }
@@ -9892,11 +9892,11 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
             return true;
         }
         if (attrType == "text.style") {
-            att->SetTextStyle(att->StrToFontstyle(attrValue));
+            att->SetTextStyle(att->StrToFontstyle(attrValue.c_str()));
             return true;
         }
         if (attrType == "text.weight") {
-            att->SetTextWeight(att->StrToFontweight(attrValue));
+            att->SetTextWeight(att->StrToFontweight(attrValue.c_str()));
             return true;
         }
     }
@@ -9984,11 +9984,11 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
             return true;
         }
         if (attrType == "fontstyle") {
-            att->SetFontstyle(att->StrToFontstyle(attrValue));
+            att->SetFontstyle(att->StrToFontstyle(attrValue.c_str()));
             return true;
         }
         if (attrType == "fontweight") {
-            att->SetFontweight(att->StrToFontweight(attrValue));
+            att->SetFontweight(att->StrToFontweight(attrValue.c_str()));
             return true;
         }
     }
@@ -9996,7 +9996,7 @@ bool Att::SetShared(Object *element, std::string attrType, std::string attrValue
         AttVisibility *att = dynamic_cast<AttVisibility *>(element);
         assert(att);
         if (attrType == "visible") {
-            att->SetVisible(att->StrToBoolean(attrValue));
+            att->SetVisible(att->StrToBoolean(attrValue.c_str()));
             return true;
         }
     }
@@ -11477,4 +11477,1345 @@ void Att::GetShared(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillSharedSetters(MapOfAttSetters *setters)
+{
+    (*setters)["func"].push_back(std::make_pair(ATT_ACCIDLOG, [](Object *element, const char *attrValue) {
+        AttAccidLog *att = dynamic_cast<AttAccidLog *>(element);
+        assert(att);
+        att->SetFunc(att->StrToAccidLogFunc(attrValue));
+    }));
+    (*setters)["accid"].push_back(std::make_pair(ATT_ACCIDENTAL, [](Object *element, const char *attrValue) {
+        AttAccidental *att = dynamic_cast<AttAccidental *>(element);
+        assert(att);
+        att->SetAccid(att->StrToAccidentalExplicit(attrValue));
+    }));
+    (*setters)["accid.ges"].push_back(
+        std::make_pair(ATT_ACCIDENTALPERFORMED, [](Object *element, const char *attrValue) {
+            AttAccidentalPerformed *att = dynamic_cast<AttAccidentalPerformed *>(element);
+            assert(att);
+            att->SetAccidGes(att->StrToAccidentalImplicit(attrValue));
+        }));
+    (*setters)["artic"].push_back(std::make_pair(ATT_ARTICULATION, [](Object *element, const char *attrValue) {
+        AttArticulation *att = dynamic_cast<AttArticulation *>(element);
+        assert(att);
+        att->SetArtic(att->StrToArticulationList(attrValue));
+    }));
+    (*setters)["artic.ges"].push_back(
+        std::make_pair(ATT_ARTICULATIONPERFORMED, [](Object *element, const char *attrValue) {
+            AttArticulationPerformed *att = dynamic_cast<AttArticulationPerformed *>(element);
+            assert(att);
+            att->SetArticGes(att->StrToArticulation(attrValue));
+        }));
+    (*setters)["dots"].push_back(std::make_pair(ATT_AUGMENTDOTS, [](Object *element, const char *attrValue) {
+        AttAugmentdots *att = dynamic_cast<AttAugmentdots *>(element);
+        assert(att);
+        att->SetDots(att->StrToInt(attrValue));
+    }));
+    (*setters)["authority"].push_back(std::make_pair(ATT_AUTHORIZED, [](Object *element, const char *attrValue) {
+        AttAuthorized *att = dynamic_cast<AttAuthorized *>(element);
+        assert(att);
+        att->SetAuthority(att->StrToStr(attrValue));
+    }));
+    (*setters)["authURI"].push_back(std::make_pair(ATT_AUTHORIZED, [](Object *element, const char *attrValue) {
+        AttAuthorized *att = dynamic_cast<AttAuthorized *>(element);
+        assert(att);
+        att->SetAuthURI(att->StrToStr(attrValue));
+    }));
+    (*setters)["form"].push_back(std::make_pair(ATT_BARLINELOG, [](Object *element, const char *attrValue) {
+        AttBarLineLog *att = dynamic_cast<AttBarLineLog *>(element);
+        assert(att);
+        att->SetForm(att->StrToBarrendition(attrValue));
+    }));
+    (*setters)["barplace"].push_back(std::make_pair(ATT_BARPLACEMENT, [](Object *element, const char *attrValue) {
+        AttBarplacement *att = dynamic_cast<AttBarplacement *>(element);
+        assert(att);
+        att->SetBarplace(att->StrToBarplace(attrValue));
+    }));
+    (*setters)["taktplace"].push_back(std::make_pair(ATT_BARPLACEMENT, [](Object *element, const char *attrValue) {
+        AttBarplacement *att = dynamic_cast<AttBarplacement *>(element);
+        assert(att);
+        att->SetTaktplace(att->StrToInt(attrValue));
+    }));
+    (*setters)["beam.color"].push_back(std::make_pair(ATT_BEAMINGVIS, [](Object *element, const char *attrValue) {
+        AttBeamingVis *att = dynamic_cast<AttBeamingVis *>(element);
+        assert(att);
+        att->SetBeamColor(att->StrToStr(attrValue));
+    }));
+    (*setters)["beam.rend"].push_back(std::make_pair(ATT_BEAMINGVIS, [](Object *element, const char *attrValue) {
+        AttBeamingVis *att = dynamic_cast<AttBeamingVis *>(element);
+        assert(att);
+        att->SetBeamRend(att->StrToBeamingVisBeamrend(attrValue));
+    }));
+    (*setters)["beam.slope"].push_back(std::make_pair(ATT_BEAMINGVIS, [](Object *element, const char *attrValue) {
+        AttBeamingVis *att = dynamic_cast<AttBeamingVis *>(element);
+        assert(att);
+        att->SetBeamSlope(att->StrToDbl(attrValue));
+    }));
+    (*setters)["analog"].push_back(std::make_pair(ATT_BIBL, [](Object *element, const char *attrValue) {
+        AttBibl *att = dynamic_cast<AttBibl *>(element);
+        assert(att);
+        att->SetAnalog(att->StrToStr(attrValue));
+    }));
+    (*setters)["calendar"].push_back(std::make_pair(ATT_CALENDARED, [](Object *element, const char *attrValue) {
+        AttCalendared *att = dynamic_cast<AttCalendared *>(element);
+        assert(att);
+        att->SetCalendar(att->StrToStr(attrValue));
+    }));
+    (*setters)["codedval"].push_back(std::make_pair(ATT_CANONICAL, [](Object *element, const char *attrValue) {
+        AttCanonical *att = dynamic_cast<AttCanonical *>(element);
+        assert(att);
+        att->SetCodedval(att->StrToStr(attrValue));
+    }));
+    (*setters)["cluster"].push_back(std::make_pair(ATT_CHORDVIS, [](Object *element, const char *attrValue) {
+        AttChordVis *att = dynamic_cast<AttChordVis *>(element);
+        assert(att);
+        att->SetCluster(att->StrToCluster(attrValue));
+    }));
+    (*setters)["classcode"].push_back(std::make_pair(ATT_CLASSCODEIDENT, [](Object *element, const char *attrValue) {
+        AttClasscodeident *att = dynamic_cast<AttClasscodeident *>(element);
+        assert(att);
+        att->SetClasscode(att->StrToStr(attrValue));
+    }));
+    (*setters)["cautionary"].push_back(std::make_pair(ATT_CLEFLOG, [](Object *element, const char *attrValue) {
+        AttClefLog *att = dynamic_cast<AttClefLog *>(element);
+        assert(att);
+        att->SetCautionary(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["clef.shape"].push_back(std::make_pair(ATT_CLEFFINGLOG, [](Object *element, const char *attrValue) {
+        AttCleffingLog *att = dynamic_cast<AttCleffingLog *>(element);
+        assert(att);
+        att->SetClefShape(att->StrToClefshape(attrValue));
+    }));
+    (*setters)["clef.line"].push_back(std::make_pair(ATT_CLEFFINGLOG, [](Object *element, const char *attrValue) {
+        AttCleffingLog *att = dynamic_cast<AttCleffingLog *>(element);
+        assert(att);
+        att->SetClefLine(att->StrToInt(attrValue));
+    }));
+    (*setters)["clef.dis"].push_back(std::make_pair(ATT_CLEFFINGLOG, [](Object *element, const char *attrValue) {
+        AttCleffingLog *att = dynamic_cast<AttCleffingLog *>(element);
+        assert(att);
+        att->SetClefDis(att->StrToOctaveDis(attrValue));
+    }));
+    (*setters)["clef.dis.place"].push_back(std::make_pair(ATT_CLEFFINGLOG, [](Object *element, const char *attrValue) {
+        AttCleffingLog *att = dynamic_cast<AttCleffingLog *>(element);
+        assert(att);
+        att->SetClefDisPlace(att->StrToPlace(attrValue));
+    }));
+    (*setters)["clef.color"].push_back(std::make_pair(ATT_CLEFFINGVIS, [](Object *element, const char *attrValue) {
+        AttCleffingVis *att = dynamic_cast<AttCleffingVis *>(element);
+        assert(att);
+        att->SetClefColor(att->StrToStr(attrValue));
+    }));
+    (*setters)["clef.visible"].push_back(std::make_pair(ATT_CLEFFINGVIS, [](Object *element, const char *attrValue) {
+        AttCleffingVis *att = dynamic_cast<AttCleffingVis *>(element);
+        assert(att);
+        att->SetClefVisible(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["shape"].push_back(std::make_pair(ATT_CLEFSHAPE, [](Object *element, const char *attrValue) {
+        AttClefshape *att = dynamic_cast<AttClefshape *>(element);
+        assert(att);
+        att->SetShape(att->StrToClefshape(attrValue));
+    }));
+    (*setters)["color"].push_back(std::make_pair(ATT_COLOR, [](Object *element, const char *attrValue) {
+        AttColor *att = dynamic_cast<AttColor *>(element);
+        assert(att);
+        att->SetColor(att->StrToStr(attrValue));
+    }));
+    (*setters)["colored"].push_back(std::make_pair(ATT_COLORATION, [](Object *element, const char *attrValue) {
+        AttColoration *att = dynamic_cast<AttColoration *>(element);
+        assert(att);
+        att->SetColored(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["n"].push_back(std::make_pair(ATT_COMMON, [](Object *element, const char *attrValue) {
+        AttCommon *att = dynamic_cast<AttCommon *>(element);
+        assert(att);
+        att->SetN(att->StrToInt(attrValue));
+    }));
+    (*setters)["label"].push_back(std::make_pair(ATT_COMMONPART, [](Object *element, const char *attrValue) {
+        AttCommonPart *att = dynamic_cast<AttCommonPart *>(element);
+        assert(att);
+        att->SetLabel(att->StrToStr(attrValue));
+    }));
+    (*setters)["xml:base"].push_back(std::make_pair(ATT_COMMONPART, [](Object *element, const char *attrValue) {
+        AttCommonPart *att = dynamic_cast<AttCommonPart *>(element);
+        assert(att);
+        att->SetBase(att->StrToStr(attrValue));
+    }));
+    (*setters)["ulx"].push_back(std::make_pair(ATT_COORDINATED, [](Object *element, const char *attrValue) {
+        AttCoordinated *att = dynamic_cast<AttCoordinated *>(element);
+        assert(att);
+        att->SetUlx(att->StrToInt(attrValue));
+    }));
+    (*setters)["uly"].push_back(std::make_pair(ATT_COORDINATED, [](Object *element, const char *attrValue) {
+        AttCoordinated *att = dynamic_cast<AttCoordinated *>(element);
+        assert(att);
+        att->SetUly(att->StrToInt(attrValue));
+    }));
+    (*setters)["lrx"].push_back(std::make_pair(ATT_COORDINATED, [](Object *element, const char *attrValue) {
+        AttCoordinated *att = dynamic_cast<AttCoordinated *>(element);
+        assert(att);
+        att->SetLrx(att->StrToInt(attrValue));
+    }));
+    (*setters)["lry"].push_back(std::make_pair(ATT_COORDINATED, [](Object *element, const char *attrValue) {
+        AttCoordinated *att = dynamic_cast<AttCoordinated *>(element);
+        assert(att);
+        att->SetLry(att->StrToInt(attrValue));
+    }));
+    (*setters)["bezier"].push_back(std::make_pair(ATT_CURVATURE, [](Object *element, const char *attrValue) {
+        AttCurvature *att = dynamic_cast<AttCurvature *>(element);
+        assert(att);
+        att->SetBezier(att->StrToStr(attrValue));
+    }));
+    (*setters)["bulge"].push_back(std::make_pair(ATT_CURVATURE, [](Object *element, const char *attrValue) {
+        AttCurvature *att = dynamic_cast<AttCurvature *>(element);
+        assert(att);
+        att->SetBulge(att->StrToDbl(attrValue));
+    }));
+    (*setters)["curvedir"].push_back(std::make_pair(ATT_CURVATURE, [](Object *element, const char *attrValue) {
+        AttCurvature *att = dynamic_cast<AttCurvature *>(element);
+        assert(att);
+        att->SetCurvedir(att->StrToCurvatureCurvedir(attrValue));
+    }));
+    (*setters)["lform"].push_back(std::make_pair(ATT_CURVEREND, [](Object *element, const char *attrValue) {
+        AttCurverend *att = dynamic_cast<AttCurverend *>(element);
+        assert(att);
+        att->SetLform(att->StrToLineform(attrValue));
+    }));
+    (*setters)["lwidth"].push_back(std::make_pair(ATT_CURVEREND, [](Object *element, const char *attrValue) {
+        AttCurverend *att = dynamic_cast<AttCurverend *>(element);
+        assert(att);
+        att->SetLwidth(att->StrToStr(attrValue));
+    }));
+    (*setters)["target"].push_back(std::make_pair(ATT_CUSTOSLOG, [](Object *element, const char *attrValue) {
+        AttCustosLog *att = dynamic_cast<AttCustosLog *>(element);
+        assert(att);
+        att->SetTarget(att->StrToStr(attrValue));
+    }));
+    (*setters)["enddate"].push_back(std::make_pair(ATT_DATABLE, [](Object *element, const char *attrValue) {
+        AttDatable *att = dynamic_cast<AttDatable *>(element);
+        assert(att);
+        att->SetEnddate(att->StrToStr(attrValue));
+    }));
+    (*setters)["isodate"].push_back(std::make_pair(ATT_DATABLE, [](Object *element, const char *attrValue) {
+        AttDatable *att = dynamic_cast<AttDatable *>(element);
+        assert(att);
+        att->SetIsodate(att->StrToStr(attrValue));
+    }));
+    (*setters)["notafter"].push_back(std::make_pair(ATT_DATABLE, [](Object *element, const char *attrValue) {
+        AttDatable *att = dynamic_cast<AttDatable *>(element);
+        assert(att);
+        att->SetNotafter(att->StrToStr(attrValue));
+    }));
+    (*setters)["notbefore"].push_back(std::make_pair(ATT_DATABLE, [](Object *element, const char *attrValue) {
+        AttDatable *att = dynamic_cast<AttDatable *>(element);
+        assert(att);
+        att->SetNotbefore(att->StrToStr(attrValue));
+    }));
+    (*setters)["startdate"].push_back(std::make_pair(ATT_DATABLE, [](Object *element, const char *attrValue) {
+        AttDatable *att = dynamic_cast<AttDatable *>(element);
+        assert(att);
+        att->SetStartdate(att->StrToStr(attrValue));
+    }));
+    (*setters)["data"].push_back(std::make_pair(ATT_DATAPOINTING, [](Object *element, const char *attrValue) {
+        AttDatapointing *att = dynamic_cast<AttDatapointing *>(element);
+        assert(att);
+        att->SetData(att->StrToStr(attrValue));
+    }));
+    (*setters)["decls"].push_back(std::make_pair(ATT_DECLARING, [](Object *element, const char *attrValue) {
+        AttDeclaring *att = dynamic_cast<AttDeclaring *>(element);
+        assert(att);
+        att->SetDecls(att->StrToStr(attrValue));
+    }));
+    (*setters)["dynam.dist"].push_back(std::make_pair(ATT_DISTANCES, [](Object *element, const char *attrValue) {
+        AttDistances *att = dynamic_cast<AttDistances *>(element);
+        assert(att);
+        att->SetDynamDist(att->StrToStr(attrValue));
+    }));
+    (*setters)["harm.dist"].push_back(std::make_pair(ATT_DISTANCES, [](Object *element, const char *attrValue) {
+        AttDistances *att = dynamic_cast<AttDistances *>(element);
+        assert(att);
+        att->SetHarmDist(att->StrToStr(attrValue));
+    }));
+    (*setters)["text.dist"].push_back(std::make_pair(ATT_DISTANCES, [](Object *element, const char *attrValue) {
+        AttDistances *att = dynamic_cast<AttDistances *>(element);
+        assert(att);
+        att->SetTextDist(att->StrToStr(attrValue));
+    }));
+    (*setters)["form"].push_back(std::make_pair(ATT_DOTLOG, [](Object *element, const char *attrValue) {
+        AttDotLog *att = dynamic_cast<AttDotLog *>(element);
+        assert(att);
+        att->SetForm(att->StrToDotLogForm(attrValue));
+    }));
+    (*setters)["dur"].push_back(std::make_pair(ATT_DURATIONADDITIVE, [](Object *element, const char *attrValue) {
+        AttDurationAdditive *att = dynamic_cast<AttDurationAdditive *>(element);
+        assert(att);
+        att->SetDur(att->StrToDuration(attrValue));
+    }));
+    (*setters)["dur.default"].push_back(std::make_pair(ATT_DURATIONDEFAULT, [](Object *element, const char *attrValue) {
+        AttDurationDefault *att = dynamic_cast<AttDurationDefault *>(element);
+        assert(att);
+        att->SetDurDefault(att->StrToDuration(attrValue));
+    }));
+    (*setters)["num.default"].push_back(std::make_pair(ATT_DURATIONDEFAULT, [](Object *element, const char *attrValue) {
+        AttDurationDefault *att = dynamic_cast<AttDurationDefault *>(element);
+        assert(att);
+        att->SetNumDefault(att->StrToInt(attrValue));
+    }));
+    (*setters)["numbase.default"].push_back(
+        std::make_pair(ATT_DURATIONDEFAULT, [](Object *element, const char *attrValue) {
+            AttDurationDefault *att = dynamic_cast<AttDurationDefault *>(element);
+            assert(att);
+            att->SetNumbaseDefault(att->StrToInt(attrValue));
+        }));
+    (*setters)["dur"].push_back(std::make_pair(ATT_DURATIONMUSICAL, [](Object *element, const char *attrValue) {
+        AttDurationMusical *att = dynamic_cast<AttDurationMusical *>(element);
+        assert(att);
+        att->SetDur(att->StrToDuration(attrValue));
+    }));
+    (*setters)["dur.ges"].push_back(std::make_pair(ATT_DURATIONPERFORMED, [](Object *element, const char *attrValue) {
+        AttDurationPerformed *att = dynamic_cast<AttDurationPerformed *>(element);
+        assert(att);
+        att->SetDurGes(att->StrToDuration(attrValue));
+    }));
+    (*setters)["num"].push_back(std::make_pair(ATT_DURATIONRATIO, [](Object *element, const char *attrValue) {
+        AttDurationRatio *att = dynamic_cast<AttDurationRatio *>(element);
+        assert(att);
+        att->SetNum(att->StrToInt(attrValue));
+    }));
+    (*setters)["numbase"].push_back(std::make_pair(ATT_DURATIONRATIO, [](Object *element, const char *attrValue) {
+        AttDurationRatio *att = dynamic_cast<AttDurationRatio *>(element);
+        assert(att);
+        att->SetNumbase(att->StrToInt(attrValue));
+    }));
+    (*setters)["enclose"].push_back(std::make_pair(ATT_ENCLOSINGCHARS, [](Object *element, const char *attrValue) {
+        AttEnclosingchars *att = dynamic_cast<AttEnclosingchars *>(element);
+        assert(att);
+        att->SetEnclose(att->StrToEnclosure(attrValue));
+    }));
+    (*setters)["ending.rend"].push_back(std::make_pair(ATT_ENDINGS, [](Object *element, const char *attrValue) {
+        AttEndings *att = dynamic_cast<AttEndings *>(element);
+        assert(att);
+        att->SetEndingRend(att->StrToEndingsEndingrend(attrValue));
+    }));
+    (*setters)["extender"].push_back(std::make_pair(ATT_EXTENDER, [](Object *element, const char *attrValue) {
+        AttExtender *att = dynamic_cast<AttExtender *>(element);
+        assert(att);
+        att->SetExtender(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["fermata"].push_back(std::make_pair(ATT_FERMATAPRESENT, [](Object *element, const char *attrValue) {
+        AttFermatapresent *att = dynamic_cast<AttFermatapresent *>(element);
+        assert(att);
+        att->SetFermata(att->StrToPlace(attrValue));
+    }));
+    (*setters)["nonfiling"].push_back(std::make_pair(ATT_FILING, [](Object *element, const char *attrValue) {
+        AttFiling *att = dynamic_cast<AttFiling *>(element);
+        assert(att);
+        att->SetNonfiling(att->StrToInt(attrValue));
+    }));
+    (*setters)["level"].push_back(std::make_pair(ATT_GRPSYMLOG, [](Object *element, const char *attrValue) {
+        AttGrpSymLog *att = dynamic_cast<AttGrpSymLog *>(element);
+        assert(att);
+        att->SetLevel(att->StrToInt(attrValue));
+    }));
+    (*setters)["hand"].push_back(std::make_pair(ATT_HANDIDENT, [](Object *element, const char *attrValue) {
+        AttHandident *att = dynamic_cast<AttHandident *>(element);
+        assert(att);
+        att->SetHand(att->StrToStr(attrValue));
+    }));
+    (*setters)["height"].push_back(std::make_pair(ATT_HEIGHT, [](Object *element, const char *attrValue) {
+        AttHeight *att = dynamic_cast<AttHeight *>(element);
+        assert(att);
+        att->SetHeight(att->StrToStr(attrValue));
+    }));
+    (*setters)["halign"].push_back(std::make_pair(ATT_HORIZONTALALIGN, [](Object *element, const char *attrValue) {
+        AttHorizontalalign *att = dynamic_cast<AttHorizontalalign *>(element);
+        assert(att);
+        att->SetHalign(att->StrToHorizontalalignment(attrValue));
+    }));
+    (*setters)["instr"].push_back(std::make_pair(ATT_INSTRUMENTIDENT, [](Object *element, const char *attrValue) {
+        AttInstrumentident *att = dynamic_cast<AttInstrumentident *>(element);
+        assert(att);
+        att->SetInstr(att->StrToStr(attrValue));
+    }));
+    (*setters)["mimetype"].push_back(std::make_pair(ATT_INTERNETMEDIA, [](Object *element, const char *attrValue) {
+        AttInternetmedia *att = dynamic_cast<AttInternetmedia *>(element);
+        assert(att);
+        att->SetMimetype(att->StrToStr(attrValue));
+    }));
+    (*setters)["join"].push_back(std::make_pair(ATT_JOINED, [](Object *element, const char *attrValue) {
+        AttJoined *att = dynamic_cast<AttJoined *>(element);
+        assert(att);
+        att->SetJoin(att->StrToStr(attrValue));
+    }));
+    (*setters)["sig"].push_back(std::make_pair(ATT_KEYSIGLOG, [](Object *element, const char *attrValue) {
+        AttKeySigLog *att = dynamic_cast<AttKeySigLog *>(element);
+        assert(att);
+        att->SetSig(att->StrToKeysignature(attrValue));
+    }));
+    (*setters)["sig.mixed"].push_back(std::make_pair(ATT_KEYSIGLOG, [](Object *element, const char *attrValue) {
+        AttKeySigLog *att = dynamic_cast<AttKeySigLog *>(element);
+        assert(att);
+        att->SetSigMixed(att->StrToStr(attrValue));
+    }));
+    (*setters)["mode"].push_back(std::make_pair(ATT_KEYSIGLOG, [](Object *element, const char *attrValue) {
+        AttKeySigLog *att = dynamic_cast<AttKeySigLog *>(element);
+        assert(att);
+        att->SetMode(att->StrToMode(attrValue));
+    }));
+    (*setters)["sig.showchange"].push_back(std::make_pair(ATT_KEYSIGVIS, [](Object *element, const char *attrValue) {
+        AttKeySigVis *att = dynamic_cast<AttKeySigVis *>(element);
+        assert(att);
+        att->SetSigShowchange(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["key.accid"].push_back(std::make_pair(ATT_KEYSIGDEFAULTLOG, [](Object *element, const char *attrValue) {
+        AttKeySigDefaultLog *att = dynamic_cast<AttKeySigDefaultLog *>(element);
+        assert(att);
+        att->SetKeyAccid(att->StrToAccidentalImplicit(attrValue));
+    }));
+    (*setters)["key.mode"].push_back(std::make_pair(ATT_KEYSIGDEFAULTLOG, [](Object *element, const char *attrValue) {
+        AttKeySigDefaultLog *att = dynamic_cast<AttKeySigDefaultLog *>(element);
+        assert(att);
+        att->SetKeyMode(att->StrToMode(attrValue));
+    }));
+    (*setters)["key.pname"].push_back(std::make_pair(ATT_KEYSIGDEFAULTLOG, [](Object *element, const char *attrValue) {
+        AttKeySigDefaultLog *att = dynamic_cast<AttKeySigDefaultLog *>(element);
+        assert(att);
+        att->SetKeyPname(att->StrToPitchname(attrValue));
+    }));
+    (*setters)["key.sig"].push_back(std::make_pair(ATT_KEYSIGDEFAULTLOG, [](Object *element, const char *attrValue) {
+        AttKeySigDefaultLog *att = dynamic_cast<AttKeySigDefaultLog *>(element);
+        assert(att);
+        att->SetKeySig(att->StrToKeysignature(attrValue));
+    }));
+    (*setters)["key.sig.mixed"].push_back(
+        std::make_pair(ATT_KEYSIGDEFAULTLOG, [](Object *element, const char *attrValue) {
+            AttKeySigDefaultLog *att = dynamic_cast<AttKeySigDefaultLog *>(element);
+            assert(att);
+            att->SetKeySigMixed(att->StrToStr(attrValue));
+        }));
+    (*setters)["key.sig.show"].push_back(
+        std::make_pair(ATT_KEYSIGDEFAULTVIS, [](Object *element, const char *attrValue) {
+            AttKeySigDefaultVis *att = dynamic_cast<AttKeySigDefaultVis *>(element);
+            assert(att);
+            att->SetKeySigShow(att->StrToBoolean(attrValue));
+        }));
+    (*setters)["key.sig.showchange"].push_back(
+        std::make_pair(ATT_KEYSIGDEFAULTVIS, [](Object *element, const char *attrValue) {
+            AttKeySigDefaultVis *att = dynamic_cast<AttKeySigDefaultVis *>(element);
+            assert(att);
+            att->SetKeySigShowchange(att->StrToBoolean(attrValue));
+        }));
+    (*setters)["label.abbr"].push_back(std::make_pair(ATT_LABELSADDL, [](Object *element, const char *attrValue) {
+        AttLabelsAddl *att = dynamic_cast<AttLabelsAddl *>(element);
+        assert(att);
+        att->SetLabelAbbr(att->StrToStr(attrValue));
+    }));
+    (*setters)["xml:lang"].push_back(std::make_pair(ATT_LANG, [](Object *element, const char *attrValue) {
+        AttLang *att = dynamic_cast<AttLang *>(element);
+        assert(att);
+        att->SetLang(att->StrToStr(attrValue));
+    }));
+    (*setters)["xml:translit"].push_back(std::make_pair(ATT_LANG, [](Object *element, const char *attrValue) {
+        AttLang *att = dynamic_cast<AttLang *>(element);
+        assert(att);
+        att->SetTranslit(att->StrToStr(attrValue));
+    }));
+    (*setters)["def"].push_back(std::make_pair(ATT_LAYERLOG, [](Object *element, const char *attrValue) {
+        AttLayerLog *att = dynamic_cast<AttLayerLog *>(element);
+        assert(att);
+        att->SetDef(att->StrToStr(attrValue));
+    }));
+    (*setters)["layer"].push_back(std::make_pair(ATT_LAYERIDENT, [](Object *element, const char *attrValue) {
+        AttLayerident *att = dynamic_cast<AttLayerident *>(element);
+        assert(att);
+        att->SetLayer(att->StrToInt(attrValue));
+    }));
+    (*setters)["form"].push_back(std::make_pair(ATT_LINEVIS, [](Object *element, const char *attrValue) {
+        AttLineVis *att = dynamic_cast<AttLineVis *>(element);
+        assert(att);
+        att->SetForm(att->StrToLineform(attrValue));
+    }));
+    (*setters)["width"].push_back(std::make_pair(ATT_LINEVIS, [](Object *element, const char *attrValue) {
+        AttLineVis *att = dynamic_cast<AttLineVis *>(element);
+        assert(att);
+        att->SetWidth(att->StrToStr(attrValue));
+    }));
+    (*setters)["endsym"].push_back(std::make_pair(ATT_LINEVIS, [](Object *element, const char *attrValue) {
+        AttLineVis *att = dynamic_cast<AttLineVis *>(element);
+        assert(att);
+        att->SetEndsym(att->StrToLinestartendsymbol(attrValue));
+    }));
+    (*setters)["endsymsize"].push_back(std::make_pair(ATT_LINEVIS, [](Object *element, const char *attrValue) {
+        AttLineVis *att = dynamic_cast<AttLineVis *>(element);
+        assert(att);
+        att->SetEndsymsize(att->StrToStr(attrValue));
+    }));
+    (*setters)["startsym"].push_back(std::make_pair(ATT_LINEVIS, [](Object *element, const char *attrValue) {
+        AttLineVis *att = dynamic_cast<AttLineVis *>(element);
+        assert(att);
+        att->SetStartsym(att->StrToLinestartendsymbol(attrValue));
+    }));
+    (*setters)["startsymsize"].push_back(std::make_pair(ATT_LINEVIS, [](Object *element, const char *attrValue) {
+        AttLineVis *att = dynamic_cast<AttLineVis *>(element);
+        assert(att);
+        att->SetStartsymsize(att->StrToStr(attrValue));
+    }));
+    (*setters)["line"].push_back(std::make_pair(ATT_LINELOC, [](Object *element, const char *attrValue) {
+        AttLineloc *att = dynamic_cast<AttLineloc *>(element);
+        assert(att);
+        att->SetLine(att->StrToInt(attrValue));
+    }));
+    (*setters)["lendsym"].push_back(std::make_pair(ATT_LINEREND, [](Object *element, const char *attrValue) {
+        AttLinerend *att = dynamic_cast<AttLinerend *>(element);
+        assert(att);
+        att->SetLendsym(att->StrToLinestartendsymbol(attrValue));
+    }));
+    (*setters)["lendsymsize"].push_back(std::make_pair(ATT_LINEREND, [](Object *element, const char *attrValue) {
+        AttLinerend *att = dynamic_cast<AttLinerend *>(element);
+        assert(att);
+        att->SetLendsymsize(att->StrToStr(attrValue));
+    }));
+    (*setters)["lstartsym"].push_back(std::make_pair(ATT_LINEREND, [](Object *element, const char *attrValue) {
+        AttLinerend *att = dynamic_cast<AttLinerend *>(element);
+        assert(att);
+        att->SetLstartsym(att->StrToLinestartendsymbol(attrValue));
+    }));
+    (*setters)["lstartsymsize"].push_back(std::make_pair(ATT_LINEREND, [](Object *element, const char *attrValue) {
+        AttLinerend *att = dynamic_cast<AttLinerend *>(element);
+        assert(att);
+        att->SetLstartsymsize(att->StrToStr(attrValue));
+    }));
+    (*setters)["lform"].push_back(std::make_pair(ATT_LINERENDBASE, [](Object *element, const char *attrValue) {
+        AttLinerendBase *att = dynamic_cast<AttLinerendBase *>(element);
+        assert(att);
+        att->SetLform(att->StrToLineform(attrValue));
+    }));
+    (*setters)["lwidth"].push_back(std::make_pair(ATT_LINERENDBASE, [](Object *element, const char *attrValue) {
+        AttLinerendBase *att = dynamic_cast<AttLinerendBase *>(element);
+        assert(att);
+        att->SetLwidth(att->StrToStr(attrValue));
+    }));
+    (*setters)["lyric.align"].push_back(std::make_pair(ATT_LYRICSTYLE, [](Object *element, const char *attrValue) {
+        AttLyricstyle *att = dynamic_cast<AttLyricstyle *>(element);
+        assert(att);
+        att->SetLyricAlign(att->StrToStr(attrValue));
+    }));
+    (*setters)["lyric.fam"].push_back(std::make_pair(ATT_LYRICSTYLE, [](Object *element, const char *attrValue) {
+        AttLyricstyle *att = dynamic_cast<AttLyricstyle *>(element);
+        assert(att);
+        att->SetLyricFam(att->StrToStr(attrValue));
+    }));
+    (*setters)["lyric.name"].push_back(std::make_pair(ATT_LYRICSTYLE, [](Object *element, const char *attrValue) {
+        AttLyricstyle *att = dynamic_cast<AttLyricstyle *>(element);
+        assert(att);
+        att->SetLyricName(att->StrToStr(attrValue));
+    }));
+    (*setters)["lyric.size"].push_back(std::make_pair(ATT_LYRICSTYLE, [](Object *element, const char *attrValue) {
+        AttLyricstyle *att = dynamic_cast<AttLyricstyle *>(element);
+        assert(att);
+        att->SetLyricSize(att->StrToInt(attrValue));
+    }));
+    (*setters)["lyric.style"].push_back(std::make_pair(ATT_LYRICSTYLE, [](Object *element, const char *attrValue) {
+        AttLyricstyle *att = dynamic_cast<AttLyricstyle *>(element);
+        assert(att);
+        att->SetLyricStyle(att->StrToFontstyle(attrValue));
+    }));
+    (*setters)["lyric.weight"].push_back(std::make_pair(ATT_LYRICSTYLE, [](Object *element, const char *attrValue) {
+        AttLyricstyle *att = dynamic_cast<AttLyricstyle *>(element);
+        assert(att);
+        att->SetLyricWeight(att->StrToFontweight(attrValue));
+    }));
+    (*setters)["left"].push_back(std::make_pair(ATT_MEASURELOG, [](Object *element, const char *attrValue) {
+        AttMeasureLog *att = dynamic_cast<AttMeasureLog *>(element);
+        assert(att);
+        att->SetLeft(att->StrToBarrendition(attrValue));
+    }));
+    (*setters)["right"].push_back(std::make_pair(ATT_MEASURELOG, [](Object *element, const char *attrValue) {
+        AttMeasureLog *att = dynamic_cast<AttMeasureLog *>(element);
+        assert(att);
+        att->SetRight(att->StrToBarrendition(attrValue));
+    }));
+    (*setters)["unit"].push_back(std::make_pair(ATT_MEASUREMENT, [](Object *element, const char *attrValue) {
+        AttMeasurement *att = dynamic_cast<AttMeasurement *>(element);
+        assert(att);
+        att->SetUnit(att->StrToStr(attrValue));
+    }));
+    (*setters)["mnum.visible"].push_back(std::make_pair(ATT_MEASURENUMBERS, [](Object *element, const char *attrValue) {
+        AttMeasurenumbers *att = dynamic_cast<AttMeasurenumbers *>(element);
+        assert(att);
+        att->SetMnumVisible(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["begin"].push_back(std::make_pair(ATT_MEDIABOUNDS, [](Object *element, const char *attrValue) {
+        AttMediabounds *att = dynamic_cast<AttMediabounds *>(element);
+        assert(att);
+        att->SetBegin(att->StrToStr(attrValue));
+    }));
+    (*setters)["end"].push_back(std::make_pair(ATT_MEDIABOUNDS, [](Object *element, const char *attrValue) {
+        AttMediabounds *att = dynamic_cast<AttMediabounds *>(element);
+        assert(att);
+        att->SetEnd(att->StrToStr(attrValue));
+    }));
+    (*setters)["betype"].push_back(std::make_pair(ATT_MEDIABOUNDS, [](Object *element, const char *attrValue) {
+        AttMediabounds *att = dynamic_cast<AttMediabounds *>(element);
+        assert(att);
+        att->SetBetype(att->StrToBetype(attrValue));
+    }));
+    (*setters)["medium"].push_back(std::make_pair(ATT_MEDIUM, [](Object *element, const char *attrValue) {
+        AttMedium *att = dynamic_cast<AttMedium *>(element);
+        assert(att);
+        att->SetMedium(att->StrToStr(attrValue));
+    }));
+    (*setters)["meiversion"].push_back(std::make_pair(ATT_MEIVERSION, [](Object *element, const char *attrValue) {
+        AttMeiversion *att = dynamic_cast<AttMeiversion *>(element);
+        assert(att);
+        att->SetMeiversion(att->StrToMeiversionMeiversion(attrValue));
+    }));
+    (*setters)["dot"].push_back(std::make_pair(ATT_MENSURLOG, [](Object *element, const char *attrValue) {
+        AttMensurLog *att = dynamic_cast<AttMensurLog *>(element);
+        assert(att);
+        att->SetDot(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["sign"].push_back(std::make_pair(ATT_MENSURLOG, [](Object *element, const char *attrValue) {
+        AttMensurLog *att = dynamic_cast<AttMensurLog *>(element);
+        assert(att);
+        att->SetSign(att->StrToMensurationsign(attrValue));
+    }));
+    (*setters)["count"].push_back(std::make_pair(ATT_METERSIGLOG, [](Object *element, const char *attrValue) {
+        AttMeterSigLog *att = dynamic_cast<AttMeterSigLog *>(element);
+        assert(att);
+        att->SetCount(att->StrToInt(attrValue));
+    }));
+    (*setters)["sym"].push_back(std::make_pair(ATT_METERSIGLOG, [](Object *element, const char *attrValue) {
+        AttMeterSigLog *att = dynamic_cast<AttMeterSigLog *>(element);
+        assert(att);
+        att->SetSym(att->StrToMetersign(attrValue));
+    }));
+    (*setters)["unit"].push_back(std::make_pair(ATT_METERSIGLOG, [](Object *element, const char *attrValue) {
+        AttMeterSigLog *att = dynamic_cast<AttMeterSigLog *>(element);
+        assert(att);
+        att->SetUnit(att->StrToInt(attrValue));
+    }));
+    (*setters)["form"].push_back(std::make_pair(ATT_METERSIGVIS, [](Object *element, const char *attrValue) {
+        AttMeterSigVis *att = dynamic_cast<AttMeterSigVis *>(element);
+        assert(att);
+        att->SetForm(att->StrToMeterSigVisForm(attrValue));
+    }));
+    (*setters)["meter.count"].push_back(
+        std::make_pair(ATT_METERSIGDEFAULTLOG, [](Object *element, const char *attrValue) {
+            AttMeterSigDefaultLog *att = dynamic_cast<AttMeterSigDefaultLog *>(element);
+            assert(att);
+            att->SetMeterCount(att->StrToInt(attrValue));
+        }));
+    (*setters)["meter.unit"].push_back(
+        std::make_pair(ATT_METERSIGDEFAULTLOG, [](Object *element, const char *attrValue) {
+            AttMeterSigDefaultLog *att = dynamic_cast<AttMeterSigDefaultLog *>(element);
+            assert(att);
+            att->SetMeterUnit(att->StrToInt(attrValue));
+        }));
+    (*setters)["meter.rend"].push_back(
+        std::make_pair(ATT_METERSIGDEFAULTVIS, [](Object *element, const char *attrValue) {
+            AttMeterSigDefaultVis *att = dynamic_cast<AttMeterSigDefaultVis *>(element);
+            assert(att);
+            att->SetMeterRend(att->StrToMeterSigDefaultVisMeterrend(attrValue));
+        }));
+    (*setters)["meter.showchange"].push_back(
+        std::make_pair(ATT_METERSIGDEFAULTVIS, [](Object *element, const char *attrValue) {
+            AttMeterSigDefaultVis *att = dynamic_cast<AttMeterSigDefaultVis *>(element);
+            assert(att);
+            att->SetMeterShowchange(att->StrToBoolean(attrValue));
+        }));
+    (*setters)["meter.sym"].push_back(
+        std::make_pair(ATT_METERSIGDEFAULTVIS, [](Object *element, const char *attrValue) {
+            AttMeterSigDefaultVis *att = dynamic_cast<AttMeterSigDefaultVis *>(element);
+            assert(att);
+            att->SetMeterSym(att->StrToMetersign(attrValue));
+        }));
+    (*setters)["metcon"].push_back(std::make_pair(ATT_METERCONFORMANCE, [](Object *element, const char *attrValue) {
+        AttMeterconformance *att = dynamic_cast<AttMeterconformance *>(element);
+        assert(att);
+        att->SetMetcon(att->StrToMeterconformanceMetcon(attrValue));
+    }));
+    (*setters)["metcon"].push_back(std::make_pair(ATT_METERCONFORMANCEBAR, [](Object *element, const char *attrValue) {
+        AttMeterconformanceBar *att = dynamic_cast<AttMeterconformanceBar *>(element);
+        assert(att);
+        att->SetMetcon(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["control"].push_back(std::make_pair(ATT_METERCONFORMANCEBAR, [](Object *element, const char *attrValue) {
+        AttMeterconformanceBar *att = dynamic_cast<AttMeterconformanceBar *>(element);
+        assert(att);
+        att->SetControl(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["mm"].push_back(std::make_pair(ATT_MMTEMPO, [](Object *element, const char *attrValue) {
+        AttMmtempo *att = dynamic_cast<AttMmtempo *>(element);
+        assert(att);
+        att->SetMm(att->StrToStr(attrValue));
+    }));
+    (*setters)["mm.unit"].push_back(std::make_pair(ATT_MMTEMPO, [](Object *element, const char *attrValue) {
+        AttMmtempo *att = dynamic_cast<AttMmtempo *>(element);
+        assert(att);
+        att->SetMmUnit(att->StrToDuration(attrValue));
+    }));
+    (*setters)["mm.dots"].push_back(std::make_pair(ATT_MMTEMPO, [](Object *element, const char *attrValue) {
+        AttMmtempo *att = dynamic_cast<AttMmtempo *>(element);
+        assert(att);
+        att->SetMmDots(att->StrToInt(attrValue));
+    }));
+    (*setters)["multi.number"].push_back(
+        std::make_pair(ATT_MULTINUMMEASURES, [](Object *element, const char *attrValue) {
+            AttMultinummeasures *att = dynamic_cast<AttMultinummeasures *>(element);
+            assert(att);
+            att->SetMultiNumber(att->StrToBoolean(attrValue));
+        }));
+    (*setters)["nymref"].push_back(std::make_pair(ATT_NAME, [](Object *element, const char *attrValue) {
+        AttName *att = dynamic_cast<AttName *>(element);
+        assert(att);
+        att->SetNymref(att->StrToStr(attrValue));
+    }));
+    (*setters)["role"].push_back(std::make_pair(ATT_NAME, [](Object *element, const char *attrValue) {
+        AttName *att = dynamic_cast<AttName *>(element);
+        assert(att);
+        att->SetRole(att->StrToStr(attrValue));
+    }));
+    (*setters)["music.name"].push_back(std::make_pair(ATT_NOTATIONSTYLE, [](Object *element, const char *attrValue) {
+        AttNotationstyle *att = dynamic_cast<AttNotationstyle *>(element);
+        assert(att);
+        att->SetMusicName(att->StrToStr(attrValue));
+    }));
+    (*setters)["music.size"].push_back(std::make_pair(ATT_NOTATIONSTYLE, [](Object *element, const char *attrValue) {
+        AttNotationstyle *att = dynamic_cast<AttNotationstyle *>(element);
+        assert(att);
+        att->SetMusicSize(att->StrToInt(attrValue));
+    }));
+    (*setters)["oct.ges"].push_back(std::make_pair(ATT_NOTEGES, [](Object *element, const char *attrValue) {
+        AttNoteGes *att = dynamic_cast<AttNoteGes *>(element);
+        assert(att);
+        att->SetOctGes(att->StrToInt(attrValue));
+    }));
+    (*setters)["pname.ges"].push_back(std::make_pair(ATT_NOTEGES, [](Object *element, const char *attrValue) {
+        AttNoteGes *att = dynamic_cast<AttNoteGes *>(element);
+        assert(att);
+        att->SetPnameGes(att->StrToPitchname(attrValue));
+    }));
+    (*setters)["pnum"].push_back(std::make_pair(ATT_NOTEGES, [](Object *element, const char *attrValue) {
+        AttNoteGes *att = dynamic_cast<AttNoteGes *>(element);
+        assert(att);
+        att->SetPnum(att->StrToInt(attrValue));
+    }));
+    (*setters)["head.color"].push_back(std::make_pair(ATT_NOTEHEADS, [](Object *element, const char *attrValue) {
+        AttNoteheads *att = dynamic_cast<AttNoteheads *>(element);
+        assert(att);
+        att->SetHeadColor(att->StrToStr(attrValue));
+    }));
+    (*setters)["head.fill"].push_back(std::make_pair(ATT_NOTEHEADS, [](Object *element, const char *attrValue) {
+        AttNoteheads *att = dynamic_cast<AttNoteheads *>(element);
+        assert(att);
+        att->SetHeadFill(att->StrToFill(attrValue));
+    }));
+    (*setters)["head.fillcolor"].push_back(std::make_pair(ATT_NOTEHEADS, [](Object *element, const char *attrValue) {
+        AttNoteheads *att = dynamic_cast<AttNoteheads *>(element);
+        assert(att);
+        att->SetHeadFillcolor(att->StrToStr(attrValue));
+    }));
+    (*setters)["head.mod"].push_back(std::make_pair(ATT_NOTEHEADS, [](Object *element, const char *attrValue) {
+        AttNoteheads *att = dynamic_cast<AttNoteheads *>(element);
+        assert(att);
+        att->SetHeadMod(att->StrToStr(attrValue));
+    }));
+    (*setters)["head.rotation"].push_back(std::make_pair(ATT_NOTEHEADS, [](Object *element, const char *attrValue) {
+        AttNoteheads *att = dynamic_cast<AttNoteheads *>(element);
+        assert(att);
+        att->SetHeadRotation(att->StrToStr(attrValue));
+    }));
+    (*setters)["head.shape"].push_back(std::make_pair(ATT_NOTEHEADS, [](Object *element, const char *attrValue) {
+        AttNoteheads *att = dynamic_cast<AttNoteheads *>(element);
+        assert(att);
+        att->SetHeadShape(att->StrToHeadshapeList(attrValue));
+    }));
+    (*setters)["head.visible"].push_back(std::make_pair(ATT_NOTEHEADS, [](Object *element, const char *attrValue) {
+        AttNoteheads *att = dynamic_cast<AttNoteheads *>(element);
+        assert(att);
+        att->SetHeadVisible(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["oct"].push_back(std::make_pair(ATT_OCTAVE, [](Object *element, const char *attrValue) {
+        AttOctave *att = dynamic_cast<AttOctave *>(element);
+        assert(att);
+        att->SetOct(att->StrToInt(attrValue));
+    }));
+    (*setters)["octave.default"].push_back(
+        std::make_pair(ATT_OCTAVEDEFAULT, [](Object *element, const char *attrValue) {
+            AttOctavedefault *att = dynamic_cast<AttOctavedefault *>(element);
+            assert(att);
+            att->SetOctaveDefault(att->StrToInt(attrValue));
+        }));
+    (*setters)["dis"].push_back(std::make_pair(ATT_OCTAVEDISPLACEMENT, [](Object *element, const char *attrValue) {
+        AttOctavedisplacement *att = dynamic_cast<AttOctavedisplacement *>(element);
+        assert(att);
+        att->SetDis(att->StrToOctaveDis(attrValue));
+    }));
+    (*setters)["dis.place"].push_back(
+        std::make_pair(ATT_OCTAVEDISPLACEMENT, [](Object *element, const char *attrValue) {
+            AttOctavedisplacement *att = dynamic_cast<AttOctavedisplacement *>(element);
+            assert(att);
+            att->SetDisPlace(att->StrToPlace(attrValue));
+        }));
+    (*setters)["ontheline"].push_back(std::make_pair(ATT_ONELINESTAFF, [](Object *element, const char *attrValue) {
+        AttOnelinestaff *att = dynamic_cast<AttOnelinestaff *>(element);
+        assert(att);
+        att->SetOntheline(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["optimize"].push_back(std::make_pair(ATT_OPTIMIZATION, [](Object *element, const char *attrValue) {
+        AttOptimization *att = dynamic_cast<AttOptimization *>(element);
+        assert(att);
+        att->SetOptimize(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["origin.layer"].push_back(
+        std::make_pair(ATT_ORIGINLAYERIDENT, [](Object *element, const char *attrValue) {
+            AttOriginLayerident *att = dynamic_cast<AttOriginLayerident *>(element);
+            assert(att);
+            att->SetOriginLayer(att->StrToStr(attrValue));
+        }));
+    (*setters)["origin.staff"].push_back(
+        std::make_pair(ATT_ORIGINSTAFFIDENT, [](Object *element, const char *attrValue) {
+            AttOriginStaffident *att = dynamic_cast<AttOriginStaffident *>(element);
+            assert(att);
+            att->SetOriginStaff(att->StrToStr(attrValue));
+        }));
+    (*setters)["origin.startid"].push_back(
+        std::make_pair(ATT_ORIGINSTARTENDID, [](Object *element, const char *attrValue) {
+            AttOriginStartendid *att = dynamic_cast<AttOriginStartendid *>(element);
+            assert(att);
+            att->SetOriginStartid(att->StrToStr(attrValue));
+        }));
+    (*setters)["origin.endid"].push_back(
+        std::make_pair(ATT_ORIGINSTARTENDID, [](Object *element, const char *attrValue) {
+            AttOriginStartendid *att = dynamic_cast<AttOriginStartendid *>(element);
+            assert(att);
+            att->SetOriginEndid(att->StrToStr(attrValue));
+        }));
+    (*setters)["origin.tstamp"].push_back(
+        std::make_pair(ATT_ORIGINTIMESTAMPMUSICAL, [](Object *element, const char *attrValue) {
+            AttOriginTimestampMusical *att = dynamic_cast<AttOriginTimestampMusical *>(element);
+            assert(att);
+            att->SetOriginTstamp(att->StrToMeasurebeat(attrValue));
+        }));
+    (*setters)["origin.tstamp2"].push_back(
+        std::make_pair(ATT_ORIGINTIMESTAMPMUSICAL, [](Object *element, const char *attrValue) {
+            AttOriginTimestampMusical *att = dynamic_cast<AttOriginTimestampMusical *>(element);
+            assert(att);
+            att->SetOriginTstamp2(att->StrToMeasurebeat(attrValue));
+        }));
+    (*setters)["num"].push_back(std::make_pair(ATT_PADLOG, [](Object *element, const char *attrValue) {
+        AttPadLog *att = dynamic_cast<AttPadLog *>(element);
+        assert(att);
+        att->SetNum(att->StrToInt(attrValue));
+    }));
+    (*setters)["page.height"].push_back(std::make_pair(ATT_PAGES, [](Object *element, const char *attrValue) {
+        AttPages *att = dynamic_cast<AttPages *>(element);
+        assert(att);
+        att->SetPageHeight(att->StrToStr(attrValue));
+    }));
+    (*setters)["page.width"].push_back(std::make_pair(ATT_PAGES, [](Object *element, const char *attrValue) {
+        AttPages *att = dynamic_cast<AttPages *>(element);
+        assert(att);
+        att->SetPageWidth(att->StrToStr(attrValue));
+    }));
+    (*setters)["page.topmar"].push_back(std::make_pair(ATT_PAGES, [](Object *element, const char *attrValue) {
+        AttPages *att = dynamic_cast<AttPages *>(element);
+        assert(att);
+        att->SetPageTopmar(att->StrToStr(attrValue));
+    }));
+    (*setters)["page.botmar"].push_back(std::make_pair(ATT_PAGES, [](Object *element, const char *attrValue) {
+        AttPages *att = dynamic_cast<AttPages *>(element);
+        assert(att);
+        att->SetPageBotmar(att->StrToStr(attrValue));
+    }));
+    (*setters)["page.leftmar"].push_back(std::make_pair(ATT_PAGES, [](Object *element, const char *attrValue) {
+        AttPages *att = dynamic_cast<AttPages *>(element);
+        assert(att);
+        att->SetPageLeftmar(att->StrToStr(attrValue));
+    }));
+    (*setters)["page.rightmar"].push_back(std::make_pair(ATT_PAGES, [](Object *element, const char *attrValue) {
+        AttPages *att = dynamic_cast<AttPages *>(element);
+        assert(att);
+        att->SetPageRightmar(att->StrToStr(attrValue));
+    }));
+    (*setters)["page.panels"].push_back(std::make_pair(ATT_PAGES, [](Object *element, const char *attrValue) {
+        AttPages *att = dynamic_cast<AttPages *>(element);
+        assert(att);
+        att->SetPagePanels(att->StrToStr(attrValue));
+    }));
+    (*setters)["page.scale"].push_back(std::make_pair(ATT_PAGES, [](Object *element, const char *attrValue) {
+        AttPages *att = dynamic_cast<AttPages *>(element);
+        assert(att);
+        att->SetPageScale(att->StrToStr(attrValue));
+    }));
+    (*setters)["folium"].push_back(std::make_pair(ATT_PBVIS, [](Object *element, const char *attrValue) {
+        AttPbVis *att = dynamic_cast<AttPbVis *>(element);
+        assert(att);
+        att->SetFolium(att->StrToPbVisFolium(attrValue));
+    }));
+    (*setters)["pname"].push_back(std::make_pair(ATT_PITCH, [](Object *element, const char *attrValue) {
+        AttPitch *att = dynamic_cast<AttPitch *>(element);
+        assert(att);
+        att->SetPname(att->StrToPitchname(attrValue));
+    }));
+    (*setters)["place"].push_back(std::make_pair(ATT_PLACEMENT, [](Object *element, const char *attrValue) {
+        AttPlacement *att = dynamic_cast<AttPlacement *>(element);
+        assert(att);
+        att->SetPlace(att->StrToStaffrel(attrValue));
+    }));
+    (*setters)["plist"].push_back(std::make_pair(ATT_PLIST, [](Object *element, const char *attrValue) {
+        AttPlist *att = dynamic_cast<AttPlist *>(element);
+        assert(att);
+        att->SetPlist(att->StrToStr(attrValue));
+    }));
+    (*setters)["xlink:actuate"].push_back(std::make_pair(ATT_POINTING, [](Object *element, const char *attrValue) {
+        AttPointing *att = dynamic_cast<AttPointing *>(element);
+        assert(att);
+        att->SetActuate(att->StrToStr(attrValue));
+    }));
+    (*setters)["xlink:role"].push_back(std::make_pair(ATT_POINTING, [](Object *element, const char *attrValue) {
+        AttPointing *att = dynamic_cast<AttPointing *>(element);
+        assert(att);
+        att->SetRole(att->StrToStr(attrValue));
+    }));
+    (*setters)["xlink:show"].push_back(std::make_pair(ATT_POINTING, [](Object *element, const char *attrValue) {
+        AttPointing *att = dynamic_cast<AttPointing *>(element);
+        assert(att);
+        att->SetShow(att->StrToStr(attrValue));
+    }));
+    (*setters)["xlink:target"].push_back(std::make_pair(ATT_POINTING, [](Object *element, const char *attrValue) {
+        AttPointing *att = dynamic_cast<AttPointing *>(element);
+        assert(att);
+        att->SetTarget(att->StrToStr(attrValue));
+    }));
+    (*setters)["xlink:targettype"].push_back(std::make_pair(ATT_POINTING, [](Object *element, const char *attrValue) {
+        AttPointing *att = dynamic_cast<AttPointing *>(element);
+        assert(att);
+        att->SetTargettype(att->StrToStr(attrValue));
+    }));
+    (*setters)["quantity"].push_back(std::make_pair(ATT_QUANTITY, [](Object *element, const char *attrValue) {
+        AttQuantity *att = dynamic_cast<AttQuantity *>(element);
+        assert(att);
+        att->SetQuantity(att->StrToDbl(attrValue));
+    }));
+    (*setters)["size"].push_back(std::make_pair(ATT_RELATIVESIZE, [](Object *element, const char *attrValue) {
+        AttRelativesize *att = dynamic_cast<AttRelativesize *>(element);
+        assert(att);
+        att->SetSize(att->StrToSize(attrValue));
+    }));
+    (*setters)["resp"].push_back(std::make_pair(ATT_RESPONSIBILITY, [](Object *element, const char *attrValue) {
+        AttResponsibility *att = dynamic_cast<AttResponsibility *>(element);
+        assert(att);
+        att->SetResp(att->StrToStr(attrValue));
+    }));
+    (*setters)["form"].push_back(std::make_pair(ATT_SBVIS, [](Object *element, const char *attrValue) {
+        AttSbVis *att = dynamic_cast<AttSbVis *>(element);
+        assert(att);
+        att->SetForm(att->StrToSbVisForm(attrValue));
+    }));
+    (*setters)["scale"].push_back(std::make_pair(ATT_SCALABLE, [](Object *element, const char *attrValue) {
+        AttScalable *att = dynamic_cast<AttScalable *>(element);
+        assert(att);
+        att->SetScale(att->StrToPercent(attrValue));
+    }));
+    (*setters)["tune.pname"].push_back(std::make_pair(ATT_SCOREDEFGES, [](Object *element, const char *attrValue) {
+        AttScoreDefGes *att = dynamic_cast<AttScoreDefGes *>(element);
+        assert(att);
+        att->SetTunePname(att->StrToPitchname(attrValue));
+    }));
+    (*setters)["tune.Hz"].push_back(std::make_pair(ATT_SCOREDEFGES, [](Object *element, const char *attrValue) {
+        AttScoreDefGes *att = dynamic_cast<AttScoreDefGes *>(element);
+        assert(att);
+        att->SetTuneHz(att->StrToDbl(attrValue));
+    }));
+    (*setters)["tune.temper"].push_back(std::make_pair(ATT_SCOREDEFGES, [](Object *element, const char *attrValue) {
+        AttScoreDefGes *att = dynamic_cast<AttScoreDefGes *>(element);
+        assert(att);
+        att->SetTuneTemper(att->StrToTemperament(attrValue));
+    }));
+    (*setters)["vu.height"].push_back(std::make_pair(ATT_SCOREDEFVIS, [](Object *element, const char *attrValue) {
+        AttScoreDefVis *att = dynamic_cast<AttScoreDefVis *>(element);
+        assert(att);
+        att->SetVuHeight(att->StrToStr(attrValue));
+    }));
+    (*setters)["restart"].push_back(std::make_pair(ATT_SECTIONVIS, [](Object *element, const char *attrValue) {
+        AttSectionVis *att = dynamic_cast<AttSectionVis *>(element);
+        assert(att);
+        att->SetRestart(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["seq"].push_back(std::make_pair(ATT_SEQUENCE, [](Object *element, const char *attrValue) {
+        AttSequence *att = dynamic_cast<AttSequence *>(element);
+        assert(att);
+        att->SetSeq(att->StrToInt(attrValue));
+    }));
+    (*setters)["slash"].push_back(std::make_pair(ATT_SLASHCOUNT, [](Object *element, const char *attrValue) {
+        AttSlashcount *att = dynamic_cast<AttSlashcount *>(element);
+        assert(att);
+        att->SetSlash(att->StrToInt(attrValue));
+    }));
+    (*setters)["slur"].push_back(std::make_pair(ATT_SLURPRESENT, [](Object *element, const char *attrValue) {
+        AttSlurpresent *att = dynamic_cast<AttSlurpresent *>(element);
+        assert(att);
+        att->SetSlur(att->StrToStr(attrValue));
+    }));
+    (*setters)["compressable"].push_back(std::make_pair(ATT_SPACEVIS, [](Object *element, const char *attrValue) {
+        AttSpaceVis *att = dynamic_cast<AttSpaceVis *>(element);
+        assert(att);
+        att->SetCompressable(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["spacing.packexp"].push_back(std::make_pair(ATT_SPACING, [](Object *element, const char *attrValue) {
+        AttSpacing *att = dynamic_cast<AttSpacing *>(element);
+        assert(att);
+        att->SetSpacingPackexp(att->StrToDbl(attrValue));
+    }));
+    (*setters)["spacing.packfact"].push_back(std::make_pair(ATT_SPACING, [](Object *element, const char *attrValue) {
+        AttSpacing *att = dynamic_cast<AttSpacing *>(element);
+        assert(att);
+        att->SetSpacingPackfact(att->StrToDbl(attrValue));
+    }));
+    (*setters)["spacing.staff"].push_back(std::make_pair(ATT_SPACING, [](Object *element, const char *attrValue) {
+        AttSpacing *att = dynamic_cast<AttSpacing *>(element);
+        assert(att);
+        att->SetSpacingStaff(att->StrToStr(attrValue));
+    }));
+    (*setters)["spacing.system"].push_back(std::make_pair(ATT_SPACING, [](Object *element, const char *attrValue) {
+        AttSpacing *att = dynamic_cast<AttSpacing *>(element);
+        assert(att);
+        att->SetSpacingSystem(att->StrToStr(attrValue));
+    }));
+    (*setters)["def"].push_back(std::make_pair(ATT_STAFFLOG, [](Object *element, const char *attrValue) {
+        AttStaffLog *att = dynamic_cast<AttStaffLog *>(element);
+        assert(att);
+        att->SetDef(att->StrToStr(attrValue));
+    }));
+    (*setters)["grid.show"].push_back(std::make_pair(ATT_STAFFDEFVIS, [](Object *element, const char *attrValue) {
+        AttStaffDefVis *att = dynamic_cast<AttStaffDefVis *>(element);
+        assert(att);
+        att->SetGridShow(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["layerscheme"].push_back(std::make_pair(ATT_STAFFDEFVIS, [](Object *element, const char *attrValue) {
+        AttStaffDefVis *att = dynamic_cast<AttStaffDefVis *>(element);
+        assert(att);
+        att->SetLayerscheme(att->StrToLayerscheme(attrValue));
+    }));
+    (*setters)["lines"].push_back(std::make_pair(ATT_STAFFDEFVIS, [](Object *element, const char *attrValue) {
+        AttStaffDefVis *att = dynamic_cast<AttStaffDefVis *>(element);
+        assert(att);
+        att->SetLines(att->StrToInt(attrValue));
+    }));
+    (*setters)["lines.color"].push_back(std::make_pair(ATT_STAFFDEFVIS, [](Object *element, const char *attrValue) {
+        AttStaffDefVis *att = dynamic_cast<AttStaffDefVis *>(element);
+        assert(att);
+        att->SetLinesColor(att->StrToStr(attrValue));
+    }));
+    (*setters)["lines.visible"].push_back(std::make_pair(ATT_STAFFDEFVIS, [](Object *element, const char *attrValue) {
+        AttStaffDefVis *att = dynamic_cast<AttStaffDefVis *>(element);
+        assert(att);
+        att->SetLinesVisible(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["spacing"].push_back(std::make_pair(ATT_STAFFDEFVIS, [](Object *element, const char *attrValue) {
+        AttStaffDefVis *att = dynamic_cast<AttStaffDefVis *>(element);
+        assert(att);
+        att->SetSpacing(att->StrToStr(attrValue));
+    }));
+    (*setters)["barthru"].push_back(std::make_pair(ATT_STAFFGRPVIS, [](Object *element, const char *attrValue) {
+        AttStaffGrpVis *att = dynamic_cast<AttStaffGrpVis *>(element);
+        assert(att);
+        att->SetBarthru(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["symbol"].push_back(std::make_pair(ATT_STAFFGROUPINGSYM, [](Object *element, const char *attrValue) {
+        AttStaffgroupingsym *att = dynamic_cast<AttStaffgroupingsym *>(element);
+        assert(att);
+        att->SetSymbol(att->StrToStaffgroupingsymSymbol(attrValue));
+    }));
+    (*setters)["staff"].push_back(std::make_pair(ATT_STAFFIDENT, [](Object *element, const char *attrValue) {
+        AttStaffident *att = dynamic_cast<AttStaffident *>(element);
+        assert(att);
+        att->SetStaff(att->StrToXsdPositiveIntegerList(attrValue));
+    }));
+    (*setters)["loc"].push_back(std::make_pair(ATT_STAFFLOC, [](Object *element, const char *attrValue) {
+        AttStaffloc *att = dynamic_cast<AttStaffloc *>(element);
+        assert(att);
+        att->SetLoc(att->StrToInt(attrValue));
+    }));
+    (*setters)["ploc"].push_back(std::make_pair(ATT_STAFFLOCPITCHED, [](Object *element, const char *attrValue) {
+        AttStafflocPitched *att = dynamic_cast<AttStafflocPitched *>(element);
+        assert(att);
+        att->SetPloc(att->StrToPitchname(attrValue));
+    }));
+    (*setters)["oloc"].push_back(std::make_pair(ATT_STAFFLOCPITCHED, [](Object *element, const char *attrValue) {
+        AttStafflocPitched *att = dynamic_cast<AttStafflocPitched *>(element);
+        assert(att);
+        att->SetOloc(att->StrToInt(attrValue));
+    }));
+    (*setters)["endid"].push_back(std::make_pair(ATT_STARTENDID, [](Object *element, const char *attrValue) {
+        AttStartendid *att = dynamic_cast<AttStartendid *>(element);
+        assert(att);
+        att->SetEndid(att->StrToStr(attrValue));
+    }));
+    (*setters)["startid"].push_back(std::make_pair(ATT_STARTID, [](Object *element, const char *attrValue) {
+        AttStartid *att = dynamic_cast<AttStartid *>(element);
+        assert(att);
+        att->SetStartid(att->StrToStr(attrValue));
+    }));
+    (*setters)["stem.dir"].push_back(std::make_pair(ATT_STEMS, [](Object *element, const char *attrValue) {
+        AttStems *att = dynamic_cast<AttStems *>(element);
+        assert(att);
+        att->SetStemDir(att->StrToStemdirection(attrValue));
+    }));
+    (*setters)["stem.len"].push_back(std::make_pair(ATT_STEMS, [](Object *element, const char *attrValue) {
+        AttStems *att = dynamic_cast<AttStems *>(element);
+        assert(att);
+        att->SetStemLen(att->StrToInt(attrValue));
+    }));
+    (*setters)["stem.mod"].push_back(std::make_pair(ATT_STEMS, [](Object *element, const char *attrValue) {
+        AttStems *att = dynamic_cast<AttStems *>(element);
+        assert(att);
+        att->SetStemMod(att->StrToStemmodifier(attrValue));
+    }));
+    (*setters)["stem.pos"].push_back(std::make_pair(ATT_STEMS, [](Object *element, const char *attrValue) {
+        AttStems *att = dynamic_cast<AttStems *>(element);
+        assert(att);
+        att->SetStemPos(att->StrToStemposition(attrValue));
+    }));
+    (*setters)["stem.x"].push_back(std::make_pair(ATT_STEMS, [](Object *element, const char *attrValue) {
+        AttStems *att = dynamic_cast<AttStems *>(element);
+        assert(att);
+        att->SetStemX(att->StrToDbl(attrValue));
+    }));
+    (*setters)["stem.y"].push_back(std::make_pair(ATT_STEMS, [](Object *element, const char *attrValue) {
+        AttStems *att = dynamic_cast<AttStems *>(element);
+        assert(att);
+        att->SetStemY(att->StrToDbl(attrValue));
+    }));
+    (*setters)["con"].push_back(std::make_pair(ATT_SYLLOG, [](Object *element, const char *attrValue) {
+        AttSylLog *att = dynamic_cast<AttSylLog *>(element);
+        assert(att);
+        att->SetCon(att->StrToSylLogCon(attrValue));
+    }));
+    (*setters)["wordpos"].push_back(std::make_pair(ATT_SYLLOG, [](Object *element, const char *attrValue) {
+        AttSylLog *att = dynamic_cast<AttSylLog *>(element);
+        assert(att);
+        att->SetWordpos(att->StrToSylLogWordpos(attrValue));
+    }));
+    (*setters)["syl"].push_back(std::make_pair(ATT_SYLTEXT, [](Object *element, const char *attrValue) {
+        AttSyltext *att = dynamic_cast<AttSyltext *>(element);
+        assert(att);
+        att->SetSyl(att->StrToStr(attrValue));
+    }));
+    (*setters)["system.leftline"].push_back(std::make_pair(ATT_SYSTEMS, [](Object *element, const char *attrValue) {
+        AttSystems *att = dynamic_cast<AttSystems *>(element);
+        assert(att);
+        att->SetSystemLeftline(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["system.leftmar"].push_back(std::make_pair(ATT_SYSTEMS, [](Object *element, const char *attrValue) {
+        AttSystems *att = dynamic_cast<AttSystems *>(element);
+        assert(att);
+        att->SetSystemLeftmar(att->StrToStr(attrValue));
+    }));
+    (*setters)["system.rightmar"].push_back(std::make_pair(ATT_SYSTEMS, [](Object *element, const char *attrValue) {
+        AttSystems *att = dynamic_cast<AttSystems *>(element);
+        assert(att);
+        att->SetSystemRightmar(att->StrToStr(attrValue));
+    }));
+    (*setters)["system.topmar"].push_back(std::make_pair(ATT_SYSTEMS, [](Object *element, const char *attrValue) {
+        AttSystems *att = dynamic_cast<AttSystems *>(element);
+        assert(att);
+        att->SetSystemTopmar(att->StrToStr(attrValue));
+    }));
+    (*setters)["evaluate"].push_back(std::make_pair(ATT_TARGETEVAL, [](Object *element, const char *attrValue) {
+        AttTargeteval *att = dynamic_cast<AttTargeteval *>(element);
+        assert(att);
+        att->SetEvaluate(att->StrToTargetevalEvaluate(attrValue));
+    }));
+    (*setters)["func"].push_back(std::make_pair(ATT_TEMPOLOG, [](Object *element, const char *attrValue) {
+        AttTempoLog *att = dynamic_cast<AttTempoLog *>(element);
+        assert(att);
+        att->SetFunc(att->StrToTempoLogFunc(attrValue));
+    }));
+    (*setters)["text.fam"].push_back(std::make_pair(ATT_TEXTSTYLE, [](Object *element, const char *attrValue) {
+        AttTextstyle *att = dynamic_cast<AttTextstyle *>(element);
+        assert(att);
+        att->SetTextFam(att->StrToStr(attrValue));
+    }));
+    (*setters)["text.name"].push_back(std::make_pair(ATT_TEXTSTYLE, [](Object *element, const char *attrValue) {
+        AttTextstyle *att = dynamic_cast<AttTextstyle *>(element);
+        assert(att);
+        att->SetTextName(att->StrToStr(attrValue));
+    }));
+    (*setters)["text.size"].push_back(std::make_pair(ATT_TEXTSTYLE, [](Object *element, const char *attrValue) {
+        AttTextstyle *att = dynamic_cast<AttTextstyle *>(element);
+        assert(att);
+        att->SetTextSize(att->StrToInt(attrValue));
+    }));
+    (*setters)["text.style"].push_back(std::make_pair(ATT_TEXTSTYLE, [](Object *element, const char *attrValue) {
+        AttTextstyle *att = dynamic_cast<AttTextstyle *>(element);
+        assert(att);
+        att->SetTextStyle(att->StrToFontstyle(attrValue));
+    }));
+    (*setters)["text.weight"].push_back(std::make_pair(ATT_TEXTSTYLE, [](Object *element, const char *attrValue) {
+        AttTextstyle *att = dynamic_cast<AttTextstyle *>(element);
+        assert(att);
+        att->SetTextWeight(att->StrToFontweight(attrValue));
+    }));
+    (*setters)["tie"].push_back(std::make_pair(ATT_TIEPRESENT, [](Object *element, const char *attrValue) {
+        AttTiepresent *att = dynamic_cast<AttTiepresent *>(element);
+        assert(att);
+        att->SetTie(att->StrToTie(attrValue));
+    }));
+    (*setters)["tstamp"].push_back(std::make_pair(ATT_TIMESTAMPMUSICAL, [](Object *element, const char *attrValue) {
+        AttTimestampMusical *att = dynamic_cast<AttTimestampMusical *>(element);
+        assert(att);
+        att->SetTstamp(att->StrToDbl(attrValue));
+    }));
+    (*setters)["tstamp.ges"].push_back(
+        std::make_pair(ATT_TIMESTAMPPERFORMED, [](Object *element, const char *attrValue) {
+            AttTimestampPerformed *att = dynamic_cast<AttTimestampPerformed *>(element);
+            assert(att);
+            att->SetTstampGes(att->StrToDuration(attrValue));
+        }));
+    (*setters)["tstamp.real"].push_back(
+        std::make_pair(ATT_TIMESTAMPPERFORMED, [](Object *element, const char *attrValue) {
+            AttTimestampPerformed *att = dynamic_cast<AttTimestampPerformed *>(element);
+            assert(att);
+            att->SetTstampReal(att->StrToStr(attrValue));
+        }));
+    (*setters)["tstamp2"].push_back(std::make_pair(ATT_TIMESTAMP2MUSICAL, [](Object *element, const char *attrValue) {
+        AttTimestamp2Musical *att = dynamic_cast<AttTimestamp2Musical *>(element);
+        assert(att);
+        att->SetTstamp2(att->StrToMeasurebeat(attrValue));
+    }));
+    (*setters)["trans.diat"].push_back(std::make_pair(ATT_TRANSPOSITION, [](Object *element, const char *attrValue) {
+        AttTransposition *att = dynamic_cast<AttTransposition *>(element);
+        assert(att);
+        att->SetTransDiat(att->StrToDbl(attrValue));
+    }));
+    (*setters)["trans.semi"].push_back(std::make_pair(ATT_TRANSPOSITION, [](Object *element, const char *attrValue) {
+        AttTransposition *att = dynamic_cast<AttTransposition *>(element);
+        assert(att);
+        att->SetTransSemi(att->StrToDbl(attrValue));
+    }));
+    (*setters)["tuplet"].push_back(std::make_pair(ATT_TUPLETPRESENT, [](Object *element, const char *attrValue) {
+        AttTupletpresent *att = dynamic_cast<AttTupletpresent *>(element);
+        assert(att);
+        att->SetTuplet(att->StrToStr(attrValue));
+    }));
+    (*setters)["type"].push_back(std::make_pair(ATT_TYPED, [](Object *element, const char *attrValue) {
+        AttTyped *att = dynamic_cast<AttTyped *>(element);
+        assert(att);
+        att->SetType(att->StrToStr(attrValue));
+    }));
+    (*setters)["subtype"].push_back(std::make_pair(ATT_TYPED, [](Object *element, const char *attrValue) {
+        AttTyped *att = dynamic_cast<AttTyped *>(element);
+        assert(att);
+        att->SetSubtype(att->StrToStr(attrValue));
+    }));
+    (*setters)["fontfam"].push_back(std::make_pair(ATT_TYPOGRAPHY, [](Object *element, const char *attrValue) {
+        AttTypography *att = dynamic_cast<AttTypography *>(element);
+        assert(att);
+        att->SetFontfam(att->StrToStr(attrValue));
+    }));
+    (*setters)["fontname"].push_back(std::make_pair(ATT_TYPOGRAPHY, [](Object *element, const char *attrValue) {
+        AttTypography *att = dynamic_cast<AttTypography *>(element);
+        assert(att);
+        att->SetFontname(att->StrToStr(attrValue));
+    }));
+    (*setters)["fontsize"].push_back(std::make_pair(ATT_TYPOGRAPHY, [](Object *element, const char *attrValue) {
+        AttTypography *att = dynamic_cast<AttTypography *>(element);
+        assert(att);
+        att->SetFontsize(att->StrToInt(attrValue));
+    }));
+    (*setters)["fontstyle"].push_back(std::make_pair(ATT_TYPOGRAPHY, [](Object *element, const char *attrValue) {
+        AttTypography *att = dynamic_cast<AttTypography *>(element);
+        assert(att);
+        att->SetFontstyle(att->StrToFontstyle(attrValue));
+    }));
+    (*setters)["fontweight"].push_back(std::make_pair(ATT_TYPOGRAPHY, [](Object *element, const char *attrValue) {
+        AttTypography *att = dynamic_cast<AttTypography *>(element);
+        assert(att);
+        att->SetFontweight(att->StrToFontweight(attrValue));
+    }));
+    (*setters)["visible"].push_back(std::make_pair(ATT_VISIBILITY, [](Object *element, const char *attrValue) {
+        AttVisibility *att = dynamic_cast<AttVisibility *>(element);
+        assert(att);
+        att->SetVisible(att->StrToBoolean(attrValue));
+    }));
+    (*setters)["ho"].push_back(std::make_pair(ATT_VISUALOFFSETHO, [](Object *element, const char *attrValue) {
+        AttVisualoffsetHo *att = dynamic_cast<AttVisualoffsetHo *>(element);
+        assert(att);
+        att->SetHo(att->StrToStr(attrValue));
+    }));
+    (*setters)["to"].push_back(std::make_pair(ATT_VISUALOFFSETTO, [](Object *element, const char *attrValue) {
+        AttVisualoffsetTo *att = dynamic_cast<AttVisualoffsetTo *>(element);
+        assert(att);
+        att->SetTo(att->StrToDbl(attrValue));
+    }));
+    (*setters)["vo"].push_back(std::make_pair(ATT_VISUALOFFSETVO, [](Object *element, const char *attrValue) {
+        AttVisualoffsetVo *att = dynamic_cast<AttVisualoffsetVo *>(element);
+        assert(att);
+        att->SetVo(att->StrToStr(attrValue));
+    }));
+    (*setters)["startho"].push_back(std::make_pair(ATT_VISUALOFFSET2HO, [](Object *element, const char *attrValue) {
+        AttVisualoffset2Ho *att = dynamic_cast<AttVisualoffset2Ho *>(element);
+        assert(att);
+        att->SetStartho(att->StrToStr(attrValue));
+    }));
+    (*setters)["endho"].push_back(std::make_pair(ATT_VISUALOFFSET2HO, [](Object *element, const char *attrValue) {
+        AttVisualoffset2Ho *att = dynamic_cast<AttVisualoffset2Ho *>(element);
+        assert(att);
+        att->SetEndho(att->StrToStr(attrValue));
+    }));
+    (*setters)["startto"].push_back(std::make_pair(ATT_VISUALOFFSET2TO, [](Object *element, const char *attrValue) {
+        AttVisualoffset2To *att = dynamic_cast<AttVisualoffset2To *>(element);
+        assert(att);
+        att->SetStartto(att->StrToDbl(attrValue));
+    }));
+    (*setters)["endto"].push_back(std::make_pair(ATT_VISUALOFFSET2TO, [](Object *element, const char *attrValue) {
+        AttVisualoffset2To *att = dynamic_cast<AttVisualoffset2To *>(element);
+        assert(att);
+        att->SetEndto(att->StrToDbl(attrValue));
+    }));
+    (*setters)["startvo"].push_back(std::make_pair(ATT_VISUALOFFSET2VO, [](Object *element, const char *attrValue) {
+        AttVisualoffset2Vo *att = dynamic_cast<AttVisualoffset2Vo *>(element);
+        assert(att);
+        att->SetStartvo(att->StrToStr(attrValue));
+    }));
+    (*setters)["endvo"].push_back(std::make_pair(ATT_VISUALOFFSET2VO, [](Object *element, const char *attrValue) {
+        AttVisualoffset2Vo *att = dynamic_cast<AttVisualoffset2Vo *>(element);
+        assert(att);
+        att->SetEndvo(att->StrToStr(attrValue));
+    }));
+    (*setters)["xml:space"].push_back(std::make_pair(ATT_WHITESPACE, [](Object *element, const char *attrValue) {
+        AttWhitespace *att = dynamic_cast<AttWhitespace *>(element);
+        assert(att);
+        att->SetSpace(att->StrToStr(attrValue));
+    }));
+    (*setters)["width"].push_back(std::make_pair(ATT_WIDTH, [](Object *element, const char *attrValue) {
+        AttWidth *att = dynamic_cast<AttWidth *>(element);
+        assert(att);
+        att->SetWidth(att->StrToStr(attrValue));
+    }));
+    (*setters)["x"].push_back(std::make_pair(ATT_XY, [](Object *element, const char *attrValue) {
+        AttXy *att = dynamic_cast<AttXy *>(element);
+        assert(att);
+        att->SetX(att->StrToDbl(attrValue));
+    }));
+    (*setters)["y"].push_back(std::make_pair(ATT_XY, [](Object *element, const char *attrValue) {
+        AttXy *att = dynamic_cast<AttXy *>(element);
+        assert(att);
+        att->SetY(att->StrToDbl(attrValue));
+    }));
+    (*setters)["x2"].push_back(std::make_pair(ATT_XY2, [](Object *element, const char *attrValue) {
+        AttXy2 *att = dynamic_cast<AttXy2 *>(element);
+        assert(att);
+        att->SetX2(att->StrToDbl(attrValue));
+    }));
+    (*setters)["y2"].push_back(std::make_pair(ATT_XY2, [](Object *element, const char *attrValue) {
+        AttXy2 *att = dynamic_cast<AttXy2 *>(element);
+        assert(att);
+        att->SetY2(att->StrToDbl(attrValue));
+    }));
+}
+
 } // vrv namespace
@@ -180,4 +180,24 @@ void Att::GetTablature(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillTablatureSetters(MapOfAttSetters *setters)
+{
+    (*setters)["tab.fret"].push_back(std::make_pair(ATT_NOTEGESTABLATURE, [](Object *element, const char *attrValue) {
+        AttNoteGesTablature *att = dynamic_cast<AttNoteGesTablature *>(element);
+        assert(att);
+        att->SetTabFret(att->StrToFretnumber(attrValue));
+    }));
+    (*setters)["tab.string"].push_back(std::make_pair(ATT_NOTEGESTABLATURE, [](Object *element, const char *attrValue) {
+        AttNoteGesTablature *att = dynamic_cast<AttNoteGesTablature *>(element);
+        assert(att);
+        att->SetTabString(att->StrToStringnumber(attrValue));
+    }));
+    (*setters)["tab.strings"].push_back(
+        std::make_pair(ATT_STAFFDEFGESTABLATURE, [](Object *element, const char *attrValue) {
+            AttStaffDefGesTablature *att = dynamic_cast<AttStaffDefGesTablature *>(element);
+            assert(att);
+            att->SetTabStrings(att->StrToStr(attrValue));
+        }));
+}
+
 } // vrv namespace
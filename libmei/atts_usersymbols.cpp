@@ -97,4 +97,13 @@ void Att::GetUsersymbols(const Object *element, ArrayOfStrAttr *attributes)
     }
 }
 
+void Att::FillUsersymbolsSetters(MapOfAttSetters *setters)
+{
+    (*setters)["altsym"].push_back(std::make_pair(ATT_ALTSYM, [](Object *element, const char *attrValue) {
+        AttAltsym *att = dynamic_cast<AttAltsym *>(element);
+        assert(att);
+        att->SetAltsym(att->StrToStr(attrValue));
+    }));
+}
+
 } // vrv namespace
@@ -260,7 +260,7 @@ void ArticPart::AddSlurPositioner(FloatingPositioner *positioner, bool start)
 
 int Artic::CalcArtic(FunctorParams *functorParams)
 {
-    FunctorDocParams *params = dynamic_cast<FunctorDocParams *>(functorParams);
+    FunctorDocParams *params = vrv_cast<FunctorDocParams *>(functorParams);
     assert(params);
 
     /************** Get the parent and the stem direction **************/
@@ -272,7 +272,7 @@ int Artic::CalcArtic(FunctorParams *functorParams)
     data_STAFFREL place = STAFFREL_NONE;
 
     if (!parentChord) {
-        parentNote = dynamic_cast<Note *>(this->GetFirstParent(NOTE));
+        parentNote = vrv_cast<Note *>(this->GetFirstParent(NOTE));
         parent = parentNote;
     }
     else {
@@ -284,9 +284,9 @@ int Artic::CalcArtic(FunctorParams *functorParams)
         return FUNCTOR_CONTINUE;
     }
 
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(staff);
-    Layer *layer = dynamic_cast<Layer *>(this->GetFirstParent(LAYER));
+    Layer *layer = vrv_cast<Layer *>(this->GetFirstParent(LAYER));
     assert(layer);
 
     stemDir = parentNote ? parentNote->GetDrawingStemDir() : parentChord->GetDrawingStemDir();
@@ -445,7 +445,7 @@ int ArticPart::ResetVerticalAlignment(FunctorParams *functorParams)
 
 int ArticPart::AdjustArticWithSlurs(FunctorParams *functorParams)
 {
-    FunctorDocParams *params = dynamic_cast<FunctorDocParams *>(functorParams);
+    FunctorDocParams *params = vrv_cast<FunctorDocParams *>(functorParams);
     assert(params);
 
     if (m_startSlurPositioners.empty() && m_endSlurPositioners.empty()) return FUNCTOR_CONTINUE;
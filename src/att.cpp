@@ -31,6 +31,40 @@ Att::~Att()
 {
 }
 
+bool Att::SetAttribute(Object *element, const char *attrType, const char *attrValue)
+{
+    static const MapOfAttSetters setters = Att::InitSetters();
+
+    MapOfAttSetters::const_iterator iter = setters.find(attrType);
+    if (iter == setters.end()) return false;
+
+    // The first att class registered for the element is used
+    ArrayOfAttSetters::const_iterator setter;
+    for (setter = iter->second.begin(); setter != iter->second.end(); setter++) {
+        if (element->HasAttClass(setter->first)) {
+            setter->second(element, attrValue);
+            return true;
+        }
+    }
+    return false;
+}
+
+MapOfAttSetters Att::InitSetters()
+{
+    // Same modules and same order as in Toolkit::Set
+    MapOfAttSetters setters;
+    Att::FillCmnSetters(&setters);
+    Att::FillCmnornamentsSetters(&setters);
+    Att::FillCritappSetters(&setters);
+    Att::FillExternalsymbolsSetters(&setters);
+    Att::FillMeiSetters(&setters);
+    Att::FillMensuralSetters(&setters);
+    Att::FillMidiSetters(&setters);
+    Att::FillPagebasedSetters(&setters);
+    Att::FillSharedSetters(&setters);
+    return setters;
+}
+
 std::string Att::StrToStr(std::string str) const
 {
     return str;
@@ -110,7 +144,7 @@ data_ARTICULATION_List Att::StrToArticulationList(std::string value) const
     std::istringstream iss(value);
     std::string token;
     while (std::getline(iss, token, ' ')) {
-        list.push_back(StrToArticulation(token));
+        list.push_back(StrToArticulation(token.c_str()));
     }
     return list;
 }
@@ -9,12 +9,14 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <assert.h>
 #define _USE_MATH_DEFINES // needed by Windows for math constants like "M_PI"
 #include <math.h>
 
 //----------------------------------------------------------------------------
 
+#include "floatingobject.h"
 #include "glyph.h"
 #include "view.h"
 #include "vrv.h"
@@ -52,17 +54,20 @@ void BBoxDeviceContext::StartGraphic(Object *object, std::string gClass, std::st
     // add the object object
     object->BoundingBox::ResetBoundingBox();
     m_objects.push_back(object);
+    PushContentExtent(object);
 }
 
 void BBoxDeviceContext::ResumeGraphic(Object *object, std::string gId)
 {
     m_objects.push_back(object);
+    PushContentExtent(object);
 }
 
 void BBoxDeviceContext::EndGraphic(Object *object, View *view)
 {
     // detach the object
     assert(m_objects.back() == object);
+    PopContentExtent();
     m_objects.pop_back();
 }
 
@@ -70,9 +75,71 @@ void BBoxDeviceContext::EndResumedGraphic(Object *object, View *view)
 {
     // detach the object
     assert(m_objects.back() == object);
+    PopContentExtent();
     m_objects.pop_back();
 }
 
+void BBoxDeviceContext::PushContentExtent(Object *object)
+{
+    ContentExtent extent = { 0, 0, 0, 0, false, false, object, NULL };
+    if (object->IsFloatingObject()) {
+        extent.m_floatingObject = vrv_cast<FloatingObject *>(object);
+        assert(extent.m_floatingObject);
+        extent.m_target = extent.m_floatingObject->GetCurrentFloatingPositioner();
+    }
+    m_contentExtents.push_back(extent);
+}
+
+void BBoxDeviceContext::PopContentExtent()
+{
+    assert(!m_contentExtents.empty());
+
+    FlushContentExtent((int)m_contentExtents.size() - 1);
+    m_contentExtents.pop_back();
+}
+
+void BBoxDeviceContext::StretchContentExtent(int idx, int x1, int x2, bool hasX, int y1, int y2, bool hasY)
+{
+    ContentExtent &extent = m_contentExtents.at(idx);
+
+    // The current positioner has changed - what was accumulated goes to the previous one
+    if (extent.m_floatingObject && (extent.m_floatingObject->GetCurrentFloatingPositioner() != extent.m_target)) {
+        FlushContentExtent(idx);
+        extent.m_target = extent.m_floatingObject->GetCurrentFloatingPositioner();
+    }
+
+    if (hasX) {
+        extent.m_x1 = extent.m_hasX ? std::min(extent.m_x1, x1) : x1;
+        extent.m_x2 = extent.m_hasX ? std::max(extent.m_x2, x2) : x2;
+        extent.m_hasX = true;
+    }
+    if (hasY) {
+        extent.m_y1 = extent.m_hasY ? std::min(extent.m_y1, y1) : y1;
+        extent.m_y2 = extent.m_hasY ? std::max(extent.m_y2, y2) : y2;
+        extent.m_hasY = true;
+    }
+}
+
+void BBoxDeviceContext::FlushContentExtent(int idx)
+{
+    ContentExtent &extent = m_contentExtents.at(idx);
+    if (!extent.m_hasX && !extent.m_hasY) return;
+
+    // Non virtual calls - for a floating object this is what FloatingObject::UpdateContentBBoxX/Y does
+    if (extent.m_target) {
+        if (extent.m_hasX) extent.m_target->BoundingBox::UpdateContentBBoxX(extent.m_x1, extent.m_x2);
+        if (extent.m_hasY) extent.m_target->BoundingBox::UpdateContentBBoxY(extent.m_y1, extent.m_y2);
+    }
+
+    // Stretch the extent of the parent
+    if (idx > 0) {
+        StretchContentExtent(idx - 1, extent.m_x1, extent.m_x2, extent.m_hasX, extent.m_y1, extent.m_y2, extent.m_hasY);
+    }
+
+    extent.m_hasX = false;
+    extent.m_hasY = false;
+}
+
 void BBoxDeviceContext::StartPage()
 {
 }
@@ -153,28 +220,7 @@ void BBoxDeviceContext::DrawEllipticArc(int x, int y, int width, int height, dou
 
 void BBoxDeviceContext::DrawLine(int x1, int y1, int x2, int y2)
 {
-    if (x1 > x2) {
-        int tmp = x1;
-        x1 = x2;
-        x2 = tmp;
-    }
-    if (y1 > y2) {
-        int tmp = y1;
-        y1 = y2;
-        y2 = tmp;
-    }
-
-    int penWidth = m_penStack.top().GetWidth();
-    int p1 = penWidth / 2;
-    int p2 = p1;
-    // how odd line width is handled might depend on the implementation of the device context.
-    // however, we expect the actualy width to be shifted on the left/top
-    // e.g. with 7, 4 on the left and 3 on the right
-    if (penWidth % 2) {
-        p1++;
-    }
-
-    UpdateBB(x1 - p1, y1 - p1, x2 + p2, y2 + p2);
+    UpdateLineBB(x1, y1, x2, y2, m_penStack.top().GetWidth());
 }
 
 void BBoxDeviceContext::DrawPolygon(int n, Point points[], int xoffset, int yoffset, int fill_style)
@@ -203,22 +249,7 @@ void BBoxDeviceContext::DrawRectangle(int x, int y, int width, int height)
 
 void BBoxDeviceContext::DrawRoundedRectangle(int x, int y, int width, int height, double radius)
 {
-    // avoid negative heights or widths
-    if (height < 0) {
-        height = -height;
-        y -= height;
-    }
-    if (width < 0) {
-        width = -width;
-        x -= width;
-    }
-    int penWidth = m_penStack.top().GetWidth();
-
-    if (penWidth % 2) {
-        penWidth += 1;
-    }
-
-    UpdateBB(x - penWidth / 2, y - penWidth / 2, x + width + penWidth / 2, y + height + penWidth / 2);
+    UpdateRectangleBB(x, y, width, height, m_penStack.top().GetWidth());
 }
 
 void BBoxDeviceContext::DrawPlaceholder(int x, int y)
@@ -280,38 +311,89 @@ void BBoxDeviceContext::DrawMusicText(const std::wstring &text, int x, int y, bo
 {
     assert(m_fontStack.top());
 
-    int g_x, g_y, g_w, g_h;
-    int lastCharWidth = 0;
+    UpdateMusicTextBB(text, x, y, m_fontStack.top()->GetPointSize(), setSmuflGlyph);
+}
 
-    wchar_t smuflGlyph = 0;
-    if (setSmuflGlyph && (text.length() == 1)) smuflGlyph = text.at(0);
+void BBoxDeviceContext::DrawSpline(int n, Point points[])
+{
+}
+
+void BBoxDeviceContext::UpdateMusicTextBB(const std::wstring &text, int x, int y, int pointSize, bool setSmuflGlyph)
+{
+    // The glyph is set only for a single one
+    setSmuflGlyph = (setSmuflGlyph && (text.length() == 1));
 
     for (unsigned int i = 0; i < text.length(); i++) {
-        wchar_t c = text.at(i);
-        Glyph *glyph = Resources::GetGlyph(c);
-        if (!glyph) {
-            continue;
-        }
-        glyph->GetBoundingBox(g_x, g_y, g_w, g_h);
-
-        int x_off = x + g_x * m_fontStack.top()->GetPointSize() / glyph->GetUnitsPerEm();
-        // because we are in the drawing context, y position is already flipped
-        int y_off = y - g_y * m_fontStack.top()->GetPointSize() / glyph->GetUnitsPerEm();
-
-        UpdateBB(x_off, y_off, x_off + g_w * m_fontStack.top()->GetPointSize() / glyph->GetUnitsPerEm(),
-            // idem, y position is flipped
-            y_off - g_h * m_fontStack.top()->GetPointSize() / glyph->GetUnitsPerEm(), smuflGlyph);
-
-        lastCharWidth = g_w * m_fontStack.top()->GetPointSize() / glyph->GetUnitsPerEm();
-        x += lastCharWidth; // move x to next char
+        x += UpdateGlyphBB(text.at(i), x, y, pointSize, setSmuflGlyph); // move x to next char
     }
 }
 
-void BBoxDeviceContext::DrawSpline(int n, Point points[])
+int BBoxDeviceContext::UpdateGlyphBB(wchar_t code, int x, int y, int pointSize, bool setSmuflGlyph)
 {
+    assert(m_resources);
+
+    const Glyph *glyph = m_resources->GetGlyph(code);
+    if (!glyph) return 0;
+
+    int g_x, g_y, g_w, g_h;
+    glyph->GetBoundingBox(g_x, g_y, g_w, g_h);
+
+    int x_off = x + g_x * pointSize / glyph->GetUnitsPerEm();
+    // because we are in the drawing context, y position is already flipped
+    int y_off = y - g_y * pointSize / glyph->GetUnitsPerEm();
+
+    UpdateBB(x_off, y_off, x_off + g_w * pointSize / glyph->GetUnitsPerEm(),
+        // idem, y position is flipped
+        y_off - g_h * pointSize / glyph->GetUnitsPerEm(), (setSmuflGlyph) ? code : 0, pointSize);
+
+    return g_w * pointSize / glyph->GetUnitsPerEm();
 }
 
-void BBoxDeviceContext::UpdateBB(int x1, int y1, int x2, int y2, wchar_t glyph)
+void BBoxDeviceContext::UpdateLineBB(int x1, int y1, int x2, int y2, int penWidth)
+{
+    if (x1 > x2) {
+        int tmp = x1;
+        x1 = x2;
+        x2 = tmp;
+    }
+    if (y1 > y2) {
+        int tmp = y1;
+        y1 = y2;
+        y2 = tmp;
+    }
+
+    int p1 = penWidth / 2;
+    int p2 = p1;
+    // how odd line width is handled might depend on the implementation of the device context.
+    // however, we expect the actualy width to be shifted on the left/top
+    // e.g. with 7, 4 on the left and 3 on the right
+    if (penWidth % 2) {
+        p1++;
+    }
+
+    UpdateBB(x1 - p1, y1 - p1, x2 + p2, y2 + p2);
+}
+
+void BBoxDeviceContext::UpdateRectangleBB(int x, int y, int width, int height, int penWidth)
+{
+    // avoid negative heights or widths
+    if (height < 0) {
+        height = -height;
+        y -= height;
+    }
+    if (width < 0) {
+        width = -width;
+        x -= width;
+    }
+
+    if (penWidth % 2) {
+        penWidth += 1;
+    }
+
+    UpdateBB(x - penWidth / 2, y - penWidth / 2, x + width + penWidth / 2, y + height + penWidth / 2);
+}
+
+void BBoxDeviceContext::UpdateBB(int x1, int y1, int x2, int y2, wchar_t glyph, int glyphPointSize)
 {
     if (m_isDeactivatedX && m_isDeactivatedY) {
         return;
@@ -322,21 +404,24 @@ void BBoxDeviceContext::UpdateBB(int x1, int y1, int x2, int y2, wchar_t glyph)
 
     // we need to store logical coordinates in the objects, we need to convert them back (this is why we need a View
     // object)
+    int lx1 = 0, lx2 = 0, ly1 = 0, ly2 = 0;
     if (!m_isDeactivatedX) {
-        (m_objects.back())->UpdateSelfBBoxX(m_view->ToLogicalX(x1), m_view->ToLogicalX(x2));
-        if (glyph != 0) (m_objects.back())->SetBoundingBoxGlyph(glyph, m_fontStack.top()->GetPointSize());
+        lx1 = m_view->ToLogicalX(x1);
+        lx2 = m_view->ToLogicalX(x2);
+        (m_objects.back())->UpdateSelfBBoxX(lx1, lx2);
+        if (glyph != 0) (m_objects.back())->SetBoundingBoxGlyph(glyph, glyphPointSize);
+        if (lx1 > lx2) std::swap(lx1, lx2);
     }
     if (!m_isDeactivatedY) {
-        (m_objects.back())->UpdateSelfBBoxY(m_view->ToLogicalY(y1), m_view->ToLogicalY(y2));
-        if (glyph != 0) (m_objects.back())->SetBoundingBoxGlyph(glyph, m_fontStack.top()->GetPointSize());
+        ly1 = m_view->ToLogicalY(y1);
+        ly2 = m_view->ToLogicalY(y2);
+        (m_objects.back())->UpdateSelfBBoxY(ly1, ly2);
+        if (glyph != 0) (m_objects.back())->SetBoundingBoxGlyph(glyph, glyphPointSize);
+        if (ly1 > ly2) std::swap(ly1, ly2);
     }
 
-    int i;
-    // Stretch the content BB of the other objects
-    for (i = 0; i < (int)m_objects.size(); i++) {
-        if (!m_isDeactivatedX) (m_objects.at(i))->UpdateContentBBoxX(m_view->ToLogicalX(x1), m_view->ToLogicalX(x2));
-        if (!m_isDeactivatedY) (m_objects.at(i))->UpdateContentBBoxY(m_view->ToLogicalY(y1), m_view->ToLogicalY(y2));
-    }
+    // Stretch the content extent of the current object - it will be propagated to the others in EndGraphic
+    StretchContentExtent((int)m_contentExtents.size() - 1, lx1, lx2, !m_isDeactivatedX, ly1, ly2, !m_isDeactivatedY);
 }
 
 } // namespace vrv
@@ -582,7 +582,7 @@ BeamElementCoord::~BeamElementCoord()
 
 int Beam::CalcStem(FunctorParams *functorParams)
 {
-    CalcStemParams *params = dynamic_cast<CalcStemParams *>(functorParams);
+    CalcStemParams *params = vrv_cast<CalcStemParams *>(functorParams);
     assert(params);
 
     ListOfObjects *beamChildren = this->GetList(this);
@@ -595,9 +595,9 @@ int Beam::CalcStem(FunctorParams *functorParams)
 
     int elementCount = (int)beamChildren->size();
 
-    Layer *layer = dynamic_cast<Layer *>(this->GetFirstParent(LAYER));
+    Layer *layer = vrv_cast<Layer *>(this->GetFirstParent(LAYER));
     assert(layer);
-    Staff *staff = dynamic_cast<Staff *>(layer->GetFirstParent(STAFF));
+    Staff *staff = vrv_cast<Staff *>(layer->GetFirstParent(STAFF));
     assert(staff);
 
     this->m_drawingParams.CalcBeam(layer, staff, params->m_doc, beamElementCoords, elementCount);
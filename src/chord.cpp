@@ -318,7 +318,7 @@ Point Chord::GetStemDownNW(Doc *doc, int staffSize, bool graceSize)
 
 int Chord::CalcStem(FunctorParams *functorParams)
 {
-    CalcStemParams *params = dynamic_cast<CalcStemParams *>(functorParams);
+    CalcStemParams *params = vrv_cast<CalcStemParams *>(functorParams);
     assert(params);
 
     // Set them to NULL in any case
@@ -339,9 +339,9 @@ int Chord::CalcStem(FunctorParams *functorParams)
 
     Stem *stem = this->GetDrawingStem();
     assert(stem);
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(staff);
-    Layer *layer = dynamic_cast<Layer *>(this->GetFirstParent(LAYER));
+    Layer *layer = vrv_cast<Layer *>(this->GetFirstParent(LAYER));
     assert(layer);
 
     if (this->m_crossStaff) staff = this->m_crossStaff;
@@ -390,7 +390,7 @@ int Chord::CalcStem(FunctorParams *functorParams)
 
 int Chord::CalcDots(FunctorParams *functorParams)
 {
-    CalcDotsParams *params = dynamic_cast<CalcDotsParams *>(functorParams);
+    CalcDotsParams *params = vrv_cast<CalcDotsParams *>(functorParams);
     assert(params);
 
     if (!this->HasDots()) {
@@ -543,7 +543,7 @@ int Chord::PrepareLayerElementParts(FunctorParams *functorParams)
 
 int Chord::PrepareTieAttr(FunctorParams *functorParams)
 {
-    PrepareTieAttrParams *params = dynamic_cast<PrepareTieAttrParams *>(functorParams);
+    PrepareTieAttrParams *params = vrv_cast<PrepareTieAttrParams *>(functorParams);
     assert(params);
 
     assert(!params->m_currentChord);
@@ -554,7 +554,7 @@ int Chord::PrepareTieAttr(FunctorParams *functorParams)
 
 int Chord::PrepareTieAttrEnd(FunctorParams *functorParams)
 {
-    PrepareTieAttrParams *params = dynamic_cast<PrepareTieAttrParams *>(functorParams);
+    PrepareTieAttrParams *params = vrv_cast<PrepareTieAttrParams *>(functorParams);
     assert(params);
 
     assert(params->m_currentChord);
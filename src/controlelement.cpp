@@ -30,7 +30,7 @@ ControlElement::ControlElement() : FloatingObject("me"), AttCommon(), AttCommonP
     Reset();
 }
 
-ControlElement::ControlElement(std::string classid) : FloatingObject(classid), AttCommon(), AttTyped()
+ControlElement::ControlElement(const char *classid) : FloatingObject(classid), AttCommon(), AttTyped()
 {
     RegisterAttClass(ATT_COMMON);
     RegisterAttClass(ATT_COMMONPART);
@@ -124,13 +124,15 @@ void DeviceContext::GetTextExtent(const std::wstring &string, TextExtend *extend
     extend->m_width = 0;
     extend->m_height = 0;
 
-    Glyph *unkown = Resources::GetTextGlyph(L'o');
+    assert(m_resources);
+
+    const Glyph *unkown = m_resources->GetTextGlyph(L'o');
 
     for (unsigned int i = 0; i < string.length(); i++) {
         wchar_t c = string[i];
-        Glyph *glyph = Resources::GetTextGlyph(c);
+        const Glyph *glyph = m_resources->GetTextGlyph(c);
         if (!glyph) {
-            glyph = Resources::GetGlyph(c);
+            glyph = m_resources->GetGlyph(c);
         }
         if (!glyph) {
             glyph = unkown;
@@ -147,9 +149,11 @@ void DeviceContext::GetSmuflTextExtent(const std::wstring &string, TextExtend *e
     extend->m_width = 0;
     extend->m_height = 0;
 
+    assert(m_resources);
+
     for (unsigned int i = 0; i < string.length(); i++) {
         wchar_t c = string[i];
-        Glyph *glyph = Resources::GetGlyph(c);
+        const Glyph *glyph = m_resources->GetGlyph(c);
         if (!glyph) {
             continue;
         }
@@ -157,7 +161,7 @@ void DeviceContext::GetSmuflTextExtent(const std::wstring &string, TextExtend *e
     }
 }
 
-void DeviceContext::AddGlyphToTextExtend(Glyph *glyph, TextExtend *extend)
+void DeviceContext::AddGlyphToTextExtend(const Glyph *glyph, TextExtend *extend)
 {
     assert(glyph);
     assert(extend);
@@ -54,11 +54,18 @@ Doc::Doc() : Object("doc-")
 
     // owned pointers need to be set to NULL;
     m_scoreBuffer = NULL;
+    m_resources = NULL;
     Reset();
+
+    this->AddToUuidIndex(this);
 }
 
 Doc::~Doc()
 {
+    // The children remove themselves from the uuid index when deleted
+    ClearChildren();
+    this->RemoveFromUuidIndex();
+
     delete m_style;
     if (m_scoreBuffer) {
         delete m_scoreBuffer;
@@ -69,6 +76,10 @@ void Doc::Reset()
 {
     Object::Reset();
 
+    // The uuids generated from now on depend only on the document being loaded, including the one of the scoreDef
+    Object::RestartUuidSequence();
+    m_scoreDef.ResetUuid();
+
     m_type = Raw;
     m_pageWidth = -1;
     m_pageHeight = -1;
@@ -85,9 +96,19 @@ void Doc::Reset()
     m_drawingPage = NULL;
     m_drawingJustifyX = true;
     m_drawingEvenSpacing = false;
+    m_layoutThreads = 1;
     m_currentScoreDefDone = false;
     m_drawingPreparationDone = false;
     m_midiExportDone = false;
+    m_castOffLayoutDone = false;
+    m_castOffLabelsWidth = 0;
+    m_castOffAbbrLabelsWidth = 0;
+    m_castOffScoreDefWidth = 0;
+    m_timeIndexNotes.clear();
+    m_timeIndexByOnset.clear();
+    m_timeIndexMaxOffsets.clear();
+    m_tempoMap.clear();
+    m_midiTicksPerQuarter = 120;
 
     m_scoreDef.Reset();
     if (m_scoreBuffer) {
@@ -192,22 +213,27 @@ void Doc::ExportMIDI(MidiFile *midiFile)
     Functor prepareProcessingLists(&Object::PrepareProcessingLists);
     this->Process(&prepareProcessingLists, &prepareProcessingListsParams);
 
-    // The tree is used to process each staff/layer/verse separatly
-    // For this, we use a array of AttCommmonNComparison that looks for each object if it is of the type
-    // and with @n specified
+    // The layers collected for each staff/layer are processed measure by measure as separate streams
+    ArrayOfObjects measures;
+    AttComparison matchMeasure(MEASURE);
+    this->FindAllChildByAttComparison(&measures, &matchMeasure);
 
     IntTree_t::iterator staves;
     IntTree_t::iterator layers;
 
-    // Set tempo
+    // Set tempo - without tempo event the MIDI default of 120 bpm applies
+    double tempo = 120.0;
     if (m_scoreDef.HasMidiBpm()) {
-        midiFile->addTempo(0, 0, m_scoreDef.GetMidiBpm());
+        tempo = m_scoreDef.GetMidiBpm();
+        midiFile->addTempo(0, 0, tempo);
     }
+    m_tempoMap.clear();
+    m_tempoMap.push_back(std::make_tuple(0.0, 0.0, tempo));
+    m_midiTicksPerQuarter = midiFile->getTicksPerQuarterNote();
 
     // Process notes and chords, rests, spaces layer by layer
     // track 0 (included by default) is reserved for meta messages common to all tracks
     int midiTrack = 1;
-    std::vector<AttComparison *> filters;
     for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
          staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
 
@@ -221,12 +247,8 @@ void Doc::ExportMIDI(MidiFile *midiFile)
         }
 
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            filters.clear();
-            // Create ad comparison object for each type / @n
-            AttCommonNComparison matchStaff(STAFF, staves->first);
-            AttCommonNComparison matchLayer(LAYER, layers->first);
-            filters.push_back(&matchStaff);
-            filters.push_back(&matchLayer);
+            const ArrayOfObjects &layerStream
+                = prepareProcessingListsParams.m_layers.at({ staves->first, layers->first });
 
             GenerateMIDIParams generateMIDIParams(midiFile);
             generateMIDIParams.m_maxValues = calcMaxMeasureDurationParams.m_maxValues;
@@ -236,13 +258,120 @@ void Doc::ExportMIDI(MidiFile *midiFile)
             Functor generateMIDIEnd(&Object::GenerateMIDIEnd);
 
             // LogDebug("Exporting track %d ----------------", midiTrack);
-            this->Process(&generateMIDI, &generateMIDIParams, &generateMIDIEnd, &filters);
+            // Every measure is processed for keeping the time, even if it does not have the layer
+            ArrayOfObjects::const_iterator layerIter = layerStream.begin();
+            for (auto &measure : measures) {
+                generateMIDI.Call(measure, &generateMIDIParams);
+                while ((layerIter != layerStream.end()) && ((*layerIter)->GetFirstParent(MEASURE) == measure)) {
+                    (*layerIter)->Process(&generateMIDI, &generateMIDIParams, &generateMIDIEnd);
+                    ++layerIter;
+                }
+                generateMIDIEnd.Call(measure, &generateMIDIParams);
+            }
         }
     }
 
+    this->BuildTimeIndex();
+
     m_midiExportDone = true;
 }
 
+void Doc::BuildTimeIndex()
+{
+    m_timeIndexNotes.clear();
+    m_timeIndexByOnset.clear();
+    m_timeIndexMaxOffsets.clear();
+
+    // Notes not played (e.g., grace notes) have no duration and are left out
+    ArrayOfObjects notes;
+    AttComparison matchType(NOTE);
+    this->FindAllChildByAttComparison(&notes, &matchType);
+    for (auto &object : notes) {
+        Note *note = dynamic_cast<Note *>(object);
+        assert(note);
+        if (note->m_playingOffset <= note->m_playingOnset) continue;
+        m_timeIndexByOnset.push_back((int)m_timeIndexNotes.size());
+        m_timeIndexNotes.push_back(note);
+    }
+
+    std::stable_sort(m_timeIndexByOnset.begin(), m_timeIndexByOnset.end(), [this](int idx1, int idx2) {
+        return (static_cast<Note *>(m_timeIndexNotes.at(idx1))->m_playingOnset
+            < static_cast<Note *>(m_timeIndexNotes.at(idx2))->m_playingOnset);
+    });
+    m_timeIndexMaxOffsets.resize(m_timeIndexByOnset.size());
+    this->BuildTimeIndexMaxOffsets(0, (int)m_timeIndexByOnset.size());
+}
+
+double Doc::BuildTimeIndexMaxOffsets(int first, int last)
+{
+    if (first >= last) return 0.0;
+
+    int middle = (first + last) / 2;
+    Note *note = static_cast<Note *>(m_timeIndexNotes.at(m_timeIndexByOnset.at(middle)));
+    double maxOffset = note->m_playingOffset;
+    maxOffset = std::max(maxOffset, this->BuildTimeIndexMaxOffsets(first, middle));
+    maxOffset = std::max(maxOffset, this->BuildTimeIndexMaxOffsets(middle + 1, last));
+    m_timeIndexMaxOffsets.at(middle) = maxOffset;
+    return maxOffset;
+}
+
+void Doc::FindNotesAtTime(std::vector<int> *indices, double scoreTime, int first, int last) const
+{
+    if (first >= last) return;
+
+    // All the notes of the range end before the time
+    int middle = (first + last) / 2;
+    if (m_timeIndexMaxOffsets.at(middle) <= scoreTime) return;
+
+    this->FindNotesAtTime(indices, scoreTime, first, middle);
+    // The notes after the middle one start at the same time or later
+    Note *note = static_cast<Note *>(m_timeIndexNotes.at(m_timeIndexByOnset.at(middle)));
+    if (note->m_playingOnset >= scoreTime) return;
+    if (note->m_playingOffset > scoreTime) indices->push_back(m_timeIndexByOnset.at(middle));
+    this->FindNotesAtTime(indices, scoreTime, middle + 1, last);
+}
+
+void Doc::GetNotesAtTime(ArrayOfObjects *notes, double scoreTime) const
+{
+    assert(notes);
+
+    // A note starting exactly at the time is not sounding yet
+    std::vector<int> indices;
+    this->FindNotesAtTime(&indices, scoreTime, 0, (int)m_timeIndexByOnset.size());
+
+    // Return them in document order
+    std::sort(indices.begin(), indices.end());
+    for (auto &idx : indices) {
+        notes->push_back(m_timeIndexNotes.at(idx));
+    }
+}
+
+double Doc::GetRealTimeForScoreTime(double scoreTime) const
+{
+    // Before any export, assume the MIDI default tempo
+    if (m_tempoMap.empty()) return scoreTime * 60000.0 / (120.0 * m_midiTicksPerQuarter);
+
+    // Find the last tempo change at or before the score time
+    auto iter = std::upper_bound(m_tempoMap.begin(), m_tempoMap.end(), scoreTime,
+        [](double time, const std::tuple<double, double, double> &change) { return time < std::get<0>(change); });
+    if (iter != m_tempoMap.begin()) --iter;
+
+    return std::get<1>(*iter)
+        + (scoreTime - std::get<0>(*iter)) * 60000.0 / (std::get<2>(*iter) * m_midiTicksPerQuarter);
+}
+
+double Doc::GetScoreTimeForRealTime(double realTime) const
+{
+    if (m_tempoMap.empty()) return realTime * 120.0 * m_midiTicksPerQuarter / 60000.0;
+
+    // Find the last tempo change at or before the real time
+    auto iter = std::upper_bound(m_tempoMap.begin(), m_tempoMap.end(), realTime,
+        [](double time, const std::tuple<double, double, double> &change) { return time < std::get<1>(change); });
+    if (iter != m_tempoMap.begin()) --iter;
+
+    return std::get<0>(*iter) + (realTime - std::get<1>(*iter)) * std::get<2>(*iter) * m_midiTicksPerQuarter / 60000.0;
+}
+
 void Doc::PrepareDrawing()
 {
     if (m_drawingPreparationDone) {
@@ -251,22 +380,15 @@ void Doc::PrepareDrawing()
     }
 
     // Try to match all spanning elements (slur, tie, etc) by processing backwards
+    // We go backwards because normally the spanning elements are at the end of the measure and the
+    // @startid and @endid are kept by uuid until the element is reached. In some cases, one (or both)
+    // end points appear afterwards in the encoding and are looked up in the elements already processed.
     PrepareTimeSpanningParams prepareTimeSpanningParams;
     Functor prepareTimeSpanning(&Object::PrepareTimeSpanning);
     Functor prepareTimeSpanningEnd(&Object::PrepareTimeSpanningEnd);
     this->Process(
         &prepareTimeSpanning, &prepareTimeSpanningParams, &prepareTimeSpanningEnd, NULL, UNLIMITED_DEPTH, BACKWARD);
 
-    // First we try backwards because normally the spanning elements are at the end of
-    // the measure. However, in some case, one (or both) end points will appear afterwards
-    // in the encoding. For these, the previous iteration will not have resolved the link and
-    // the spanning elements will remain in the timeSpanningElements array. We try again forwards
-    // but this time without filling the list (that is only will the remaining elements)
-    if (!prepareTimeSpanningParams.m_timeSpanningInterfaces.empty()) {
-        prepareTimeSpanningParams.m_fillList = false;
-        this->Process(&prepareTimeSpanning, &prepareTimeSpanningParams);
-    }
-
     // Try to match all time pointing elements (tempo, fermata, etc) by processing backwards
     PrepareTimePointingParams prepareTimePointingParams;
     Functor prepareTimePointing(&Object::PrepareTimePointing);
@@ -276,7 +398,9 @@ void Doc::PrepareDrawing()
 
     // Now try to match the @tstamp and @tstamp2 attributes.
     PrepareTimestampsParams prepareTimestampsParams;
-    prepareTimestampsParams.m_timeSpanningInterfaces = prepareTimeSpanningParams.m_timeSpanningInterfaces;
+    for (auto &interface : prepareTimeSpanningParams.m_timeSpanningInterfaces) {
+        if (!interface.first->HasStartAndEnd()) prepareTimestampsParams.m_timeSpanningInterfaces.push_back(interface);
+    }
     Functor prepareTimestamps(&Object::PrepareTimestamps);
     Functor prepareTimestampsEnd(&Object::PrepareTimestampsEnd);
     this->Process(&prepareTimestamps, &prepareTimestampsParams, &prepareTimestampsEnd);
@@ -305,9 +429,8 @@ void Doc::PrepareDrawing()
     Functor prepareProcessingLists(&Object::PrepareProcessingLists);
     this->Process(&prepareProcessingLists, &prepareProcessingListsParams);
 
-    // The tree is used to process each staff/layer/verse separately
-    // For this, we use an array of AttCommmonNComparison that looks for each object if it is of the type
-    // and with @n specified
+    // The layers collected for each staff/layer are processed as separate streams, which avoids processing the
+    // entire document for each of them. The streams not creating any object are processed concurrently.
 
     IntTree_t::iterator staves;
     IntTree_t::iterator layers;
@@ -315,75 +438,74 @@ void Doc::PrepareDrawing()
 
     // Process by layer for matching @tie attribute - we process notes and chords, looking at
     // GetTie values and pitch and oct for matching notes
-    std::vector<AttComparison *> filters;
-    for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
-         staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
-        for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            filters.clear();
-            // Create ad comparison object for each type / @n
-            AttCommonNComparison matchStaff(STAFF, staves->first);
-            AttCommonNComparison matchLayer(LAYER, layers->first);
-            filters.push_back(&matchStaff);
-            filters.push_back(&matchLayer);
+    // This is not done concurrently because the ties created get their uuid in the order of the processing
+    MapOfLayersByStaffLayerN::iterator layerStream;
+    for (layerStream = prepareProcessingListsParams.m_layers.begin();
+         layerStream != prepareProcessingListsParams.m_layers.end(); ++layerStream) {
+        PrepareTieAttrParams prepareTieAttrParams;
+        Functor prepareTieAttr(&Object::PrepareTieAttr);
+        Functor prepareTieAttrEnd(&Object::PrepareTieAttrEnd);
+        for (auto &layer : layerStream->second) {
+            layer->Process(&prepareTieAttr, &prepareTieAttrParams, &prepareTieAttrEnd);
+        }
 
-            PrepareTieAttrParams prepareTieAttrParams;
-            Functor prepareTieAttr(&Object::PrepareTieAttr);
-            Functor prepareTieAttrEnd(&Object::PrepareTieAttrEnd);
-            this->Process(&prepareTieAttr, &prepareTieAttrParams, &prepareTieAttrEnd, &filters);
-
-            // After having processed one layer, we check if we have open ties - if yes, we
-            // must reset them and they will be ignored.
-            if (!prepareTieAttrParams.m_currentNotes.empty()) {
-                std::vector<Note *>::iterator iter;
-                for (iter = prepareTieAttrParams.m_currentNotes.begin();
-                     iter != prepareTieAttrParams.m_currentNotes.end(); iter++) {
-                    LogWarning("Unable to match @tie of note '%s', skipping it", (*iter)->GetUuid().c_str());
-                    (*iter)->ResetDrawingTieAttr();
-                }
+        // After having processed one layer, we check if we have open ties - if yes, we
+        // must reset them and they will be ignored.
+        if (!prepareTieAttrParams.m_currentNotes.empty()) {
+            std::vector<Note *>::iterator iter;
+            for (iter = prepareTieAttrParams.m_currentNotes.begin(); iter != prepareTieAttrParams.m_currentNotes.end();
+                 iter++) {
+                LogWarning("Unable to match @tie of note '%s', skipping it", (*iter)->GetUuid().c_str());
+                (*iter)->ResetDrawingTieAttr();
             }
         }
     }
 
-    for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
-         staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
-        for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
-            filters.clear();
-            // Create ad comparison object for each type / @n
-            AttCommonNComparison matchStaff(STAFF, staves->first);
-            AttCommonNComparison matchLayer(LAYER, layers->first);
-            filters.push_back(&matchStaff);
-            filters.push_back(&matchLayer);
-
+    std::vector<ArrayOfObjects *> layerStreams;
+    for (layerStream = prepareProcessingListsParams.m_layers.begin();
+         layerStream != prepareProcessingListsParams.m_layers.end(); ++layerStream) {
+        layerStreams.push_back(&layerStream->second);
+    }
+    ProcessInChunks((int)layerStreams.size(), m_layoutThreads, [&layerStreams](int begin, int end) {
+        for (int i = begin; i < end; i++) {
             PreparePointersByLayerParams preparePointersByLayerParams;
             Functor preparePointersByLayer(&Object::PreparePointersByLayer);
-            this->Process(&preparePointersByLayer, &preparePointersByLayerParams, NULL, &filters);
+            for (auto &layer : *layerStreams.at(i)) {
+                layer->Process(&preparePointersByLayer, &preparePointersByLayerParams);
+            }
         }
-    }
+    });
 
     // Same for the lyrics, but Verse by Verse since Syl are TimeSpanningInterface elements for handling connectors
+    std::vector<std::pair<ArrayOfObjects *, int> > verseStreams;
     for (staves = prepareProcessingListsParams.m_verseTree.child.begin();
          staves != prepareProcessingListsParams.m_verseTree.child.end(); ++staves) {
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
             for (verses = layers->second.child.begin(); verses != layers->second.child.end(); ++verses) {
                 // std::cout << staves->first << " => " << layers->first << " => " << verses->first << '\n';
-                filters.clear();
-                // Create ad comparison object for each type / @n
-                AttCommonNComparison matchStaff(STAFF, staves->first);
-                AttCommonNComparison matchLayer(LAYER, layers->first);
-                AttCommonNComparison matchVerse(VERSE, verses->first);
-                filters.push_back(&matchStaff);
-                filters.push_back(&matchLayer);
-                filters.push_back(&matchVerse);
-
-                // The first pass sets m_drawingFirstNote and m_drawingLastNote for each syl
-                // m_drawingLastNote is set only if the syl has a forward connector
-                PrepareLyricsParams prepareLyricsParams;
-                Functor prepareLyrics(&Object::PrepareLyrics);
-                Functor prepareLyricsEnd(&Object::PrepareLyricsEnd);
-                this->Process(&prepareLyrics, &prepareLyricsParams, &prepareLyricsEnd, &filters);
+                verseStreams.push_back(std::make_pair(
+                    &prepareProcessingListsParams.m_layers.at({ staves->first, layers->first }), verses->first));
             }
         }
     }
+    ProcessInChunks((int)verseStreams.size(), m_layoutThreads, [this, &verseStreams](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            // Create ad comparison object for the verse @n
+            std::vector<AttComparison *> filters;
+            AttCommonNComparison matchVerse(VERSE, verseStreams.at(i).second);
+            filters.push_back(&matchVerse);
+
+            // The first pass sets m_drawingFirstNote and m_drawingLastNote for each syl
+            // m_drawingLastNote is set only if the syl has a forward connector
+            PrepareLyricsParams prepareLyricsParams;
+            Functor prepareLyrics(&Object::PrepareLyrics);
+            Functor prepareLyricsEnd(&Object::PrepareLyricsEnd);
+            for (auto &layer : *verseStreams.at(i).first) {
+                layer->Process(&prepareLyrics, &prepareLyricsParams, NULL, &filters);
+            }
+            prepareLyricsEnd.Call(this, &prepareLyricsParams);
+        }
+    });
 
     // Once <slur>, <ties> and @ties are matched but also syl connectors, we need to set them as running
     // TimeSpanningInterface to each staff they are extended. This does not need to be done staff by staff because we
@@ -400,6 +522,7 @@ void Doc::PrepareDrawing()
     }
 
     // Process by staff for matching mRpt elements and setting the drawing number
+    std::vector<AttComparison *> filters;
     for (staves = prepareProcessingListsParams.m_layerTree.child.begin();
          staves != prepareProcessingListsParams.m_layerTree.child.end(); ++staves) {
         for (layers = staves->second.child.begin(); layers != staves->second.child.end(); ++layers) {
@@ -413,6 +536,7 @@ void Doc::PrepareDrawing()
             // We set multiNumber to NONE for indicated we need to look at the staffDef when reaching the first staff
             PrepareRptParams prepareRptParams(&m_scoreDef);
             Functor prepareRpt(&Object::PrepareRpt);
+            prepareRpt.SetClassIds({ STAFF, LAYER, MRPT }, Functor::s_layerElementContainerIds);
             this->Process(&prepareRpt, &prepareRptParams, NULL, &filters);
         }
     }
@@ -428,6 +552,7 @@ void Doc::PrepareDrawing()
     this->Process(&prepareFloatingGrps, &prepareFloatingGrpsParams);
 
     Functor prepareLayerElementParts(&Object::PrepareLayerElementParts);
+    prepareLayerElementParts.SetClassIds({ ARTIC, CHORD, NOTE, REST }, Functor::s_layerElementContainerIds);
     this->Process(&prepareLayerElementParts, NULL);
 
     // Prepare the drawing cue size
@@ -491,20 +616,37 @@ void Doc::CollectScoreDefs(bool force)
     m_currentScoreDefDone = true;
 }
 
-void Doc::CastOffDoc()
+void Doc::CastOffDoc(bool reuseLayout)
 {
     this->CollectScoreDefs();
 
     Page *contentPage = this->SetDrawingPage(0);
     assert(contentPage);
-    contentPage->LayOutHorizontally();
+
+    reuseLayout = reuseLayout && m_castOffLayoutDone;
+    if (!reuseLayout) {
+        contentPage->LayOutHorizontally();
+    }
 
     System *contentSystem = dynamic_cast<System *>(contentPage->DetachChild(0));
     assert(contentSystem);
 
+    // The measure widths are kept in the measures, the other ones are set back from the previous cast off
+    if (reuseLayout) {
+        contentSystem->SetDrawingLabelsWidth(m_castOffLabelsWidth);
+        contentSystem->SetDrawingAbbrLabelsWidth(m_castOffAbbrLabelsWidth);
+        contentPage->m_drawingScoreDef.SetDrawingWidth(m_castOffScoreDefWidth);
+    }
+    else {
+        m_castOffLabelsWidth = contentSystem->GetDrawingLabelsWidth();
+        m_castOffAbbrLabelsWidth = contentSystem->GetDrawingAbbrLabelsWidth();
+        m_castOffScoreDefWidth = contentPage->m_drawingScoreDef.GetDrawingWidth();
+    }
+
     System *currentSystem = new System();
     contentPage->AddChild(currentSystem);
     CastOffSystemsParams castOffSystemsParams(contentSystem, contentPage, currentSystem);
+    castOffSystemsParams.m_reuseLayout = reuseLayout;
     castOffSystemsParams.m_systemWidth = this->m_drawingPageWidth - this->m_drawingPageLeftMar
         - this->m_drawingPageRightMar - currentSystem->m_systemLeftMar - currentSystem->m_systemRightMar;
     castOffSystemsParams.m_shift = -contentSystem->GetDrawingLabelsWidth();
@@ -544,6 +686,8 @@ void Doc::CastOffDoc()
     // because idx will still be 0 but contentPage is dead!
     this->ResetDrawingPage();
     this->CollectScoreDefs(true);
+
+    m_castOffLayoutDone = true;
 }
 
 void Doc::UnCastOffDoc()
@@ -600,6 +744,84 @@ void Doc::CastOffEncodingDoc()
     this->CollectScoreDefs(true);
 }
 
+void Doc::GetCastOff(ArrayOfUuidCountPairs &systems, ArrayOfUuidCountPairs &pages)
+{
+    systems.clear();
+    pages.clear();
+
+    ArrayOfObjects::iterator pageIter;
+    for (pageIter = m_children.begin(); pageIter != m_children.end(); pageIter++) {
+        int systemCount = (*pageIter)->GetChildCount();
+        pages.push_back(std::make_pair((*pageIter)->GetUuid(), systemCount));
+        for (int i = 0; i < systemCount; i++) {
+            Object *system = (*pageIter)->GetChild(i);
+            systems.push_back(std::make_pair(system->GetUuid(), system->GetChildCount()));
+        }
+    }
+}
+
+bool Doc::ApplyCastOff(const ArrayOfUuidCountPairs &systems, const ArrayOfUuidCountPairs &pages)
+{
+    if ((this->GetChildCount() != 1) || (this->GetChild(0)->GetChildCount() != 1)) {
+        return false;
+    }
+
+    Page *contentPage = dynamic_cast<Page *>(this->GetChild(0));
+    assert(contentPage);
+    System *contentSystem = dynamic_cast<System *>(contentPage->GetChild(0));
+    if (!contentSystem) {
+        return false;
+    }
+
+    // Check that the breaks cover exactly the content of the system
+    int systemCount = 0;
+    ArrayOfUuidCountPairs::const_iterator iter;
+    for (iter = pages.begin(); iter != pages.end(); iter++) {
+        if (iter->second < 0) return false;
+        systemCount += iter->second;
+    }
+    int childCount = 0;
+    for (iter = systems.begin(); iter != systems.end(); iter++) {
+        if (iter->second < 0) return false;
+        childCount += iter->second;
+    }
+    if ((systemCount != (int)systems.size()) || (childCount != contentSystem->GetChildCount())) {
+        return false;
+    }
+
+    this->CollectScoreDefs();
+
+    // Detach the contentPage
+    this->DetachChild(0);
+    assert(contentPage && !contentPage->GetParent());
+
+    // Same as in the CastOffSystems and CastOffPages functors, the children are relinquished and the content page
+    // deleted afterwards. The uuids are restored for the output to be the same as with CastOffDoc
+    int childIdx = 0;
+    ArrayOfUuidCountPairs::const_iterator systemIter = systems.begin();
+    for (iter = pages.begin(); iter != pages.end(); iter++) {
+        Page *page = new Page();
+        page->SetUuid(iter->first);
+        this->AddChild(page);
+        for (int i = 0; i < iter->second; i++, systemIter++) {
+            System *system = new System();
+            system->SetUuid(systemIter->first);
+            page->AddChild(system);
+            for (int j = 0; j < systemIter->second; j++, childIdx++) {
+                system->AddChild(contentSystem->Relinquish(childIdx));
+            }
+        }
+    }
+    delete contentPage;
+
+    // We need to reset the drawing page to NULL
+    // because idx will still be 0 but contentPage is dead!
+    this->ResetDrawingPage();
+    this->CollectScoreDefs(true);
+
+    return true;
+}
+
 void Doc::ConvertToPageBasedDoc()
 {
     assert(m_scoreBuffer); // Doc::CreateScoreBuffer needs to be called first;
@@ -639,10 +861,57 @@ bool Doc::GetMidiExportDone() const
     return m_midiExportDone;
 }
 
+void Doc::AddUuidIndexed(Object *object)
+{
+    assert(object);
+
+    if (object->HasGeneratedUuid()) {
+        m_generatedUuidIndex.insert(std::make_pair(object->GetUuidNumber(), object));
+    }
+    else {
+        m_uuidIndex.insert(std::make_pair(object->GetUuid(), object));
+    }
+}
+
+void Doc::RemoveUuidIndexed(Object *object)
+{
+    assert(object);
+
+    if (object->HasGeneratedUuid()) {
+        auto iter = m_generatedUuidIndex.find(object->GetUuidNumber());
+        if ((iter != m_generatedUuidIndex.end()) && (iter->second == object)) m_generatedUuidIndex.erase(iter);
+    }
+    else {
+        auto iter = m_uuidIndex.find(object->GetUuid());
+        if ((iter != m_uuidIndex.end()) && (iter->second == object)) m_uuidIndex.erase(iter);
+    }
+}
+
+Object *Doc::GetUuidIndexed(const std::string &uuid) const
+{
+    auto iter = m_uuidIndex.find(uuid);
+    if (iter != m_uuidIndex.end()) return iter->second;
+
+    // Look for a generated uuid with the same number and check that the prefix is also the same
+    unsigned int number;
+    if (!Object::UuidStrToNumber(uuid, number)) return NULL;
+    auto generatedIter = m_generatedUuidIndex.find(number);
+    if (generatedIter == m_generatedUuidIndex.end()) return NULL;
+    return (generatedIter->second->GetUuid() == uuid) ? generatedIter->second : NULL;
+}
+
+const Resources *Doc::GetResources() const
+{
+    if (m_resources) return m_resources;
+    const Resources *resources = Resources::GetResources();
+    assert(resources);
+    return resources;
+}
+
 int Doc::GetGlyphHeight(wchar_t code, int staffSize, bool graceSize) const
 {
     int x, y, w, h;
-    Glyph *glyph = Resources::GetGlyph(code);
+    const Glyph *glyph = this->GetResources()->GetGlyph(code);
     assert(glyph);
     glyph->GetBoundingBox(x, y, w, h);
     h = h * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
@@ -654,7 +923,7 @@ int Doc::GetGlyphHeight(wchar_t code, int staffSize, bool graceSize) const
 int Doc::GetGlyphWidth(wchar_t code, int staffSize, bool graceSize) const
 {
     int x, y, w, h;
-    Glyph *glyph = Resources::GetGlyph(code);
+    const Glyph *glyph = this->GetResources()->GetGlyph(code);
     assert(glyph);
     glyph->GetBoundingBox(x, y, w, h);
     w = w * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
@@ -684,7 +953,7 @@ Point Doc::ConvertFontPoint(const Glyph *glyph, const Point &fontPoint, int staf
 int Doc::GetGlyphDescender(wchar_t code, int staffSize, bool graceSize) const
 {
     int x, y, w, h;
-    Glyph *glyph = Resources::GetGlyph(code);
+    const Glyph *glyph = this->GetResources()->GetGlyph(code);
     assert(glyph);
     glyph->GetBoundingBox(x, y, w, h);
     y = y * m_drawingSmuflFontSize / glyph->GetUnitsPerEm();
@@ -698,7 +967,7 @@ int Doc::GetTextGlyphHeight(wchar_t code, FontInfo *font, bool graceSize) const
     assert(font);
 
     int x, y, w, h;
-    Glyph *glyph = Resources::GetTextGlyph(code);
+    const Glyph *glyph = this->GetResources()->GetTextGlyph(code);
     assert(glyph);
     glyph->GetBoundingBox(x, y, w, h);
     h = h * font->GetPointSize() / glyph->GetUnitsPerEm();
@@ -711,7 +980,7 @@ int Doc::GetTextGlyphWidth(wchar_t code, FontInfo *font, bool graceSize) const
     assert(font);
 
     int x, y, w, h;
-    Glyph *glyph = Resources::GetTextGlyph(code);
+    const Glyph *glyph = this->GetResources()->GetTextGlyph(code);
     assert(glyph);
     glyph->GetBoundingBox(x, y, w, h);
     w = w * font->GetPointSize() / glyph->GetUnitsPerEm();
@@ -724,7 +993,7 @@ int Doc::GetTextGlyphDescender(wchar_t code, FontInfo *font, bool graceSize) con
     assert(font);
 
     int x, y, w, h;
-    Glyph *glyph = Resources::GetTextGlyph(code);
+    const Glyph *glyph = this->GetResources()->GetTextGlyph(code);
     assert(glyph);
     glyph->GetBoundingBox(x, y, w, h);
     y = y * font->GetPointSize() / glyph->GetUnitsPerEm();
@@ -816,16 +1085,21 @@ int Doc::GetCueSize(int value) const
 
 FontInfo *Doc::GetDrawingSmuflFont(int staffSize, bool graceSize)
 {
+    // One font per thread since pages can be drawn concurrently (see View::DrawLaidOutPage)
+    static thread_local FontInfo drawingSmuflFont;
+
     int value = m_drawingSmuflFontSize * staffSize / 100;
     if (graceSize) value = value * this->m_style->m_graceNum / this->m_style->m_graceDen;
-    m_drawingSmuflFont.SetPointSize(value);
-    return &m_drawingSmuflFont;
+    drawingSmuflFont.SetPointSize(value);
+    return &drawingSmuflFont;
 }
 
 FontInfo *Doc::GetDrawingLyricFont(int staffSize)
 {
-    m_drawingLyricFont.SetPointSize(m_drawingLyricFontSize * staffSize / 100);
-    return &m_drawingLyricFont;
+    static thread_local FontInfo drawingLyricFont;
+
+    drawingLyricFont.SetPointSize(m_drawingLyricFontSize * staffSize / 100);
+    return &drawingLyricFont;
 }
 
 char Doc::GetLeftMargin(const ClassId classId) const
@@ -1036,7 +1310,7 @@ int Doc::GetAdjustedDrawingPageWidth() const
 
 int Doc::PrepareLyricsEnd(FunctorParams *functorParams)
 {
-    PrepareLyricsParams *params = dynamic_cast<PrepareLyricsParams *>(functorParams);
+    PrepareLyricsParams *params = vrv_cast<PrepareLyricsParams *>(functorParams);
     assert(params);
 
     if ((params->m_currentSyl && params->m_lastNote) && (params->m_currentSyl->GetStart() != params->m_lastNote)) {
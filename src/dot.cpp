@@ -51,7 +51,7 @@ void Dot::Reset()
 
 int Dot::PreparePointersByLayer(FunctorParams *functorParams)
 {
-    PreparePointersByLayerParams *params = dynamic_cast<PreparePointersByLayerParams *>(functorParams);
+    PreparePointersByLayerParams *params = vrv_cast<PreparePointersByLayerParams *>(functorParams);
     assert(params);
 
     m_drawingNote = params->m_currentNote;
@@ -39,7 +39,7 @@ EditorialElement::EditorialElement() : Object("ee-"), BoundaryStartInterface(),
     Reset();
 }
 
-EditorialElement::EditorialElement(std::string classid)
+EditorialElement::EditorialElement(const char *classid)
     : Object(classid), BoundaryStartInterface(), AttCommon(), AttCommonPart(), AttTyped()
 {
     RegisterAttClass(ATT_COMMON);
@@ -540,7 +540,7 @@ void Unclear::Reset()
 
 int EditorialElement::ConvertToPageBased(FunctorParams *functorParams)
 {
-    ConvertToPageBasedParams *params = dynamic_cast<ConvertToPageBasedParams *>(functorParams);
+    ConvertToPageBasedParams *params = vrv_cast<ConvertToPageBasedParams *>(functorParams);
     assert(params);
 
     this->MoveItselfTo(params->m_pageBasedSystem);
@@ -550,7 +550,7 @@ int EditorialElement::ConvertToPageBased(FunctorParams *functorParams)
 
 int EditorialElement::ConvertToPageBasedEnd(FunctorParams *functorParams)
 {
-    ConvertToPageBasedParams *params = dynamic_cast<ConvertToPageBasedParams *>(functorParams);
+    ConvertToPageBasedParams *params = vrv_cast<ConvertToPageBasedParams *>(functorParams);
     assert(params);
 
     if (this->m_visibility == Visible) ConvertToPageBasedBoundary(this, params->m_pageBasedSystem);
@@ -578,7 +578,7 @@ int EditorialElement::ResetDrawing(FunctorParams *functorParams)
 
 int EditorialElement::CastOffSystems(FunctorParams *functorParams)
 {
-    CastOffSystemsParams *params = dynamic_cast<CastOffSystemsParams *>(functorParams);
+    CastOffSystemsParams *params = vrv_cast<CastOffSystemsParams *>(functorParams);
     assert(params);
 
     // Since the functor returns FUNCTOR_SIBLINGS we should never go lower than the system children
@@ -599,7 +599,7 @@ int EditorialElement::CastOffSystems(FunctorParams *functorParams)
 
 int EditorialElement::CastOffEncoding(FunctorParams *functorParams)
 {
-    CastOffEncodingParams *params = dynamic_cast<CastOffEncodingParams *>(functorParams);
+    CastOffEncodingParams *params = vrv_cast<CastOffEncodingParams *>(functorParams);
     assert(params);
 
     MoveItselfTo(params->m_currentSystem);
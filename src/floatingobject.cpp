@@ -43,7 +43,7 @@ FloatingObject::FloatingObject() : Object("fe")
     Reset();
 }
 
-FloatingObject::FloatingObject(std::string classid) : Object(classid)
+FloatingObject::FloatingObject(const char *classid) : Object(classid)
 {
     Reset();
 
@@ -54,7 +54,7 @@ Alignment *HorizontalAligner::SearchAlignmentAtTime(double time, AlignmentType t
     Alignment *alignment = NULL;
     // First try to see if we already have something at the time position
     for (i = 0; i < GetAlignmentCount(); i++) {
-        alignment = dynamic_cast<Alignment *>(m_children.at(i));
+        alignment = vrv_cast<Alignment *>(m_children.at(i));
         assert(alignment);
 
         double alignment_time = alignment->GetTime();
@@ -157,7 +157,7 @@ void MeasureAligner::SetMaxTime(double time)
     Alignment *alignment = NULL;
     // Increase the time position for all alignment from the right barline
     for (i = idx; i < GetAlignmentCount(); i++) {
-        alignment = dynamic_cast<Alignment *>(m_children.at(i));
+        alignment = vrv_cast<Alignment *>(m_children.at(i));
         assert(alignment);
         // Change it only if higher than before
         if (time > alignment->GetTime()) alignment->SetTime(time);
@@ -172,6 +172,33 @@ double MeasureAligner::GetMaxTime() const
     return m_rightAlignment->GetTime();
 }
 
+void MeasureAligner::StoreXRels(MapOfAlignmentXRels &xRels) const
+{
+    xRels.clear();
+    for (auto &child : m_children) {
+        Alignment *alignment = vrv_cast<Alignment *>(child);
+        assert(alignment);
+        xRels[std::make_pair(alignment->GetType(), alignment->GetTime())] = alignment->GetXRel();
+    }
+}
+
+void MeasureAligner::RestoreXRels(const MapOfAlignmentXRels &xRels)
+{
+    for (auto &child : m_children) {
+        Alignment *alignment = vrv_cast<Alignment *>(child);
+        assert(alignment);
+        // The scoreDef elements referred to might have been deleted when the scoreDefs were collected again
+        if (alignment->IsOfType({ ALIGNMENT_SCOREDEF_CLEF, ALIGNMENT_SCOREDEF_KEYSIG, ALIGNMENT_SCOREDEF_MENSUR,
+                ALIGNMENT_SCOREDEF_METERSIG, ALIGNMENT_SCOREDEF_CAUTION_CLEF, ALIGNMENT_SCOREDEF_CAUTION_KEYSIG,
+                ALIGNMENT_SCOREDEF_CAUTION_MENSUR, ALIGNMENT_SCOREDEF_CAUTION_METERSIG })) {
+            continue;
+        }
+        MapOfAlignmentXRels::const_iterator xRel
+            = xRels.find(std::make_pair(alignment->GetType(), alignment->GetTime()));
+        if (xRel != xRels.end()) alignment->SetXRel(xRel->second);
+    }
+}
+
 void MeasureAligner::AdjustProportionally(const ArrayOfAdjustmentTuples &adjustments)
 {
     ArrayOfAdjustmentTuples::const_iterator iter;
@@ -191,7 +218,7 @@ void MeasureAligner::AdjustProportionally(const ArrayOfAdjustmentTuples &adjustm
         // We use a reverse iterator
         ArrayOfObjects::iterator alignIter;
         for (alignIter = m_children.begin(); alignIter != m_children.end(); alignIter++) {
-            Alignment *current = dynamic_cast<Alignment *>(*alignIter);
+            Alignment *current = vrv_cast<Alignment *>(*alignIter);
             assert(current);
             // Nothing to do once we passed the start aligment
             if (current->GetXRel() <= startX)
@@ -214,7 +241,7 @@ void MeasureAligner::PushAlignmentsRight()
     Alignment *previous = NULL;
     ArrayOfObjects::reverse_iterator riter;
     for (riter = m_children.rbegin(); riter != m_children.rend(); riter++) {
-        Alignment *current = dynamic_cast<Alignment *>(*riter);
+        Alignment *current = vrv_cast<Alignment *>(*riter);
         assert(current);
         if (current->IsOfType({ ALIGNMENT_GRACENOTE })) {
             if (previous) current->SetXRel(previous->GetXRel());
@@ -232,7 +259,7 @@ void MeasureAligner::AdjustGraceNoteSpacing(Doc *doc, Alignment *alignment, int
     assert(alignment->GetType() == ALIGNMENT_GRACENOTE);
     assert(alignment->GetGraceAligner());
 
-    Measure *measure = dynamic_cast<Measure *>(this->GetParent());
+    Measure *measure = vrv_cast<Measure *>(this->GetParent());
     assert(measure);
 
     int maxRight = VRV_UNSET;
@@ -322,7 +349,7 @@ void GraceAligner::StackGraceElement(LayerElement *element)
     assert(element->Is({ NOTE, CHORD }));
 
     if (element->Is(NOTE)) {
-        Note *note = dynamic_cast<Note *>(element);
+        Note *note = vrv_cast<Note *>(element);
         assert(note);
         if (note->IsChordTone()) return;
     }
@@ -335,7 +362,7 @@ void GraceAligner::AlignStack()
     int i;
     double time = 0.0;
     for (i = (int)m_graceStack.size(); i > 0; i--) {
-        LayerElement *element = dynamic_cast<LayerElement *>(m_graceStack.at(i - 1));
+        LayerElement *element = vrv_cast<LayerElement *>(m_graceStack.at(i - 1));
         assert(element);
         // get the duration of the event
         double duration = element->GetAlignmentDuration(NULL, NULL, false);
@@ -355,7 +382,7 @@ void GraceAligner::AlignStack()
             // Trick : FindAllChildByAttComparison include the element, which is probably a problem.
             // With note, we want to set only accid, so make sure we do not set it twice
             if (*childrenIter == element) continue;
-            LayerElement *childElement = dynamic_cast<LayerElement *>(*childrenIter);
+            LayerElement *childElement = vrv_cast<LayerElement *>(*childrenIter);
             assert(childElement);
             childElement->SetGraceAlignment(alignment);
             alignment->AddLayerElementRef(childElement);
@@ -409,7 +436,7 @@ void GraceAligner::SetGraceAligmentXPos(Doc *doc)
     int i = 0;
     // Then the @n of each first staffDef
     for (childrenIter = m_children.rbegin(); childrenIter != m_children.rend(); childrenIter++) {
-        Alignment *alignment = dynamic_cast<Alignment *>(*childrenIter);
+        Alignment *alignment = vrv_cast<Alignment *>(*childrenIter);
         assert(alignment);
         // We space with a notehead (non grace size) which seems to be a reasonable default spacing with margin
         // Ideally we should look at the duration in that alignmment and also the maximum staff scaling for this aligner
@@ -502,8 +529,8 @@ bool Alignment::AddLayerElementRef(LayerElement *element)
         }
         // Non cross staff normal case
         else {
-            layerRef = dynamic_cast<Layer *>(element->GetFirstParent(LAYER));
-            if (layerRef) staffRef = dynamic_cast<Staff *>(layerRef->GetFirstParent(STAFF));
+            layerRef = vrv_cast<Layer *>(element->GetFirstParent(LAYER));
+            if (layerRef) staffRef = vrv_cast<Staff *>(layerRef->GetFirstParent(STAFF));
             if (staffRef) {
                 layerN = layerRef->GetN();
                 staffN = staffRef->GetN();
@@ -619,7 +646,7 @@ void AlignmentReference::Reset()
 
 void AlignmentReference::AddChild(Object *child)
 {
-    LayerElement *childElement = dynamic_cast<LayerElement *>(child);
+    LayerElement *childElement = vrv_cast<LayerElement *>(child);
     assert(childElement);
 
     ArrayOfObjects::iterator childrenIter;
@@ -685,7 +712,7 @@ TimestampAttr *TimestampAligner::GetTimestampAtTime(double time)
     TimestampAttr *timestampAttr = NULL;
     // First try to see if we already have something at the time position
     for (i = 0; i < GetChildCount(); i++) {
-        timestampAttr = dynamic_cast<TimestampAttr *>(m_children.at(i));
+        timestampAttr = vrv_cast<TimestampAttr *>(m_children.at(i));
         assert(timestampAttr);
 
         double alignmentTime = timestampAttr->GetActualDurPos();
@@ -717,7 +744,7 @@ TimestampAttr *TimestampAligner::GetTimestampAtTime(double time)
 
 int MeasureAligner::SetAlignmentXPos(FunctorParams *functorParams)
 {
-    SetAlignmentXPosParams *params = dynamic_cast<SetAlignmentXPosParams *>(functorParams);
+    SetAlignmentXPosParams *params = vrv_cast<SetAlignmentXPosParams *>(functorParams);
     assert(params);
 
     // We start a new MeasureAligner
@@ -730,7 +757,7 @@ int MeasureAligner::SetAlignmentXPos(FunctorParams *functorParams)
 
 int MeasureAligner::JustifyX(FunctorParams *functorParams)
 {
-    JustifyXParams *params = dynamic_cast<JustifyXParams *>(functorParams);
+    JustifyXParams *params = vrv_cast<JustifyXParams *>(functorParams);
     assert(params);
 
     params->m_leftBarLineX = GetLeftBarLineAlignment()->GetXRel();
@@ -741,7 +768,7 @@ int MeasureAligner::JustifyX(FunctorParams *functorParams)
 
 int Alignment::AdjustGraceXPos(FunctorParams *functorParams)
 {
-    AdjustGraceXPosParams *params = dynamic_cast<AdjustGraceXPosParams *>(functorParams);
+    AdjustGraceXPosParams *params = vrv_cast<AdjustGraceXPosParams *>(functorParams);
     assert(params);
 
     // We are in a Measure aligner - redirect to the GraceAligner when it is a ALIGNMENT_GRACENOTE
@@ -758,7 +785,7 @@ int Alignment::AdjustGraceXPos(FunctorParams *functorParams)
         params->m_isGraceAlignment = true;
 
         // Get the parent measure Aligner
-        MeasureAligner *measureAligner = dynamic_cast<MeasureAligner *>(this->GetFirstParent(MEASURE_ALIGNER));
+        MeasureAligner *measureAligner = vrv_cast<MeasureAligner *>(this->GetFirstParent(MEASURE_ALIGNER));
         assert(measureAligner);
 
         std::vector<int>::iterator iter;
@@ -821,7 +848,7 @@ int Alignment::AdjustGraceXPos(FunctorParams *functorParams)
 
 int Alignment::AdjustGraceXPosEnd(FunctorParams *functorParams)
 {
-    AdjustGraceXPosParams *params = dynamic_cast<AdjustGraceXPosParams *>(functorParams);
+    AdjustGraceXPosParams *params = vrv_cast<AdjustGraceXPosParams *>(functorParams);
     assert(params);
 
     if (params->m_graceUpcomingMaxPos != -VRV_UNSET) {
@@ -835,7 +862,7 @@ int Alignment::AdjustGraceXPosEnd(FunctorParams *functorParams)
 
 int Alignment::AdjustXPos(FunctorParams *functorParams)
 {
-    AdjustXPosParams *params = dynamic_cast<AdjustXPosParams *>(functorParams);
+    AdjustXPosParams *params = vrv_cast<AdjustXPosParams *>(functorParams);
     assert(params);
 
     // LogDebug("Alignment type %d", m_type);
@@ -851,7 +878,7 @@ int Alignment::AdjustXPos(FunctorParams *functorParams)
 
 int Alignment::AdjustXPosEnd(FunctorParams *functorParams)
 {
-    AdjustXPosParams *params = dynamic_cast<AdjustXPosParams *>(functorParams);
+    AdjustXPosParams *params = vrv_cast<AdjustXPosParams *>(functorParams);
     assert(params);
 
     if (params->m_upcomingMinPos != VRV_UNSET) {
@@ -872,7 +899,7 @@ int Alignment::AdjustXPosEnd(FunctorParams *functorParams)
 
 int Alignment::AdjustAccidX(FunctorParams *functorParams)
 {
-    AdjustAccidXParams *params = dynamic_cast<AdjustAccidXParams *>(functorParams);
+    AdjustAccidXParams *params = vrv_cast<AdjustAccidXParams *>(functorParams);
     assert(params);
 
     if (this->m_graceAligner) this->m_graceAligner->Process(params->m_functor, functorParams);
@@ -893,7 +920,7 @@ int Alignment::HorizontalSpaceForDuration(
 
 int Alignment::SetAlignmentXPos(FunctorParams *functorParams)
 {
-    SetAlignmentXPosParams *params = dynamic_cast<SetAlignmentXPosParams *>(functorParams);
+    SetAlignmentXPosParams *params = vrv_cast<SetAlignmentXPosParams *>(functorParams);
     assert(params);
 
     // Do not set an x pos for anything before the barline (including it)
@@ -925,7 +952,7 @@ int Alignment::SetAlignmentXPos(FunctorParams *functorParams)
 
 int Alignment::JustifyX(FunctorParams *functorParams)
 {
-    JustifyXParams *params = dynamic_cast<JustifyXParams *>(functorParams);
+    JustifyXParams *params = vrv_cast<JustifyXParams *>(functorParams);
     assert(params);
 
     if (m_type <= ALIGNMENT_MEASURE_LEFT_BARLINE) {
@@ -954,7 +981,7 @@ int Alignment::JustifyX(FunctorParams *functorParams)
 
 int AlignmentReference::AdjustLayers(FunctorParams *functorParams)
 {
-    AdjustLayersParams *params = dynamic_cast<AdjustLayersParams *>(functorParams);
+    AdjustLayersParams *params = vrv_cast<AdjustLayersParams *>(functorParams);
     assert(params);
 
     if (!m_multipleLayer) return FUNCTOR_SIBLINGS;
@@ -970,7 +997,7 @@ int AlignmentReference::AdjustLayers(FunctorParams *functorParams)
 
 int AlignmentReference::AdjustGraceXPos(FunctorParams *functorParams)
 {
-    AdjustGraceXPosParams *params = dynamic_cast<AdjustGraceXPosParams *>(functorParams);
+    AdjustGraceXPosParams *params = vrv_cast<AdjustGraceXPosParams *>(functorParams);
     assert(params);
 
     ArrayOfObjects::iterator childrenIter;
@@ -987,7 +1014,7 @@ int AlignmentReference::AdjustGraceXPos(FunctorParams *functorParams)
 
 int AlignmentReference::AdjustAccidX(FunctorParams *functorParams)
 {
-    AdjustAccidXParams *params = dynamic_cast<AdjustAccidXParams *>(functorParams);
+    AdjustAccidXParams *params = vrv_cast<AdjustAccidXParams *>(functorParams);
     assert(params);
 
     if (m_accidSpace.empty()) return FUNCTOR_SIBLINGS;
@@ -10,6 +10,7 @@
 //----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <fstream>
 #include <iostream>
 
 //----------------------------------------------------------------------------
@@ -71,6 +72,43 @@ namespace vrv {
 std::vector<std::string> MeiInput::s_editorialElementNames = { "abbr", "add", "app", "annot", "choice", "corr",
     "damage", "del", "expan", "orig", "reg", "restore", "sic", "supplied", "unclear" };
 
+std::vector<std::string> MeiInput::s_readAttributeNames = { "lrx", "system.leftmar", "system.rightmar", "ulx", "uly",
+    "xml:id" };
+
+//----------------------------------------------------------------------------
+// MeiStreamWriter
+//----------------------------------------------------------------------------
+
+MeiStreamWriter::MeiStreamWriter()
+{
+    m_stream = NULL;
+}
+
+MeiStreamWriter::~MeiStreamWriter()
+{
+}
+
+void MeiStreamWriter::SetStream(std::ostream *stream)
+{
+    m_stream = stream;
+    m_buffer.clear();
+}
+
+void MeiStreamWriter::write(const void *data, size_t size)
+{
+    m_buffer.append(static_cast<const char *>(data), size);
+    // 64KB chunks
+    if (m_buffer.size() >= 65536) this->Flush();
+}
+
+void MeiStreamWriter::Flush()
+{
+    assert(m_stream);
+
+    m_stream->write(m_buffer.c_str(), m_buffer.size());
+    m_buffer.clear();
+}
+
 //----------------------------------------------------------------------------
 // MeiOutput
 //----------------------------------------------------------------------------
@@ -81,6 +119,7 @@ MeiOutput::MeiOutput(Doc *doc, std::string filename) : FileOutputStream(doc)
     m_writeToStreamString = false;
     m_page = -1;
     m_scoreBasedMEI = false;
+    m_inlineDepth = 0;
 }
 
 MeiOutput::~MeiOutput()
@@ -89,6 +128,21 @@ MeiOutput::~MeiOutput()
 
 bool MeiOutput::ExportFile()
 {
+    std::ofstream outfile;
+    if (m_writeToStreamString) {
+        m_streamWriter.SetStream(&m_streamStringOutput);
+    }
+    else {
+        outfile.open(m_filename.c_str(), std::ios::binary);
+        if (!outfile.is_open()) {
+            LogError("Unable to open file '%s' for writing", m_filename.c_str());
+            return false;
+        }
+        m_streamWriter.SetStream(&outfile);
+    }
+    m_streamedNodes.clear();
+    m_inlineDepth = 0;
+
     try {
         pugi::xml_document meiDoc;
 
@@ -125,6 +179,8 @@ bool MeiOutput::ExportFile()
             }
             Page *page = dynamic_cast<Page *>(m_doc->GetChild(m_page));
             assert(page);
+            // The declaration pugixml adds when saving a document without one
+            m_streamWriter.Write("<?xml version=\"1.0\"?>\n");
             if (m_scoreBasedMEI) {
                 m_currentNode = meiDoc.append_child("score");
                 m_currentNode = m_currentNode.append_child("section");
@@ -138,20 +194,24 @@ bool MeiOutput::ExportFile()
 
             page->Save(this);
         }
-        if (m_writeToStreamString) {
-            // meiDoc.save(m_streamStringOutput, "    ", pugi::format_default | pugi::format_no_escapes);
-            meiDoc.save(m_streamStringOutput, "    ");
+
+        // Close the elements still open and write what has not been streamed yet
+        while (!m_streamedNodes.empty()) {
+            StreamNodeEnd(m_streamedNodes.back());
         }
-        else {
-            // meiDoc.save_file(m_filename.c_str(), "    ", pugi::format_default | pugi::format_no_escapes);
-            meiDoc.save_file(m_filename.c_str(), "    ");
+        while (meiDoc.first_child()) {
+            StreamNode(meiDoc.first_child(), 0);
         }
     }
     catch (char *str) {
         LogError("%s", str);
+        m_streamWriter.SetStream(NULL);
         return false;
     }
 
+    m_streamWriter.Flush();
+    m_streamWriter.SetStream(NULL);
+
     return true;
 }
 
@@ -163,7 +223,9 @@ std::string MeiOutput::GetOutput(int page)
     m_writeToStreamString = false;
     m_page = -1;
 
-    return m_streamStringOutput.str();
+    std::string output = m_streamStringOutput.str();
+    m_streamStringOutput.str("");
+    return output;
 }
 
 bool MeiOutput::WriteObject(Object *object)
@@ -515,7 +577,10 @@ bool MeiOutput::WriteObject(Object *object)
     }
 
     // Object representing an attribute have no node to push
-    if (!object->IsAttribute()) m_nodeStack.push_back(m_currentNode);
+    if (!object->IsAttribute()) {
+        m_nodeStack.push_back(m_currentNode);
+        if (IsInlineObject(object)) m_inlineDepth++;
+    }
 
     return true;
 }
@@ -537,12 +602,113 @@ bool MeiOutput::WriteObjectEnd(Object *object)
     else if (m_scoreBasedMEI && (object->Is(PAGE))) {
         return true;
     }
+
+    if (IsInlineObject(object)) m_inlineDepth--;
+
+    pugi::xml_node node = m_nodeStack.back();
     m_nodeStack.pop_back();
-    m_currentNode = m_nodeStack.back();
+    m_currentNode = (m_nodeStack.empty()) ? pugi::xml_node() : m_nodeStack.back();
+
+    // Stream the node unless it is still the current one or within a layer, text or control element
+    if ((m_inlineDepth == 0) && (node != m_currentNode)) {
+        if (!m_streamedNodes.empty() && (m_streamedNodes.back() == node)) {
+            StreamNodeEnd(node);
+        }
+        else {
+            StreamNodes(node.parent());
+        }
+    }
 
     return true;
 }
 
+void MeiOutput::StreamNodes(pugi::xml_node parent)
+{
+    std::vector<pugi::xml_node> path;
+    for (pugi::xml_node node = parent; node.type() == pugi::node_element; node = node.parent()) {
+        path.insert(path.begin(), node);
+    }
+    // The streamed nodes are always the beginning of the path
+    assert(m_streamedNodes.size() <= path.size());
+
+    pugi::xml_node current = (m_streamedNodes.empty()) ? parent.root() : m_streamedNodes.back();
+    for (int i = (int)m_streamedNodes.size(); i < (int)path.size(); i++) {
+        // All the nodes before the one in the path are completed
+        while (current.first_child() != path.at(i)) {
+            StreamNode(current.first_child(), i);
+        }
+        StreamStartTag(path.at(i), i);
+        m_streamedNodes.push_back(path.at(i));
+        current = path.at(i);
+    }
+
+    while (parent.first_child()) {
+        StreamNode(parent.first_child(), (int)path.size());
+    }
+}
+
+void MeiOutput::StreamNodeEnd(pugi::xml_node node)
+{
+    assert(!m_streamedNodes.empty() && (m_streamedNodes.back() == node));
+
+    int depth = (int)m_streamedNodes.size() - 1;
+    while (node.first_child()) {
+        StreamNode(node.first_child(), depth + 1);
+    }
+
+    std::string tag;
+    for (int i = 0; i < depth; i++) {
+        tag += "    ";
+    }
+    tag.append("</").append(node.name()).append(">\n");
+    m_streamWriter.Write(tag);
+
+    m_streamedNodes.pop_back();
+    node.parent().remove_child(node);
+}
+
+void MeiOutput::StreamNode(pugi::xml_node node, int depth)
+{
+    node.print(m_streamWriter, "    ", pugi::format_default, pugi::encoding_auto, depth);
+    node.parent().remove_child(node);
+}
+
+void MeiOutput::StreamStartTag(pugi::xml_node node, int depth)
+{
+    std::string tag;
+    for (int i = 0; i < depth; i++) {
+        tag += "    ";
+    }
+    tag.append("<").append(node.name());
+    for (pugi::xml_attribute attr = node.first_attribute(); attr; attr = attr.next_attribute()) {
+        tag.append(" ").append(attr.name()).append("=\"");
+        // Escape the value as pugixml does for attributes
+        for (const char *c = attr.value(); *c; c++) {
+            unsigned char ch = *c;
+            if (ch == '&')
+                tag += "&amp;";
+            else if (ch == '<')
+                tag += "&lt;";
+            else if (ch == '>')
+                tag += "&gt;";
+            else if (ch == '"')
+                tag += "&quot;";
+            else if ((ch < 32) && (ch != '\t'))
+                tag.append(StringFormat("&#%d%d;", ch / 10, ch % 10));
+            else
+                tag += *c;
+        }
+        tag += "\"";
+    }
+    tag += ">\n";
+    m_streamWriter.Write(tag);
+}
+
+bool MeiOutput::IsInlineObject(Object *object)
+{
+    return (object->IsLayerElement() || object->IsTextElement() || object->IsControlElement());
+}
+
 std::string MeiOutput::UuidToMeiStr(Object *element)
 {
     std::string out = element->GetUuid();
@@ -1584,6 +1750,7 @@ MeiInput::MeiInput(Doc *doc, std::string filename) : FileInputStream(doc)
     m_hasScoreDef = false;
     m_readingScoreBased = false;
     m_version = MEI_UNDEFINED;
+    m_measureScan = NULL;
 }
 
 MeiInput::~MeiInput()
@@ -1592,37 +1759,87 @@ MeiInput::~MeiInput()
 
 bool MeiInput::ImportFile()
 {
-    try {
-        m_doc->SetType(Raw);
-        pugi::xml_document doc;
-        pugi::xml_parse_result result = doc.load_file(m_filename.c_str(), pugi::parse_default & ~pugi::parse_eol);
-        if (!result) {
-            return false;
-        }
-        pugi::xml_node root = doc.first_child();
-        return ReadMei(root);
+    // The file is read into a buffer that is parsed incrementally (see MeiInput::ReadMeiBuffer)
+    std::ifstream file(m_filename.c_str(), std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+        return false;
     }
-    catch (char *str) {
-        LogError("%s", str);
+    file.seekg(0, std::ios::end);
+    std::streamoff size = file.tellg();
+    if (size < 0) {
+        return false;
+    }
+    std::string mei;
+    mei.resize(size);
+    file.seekg(0, std::ios::beg);
+    file.read(&mei[0], mei.size());
+    if (!file) {
         return false;
     }
+    file.close();
+    return ImportString(mei);
 }
 
 bool MeiInput::ImportString(std::string const &mei)
 {
+    // Only the selected <mdiv> will be parsed if it can be found by scanning the buffer
+    std::string selection;
+    if (!m_mdivXPathQuery.empty() && SelectMdiv(mei, selection)) {
+        return ReadMeiBuffer(selection);
+    }
+    return ReadMeiBuffer(mei);
+}
+
+bool MeiInput::ReadMeiBuffer(std::string const &mei)
+{
+    const unsigned int options = pugi::parse_default & ~pugi::parse_eol;
+
     try {
         m_doc->SetType(Raw);
         pugi::xml_document doc;
-        doc.load(mei.c_str(), pugi::parse_default & ~pugi::parse_eol);
+        // The xPath queries can look at the content of the <measure> elements, which then has to be parsed at once.
+        // This is also the case for a UTF-16 or UTF-32 encoded buffer, which the scan cannot read.
+        MeiMeasureScan measureScan;
+        bool scanned = (m_appXPathQueries.empty() && m_choiceXPathQueries.empty() && m_mdivXPathQuery.empty()
+            && (mei.find('\0', 0) >= 4) && measureScan.Scan(mei) && measureScan.LoadSkeleton(doc, options));
+        if (scanned) {
+            m_measureScan = &measureScan;
+        }
+        else if (!doc.load_buffer(mei.data(), mei.size(), options)) {
+            return false;
+        }
         pugi::xml_node root = doc.first_child();
-        return ReadMei(root);
+        bool success = ReadMei(root);
+        m_measureScan = NULL;
+        return success;
     }
     catch (char *str) {
+        m_measureScan = NULL;
         LogError("%s", str);
         return false;
     }
 }
 
+bool MeiInput::SelectMdiv(std::string const &mei, std::string &buffer)
+{
+    MeiMdivScan scan;
+    if (!scan.Scan(mei)) return false;
+
+    pugi::xpath_node selection = scan.GetBody().select_single_node(m_mdivXPathQuery.c_str());
+    // The query might use the content of the <mdiv>, in which case the full buffer has to be read
+    if (!selection || !scan.GetBufferWithMdiv(mei, selection.node(), buffer)) return false;
+
+    m_mdivXPathQuery.clear();
+    return true;
+}
+
+pugi::xml_node MeiInput::ReleaseMeiNode(pugi::xml_node node)
+{
+    pugi::xml_node next = node.next_sibling();
+    node.parent().remove_child(node);
+    return next;
+}
+
 bool MeiInput::IsAllowed(std::string element, Object *filterParent)
 {
     if (!filterParent) {
@@ -1817,6 +2034,7 @@ bool MeiInput::ReadMei(pugi::xml_node root)
         m_doc->m_header.reset();
         // copy the complete header into the master document
         m_doc->m_header.append_copy(current);
+        root.remove_child(current);
         if (root.attribute("meiversion")) {
             std::string version = std::string(root.attribute("meiversion").value());
             if (version == "2013")
@@ -1901,8 +2119,7 @@ bool MeiInput::ReadMeiSection(Object *parent, pugi::xml_node section)
     Section *vrvSection = new Section();
     SetMeiUuid(section, vrvSection);
 
-    vrvSection->ReadCommon(section);
-    vrvSection->ReadCommonPart(section);
+    ReadAttributes(section, vrvSection);
 
     parent->AddChild(vrvSection);
     if (m_readingScoreBased)
@@ -1919,7 +2136,8 @@ bool MeiInput::ReadMeiSectionChildren(Object *parent, pugi::xml_node parentNode)
     bool success = true;
     pugi::xml_node current;
     Measure *unmeasured = NULL;
-    for (current = parentNode.first_child(); current; current = current.next_sibling()) {
+    // The nodes are released once read since the content is now in the object tree (see MeiInput::ReleaseMeiNode)
+    for (current = parentNode.first_child(); current; current = ReleaseMeiNode(current)) {
         if (!success) break;
         // editorial
         else if (IsEditorialElementName(current.name())) {
@@ -1979,8 +2197,7 @@ bool MeiInput::ReadMeiSectionChildren(Object *parent, pugi::xml_node parentNode)
 bool MeiInput::ReadSystemElement(pugi::xml_node element, SystemElement *object)
 {
     SetMeiUuid(element, object);
-    object->ReadCommon(element);
-    object->ReadTyped(element);
+    ReadAttributes(element, object);
 
     return true;
 }
@@ -2002,9 +2219,6 @@ bool MeiInput::ReadMeiExpansion(Object *parent, pugi::xml_node expansion)
     Expansion *vrvExpansion = new Expansion();
     ReadSystemElement(expansion, vrvExpansion);
 
-    vrvExpansion->ReadCommonPart(expansion);
-    vrvExpansion->ReadPlist(expansion);
-
     parent->AddChild(vrvExpansion);
     if (m_readingScoreBased)
         return ReadMeiSectionChildren(vrvExpansion, expansion);
@@ -2110,8 +2324,7 @@ bool MeiInput::ReadMeiSystem(Object *parent, pugi::xml_node system)
 
     System *vrvSystem = new System();
     SetMeiUuid(system, vrvSystem);
-    vrvSystem->ReadCommon(system);
-    vrvSystem->ReadTyped(system);
+    ReadAttributes(system, vrvSystem);
 
     if (system.attribute("system.leftmar")) {
         vrvSystem->m_systemLeftMar = atoi(system.attribute("system.leftmar").value());
@@ -2139,7 +2352,8 @@ bool MeiInput::ReadMeiSystemChildren(Object *parent, pugi::xml_node parentNode)
     bool success = true;
     pugi::xml_node current;
     Measure *unmeasured = NULL;
-    for (current = parentNode.first_child(); current; current = current.next_sibling()) {
+    // The nodes are released once read since the content is now in the object tree (see MeiInput::ReleaseMeiNode)
+    for (current = parentNode.first_child(); current; current = ReleaseMeiNode(current)) {
         if (!success) break;
         // editorial
         else if (IsEditorialElementName(current.name())) {
@@ -2210,8 +2424,7 @@ bool MeiInput::ReadMeiBoundaryEnd(Object *parent, pugi::xml_node boundaryEnd)
 bool MeiInput::ReadScoreDefElement(pugi::xml_node element, ScoreDefElement *object)
 {
     SetMeiUuid(element, object);
-    object->ReadCommon(element);
-    object->ReadTyped(element);
+    ReadAttributes(element, object);
 
     return true;
 }
@@ -2230,9 +2443,6 @@ bool MeiInput::ReadMeiScoreDef(Object *parent, pugi::xml_node scoreDef)
     }
     ReadScoreDefElement(scoreDef, vrvScoreDef);
 
-    ReadScoreDefInterface(scoreDef, vrvScoreDef);
-    vrvScoreDef->ReadEndings(scoreDef);
-
     if (!m_hasScoreDef) {
         m_hasScoreDef = true;
     }
@@ -2272,12 +2482,7 @@ bool MeiInput::ReadMeiStaffGrp(Object *parent, pugi::xml_node staffGrp)
     StaffGrp *vrvStaffGrp = new StaffGrp();
     SetMeiUuid(staffGrp, vrvStaffGrp);
 
-    vrvStaffGrp->ReadCommon(staffGrp);
-    vrvStaffGrp->ReadCommonPart(staffGrp);
-    vrvStaffGrp->ReadLabelsAddl(staffGrp);
-    vrvStaffGrp->ReadStaffGrpVis(staffGrp);
-    vrvStaffGrp->ReadStaffgroupingsym(staffGrp);
-    vrvStaffGrp->ReadTyped(staffGrp);
+    ReadAttributes(staffGrp, vrvStaffGrp);
 
     parent->AddChild(vrvStaffGrp);
     return ReadMeiStaffGrpChildren(vrvStaffGrp, staffGrp);
@@ -2316,20 +2521,10 @@ bool MeiInput::ReadMeiStaffDef(Object *parent, pugi::xml_node staffDef)
     StaffDef *vrvStaffDef = new StaffDef();
     ReadScoreDefElement(staffDef, vrvStaffDef);
 
-    vrvStaffDef->ReadCommonPart(staffDef);
-    vrvStaffDef->ReadDistances(staffDef);
-    vrvStaffDef->ReadLabelsAddl(staffDef);
-    vrvStaffDef->ReadNotationtype(staffDef);
-    vrvStaffDef->ReadScalable(staffDef);
-    vrvStaffDef->ReadStaffDefVis(staffDef);
-    vrvStaffDef->ReadTransposition(staffDef);
-
     if (!vrvStaffDef->HasN()) {
         LogWarning("No @n on <staffDef> might yield unpredictable results");
     }
 
-    ReadScoreDefInterface(staffDef, vrvStaffDef);
-
     parent->AddChild(vrvStaffDef);
     return true;
 }
@@ -2339,10 +2534,7 @@ bool MeiInput::ReadMeiMeasure(Object *parent, pugi::xml_node measure)
     Measure *vrvMeasure = new Measure();
     SetMeiUuid(measure, vrvMeasure);
 
-    vrvMeasure->ReadCommon(measure);
-    vrvMeasure->ReadMeasureLog(measure);
-    vrvMeasure->ReadPointing(measure);
-    vrvMeasure->ReadTyped(measure);
+    ReadAttributes(measure, vrvMeasure);
 
     if (measure.attribute("ulx") && measure.attribute("lrx") && (this->m_doc->GetType() == Transcription)) {
         vrvMeasure->m_xAbs = atoi(measure.attribute("ulx").value()) * DEFINITION_FACTOR;
@@ -2351,6 +2543,12 @@ bool MeiInput::ReadMeiMeasure(Object *parent, pugi::xml_node measure)
 
     // This could be moved to an AddMeasure method for consistency with AddLayerElement
     parent->AddChild(vrvMeasure);
+
+    // When the buffer is read incrementally, the content of the measure is parsed only now (see MeiMeasureScan)
+    pugi::xml_document measureDoc;
+    if (m_measureScan && m_measureScan->LoadMeasure(measure, measureDoc, pugi::parse_default & ~pugi::parse_eol)) {
+        measure = measureDoc.first_child();
+    }
     return ReadMeiMeasureChildren(vrvMeasure, measure);
 }
 
@@ -2430,9 +2628,7 @@ bool MeiInput::ReadMeiMeasureChildren(Object *parent, pugi::xml_node parentNode)
 bool MeiInput::ReadControlElement(pugi::xml_node element, ControlElement *object)
 {
     SetMeiUuid(element, object);
-    object->ReadCommon(element);
-    object->ReadCommonPart(element);
-    object->ReadTyped(element);
+    ReadAttributes(element, object);
 
     return true;
 }
@@ -2442,8 +2638,6 @@ bool MeiInput::ReadMeiAnchoredText(Object *parent, pugi::xml_node anchoredText)
     AnchoredText *vrvAnchoredText = new AnchoredText();
     ReadControlElement(anchoredText, vrvAnchoredText);
 
-    ReadTextDirInterface(anchoredText, vrvAnchoredText);
-
     parent->AddChild(vrvAnchoredText);
     return ReadMeiTextChildren(vrvAnchoredText, anchoredText, vrvAnchoredText);
 }
@@ -2453,10 +2647,6 @@ bool MeiInput::ReadMeiBreath(Object *parent, pugi::xml_node breath)
     Breath *vrvBreath = new Breath();
     ReadControlElement(breath, vrvBreath);
 
-    ReadTimePointInterface(breath, vrvBreath);
-    vrvBreath->ReadColor(breath);
-    vrvBreath->ReadPlacement(breath);
-
     parent->AddChild(vrvBreath);
     return ReadMeiTextChildren(vrvBreath, breath, vrvBreath);
 }
@@ -2466,10 +2656,6 @@ bool MeiInput::ReadMeiDir(Object *parent, pugi::xml_node dir)
     Dir *vrvDir = new Dir();
     ReadControlElement(dir, vrvDir);
 
-    ReadTextDirInterface(dir, vrvDir);
-    ReadTimeSpanningInterface(dir, vrvDir);
-    vrvDir->ReadLang(dir);
-
     parent->AddChild(vrvDir);
     return ReadMeiTextChildren(vrvDir, dir, vrvDir);
 }
@@ -2479,9 +2665,6 @@ bool MeiInput::ReadMeiDynam(Object *parent, pugi::xml_node dynam)
     Dynam *vrvDynam = new Dynam();
     ReadControlElement(dynam, vrvDynam);
 
-    ReadTextDirInterface(dynam, vrvDynam);
-    ReadTimeSpanningInterface(dynam, vrvDynam);
-
     parent->AddChild(vrvDynam);
     return ReadMeiTextChildren(vrvDynam, dynam, vrvDynam);
 }
@@ -2491,11 +2674,6 @@ bool MeiInput::ReadMeiFermata(Object *parent, pugi::xml_node fermata)
     Fermata *vrvFermata = new Fermata();
     ReadControlElement(fermata, vrvFermata);
 
-    ReadTimePointInterface(fermata, vrvFermata);
-    vrvFermata->ReadColor(fermata);
-    vrvFermata->ReadFermataVis(fermata);
-    vrvFermata->ReadPlacement(fermata);
-
     parent->AddChild(vrvFermata);
     return true;
 }
@@ -2505,11 +2683,6 @@ bool MeiInput::ReadMeiHairpin(Object *parent, pugi::xml_node hairpin)
     Hairpin *vrvHairpin = new Hairpin();
     ReadControlElement(hairpin, vrvHairpin);
 
-    ReadTimeSpanningInterface(hairpin, vrvHairpin);
-    vrvHairpin->ReadColor(hairpin);
-    vrvHairpin->ReadHairpinLog(hairpin);
-    vrvHairpin->ReadPlacement(hairpin);
-
     parent->AddChild(vrvHairpin);
     return true;
 }
@@ -2519,10 +2692,6 @@ bool MeiInput::ReadMeiHarm(Object *parent, pugi::xml_node harm)
     Harm *vrvHarm = new Harm();
     ReadControlElement(harm, vrvHarm);
 
-    ReadTextDirInterface(harm, vrvHarm);
-    ReadTimeSpanningInterface(harm, vrvHarm);
-    vrvHarm->ReadLang(harm);
-
     parent->AddChild(vrvHarm);
     return ReadMeiTextChildren(vrvHarm, harm, vrvHarm);
 }
@@ -2532,12 +2701,6 @@ bool MeiInput::ReadMeiMordent(Object *parent, pugi::xml_node mordent)
     Mordent *vrvMordent = new Mordent();
     ReadControlElement(mordent, vrvMordent);
 
-    ReadTimePointInterface(mordent, vrvMordent);
-    vrvMordent->ReadColor(mordent);
-    vrvMordent->ReadOrnamentaccid(mordent);
-    vrvMordent->ReadPlacement(mordent);
-    vrvMordent->ReadMordentLog(mordent);
-
     parent->AddChild(vrvMordent);
     return true;
 }
@@ -2547,11 +2710,6 @@ bool MeiInput::ReadMeiOctave(Object *parent, pugi::xml_node octave)
     Octave *vrvOctave = new Octave();
     ReadControlElement(octave, vrvOctave);
 
-    ReadTimeSpanningInterface(octave, vrvOctave);
-    vrvOctave->ReadColor(octave);
-    vrvOctave->ReadLinerendBase(octave);
-    vrvOctave->ReadOctavedisplacement(octave);
-
     parent->AddChild(vrvOctave);
     return true;
 }
@@ -2561,11 +2719,6 @@ bool MeiInput::ReadMeiPedal(Object *parent, pugi::xml_node pedal)
     Pedal *vrvPedal = new Pedal();
     ReadControlElement(pedal, vrvPedal);
 
-    ReadTimePointInterface(pedal, vrvPedal);
-    vrvPedal->ReadColor(pedal);
-    vrvPedal->ReadPedalLog(pedal);
-    vrvPedal->ReadPlacement(pedal);
-
     parent->AddChild(vrvPedal);
     return true;
 }
@@ -2575,10 +2728,6 @@ bool MeiInput::ReadMeiSlur(Object *parent, pugi::xml_node slur)
     Slur *vrvSlur = new Slur();
     ReadControlElement(slur, vrvSlur);
 
-    ReadTimeSpanningInterface(slur, vrvSlur);
-    vrvSlur->ReadColor(slur);
-    vrvSlur->ReadCurvature(slur);
-
     parent->AddChild(vrvSlur);
     return true;
 }
@@ -2588,12 +2737,6 @@ bool MeiInput::ReadMeiTempo(Object *parent, pugi::xml_node tempo)
     Tempo *vrvTempo = new Tempo();
     ReadControlElement(tempo, vrvTempo);
 
-    ReadTextDirInterface(tempo, vrvTempo);
-    ReadTimePointInterface(tempo, vrvTempo);
-    vrvTempo->ReadLang(tempo);
-    vrvTempo->ReadMiditempo(tempo);
-    vrvTempo->ReadMmtempo(tempo);
-
     parent->AddChild(vrvTempo);
     return ReadMeiTextChildren(vrvTempo, tempo, vrvTempo);
 }
@@ -2603,10 +2746,6 @@ bool MeiInput::ReadMeiTie(Object *parent, pugi::xml_node tie)
     Tie *vrvTie = new Tie();
     ReadControlElement(tie, vrvTie);
 
-    ReadTimeSpanningInterface(tie, vrvTie);
-    vrvTie->ReadColor(tie);
-    vrvTie->ReadCurvature(tie);
-
     parent->AddChild(vrvTie);
     return true;
 }
@@ -2616,11 +2755,6 @@ bool MeiInput::ReadMeiTrill(Object *parent, pugi::xml_node trill)
     Trill *vrvTrill = new Trill();
     ReadControlElement(trill, vrvTrill);
 
-    ReadTimePointInterface(trill, vrvTrill);
-    vrvTrill->ReadColor(trill);
-    vrvTrill->ReadOrnamentaccid(trill);
-    vrvTrill->ReadPlacement(trill);
-
     parent->AddChild(vrvTrill);
     return true;
 }
@@ -2630,12 +2764,6 @@ bool MeiInput::ReadMeiTurn(Object *parent, pugi::xml_node turn)
     Turn *vrvTurn = new Turn();
     ReadControlElement(turn, vrvTurn);
 
-    ReadTimePointInterface(turn, vrvTurn);
-    vrvTurn->ReadColor(turn);
-    vrvTurn->ReadOrnamentaccid(turn);
-    vrvTurn->ReadPlacement(turn);
-    vrvTurn->ReadTurnLog(turn);
-
     parent->AddChild(vrvTurn);
     return true;
 }
@@ -2677,9 +2805,7 @@ bool MeiInput::ReadMeiStaff(Object *parent, pugi::xml_node staff)
     Staff *vrvStaff = new Staff();
     SetMeiUuid(staff, vrvStaff);
 
-    vrvStaff->ReadCommon(staff);
-    vrvStaff->ReadTyped(staff);
-    vrvStaff->ReadVisibility(staff);
+    ReadAttributes(staff, vrvStaff);
 
     if (staff.attribute("uly") && (this->m_doc->GetType() == Transcription)) {
         vrvStaff->m_yAbs = atoi(staff.attribute("uly").value()) * DEFINITION_FACTOR;
@@ -2721,9 +2847,7 @@ bool MeiInput::ReadMeiLayer(Object *parent, pugi::xml_node layer)
     Layer *vrvLayer = new Layer();
     SetMeiUuid(layer, vrvLayer);
 
-    vrvLayer->ReadCommon(layer);
-    vrvLayer->ReadTyped(layer);
-    vrvLayer->ReadVisibility(layer);
+    ReadAttributes(layer, vrvLayer);
 
     if (!vrvLayer->HasN()) {
         LogWarning("No @n on <layer>, 1 is set");
@@ -2855,9 +2979,7 @@ bool MeiInput::ReadLayerElement(pugi::xml_node element, LayerElement *object)
     }
 
     SetMeiUuid(element, object);
-    object->ReadCommon(element);
-    object->ReadCommonPart(element);
-    object->ReadTyped(element);
+    ReadAttributes(element, object);
 
     return true;
 }
@@ -2867,13 +2989,6 @@ bool MeiInput::ReadMeiAccid(Object *parent, pugi::xml_node accid)
     Accid *vrvAccid = new Accid();
     ReadLayerElement(accid, vrvAccid);
 
-    ReadPositionInterface(accid, vrvAccid);
-    vrvAccid->ReadAccidental(accid);
-    vrvAccid->ReadAccidentalPerformed(accid);
-    vrvAccid->ReadAccidLog(accid);
-    vrvAccid->ReadColor(accid);
-    vrvAccid->ReadEnclosingchars(accid);
-
     parent->AddChild(vrvAccid);
     return true;
 }
@@ -2883,10 +2998,6 @@ bool MeiInput::ReadMeiArtic(Object *parent, pugi::xml_node artic)
     Artic *vrvArtic = new Artic();
     ReadLayerElement(artic, vrvArtic);
 
-    vrvArtic->ReadArticulation(artic);
-    vrvArtic->ReadColor(artic);
-    vrvArtic->ReadPlacement(artic);
-
     parent->AddChild(vrvArtic);
     return true;
 }
@@ -2896,9 +3007,6 @@ bool MeiInput::ReadMeiBarLine(Object *parent, pugi::xml_node barLine)
     BarLine *vrvBarLine = new BarLine();
     ReadLayerElement(barLine, vrvBarLine);
 
-    vrvBarLine->ReadBarLineLog(barLine);
-    vrvBarLine->ReadColor(barLine);
-
     parent->AddChild(vrvBarLine);
     return true;
 }
@@ -2908,8 +3016,6 @@ bool MeiInput::ReadMeiBeam(Object *parent, pugi::xml_node beam)
     Beam *vrvBeam = new Beam();
     ReadLayerElement(beam, vrvBeam);
 
-    vrvBeam->ReadColor(beam);
-
     parent->AddChild(vrvBeam);
 
     return ReadMeiLayerChildren(vrvBeam, beam, vrvBeam);
@@ -2920,9 +3026,6 @@ bool MeiInput::ReadMeiBeatRpt(Object *parent, pugi::xml_node beatRpt)
     BeatRpt *vrvBeatRpt = new BeatRpt();
     ReadLayerElement(beatRpt, vrvBeatRpt);
 
-    vrvBeatRpt->ReadColor(beatRpt);
-    vrvBeatRpt->ReadBeatRptVis(beatRpt);
-
     parent->AddChild(vrvBeatRpt);
     return true;
 }
@@ -2932,8 +3035,6 @@ bool MeiInput::ReadMeiBTrem(Object *parent, pugi::xml_node bTrem)
     BTrem *vrvBTrem = new BTrem();
     ReadLayerElement(bTrem, vrvBTrem);
 
-    vrvBTrem->ReadTremmeasured(bTrem);
-
     parent->AddChild(vrvBTrem);
     return ReadMeiLayerChildren(vrvBTrem, bTrem, vrvBTrem);
 }
@@ -2941,19 +3042,13 @@ bool MeiInput::ReadMeiBTrem(Object *parent, pugi::xml_node bTrem)
 bool MeiInput::ReadMeiChord(Object *parent, pugi::xml_node chord)
 {
     Chord *vrvChord = new Chord();
-    ReadLayerElement(chord, vrvChord);
-
-    ReadDurationInterface(chord, vrvChord);
-    vrvChord->ReadColor(chord);
-    vrvChord->ReadGraced(chord);
-    vrvChord->ReadRelativesize(chord);
-    vrvChord->ReadStems(chord);
-    vrvChord->ReadStemsCmn(chord);
-    vrvChord->ReadTiepresent(chord);
-    vrvChord->ReadVisibility(chord);
 
+    // read the attributes stored as children before the ones of the chord itself
     AttArticulation artic;
     artic.ReadArticulation(chord);
+
+    ReadLayerElement(chord, vrvChord);
+
     if (artic.HasArtic()) {
         Artic *vrvArtic = new Artic();
         vrvArtic->IsAttribute(true);
@@ -2970,11 +3065,6 @@ bool MeiInput::ReadMeiClef(Object *parent, pugi::xml_node clef)
     Clef *vrvClef = new Clef();
     ReadLayerElement(clef, vrvClef);
 
-    vrvClef->ReadClefshape(clef);
-    vrvClef->ReadColor(clef);
-    vrvClef->ReadLineloc(clef);
-    vrvClef->ReadOctavedisplacement(clef);
-
     parent->AddChild(vrvClef);
     return true;
 }
@@ -2984,10 +3074,6 @@ bool MeiInput::ReadMeiCustos(Object *parent, pugi::xml_node custos)
     Custos *vrvCustos = new Custos();
     ReadLayerElement(custos, vrvCustos);
 
-    ReadPositionInterface(custos, vrvCustos);
-
-    vrvCustos->ReadColor(custos);
-
     parent->AddChild(vrvCustos);
     return true;
 }
@@ -2997,10 +3083,6 @@ bool MeiInput::ReadMeiDot(Object *parent, pugi::xml_node dot)
     Dot *vrvDot = new Dot();
     ReadLayerElement(dot, vrvDot);
 
-    ReadPositionInterface(dot, vrvDot);
-    vrvDot->ReadColor(dot);
-    vrvDot->ReadDotLog(dot);
-
     parent->AddChild(vrvDot);
     return true;
 }
@@ -3010,9 +3092,6 @@ bool MeiInput::ReadMeiFTrem(Object *parent, pugi::xml_node fTrem)
     FTrem *vrvFTrem = new FTrem();
     ReadLayerElement(fTrem, vrvFTrem);
 
-    vrvFTrem->ReadSlashcount(fTrem);
-    vrvFTrem->ReadTremmeasured(fTrem);
-
     parent->AddChild(vrvFTrem);
     return ReadMeiLayerChildren(vrvFTrem, fTrem, vrvFTrem);
 }
@@ -3022,9 +3101,6 @@ bool MeiInput::ReadMeiKeySig(Object *parent, pugi::xml_node keySig)
     KeySig *vrvKeySig = new KeySig();
     ReadLayerElement(keySig, vrvKeySig);
 
-    vrvKeySig->ReadAccidental(keySig);
-    vrvKeySig->ReadPitch(keySig);
-
     // special processing required
     vrvKeySig->ConvertToInternal();
 
@@ -3037,10 +3113,7 @@ bool MeiInput::ReadMeiLigature(Object *parent, pugi::xml_node ligature)
     Ligature *vrvLigature = new Ligature();
     SetMeiUuid(ligature, vrvLigature);
 
-    ReadDurationInterface(ligature, vrvLigature);
-    vrvLigature->ReadStems(ligature);
-    vrvLigature->ReadStemsCmn(ligature);
-    vrvLigature->ReadTiepresent(ligature);
+    ReadAttributes(ligature, vrvLigature);
 
     parent->AddChild(vrvLigature);
     return ReadMeiLayerChildren(vrvLigature, ligature, vrvLigature);
@@ -3051,14 +3124,6 @@ bool MeiInput::ReadMeiMensur(Object *parent, pugi::xml_node mensur)
     Mensur *vrvMensur = new Mensur();
     ReadLayerElement(mensur, vrvMensur);
 
-    vrvMensur->ReadColor(mensur);
-    vrvMensur->ReadDurationRatio(mensur);
-    vrvMensur->ReadMensuralShared(mensur);
-    vrvMensur->ReadMensurLog(mensur);
-    vrvMensur->ReadMensurVis(mensur);
-    vrvMensur->ReadRelativesize(mensur);
-    vrvMensur->ReadSlashcount(mensur);
-
     parent->AddChild(vrvMensur);
     return true;
 }
@@ -3068,9 +3133,6 @@ bool MeiInput::ReadMeiMeterSig(Object *parent, pugi::xml_node meterSig)
     MeterSig *vrvMeterSig = new MeterSig();
     ReadLayerElement(meterSig, vrvMeterSig);
 
-    vrvMeterSig->ReadMeterSigLog(meterSig);
-    vrvMeterSig->ReadMeterSigVis(meterSig);
-
     parent->AddChild(vrvMeterSig);
     return true;
 }
@@ -3079,11 +3141,6 @@ bool MeiInput::ReadMeiMRest(Object *parent, pugi::xml_node mRest)
 {
     MRest *vrvMRest = new MRest();
     ReadLayerElement(mRest, vrvMRest);
-    ReadPositionInterface(mRest, vrvMRest);
-
-    vrvMRest->ReadFermatapresent(mRest);
-    vrvMRest->ReadRelativesize(mRest);
-    vrvMRest->ReadVisibility(mRest);
 
     parent->AddChild(vrvMRest);
     return true;
@@ -3112,9 +3169,6 @@ bool MeiInput::ReadMeiMultiRest(Object *parent, pugi::xml_node multiRest)
     MultiRest *vrvMultiRest = new MultiRest();
     ReadLayerElement(multiRest, vrvMultiRest);
 
-    vrvMultiRest->ReadMultiRestVis(multiRest);
-    vrvMultiRest->ReadNumbered(multiRest);
-
     parent->AddChild(vrvMultiRest);
     return true;
 }
@@ -3124,8 +3178,6 @@ bool MeiInput::ReadMeiMultiRpt(Object *parent, pugi::xml_node multiRpt)
     MultiRpt *vrvMultiRpt = new MultiRpt();
     ReadLayerElement(multiRpt, vrvMultiRpt);
 
-    vrvMultiRpt->ReadNumbered(multiRpt);
-
     parent->AddChild(vrvMultiRpt);
     return true;
 }
@@ -3133,23 +3185,17 @@ bool MeiInput::ReadMeiMultiRpt(Object *parent, pugi::xml_node multiRpt)
 bool MeiInput::ReadMeiNote(Object *parent, pugi::xml_node note)
 {
     Note *vrvNote = new Note();
-    ReadLayerElement(note, vrvNote);
-
-    ReadDurationInterface(note, vrvNote);
-    ReadPitchInterface(note, vrvNote);
-    ReadPositionInterface(note, vrvNote);
-    vrvNote->ReadColor(note);
-    vrvNote->ReadColoration(note);
-    vrvNote->ReadGraced(note);
-    vrvNote->ReadNoteLogMensural(note);
-    vrvNote->ReadRelativesize(note);
-    vrvNote->ReadStems(note);
-    vrvNote->ReadStemsCmn(note);
-    vrvNote->ReadTiepresent(note);
-    vrvNote->ReadVisibility(note);
 
+    // read the attributes stored as children before the ones of the note itself
     AttArticulation artic;
     artic.ReadArticulation(note);
+    AttAccidental accidental;
+    accidental.ReadAccidental(note);
+    AttAccidentalPerformed accidentalPerformed;
+    accidentalPerformed.ReadAccidentalPerformed(note);
+
+    ReadLayerElement(note, vrvNote);
+
     if (artic.HasArtic()) {
         Artic *vrvArtic = new Artic();
         vrvArtic->IsAttribute(true);
@@ -3157,10 +3203,6 @@ bool MeiInput::ReadMeiNote(Object *parent, pugi::xml_node note)
         vrvNote->AddChild(vrvArtic);
     }
 
-    AttAccidental accidental;
-    accidental.ReadAccidental(note);
-    AttAccidentalPerformed accidentalPerformed;
-    accidentalPerformed.ReadAccidentalPerformed(note);
     if (accidental.HasAccid() || accidentalPerformed.HasAccidGes()) {
         Accid *vrvAccid = new Accid();
         vrvAccid->IsAttribute(true);
@@ -3178,12 +3220,6 @@ bool MeiInput::ReadMeiRest(Object *parent, pugi::xml_node rest)
     Rest *vrvRest = new Rest();
     ReadLayerElement(rest, vrvRest);
 
-    ReadDurationInterface(rest, vrvRest);
-    ReadPositionInterface(rest, vrvRest);
-    vrvRest->ReadColor(rest);
-    vrvRest->ReadRelativesize(rest);
-    vrvRest->ReadRestVisMensural(rest);
-
     parent->AddChild(vrvRest);
     return true;
 }
@@ -3193,8 +3229,6 @@ bool MeiInput::ReadMeiProport(Object *parent, pugi::xml_node proport)
     Proport *vrvProport = new Proport();
     ReadLayerElement(proport, vrvProport);
 
-    vrvProport->ReadDurationRatio(proport);
-
     parent->AddChild(vrvProport);
     return true;
 }
@@ -3204,8 +3238,6 @@ bool MeiInput::ReadMeiSpace(Object *parent, pugi::xml_node space)
     Space *vrvSpace = new Space();
     ReadLayerElement(space, vrvSpace);
 
-    ReadDurationInterface(space, vrvSpace);
-
     parent->AddChild(vrvSpace);
     return true;
 }
@@ -3215,10 +3247,6 @@ bool MeiInput::ReadMeiSyl(Object *parent, pugi::xml_node syl)
     Syl *vrvSyl = new Syl();
     ReadLayerElement(syl, vrvSyl);
 
-    vrvSyl->ReadLang(syl);
-    vrvSyl->ReadTypography(syl);
-    vrvSyl->ReadSylLog(syl);
-
     parent->AddChild(vrvSyl);
     return ReadMeiTextChildren(vrvSyl, syl, vrvSyl);
 }
@@ -3228,11 +3256,6 @@ bool MeiInput::ReadMeiTuplet(Object *parent, pugi::xml_node tuplet)
     Tuplet *vrvTuplet = new Tuplet();
     ReadLayerElement(tuplet, vrvTuplet);
 
-    vrvTuplet->ReadColor(tuplet);
-    vrvTuplet->ReadDurationRatio(tuplet);
-    vrvTuplet->ReadNumberplacement(tuplet);
-    vrvTuplet->ReadTupletVis(tuplet);
-
     parent->AddChild(vrvTuplet);
     return ReadMeiLayerChildren(vrvTuplet, tuplet, vrvTuplet);
 }
@@ -3242,10 +3265,6 @@ bool MeiInput::ReadMeiVerse(Object *parent, pugi::xml_node verse)
     Verse *vrvVerse = new Verse();
     ReadLayerElement(verse, vrvVerse);
 
-    vrvVerse->ReadColor(verse);
-    vrvVerse->ReadLang(verse);
-    vrvVerse->ReadTypography(verse);
-
     parent->AddChild(vrvVerse);
     return ReadMeiLayerChildren(vrvVerse, verse, vrvVerse);
 }
@@ -3297,8 +3316,7 @@ bool MeiInput::ReadMeiTextChildren(Object *parent, pugi::xml_node parentNode, Ob
 bool MeiInput::ReadTextElement(pugi::xml_node element, TextElement *object)
 {
     SetMeiUuid(element, object);
-    object->ReadCommon(element);
-    object->ReadTyped(element);
+    ReadAttributes(element, object);
 
     return true;
 }
@@ -3317,12 +3335,6 @@ bool MeiInput::ReadMeiRend(Object *parent, pugi::xml_node rend)
     Rend *vrvRend = new Rend();
     ReadTextElement(rend, vrvRend);
 
-    vrvRend->ReadColor(rend);
-    vrvRend->ReadHorizontalalign(rend);
-    vrvRend->ReadLang(rend);
-    vrvRend->ReadTypography(rend);
-    vrvRend->ReadWhitespace(rend);
-
     parent->AddChild(vrvRend);
     return ReadMeiTextChildren(vrvRend, rend);
 }
@@ -3342,74 +3354,12 @@ bool MeiInput::ReadMeiText(Object *parent, pugi::xml_node text, bool trimLeft, b
     return true;
 }
 
-bool MeiInput::ReadDurationInterface(pugi::xml_node element, DurationInterface *interface)
-{
-    interface->ReadAugmentdots(element);
-    interface->ReadBeamsecondary(element);
-    interface->ReadDurationMusical(element);
-    interface->ReadDurationPerformed(element);
-    interface->ReadDurationRatio(element);
-    interface->ReadFermatapresent(element);
-    interface->ReadStaffident(element);
-    return true;
-}
-
-bool MeiInput::ReadPitchInterface(pugi::xml_node element, PitchInterface *interface)
-{
-    interface->ReadNoteGes(element);
-    interface->ReadOctave(element);
-    interface->ReadPitch(element);
-    return true;
-}
-
-bool MeiInput::ReadPositionInterface(pugi::xml_node element, PositionInterface *interface)
-{
-    interface->ReadStaffloc(element);
-    interface->ReadStafflocPitched(element);
-    return true;
-}
-
-bool MeiInput::ReadScoreDefInterface(pugi::xml_node element, ScoreDefInterface *interface)
-{
-    interface->ReadCleffingLog(element);
-    interface->ReadCleffingVis(element);
-    interface->ReadKeySigDefaultLog(element);
-    interface->ReadKeySigDefaultVis(element);
-    interface->ReadLyricstyle(element);
-    interface->ReadMensuralLog(element);
-    interface->ReadMensuralShared(element);
-    interface->ReadMeterSigDefaultLog(element);
-    interface->ReadMeterSigDefaultVis(element);
-    interface->ReadMiditempo(element);
-    interface->ReadMultinummeasures(element);
-    return true;
-}
-
-bool MeiInput::ReadTextDirInterface(pugi::xml_node element, TextDirInterface *interface)
-{
-    interface->ReadPlacement(element);
-    return true;
-}
-
-bool MeiInput::ReadTimePointInterface(pugi::xml_node element, TimePointInterface *interface)
-{
-    interface->ReadStaffident(element);
-    interface->ReadStartid(element);
-    interface->ReadTimestampMusical(element);
-    return true;
-}
-
-bool MeiInput::ReadTimeSpanningInterface(pugi::xml_node element, TimeSpanningInterface *interface)
-{
-    ReadTimePointInterface(element, interface);
-    interface->ReadStartendid(element);
-    interface->ReadTimestamp2Musical(element);
-    return true;
-}
-
-void MeiInput::ReadUnsupportedAttr(pugi::xml_node element, Object *object)
+void MeiInput::ReadAttributes(pugi::xml_node element, Object *object)
 {
     for (pugi::xml_attribute_iterator ait = element.attributes_begin(); ait != element.attributes_end(); ++ait) {
+        if (Att::SetAttribute(object, ait->name(), ait->value())) continue;
+        // Skip the attributes read by the calling method itself
+        if (this->IsReadAttributeName(ait->name())) continue;
         object->m_unsupported.push_back(std::make_pair(ait->name(), ait->value()));
     }
 }
@@ -3471,9 +3421,7 @@ bool MeiInput::ReadEditorialElement(pugi::xml_node element, EditorialElement *ob
 {
     SetMeiUuid(element, object);
 
-    object->ReadCommon(element);
-    object->ReadCommonPart(element);
-    object->ReadTyped(element);
+    ReadAttributes(element, object);
 
     return true;
 }
@@ -3483,8 +3431,6 @@ bool MeiInput::ReadMeiAbbr(Object *parent, pugi::xml_node abbr, EditorialLevel l
     Abbr *vrvAbbr = new Abbr();
     ReadEditorialElement(abbr, vrvAbbr);
 
-    vrvAbbr->ReadSource(abbr);
-
     parent->AddChild(vrvAbbr);
     return ReadMeiEditorialChildren(vrvAbbr, abbr, level, filter);
 }
@@ -3494,8 +3440,6 @@ bool MeiInput::ReadMeiAdd(Object *parent, pugi::xml_node add, EditorialLevel lev
     Add *vrvAdd = new Add();
     ReadEditorialElement(add, vrvAdd);
 
-    vrvAdd->ReadSource(add);
-
     parent->AddChild(vrvAdd);
     return ReadMeiEditorialChildren(vrvAdd, add, level, filter);
 }
@@ -3505,9 +3449,6 @@ bool MeiInput::ReadMeiAnnot(Object *parent, pugi::xml_node annot)
     Annot *vrvAnnot = new Annot();
     ReadEditorialElement(annot, vrvAnnot);
 
-    vrvAnnot->ReadPlist(annot);
-    vrvAnnot->ReadSource(annot);
-
     vrvAnnot->m_content.reset();
     // copy all the nodes inside into the document
     for (pugi::xml_node child = annot.first_child(); child; child = child.next_sibling()) {
@@ -3672,8 +3613,6 @@ bool MeiInput::ReadMeiCorr(Object *parent, pugi::xml_node corr, EditorialLevel l
     Corr *vrvCorr = new Corr();
     ReadEditorialElement(corr, vrvCorr);
 
-    vrvCorr->ReadSource(corr);
-
     parent->AddChild(vrvCorr);
     return ReadMeiEditorialChildren(vrvCorr, corr, level, filter);
 }
@@ -3683,8 +3622,6 @@ bool MeiInput::ReadMeiDamage(Object *parent, pugi::xml_node damage, EditorialLev
     Damage *vrvDamage = new Damage();
     ReadEditorialElement(damage, vrvDamage);
 
-    vrvDamage->ReadSource(damage);
-
     parent->AddChild(vrvDamage);
     return ReadMeiEditorialChildren(vrvDamage, damage, level, filter);
 }
@@ -3694,8 +3631,6 @@ bool MeiInput::ReadMeiDel(Object *parent, pugi::xml_node del, EditorialLevel lev
     Del *vrvDel = new Del();
     ReadEditorialElement(del, vrvDel);
 
-    vrvDel->ReadSource(del);
-
     parent->AddChild(vrvDel);
     return ReadMeiEditorialChildren(vrvDel, del, level, filter);
 }
@@ -3705,8 +3640,6 @@ bool MeiInput::ReadMeiExpan(Object *parent, pugi::xml_node expan, EditorialLevel
     Expan *vrvExpan = new Expan();
     ReadEditorialElement(expan, vrvExpan);
 
-    vrvExpan->ReadSource(expan);
-
     parent->AddChild(vrvExpan);
     return ReadMeiEditorialChildren(vrvExpan, expan, level, filter);
 }
@@ -3720,8 +3653,6 @@ bool MeiInput::ReadMeiLem(Object *parent, pugi::xml_node lem, EditorialLevel lev
     vrvLem->m_visibility = Hidden;
     ReadEditorialElement(lem, vrvLem);
 
-    vrvLem->ReadSource(lem);
-
     parent->AddChild(vrvLem);
     return ReadMeiEditorialChildren(vrvLem, lem, level, filter);
 }
@@ -3731,8 +3662,6 @@ bool MeiInput::ReadMeiOrig(Object *parent, pugi::xml_node orig, EditorialLevel l
     Orig *vrvOrig = new Orig();
     ReadEditorialElement(orig, vrvOrig);
 
-    vrvOrig->ReadSource(orig);
-
     parent->AddChild(vrvOrig);
     return ReadMeiEditorialChildren(vrvOrig, orig, level, filter);
 }
@@ -3746,8 +3675,6 @@ bool MeiInput::ReadMeiRdg(Object *parent, pugi::xml_node rdg, EditorialLevel lev
     vrvRdg->m_visibility = Hidden;
     ReadEditorialElement(rdg, vrvRdg);
 
-    vrvRdg->ReadSource(rdg);
-
     parent->AddChild(vrvRdg);
     return ReadMeiEditorialChildren(vrvRdg, rdg, level, filter);
 }
@@ -3757,8 +3684,6 @@ bool MeiInput::ReadMeiReg(Object *parent, pugi::xml_node reg, EditorialLevel lev
     Reg *vrvReg = new Reg();
     ReadEditorialElement(reg, vrvReg);
 
-    vrvReg->ReadSource(reg);
-
     parent->AddChild(vrvReg);
     return ReadMeiEditorialChildren(vrvReg, reg, level, filter);
 }
@@ -3768,8 +3693,6 @@ bool MeiInput::ReadMeiRestore(Object *parent, pugi::xml_node restore, EditorialL
     Restore *vrvRestore = new Restore();
     ReadEditorialElement(restore, vrvRestore);
 
-    vrvRestore->ReadSource(restore);
-
     parent->AddChild(vrvRestore);
     return ReadMeiEditorialChildren(vrvRestore, restore, level, filter);
 }
@@ -3779,8 +3702,6 @@ bool MeiInput::ReadMeiSic(Object *parent, pugi::xml_node sic, EditorialLevel lev
     Sic *vrvSic = new Sic();
     ReadEditorialElement(sic, vrvSic);
 
-    vrvSic->ReadSource(sic);
-
     parent->AddChild(vrvSic);
     return ReadMeiEditorialChildren(vrvSic, sic, level, filter);
 }
@@ -3790,8 +3711,6 @@ bool MeiInput::ReadMeiSupplied(Object *parent, pugi::xml_node supplied, Editoria
     Supplied *vrvSupplied = new Supplied();
     ReadEditorialElement(supplied, vrvSupplied);
 
-    vrvSupplied->ReadSource(supplied);
-
     parent->AddChild(vrvSupplied);
     return ReadMeiEditorialChildren(vrvSupplied, supplied, level, filter);
 }
@@ -3801,8 +3720,6 @@ bool MeiInput::ReadMeiUnclear(Object *parent, pugi::xml_node unclear, EditorialL
     Unclear *vrvUnclear = new Unclear();
     ReadEditorialElement(unclear, vrvUnclear);
 
-    vrvUnclear->ReadSource(unclear);
-
     parent->AddChild(vrvUnclear);
     return ReadMeiEditorialChildren(vrvUnclear, unclear, level, filter);
 }
@@ -4010,4 +3927,279 @@ bool MeiInput::IsEditorialElementName(std::string elementName)
     return false;
 }
 
+bool MeiInput::IsReadAttributeName(std::string attributeName)
+{
+    auto i = std::find(MeiInput::s_readAttributeNames.begin(), MeiInput::s_readAttributeNames.end(), attributeName);
+    if (i != MeiInput::s_readAttributeNames.end()) return true;
+    return false;
+}
+
+//----------------------------------------------------------------------------
+// MeiBufferScan
+//----------------------------------------------------------------------------
+
+bool MeiBufferScan::FindNextTag(std::string const &mei, size_t &pos, size_t &start, size_t &end, std::string &name,
+    bool &isClosing, bool &isEmpty)
+{
+    while (pos != std::string::npos) {
+        pos = mei.find('<', pos);
+        if (pos == std::string::npos) {
+            // no tag anymore
+            pos = mei.size();
+            return false;
+        }
+        // comments, cdata, processing instructions and doctype
+        if (mei.compare(pos, 4, "<!--") == 0) {
+            pos = mei.find("-->", pos + 4);
+            if (pos != std::string::npos) pos += 3;
+            continue;
+        }
+        else if (mei.compare(pos, 9, "<![CDATA[") == 0) {
+            pos = mei.find("]]>", pos + 9);
+            if (pos != std::string::npos) pos += 3;
+            continue;
+        }
+        else if (mei.compare(pos, 2, "<?") == 0) {
+            pos = mei.find("?>", pos + 2);
+            if (pos != std::string::npos) pos += 2;
+            continue;
+        }
+        else if (mei.compare(pos, 2, "<!") == 0) {
+            size_t doctypeEnd = mei.find('>', pos);
+            size_t subset = mei.find('[', pos);
+            // internal subset of the doctype
+            if ((subset != std::string::npos) && (subset < doctypeEnd)) doctypeEnd = mei.find("]>", subset);
+            pos = (doctypeEnd != std::string::npos) ? doctypeEnd + 1 : std::string::npos;
+            continue;
+        }
+
+        start = pos;
+        isClosing = (mei.compare(pos, 2, "</") == 0);
+        // attribute values can contain '>'
+        char quote = 0;
+        for (end = pos + 1; end < mei.size(); ++end) {
+            char c = mei[end];
+            if (quote) {
+                if (c == quote) quote = 0;
+            }
+            else if (!isClosing && ((c == '"') || (c == '\''))) {
+                quote = c;
+            }
+            else if (c == '>') {
+                break;
+            }
+        }
+        if (end >= mei.size()) {
+            pos = std::string::npos;
+            return false;
+        }
+        isEmpty = (!isClosing && (mei[end - 1] == '/'));
+        size_t nameStart = (isClosing) ? pos + 2 : pos + 1;
+        size_t nameEnd = mei.find_first_of(" \t\r\n/>", nameStart);
+        name = mei.substr(nameStart, nameEnd - nameStart);
+        pos = ++end;
+        return true;
+    }
+    return false;
+}
+
+//----------------------------------------------------------------------------
+// MeiMdivScan
+//----------------------------------------------------------------------------
+
+MeiMdivScan::MeiMdivScan()
+{
+    m_bodyStart = std::string::npos;
+    m_bodyEnd = std::string::npos;
+}
+
+bool MeiMdivScan::Scan(std::string const &mei)
+{
+    m_skeleton.reset();
+    m_body = pugi::xml_node();
+    m_bodyStart = std::string::npos;
+    m_bodyEnd = std::string::npos;
+    m_mdivRanges.clear();
+
+    // The open elements, with an empty node for the ones not in the skeleton
+    std::vector<pugi::xml_node> openNodes;
+    // The indexes in m_mdivRanges of the open <mdiv>
+    std::vector<int> openMdivs;
+
+    size_t pos = 0;
+    size_t start, end;
+    std::string name;
+    bool isClosing, isEmpty;
+    while (FindNextTag(mei, pos, start, end, name, isClosing, isEmpty)) {
+        // closing tag
+        if (isClosing) {
+            if (openNodes.empty()) return false;
+            pugi::xml_node node = openNodes.back();
+            openNodes.pop_back();
+            if (node) {
+                if (node == m_body) {
+                    m_bodyEnd = start;
+                }
+                else if (std::string(node.name()) == "mdiv") {
+                    m_mdivRanges.at(openMdivs.back()).second = end;
+                    openMdivs.pop_back();
+                }
+            }
+            continue;
+        }
+
+        // Only the path to the <body> and the <mdiv> elements within it are kept
+        pugi::xml_node parent = (openNodes.empty()) ? m_skeleton.root() : openNodes.back();
+        bool keep = false;
+        if (parent && !m_body) {
+            keep = ((name == "mei") || (name == "music") || (name == "body"));
+        }
+        else if (parent && ((parent == m_body) || (std::string(parent.name()) == "mdiv"))) {
+            keep = (name == "mdiv");
+        }
+
+        pugi::xml_node node;
+        if (keep) {
+            // Let pugixml read the attributes of the opening tag
+            std::string tag = mei.substr(start, end - start - 1) + ((isEmpty) ? ">" : "/>");
+            pugi::xml_document tagDoc;
+            if (!tagDoc.load_buffer(tag.data(), tag.size())) return false;
+            node = parent.append_copy(tagDoc.first_child());
+            if (name == "body") {
+                if (m_body) return false;
+                m_body = node;
+                m_bodyStart = end;
+            }
+            else if (name == "mdiv") {
+                m_mdivRanges.push_back(std::make_pair(start, end));
+                if (!isEmpty) openMdivs.push_back((int)m_mdivRanges.size() - 1);
+            }
+        }
+        if (!isEmpty) openNodes.push_back(node);
+    }
+
+    if ((pos == std::string::npos) || !openNodes.empty() || (m_bodyEnd == std::string::npos) || m_mdivRanges.empty()) {
+        m_skeleton.reset();
+        m_body = pugi::xml_node();
+        return false;
+    }
+    return true;
+}
+
+bool MeiMdivScan::GetBufferWithMdiv(std::string const &mei, pugi::xml_node mdiv, std::string &buffer) const
+{
+    pugi::xpath_node_set mdivs = this->GetMdivs();
+    for (int i = 0; i < (int)mdivs.size(); ++i) {
+        if (mdivs[i].node() != mdiv) continue;
+        std::pair<size_t, size_t> range = m_mdivRanges.at(i);
+        buffer.reserve(m_bodyStart + (range.second - range.first) + (mei.size() - m_bodyEnd));
+        buffer.assign(mei, 0, m_bodyStart);
+        buffer.append(mei, range.first, range.second - range.first);
+        buffer.append(mei, m_bodyEnd, std::string::npos);
+        return true;
+    }
+    return false;
+}
+
+std::string MeiMdivScan::GetMdivXPathQuery(pugi::xml_node mdiv) const
+{
+    std::string query;
+    pugi::xml_node node;
+    for (node = mdiv; node && (node != m_body); node = node.parent()) {
+        int n = 1;
+        pugi::xml_node sibling;
+        for (sibling = node.previous_sibling("mdiv"); sibling; sibling = sibling.previous_sibling("mdiv")) n++;
+        query = StringFormat("/mdiv[%d]", n) + query;
+    }
+    return "." + query;
+}
+
+//----------------------------------------------------------------------------
+// MeiMeasureScan
+//----------------------------------------------------------------------------
+
+MeiMeasureScan::MeiMeasureScan()
+{
+    m_buffer = NULL;
+}
+
+bool MeiMeasureScan::Scan(std::string const &mei)
+{
+    m_buffer = &mei;
+    m_skeletonBuffer.clear();
+    m_measureRanges.clear();
+    m_measureNodes.clear();
+
+    // The depth of the open elements and of the <measure> being skipped
+    int depth = 0;
+    int measureDepth = -1;
+    // The position in the buffer up to which it is in the skeleton
+    size_t skeletonEnd = 0;
+
+    size_t pos = 0;
+    size_t start, end;
+    std::string name;
+    bool isClosing, isEmpty;
+    while (FindNextTag(mei, pos, start, end, name, isClosing, isEmpty)) {
+        if (isClosing) {
+            if (--depth < 0) return false;
+            if (depth == measureDepth) {
+                // The content of the <measure> is left out from the skeleton
+                m_measureRanges.back().second = end;
+                skeletonEnd = start;
+                measureDepth = -1;
+            }
+            continue;
+        }
+        if ((measureDepth == -1) && (name == "measure")) {
+            if (isEmpty) {
+                m_measureRanges.push_back(std::make_pair(std::string::npos, std::string::npos));
+            }
+            else {
+                m_skeletonBuffer.append(mei, skeletonEnd, end - skeletonEnd);
+                m_measureRanges.push_back(std::make_pair(start, std::string::npos));
+                measureDepth = depth;
+            }
+        }
+        if (!isEmpty) depth++;
+    }
+
+    if ((pos == std::string::npos) || (depth != 0)) {
+        m_skeletonBuffer.clear();
+        m_measureRanges.clear();
+        return false;
+    }
+    m_skeletonBuffer.append(mei, skeletonEnd, std::string::npos);
+    return true;
+}
+
+bool MeiMeasureScan::LoadSkeleton(pugi::xml_document &skeleton, unsigned int options)
+{
+    pugi::xml_parse_result result
+        = skeleton.load_buffer(m_skeletonBuffer.data(), m_skeletonBuffer.size(), options, pugi::encoding_utf8);
+    std::string().swap(m_skeletonBuffer);
+    if (!result) return false;
+
+    // The <measure> nodes are in the same order as in the buffer
+    pugi::xpath_node_set measures = skeleton.select_nodes("//measure");
+    if (measures.size() != m_measureRanges.size()) return false;
+    for (int i = 0; i < (int)measures.size(); ++i) {
+        m_measureNodes[measures[i].node()] = i;
+    }
+    return true;
+}
+
+bool MeiMeasureScan::LoadMeasure(pugi::xml_node measure, pugi::xml_document &measureDoc, unsigned int options)
+{
+    std::map<pugi::xml_node, int>::iterator iter = m_measureNodes.find(measure);
+    if (iter == m_measureNodes.end()) return false;
+    std::pair<size_t, size_t> range = m_measureRanges.at(iter->second);
+    m_measureNodes.erase(iter);
+    if (range.first == std::string::npos) return false;
+
+    assert(m_buffer);
+    return measureDoc.load_buffer(
+        m_buffer->data() + range.first, range.second - range.first, options, pugi::encoding_utf8);
+}
+
 } // namespace vrv
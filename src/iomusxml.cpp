@@ -295,12 +295,7 @@ void MusicXmlInput::FillSpace(Layer *layer, int dur)
 
 void MusicXmlInput::GenerateUuid(pugi::xml_node node)
 {
-    int nr = std::rand();
-    char str[17];
-    // I do not want to use a stream for doing this!
-    snprintf(str, 17, "%016d", nr);
-
-    std::string uuid = StringFormat("%s-%s", node.name(), str).c_str();
+    std::string uuid = Object::GenerateUuidStr(StringFormat("%s-", node.name()));
     std::transform(uuid.begin(), uuid.end(), uuid.begin(), ::tolower);
     node.append_attribute("xml:id").set_value(uuid.c_str());
 }
@@ -625,7 +620,7 @@ int MusicXmlInput::ReadMusicXmlPartAttributesAsStaffDef(pugi::xml_node node, Sta
             }
             if (clefSign && HasContent(clefSign.node())) {
                 staffDef->SetClefShape(
-                    staffDef->AttCleffingLog::StrToClefshape(GetContent(clefSign.node()).substr(0, 4)));
+                    staffDef->AttCleffingLog::StrToClefshape(GetContent(clefSign.node()).substr(0, 4).c_str()));
             }
             // clef line
             pugi::xpath_node clefLine;
@@ -862,7 +857,7 @@ void MusicXmlInput::ReadMusicXmlAttributes(pugi::xml_node node, Section *section
         pugi::xpath_node clefLine = clef.node().select_single_node("line");
         if (clefSign && clefLine) {
             Clef *meiClef = new Clef();
-            meiClef->SetShape(meiClef->AttClefshape::StrToClefshape(GetContent(clefSign.node())));
+            meiClef->SetShape(meiClef->AttClefshape::StrToClefshape(GetContent(clefSign.node()).c_str()));
             meiClef->SetLine(meiClef->AttClefshape::StrToInt(clefLine.node().text().as_string()));
             // clef octave change
             pugi::xpath_node clefOctaveChange = clef.node().select_single_node("clef-octave-change");
@@ -1326,9 +1321,10 @@ void MusicXmlInput::ReadMusicXmlNote(pugi::xml_node node, Measure *measure, int
             tuplet->SetNumbase(atoi(GetContent(normalNotes.node()).c_str()));
         }
         if (!GetAttributeValue(tupletStart.node(), "placement").empty()) {
-            tuplet->SetNumPlace(tuplet->AttTupletVis::StrToPlace(GetAttributeValue(tupletStart.node(), "placement")));
+            tuplet->SetNumPlace(
+                tuplet->AttTupletVis::StrToPlace(GetAttributeValue(tupletStart.node(), "placement").c_str()));
             tuplet->SetBracketPlace(
-                tuplet->AttTupletVis::StrToPlace(GetAttributeValue(tupletStart.node(), "placement")));
+                tuplet->AttTupletVis::StrToPlace(GetAttributeValue(tupletStart.node(), "placement").c_str()));
         }
         tuplet->SetNumFormat(ConvertTupletNumberValue(GetAttributeValue(tupletStart.node(), "show-number")));
         if (HasAttributeWithValue(tupletStart.node(), "show-number", "none")) tuplet->SetNumVisible(BOOLEAN_false);
@@ -1439,7 +1435,8 @@ void MusicXmlInput::ReadMusicXmlNote(pugi::xml_node node, Measure *measure, int
                 if (dots > 0) chord->SetDots(dots);
                 chord->SetStemDir(stemDir);
                 if (cue) chord->SetSize(SIZE_cue);
-                if (tremSlashNum != "0") chord->SetStemMod(chord->AttStems::StrToStemmodifier(tremSlashNum + "slash"));
+                if (tremSlashNum != "0")
+                    chord->SetStemMod(chord->AttStems::StrToStemmodifier((tremSlashNum + "slash").c_str()));
                 AddLayerElement(layer, chord);
                 m_elementStack.push_back(chord);
                 element = chord;
@@ -1468,7 +1465,8 @@ void MusicXmlInput::ReadMusicXmlNote(pugi::xml_node node, Measure *measure, int
             if (dots > 0) note->SetDots(dots);
             note->SetStemDir(stemDir);
             if (cue) note->SetSize(SIZE_cue);
-            if (tremSlashNum != "0") note->SetStemMod(note->AttStems::StrToStemmodifier(tremSlashNum + "slash"));
+            if (tremSlashNum != "0")
+                note->SetStemMod(note->AttStems::StrToStemmodifier((tremSlashNum + "slash").c_str()));
         }
 
         // verse / syl
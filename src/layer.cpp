@@ -192,28 +192,28 @@ int Layer::GetClefLocOffset(LayerElement *test)
 
 Clef *Layer::GetCurrentClef() const
 {
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(staff && staff->m_drawingStaffDef && staff->m_drawingStaffDef->GetCurrentClef());
     return staff->m_drawingStaffDef->GetCurrentClef();
 }
 
 KeySig *Layer::GetCurrentKeySig() const
 {
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(staff && staff->m_drawingStaffDef);
     return staff->m_drawingStaffDef->GetCurrentKeySig();
 }
 
 Mensur *Layer::GetCurrentMensur() const
 {
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(staff && staff->m_drawingStaffDef);
     return staff->m_drawingStaffDef->GetCurrentMensur();
 }
 
 MeterSig *Layer::GetCurrentMeterSig() const
 {
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(staff && staff->m_drawingStaffDef);
     return staff->m_drawingStaffDef->GetCurrentMeterSig();
 }
@@ -230,19 +230,19 @@ void Layer::SetDrawingStaffDefValues(StaffDef *currentStaffDef)
 
     if (currentStaffDef->DrawClef()) {
         this->m_staffDefClef = new Clef(*currentStaffDef->GetCurrentClef());
-        this->m_staffDefClef->SetParent(this);
+        this->m_staffDefClef->SetMemberParent(this);
     }
     if (currentStaffDef->DrawKeySig()) {
         this->m_staffDefKeySig = new KeySig(*currentStaffDef->GetCurrentKeySig());
-        this->m_staffDefKeySig->SetParent(this);
+        this->m_staffDefKeySig->SetMemberParent(this);
     }
     if (currentStaffDef->DrawMensur()) {
         this->m_staffDefMensur = new Mensur(*currentStaffDef->GetCurrentMensur());
-        this->m_staffDefMensur->SetParent(this);
+        this->m_staffDefMensur->SetMemberParent(this);
     }
     if (currentStaffDef->DrawMeterSig()) {
         this->m_staffDefMeterSig = new MeterSig(*currentStaffDef->GetCurrentMeterSig());
-        this->m_staffDefMeterSig->SetParent(this);
+        this->m_staffDefMeterSig->SetMemberParent(this);
     }
 
     // Don't draw on the next one
@@ -261,20 +261,20 @@ void Layer::SetDrawingCautionValues(StaffDef *currentStaffDef)
 
     if (currentStaffDef->DrawClef()) {
         this->m_cautionStaffDefClef = new Clef(*currentStaffDef->GetCurrentClef());
-        this->m_cautionStaffDefClef->SetParent(this);
+        this->m_cautionStaffDefClef->SetMemberParent(this);
     }
     // special case - see above
     if (currentStaffDef->DrawKeySig()) {
         this->m_cautionStaffDefKeySig = new KeySig(*currentStaffDef->GetCurrentKeySig());
-        this->m_cautionStaffDefKeySig->SetParent(this);
+        this->m_cautionStaffDefKeySig->SetMemberParent(this);
     }
     if (currentStaffDef->DrawMensur()) {
         this->m_cautionStaffDefMensur = new Mensur(*currentStaffDef->GetCurrentMensur());
-        this->m_cautionStaffDefMensur->SetParent(this);
+        this->m_cautionStaffDefMensur->SetMemberParent(this);
     }
     if (currentStaffDef->DrawMeterSig()) {
         this->m_cautionStaffDefMeterSig = new MeterSig(*currentStaffDef->GetCurrentMeterSig());
-        this->m_cautionStaffDefMeterSig->SetParent(this);
+        this->m_cautionStaffDefMeterSig->SetMemberParent(this);
     }
 
     // Don't draw on the next one
@@ -297,7 +297,7 @@ int Layer::UnsetCurrentScoreDef(FunctorParams *functorParams)
 
 int Layer::AlignHorizontally(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     params->m_currentMensur = GetCurrentMensur();
@@ -335,7 +335,7 @@ int Layer::AlignHorizontally(FunctorParams *functorParams)
 
 int Layer::AlignHorizontallyEnd(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     params->m_scoreDefRole = CAUTIONARY_SCOREDEF;
@@ -370,22 +370,23 @@ int Layer::AlignHorizontallyEnd(FunctorParams *functorParams)
 
 int Layer::PrepareProcessingLists(FunctorParams *functorParams)
 {
-    PrepareProcessingListsParams *params = dynamic_cast<PrepareProcessingListsParams *>(functorParams);
+    PrepareProcessingListsParams *params = vrv_cast<PrepareProcessingListsParams *>(functorParams);
     assert(params);
 
     // Alternate solution with StaffN_LayerN_VerseN_t
     // StaffN_LayerN_VerseN_t *tree = static_cast<StaffN_LayerN_VerseN_t*>((*params).at(0));
 
-    Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(staff);
     params->m_layerTree.child[staff->GetN()].child[this->GetN()];
+    params->m_layers[{ staff->GetN(), this->GetN() }].push_back(this);
 
     return FUNCTOR_CONTINUE;
 }
 
 int Layer::PrepareRpt(FunctorParams *functorParams)
 {
-    PrepareRptParams *params = dynamic_cast<PrepareRptParams *>(functorParams);
+    PrepareRptParams *params = vrv_cast<PrepareRptParams *>(functorParams);
     assert(params);
 
     // If we have encountered a mRpt before and there is none is this layer, reset it to NULL
@@ -397,8 +398,7 @@ int Layer::PrepareRpt(FunctorParams *functorParams)
 
 int Layer::CalcStem(FunctorParams *functorParams)
 {
-    CalcStemParams *params = dynamic_cast<CalcStemParams *>(functorParams);
-    assert(params);
+    assert(dynamic_cast<CalcStemParams *>(functorParams));
 
     // setting the layer stem direction
     if (this->GetParent()->GetChildCount(LAYER) > 1) {
@@ -415,7 +415,7 @@ int Layer::CalcStem(FunctorParams *functorParams)
 
 int Layer::AdjustSylSpacing(FunctorParams *functorParams)
 {
-    AdjustSylSpacingParams *params = dynamic_cast<AdjustSylSpacingParams *>(functorParams);
+    AdjustSylSpacingParams *params = vrv_cast<AdjustSylSpacingParams *>(functorParams);
     assert(params);
 
     // reset it
@@ -427,7 +427,7 @@ int Layer::AdjustSylSpacing(FunctorParams *functorParams)
 
 int Layer::CalcMaxMeasureDuration(FunctorParams *functorParams)
 {
-    CalcMaxMeasureDurationParams *params = dynamic_cast<CalcMaxMeasureDurationParams *>(functorParams);
+    CalcMaxMeasureDurationParams *params = vrv_cast<CalcMaxMeasureDurationParams *>(functorParams);
     assert(params);
 
     // reset it
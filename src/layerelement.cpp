@@ -65,7 +65,7 @@ LayerElement::LayerElement() : Object("le-"), AttCommon(), AttCommonPart(), AttT
     Reset();
 }
 
-LayerElement::LayerElement(std::string classid) : Object(classid), AttCommon(), AttTyped()
+LayerElement::LayerElement(const char *classid) : Object(classid), AttCommon(), AttTyped()
 {
     RegisterAttClass(ATT_COMMON);
     RegisterAttClass(ATT_COMMONPART);
@@ -338,7 +338,7 @@ void LayerElement::CenterDrawingX()
 
     SetDrawingXRel(0);
 
-    Measure *measure = dynamic_cast<Measure *>(this->GetFirstParent(MEASURE));
+    Measure *measure = vrv_cast<Measure *>(this->GetFirstParent(MEASURE));
     assert(measure);
 
     SetDrawingXRel(measure->GetInnerCenterX() - this->GetDrawingX());
@@ -494,7 +494,7 @@ int LayerElement::ResetVerticalAlignment(FunctorParams *functorParams)
 
 int LayerElement::ApplyPPUFactor(FunctorParams *functorParams)
 {
-    ApplyPPUFactorParams *params = dynamic_cast<ApplyPPUFactorParams *>(functorParams);
+    ApplyPPUFactorParams *params = vrv_cast<ApplyPPUFactorParams *>(functorParams);
     assert(params);
 
     if (m_xAbs != VRV_UNSET) m_xAbs /= params->m_page->GetPPUFactor();
@@ -504,7 +504,7 @@ int LayerElement::ApplyPPUFactor(FunctorParams *functorParams)
 
 int LayerElement::AlignHorizontally(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     assert(!m_alignment);
@@ -599,13 +599,13 @@ int LayerElement::AlignHorizontally(FunctorParams *functorParams)
     }
     else if (this->Is({ ARTIC, ARTIC_PART, SYL })) {
         // Refer to the note parent
-        Note *note = dynamic_cast<Note *>(this->GetFirstParent(NOTE));
+        Note *note = vrv_cast<Note *>(this->GetFirstParent(NOTE));
         assert(note);
         m_alignment = note->GetAlignment();
     }
     else if (this->Is(VERSE)) {
         // Idem
-        Note *note = dynamic_cast<Note *>(this->GetFirstParent(NOTE));
+        Note *note = vrv_cast<Note *>(this->GetFirstParent(NOTE));
         assert(note);
         m_alignment = note->GetAlignment();
     }
@@ -658,13 +658,13 @@ int LayerElement::AlignHorizontally(FunctorParams *functorParams)
 
 int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
 {
-    SetAlignmentPitchPosParams *params = dynamic_cast<SetAlignmentPitchPosParams *>(functorParams);
+    SetAlignmentPitchPosParams *params = vrv_cast<SetAlignmentPitchPosParams *>(functorParams);
     assert(params);
 
     LayerElement *layerElementY = this;
-    Staff *staffY = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *staffY = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(staffY);
-    Layer *layerY = dynamic_cast<Layer *>(this->GetFirstParent(LAYER));
+    Layer *layerY = vrv_cast<Layer *>(this->GetFirstParent(LAYER));
     assert(layerY);
 
     if (m_crossStaff && m_crossLayer) {
@@ -677,7 +677,7 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
     if (this->Is(ACCID)) {
         Accid *accid = dynamic_cast<Accid *>(this);
         assert(accid);
-        Note *note = dynamic_cast<Note *>(this->GetFirstParent(NOTE));
+        Note *note = vrv_cast<Note *>(this->GetFirstParent(NOTE));
         // We should probably also avoid to add editorial accidentals to the accid space
         // However, since they are placed above by View::DrawNote it works without avoiding it
         if (note) {
@@ -738,7 +738,7 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
         // Automatically calculate rest position
         else {
             // set default location to the middle of the staff
-            Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+            Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
             assert(staff);
             loc = staff->m_drawingLines - 1;
             bool hasMultipleLayer = (staffY->GetChildCount(LAYER) > 1);
@@ -773,7 +773,7 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
         // Automatically calculate rest position
         else {
             // set default location to the middle of the staff
-            Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+            Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
             assert(staff);
             loc = staff->m_drawingLines - 1;
             bool hasMultipleLayer = (staffY->GetChildCount(LAYER) > 1);
@@ -796,7 +796,7 @@ int LayerElement::SetAlignmentPitchPos(FunctorParams *functorParams)
 
 int LayerElement::AdjustLayers(FunctorParams *functorParams)
 {
-    AdjustLayersParams *params = dynamic_cast<AdjustLayersParams *>(functorParams);
+    AdjustLayersParams *params = vrv_cast<AdjustLayersParams *>(functorParams);
     assert(params);
 
     // Check if we are starting a new layer content - if yes copy the current elements to previous
@@ -830,7 +830,7 @@ int LayerElement::AdjustLayers(FunctorParams *functorParams)
     // Eventually we also want to have stem for overlapping voices
     if (this->Is({ NOTE, DOTS })) {
 
-        Staff *staff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+        Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
         assert(staff);
 
         std::vector<LayerElement *>::iterator iter;
@@ -882,7 +882,7 @@ int LayerElement::AdjustLayers(FunctorParams *functorParams)
 
 int LayerElement::AdjustGraceXPos(FunctorParams *functorParams)
 {
-    AdjustGraceXPosParams *params = dynamic_cast<AdjustGraceXPosParams *>(functorParams);
+    AdjustGraceXPosParams *params = vrv_cast<AdjustGraceXPosParams *>(functorParams);
     assert(params);
 
     if (params->m_graceCumulatedXShift == VRV_UNSET) params->m_graceCumulatedXShift = 0;
@@ -919,7 +919,7 @@ int LayerElement::AdjustGraceXPos(FunctorParams *functorParams)
 
 int LayerElement::AdjustXPos(FunctorParams *functorParams)
 {
-    AdjustXPosParams *params = dynamic_cast<AdjustXPosParams *>(functorParams);
+    AdjustXPosParams *params = vrv_cast<AdjustXPosParams *>(functorParams);
     assert(params);
 
     // we should have processed aligned before
@@ -1033,7 +1033,7 @@ int LayerElement::PrepareDrawingCueSize(FunctorParams *functorParams)
 
 int LayerElement::PrepareCrossStaff(FunctorParams *functorParams)
 {
-    PrepareCrossStaffParams *params = dynamic_cast<PrepareCrossStaffParams *>(functorParams);
+    PrepareCrossStaffParams *params = vrv_cast<PrepareCrossStaffParams *>(functorParams);
     assert(params);
 
     m_crossStaff = NULL;
@@ -1063,7 +1063,7 @@ int LayerElement::PrepareCrossStaff(FunctorParams *functorParams)
         return FUNCTOR_CONTINUE;
     }
 
-    Staff *parentStaff = dynamic_cast<Staff *>(this->GetFirstParent(STAFF));
+    Staff *parentStaff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
     assert(parentStaff);
     // Check if we have a cross-staff to itself...
     if (m_crossStaff == parentStaff) {
@@ -1073,7 +1073,7 @@ int LayerElement::PrepareCrossStaff(FunctorParams *functorParams)
         return FUNCTOR_CONTINUE;
     }
 
-    Layer *parentLayer = dynamic_cast<Layer *>(this->GetFirstParent(LAYER));
+    Layer *parentLayer = vrv_cast<Layer *>(this->GetFirstParent(LAYER));
     assert(parentLayer);
     // Now try to get the corresponding layer - for now look for the same layer @n
     int layerN = parentLayer->GetN();
@@ -1100,7 +1100,7 @@ int LayerElement::PrepareCrossStaff(FunctorParams *functorParams)
 
 int LayerElement::PrepareCrossStaffEnd(FunctorParams *functorParams)
 {
-    PrepareCrossStaffParams *params = dynamic_cast<PrepareCrossStaffParams *>(functorParams);
+    PrepareCrossStaffParams *params = vrv_cast<PrepareCrossStaffParams *>(functorParams);
     assert(params);
 
     DurationInterface *durElement = this->GetDurationInterface();
@@ -1119,43 +1119,43 @@ int LayerElement::PrepareCrossStaffEnd(FunctorParams *functorParams)
 
 int LayerElement::PrepareTimePointing(FunctorParams *functorParams)
 {
-    PrepareTimePointingParams *params = dynamic_cast<PrepareTimePointingParams *>(functorParams);
+    PrepareTimePointingParams *params = vrv_cast<PrepareTimePointingParams *>(functorParams);
     assert(params);
 
     // Do not look for tstamp pointing to these
     if (this->Is({ ARTIC, ARTIC_PART, BEAM, FLAG, TUPLET, STEM, VERSE })) return FUNCTOR_CONTINUE;
 
-    ArrayOfPointingInterClassIdPairs::iterator iter = params->m_timePointingInterfaces.begin();
-    while (iter != params->m_timePointingInterfaces.end()) {
-        if (iter->first->SetStartOnly(this)) {
-            // We have both the start and the end that are matched
-            iter = params->m_timePointingInterfaces.erase(iter);
-        }
-        else {
-            iter++;
-        }
+    // Match the elements waiting for this one
+    MapOfPointingInterClassIdPairsByUuid::iterator pending = params->m_timePointingInterfaces.find(this->GetUuid());
+    if (pending == params->m_timePointingInterfaces.end()) return FUNCTOR_CONTINUE;
+    for (auto &interface : pending->second) {
+        interface.first->SetStartOnly(this);
     }
+    params->m_timePointingInterfaces.erase(pending);
 
     return FUNCTOR_CONTINUE;
 }
 
 int LayerElement::PrepareTimeSpanning(FunctorParams *functorParams)
 {
-    PrepareTimeSpanningParams *params = dynamic_cast<PrepareTimeSpanningParams *>(functorParams);
+    PrepareTimeSpanningParams *params = vrv_cast<PrepareTimeSpanningParams *>(functorParams);
     assert(params);
 
     // Do not look for tstamp pointing to these
     if (this->Is({ ARTIC, ARTIC_PART, BEAM, FLAG, TUPLET, STEM, VERSE })) return FUNCTOR_CONTINUE;
 
-    ArrayOfSpanningInterClassIdPairs::iterator iter = params->m_timeSpanningInterfaces.begin();
-    while (iter != params->m_timeSpanningInterfaces.end()) {
-        if (iter->first->SetStartAndEnd(this)) {
-            // We have both the start and the end that are matched
-            iter = params->m_timeSpanningInterfaces.erase(iter);
-        }
-        else {
-            iter++;
+    // Keep it for the elements pointing to it that have not been processed yet
+    params->m_layerElements[this->GetUuid()] = this;
+
+    // Match the elements waiting for this one
+    for (MapOfSpanningInterClassIdPairsByUuid *pendingInterfaces :
+        { &params->m_pendingInterfaces, &params->m_measurePendingInterfaces }) {
+        MapOfSpanningInterClassIdPairsByUuid::iterator pending = pendingInterfaces->find(this->GetUuid());
+        if (pending == pendingInterfaces->end()) continue;
+        for (auto &interface : pending->second) {
+            interface.first->SetStartAndEnd(this);
         }
+        pendingInterfaces->erase(pending);
     }
 
     return FUNCTOR_CONTINUE;
@@ -1163,7 +1163,7 @@ int LayerElement::PrepareTimeSpanning(FunctorParams *functorParams)
 
 int LayerElement::FindTimeSpanningLayerElements(FunctorParams *functorParams)
 {
-    FindTimeSpanningLayerElementsParams *params = dynamic_cast<FindTimeSpanningLayerElementsParams *>(functorParams);
+    FindTimeSpanningLayerElementsParams *params = vrv_cast<FindTimeSpanningLayerElementsParams *>(functorParams);
     assert(params);
 
     if ((this->GetDrawingX() > params->m_minPos) && (this->GetDrawingX() < params->m_maxPos)) {
@@ -1176,9 +1176,29 @@ int LayerElement::FindTimeSpanningLayerElements(FunctorParams *functorParams)
     return FUNCTOR_CONTINUE;
 }
 
+int LayerElement::IndexLayerElements(FunctorParams *functorParams)
+{
+    IndexLayerElementsParams *params = vrv_cast<IndexLayerElementsParams *>(functorParams);
+    assert(params);
+
+    if (!params->m_layerElementXs) return FUNCTOR_CONTINUE;
+
+    Staff *staff = vrv_cast<Staff *>(this->GetFirstParent(STAFF));
+    Layer *layer = vrv_cast<Layer *>(this->GetFirstParent(LAYER));
+    if (!staff || !layer) return FUNCTOR_CONTINUE;
+
+    // Keep the running maximum since the x positions are not always increasing (e.g., notes in chords)
+    ArrayOfLayerElementIntPairs *elements = &(*params->m_layerElementXs)[std::make_pair(staff->GetN(), layer->GetN())];
+    int maxX = this->GetDrawingX();
+    if (!elements->empty()) maxX = std::max(maxX, elements->back().second);
+    elements->push_back(std::make_pair(this, maxX));
+
+    return FUNCTOR_CONTINUE;
+}
+
 int LayerElement::GenerateMIDI(FunctorParams *functorParams)
 {
-    GenerateMIDIParams *params = dynamic_cast<GenerateMIDIParams *>(functorParams);
+    GenerateMIDIParams *params = vrv_cast<GenerateMIDIParams *>(functorParams);
     assert(params);
 
     // Here we need to check if the LayerElement has a duration, otherwise we can continue
@@ -1289,7 +1309,7 @@ int LayerElement::GenerateMIDI(FunctorParams *functorParams)
 
 int LayerElement::GenerateMIDIEnd(FunctorParams *functorParams)
 {
-    GenerateMIDIParams *params = dynamic_cast<GenerateMIDIParams *>(functorParams);
+    GenerateMIDIParams *params = vrv_cast<GenerateMIDIParams *>(functorParams);
     assert(params);
 
     if (this->Is(CHORD)) {
@@ -1305,7 +1325,7 @@ int LayerElement::GenerateMIDIEnd(FunctorParams *functorParams)
 
 int LayerElement::CalcMaxMeasureDuration(FunctorParams *functorParams)
 {
-    CalcMaxMeasureDurationParams *params = dynamic_cast<CalcMaxMeasureDurationParams *>(functorParams);
+    CalcMaxMeasureDurationParams *params = vrv_cast<CalcMaxMeasureDurationParams *>(functorParams);
     assert(params);
 
     // Here we need to check if the LayerElement as a duration, otherwise we can continue
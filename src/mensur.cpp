@@ -56,7 +56,7 @@ void Mensur::Init()
     RegisterAttClass(ATT_DURATIONRATIO);
     RegisterAttClass(ATT_MENSURALSHARED);
     RegisterAttClass(ATT_MENSURLOG);
-    RegisterAttClass(ATT_METERSIGVIS);
+    RegisterAttClass(ATT_MENSURVIS);
     RegisterAttClass(ATT_RELATIVESIZE);
     RegisterAttClass(ATT_SLASHCOUNT);
 
@@ -10,6 +10,8 @@
 //----------------------------------------------------------------------------
 
 #include <assert.h>
+#include <atomic>
+#include <climits>
 #include <iostream>
 #include <math.h>
 #include <sstream>
@@ -45,7 +47,11 @@ namespace vrv {
 // Object
 //----------------------------------------------------------------------------
 
-unsigned long Object::s_objectCounter = 0;
+std::atomic<unsigned long> Object::s_objectCounter(0);
+
+// The seed for generating the uuids and the counter of the sequence of each thread
+static std::atomic<unsigned int> s_uuidSeed(0);
+static thread_local unsigned int s_uuidCounter = 0;
 
 Object::Object() : BoundingBox()
 {
@@ -55,7 +61,7 @@ Object::Object() : BoundingBox()
     }
 }
 
-Object::Object(std::string classid) : BoundingBox()
+Object::Object(const char *classid) : BoundingBox()
 {
     Init(classid);
     if (s_objectCounter++ == 0) {
@@ -75,9 +81,12 @@ Object::Object(const Object &object) : BoundingBox(object)
     ClearChildren();
     ResetBoundingBox(); // It does not make sense to keep the values of the BBox
     m_parent = NULL;
+    m_uuidIndexDoc = NULL;
     m_classid = object.m_classid;
     m_isReferencObject = object.m_isReferencObject;
-    m_uuid = object.m_uuid; // for now copy the uuid - to be decided
+    // for now copy the uuid - to be decided
+    m_uuid = object.m_uuid;
+    m_uuidNumber = object.m_uuidNumber;
     m_isModified = true;
     int i;
     for (i = 0; i < (int)object.m_children.size(); i++) {
@@ -98,7 +107,7 @@ Object &Object::operator=(const Object &object)
         m_parent = NULL;
         m_classid = object.m_classid;
         m_isReferencObject = object.m_isReferencObject;
-        m_uuid = object.m_uuid; // for now copy the uuid - to be decided
+        this->StoreUuid(object.m_uuid, object.m_uuidNumber); // for now copy the uuid - to be decided
         m_isModified = true;
 
         int i;
@@ -116,11 +125,13 @@ Object &Object::operator=(const Object &object)
 Object::~Object()
 {
     ClearChildren();
+    this->RemoveFromUuidIndex();
 }
 
-void Object::Init(std::string classid)
+void Object::Init(const char *classid)
 {
     m_parent = NULL;
+    m_uuidIndexDoc = NULL;
     m_isAttribute = false;
     m_isModified = true;
     m_classid = classid;
@@ -200,11 +211,32 @@ void Object::MoveItselfTo(Object *targetParent)
     targetParent->AddChild(relinquishedObject);
 }
 
+std::string Object::GetUuid() const
+{
+    if (!m_uuid.empty()) return m_uuid;
+
+    return Object::UuidNumberToStr(m_classid, m_uuidNumber);
+}
+
 void Object::SetUuid(std::string uuid)
 {
-    m_uuid = uuid;
+    this->StoreUuid(uuid, m_uuidNumber);
 };
 
+void Object::StoreUuid(const std::string &uuid, unsigned int uuidNumber)
+{
+    if (m_uuidIndexDoc) {
+        Doc *doc = m_uuidIndexDoc;
+        this->RemoveFromUuidIndex();
+        m_uuid = uuid;
+        m_uuidNumber = uuidNumber;
+        this->AddToUuidIndex(doc);
+        return;
+    }
+    m_uuid = uuid;
+    m_uuidNumber = uuidNumber;
+}
+
 void Object::ClearChildren()
 {
     if (m_isReferencObject) {
@@ -350,6 +382,12 @@ void Object::ClearRelinquishedChildren()
 
 Object *Object::FindChildByUuid(std::string uuid, int deepness, bool direction)
 {
+    // Only one object is indexed by uuid, so we still look for it when the one indexed is not a child
+    if (m_uuidIndexDoc && (deepness == UNLIMITED_DEPTH)) {
+        Object *object = m_uuidIndexDoc->GetUuidIndexed(uuid);
+        if (object && object->IsAttachedTo(this)) return object;
+    }
+
     Functor findByUuid(&Object::FindByUuid);
     FindByUuidParams findbyUuidParams;
     findbyUuidParams.m_uuid = uuid;
@@ -415,12 +453,92 @@ bool Object::DeleteChild(Object *child)
 
 void Object::GenerateUuid()
 {
-    int nr = std::rand();
+    this->StoreUuid("", Object::GenerateUuidNumber());
+}
+
+unsigned int Object::GenerateUuidNumber()
+{
+    // Mix the counter with a bijective hash, which makes the numbers look random but never repeat them for a seed
+    unsigned int number = s_uuidCounter++ + s_uuidSeed * 0x9e3779b9;
+    number ^= number >> 16;
+    number *= 0x7feb352d;
+    number ^= number >> 15;
+    number *= 0x846ca68b;
+    number ^= number >> 16;
+    return number;
+}
+
+std::string Object::GenerateUuidStr(const std::string &prefix)
+{
+    return Object::UuidNumberToStr(prefix.c_str(), Object::GenerateUuidNumber());
+}
+
+std::string Object::UuidNumberToStr(const char *prefix, unsigned int number)
+{
+    // The prefix followed by the number with 16 digits
     char str[17];
-    // I do not want to use a stream for doing this!
-    snprintf(str, 17, "%016d", nr);
+    for (int i = 15; i >= 0; i--) {
+        str[i] = '0' + (number % 10);
+        number /= 10;
+    }
+    str[16] = '\0';
+    return std::string(prefix) + str;
+}
 
-    m_uuid = m_classid + std::string(str);
+bool Object::UuidStrToNumber(const std::string &uuid, unsigned int &number)
+{
+    // The prefix followed by the number with 16 digits
+    if (uuid.size() < 16) return false;
+    unsigned long long value = 0;
+    for (auto c = uuid.end() - 16; c != uuid.end(); ++c) {
+        if ((*c < '0') || (*c > '9')) return false;
+        value = value * 10 + (*c - '0');
+    }
+    if (value > UINT_MAX) return false;
+    number = (unsigned int)value;
+    return true;
+}
+
+bool Object::IsAttachedTo(const Object *ancestor) const
+{
+    const Object *object = this;
+    while (object != ancestor) {
+        Object *parent = object->m_parent;
+        if (!parent) return false;
+        // Children of hidden editorial elements are not processed - see Object::Process
+        if (parent->IsEditorialElement()) {
+            EditorialElement *editorialElement = dynamic_cast<EditorialElement *>(parent);
+            assert(editorialElement);
+            if (editorialElement->m_visibility == Hidden) return false;
+        }
+        object = parent;
+    }
+    return true;
+}
+
+void Object::AddToUuidIndex(Doc *doc)
+{
+    assert(doc);
+
+    if (m_uuidIndexDoc == doc) return;
+    if (m_uuidIndexDoc) this->RemoveFromUuidIndex();
+
+    m_uuidIndexDoc = doc;
+    doc->AddUuidIndexed(this);
+
+    ArrayOfObjects::iterator iter;
+    for (iter = m_children.begin(); iter != m_children.end(); ++iter) {
+        // Relinquished children are not ours anymore
+        if ((*iter)->GetParent() == this) (*iter)->AddToUuidIndex(doc);
+    }
+}
+
+void Object::RemoveFromUuidIndex()
+{
+    if (!m_uuidIndexDoc) return;
+
+    m_uuidIndexDoc->RemoveUuidIndexed(this);
+    m_uuidIndexDoc = NULL;
 }
 
 void Object::ResetUuid()
@@ -430,16 +548,29 @@ void Object::ResetUuid()
 
 void Object::SeedUuid(unsigned int seed)
 {
-    // Init random number generator for uuids
+    // Init the uuid generator, which restarts the sequence
     if (seed == 0) {
-        std::srand((unsigned int)std::time(0));
+        s_uuidSeed = (unsigned int)std::time(0);
     }
     else {
-        std::srand(seed);
+        s_uuidSeed = seed;
     }
+    RestartUuidSequence();
+}
+
+void Object::RestartUuidSequence()
+{
+    s_uuidCounter = 0;
 }
 
 void Object::SetParent(Object *parent)
+{
+    assert(!m_parent);
+    m_parent = parent;
+    if (parent && parent->m_uuidIndexDoc) this->AddToUuidIndex(parent->m_uuidIndexDoc);
+}
+
+void Object::SetMemberParent(Object *parent)
 {
     assert(!m_parent);
     m_parent = parent;
@@ -570,7 +701,7 @@ void Object::Process(Functor *functor, FunctorParams *functorParams, Functor *en
         }
     }
 
-    functor->Call(this, functorParams);
+    if (functor->IsCalledFor(this)) functor->Call(this, functorParams);
 
     // do not go any deeper in this case
     if (functor->m_returnCode == FUNCTOR_SIBLINGS) {
@@ -587,19 +718,8 @@ void Object::Process(Functor *functor, FunctorParams *functorParams, Functor *en
     }
     deepness--;
 
-    if (processChildren) {
-        ArrayOfObjects::iterator iter;
-        // We need a pointer to the array for the option to work on a reversed copy
-        ArrayOfObjects *children = &this->m_children;
-        ArrayOfObjects reversed;
-        // For processing backwards, we operated on a copied reversed version
-        // Since we hold pointers, only addresses are copied
-        if (direction == BACKWARD) {
-            reversed = (*children);
-            std::reverse(reversed.begin(), reversed.end());
-            children = &reversed;
-        }
-        for (iter = children->begin(); iter != children->end(); ++iter) {
+    if (processChildren && functor->IsContainer(this)) {
+        auto processChild = [&](Object *child) {
             if (filters && !filters->empty()) {
                 bool hasAttComparison = false;
                 // first we look if there is a comparison object for the object type (e.g., a Staff)
@@ -607,29 +727,42 @@ void Object::Process(Functor *functor, FunctorParams *functorParams, Functor *en
                 for (attComparisonIter = filters->begin(); attComparisonIter != filters->end(); attComparisonIter++) {
                     // if yes, we will use it (*attComparisonIter) for evaluating if the object matches
                     // the attribute (see below)
-                    Object *o = *iter;
-                    if (o->GetClassId() == (*attComparisonIter)->GetType()) {
+                    if (child->GetClassId() == (*attComparisonIter)->GetType()) {
                         hasAttComparison = true;
                         break;
                     }
                 }
                 if (hasAttComparison) {
                     // use the operator of the AttComparison object to evaluate the attribute
-                    if ((**attComparisonIter)(*iter)) {
+                    if ((**attComparisonIter)(child)) {
                         // the attribute value matches, process the object
-                        // LogDebug("%s ", (*iter)->GetClassName().c_str());
-                        (*iter)->Process(functor, functorParams, endFunctor, filters, deepness, direction);
+                        // LogDebug("%s ", child->GetClassName().c_str());
+                        child->Process(functor, functorParams, endFunctor, filters, deepness, direction);
                     }
                     // continue to the next child
-                    continue;
+                    return;
                 }
             }
             // we will end here if there is no filter at all or for the current child type
-            (*iter)->Process(functor, functorParams, endFunctor, filters, deepness, direction);
+            child->Process(functor, functorParams, endFunctor, filters, deepness, direction);
+        };
+
+        // For processing backwards, we iterate in reverse order without copying the children
+        if (direction == BACKWARD) {
+            ArrayOfObjects::reverse_iterator riter;
+            for (riter = m_children.rbegin(); riter != m_children.rend(); ++riter) {
+                processChild(*riter);
+            }
+        }
+        else {
+            ArrayOfObjects::iterator iter;
+            for (iter = m_children.begin(); iter != m_children.end(); ++iter) {
+                processChild(*iter);
+            }
         }
     }
 
-    if (endFunctor) {
+    if (endFunctor && endFunctor->IsCalledFor(this)) {
         endFunctor->Call(this, functorParams);
     }
 }
@@ -787,10 +920,14 @@ void TextListInterface::FilterList(ListOfObjects *childList)
 // Functor
 //----------------------------------------------------------------------------
 
+const std::vector<ClassId> Functor::s_layerElementContainerIds
+    = { DOC, SCORE, PAGE, SYSTEM, SYSTEM_ELEMENT, MEASURE, STAFF, LAYER, LAYER_ELEMENT };
+
 Functor::Functor()
 {
     m_returnCode = FUNCTOR_CONTINUE;
     m_visibleOnly = true;
+    m_hasClassIds = false;
     obj_fpt = NULL;
 }
 
@@ -798,6 +935,7 @@ Functor::Functor(int (Object::*_obj_fpt)(FunctorParams *))
 {
     m_returnCode = FUNCTOR_CONTINUE;
     m_visibleOnly = true;
+    m_hasClassIds = false;
     obj_fpt = _obj_fpt;
 }
 
@@ -807,13 +945,40 @@ void Functor::Call(Object *ptr, FunctorParams *functorParams)
     m_returnCode = (*ptr.*obj_fpt)(functorParams);
 }
 
+void Functor::SetClassIds(const std::vector<ClassId> &classIds, const std::vector<ClassId> &containerIds)
+{
+    // Expand the base ids to their range
+    auto setClassIds = [](std::bitset<UNSPECIFIED + 1> &bits, const std::vector<ClassId> &ids) {
+        for (auto id : ids) {
+            ClassId max = id;
+            switch (id) {
+                case EDITORIAL_ELEMENT: max = EDITORIAL_ELEMENT_max; break;
+                case SYSTEM_ELEMENT: max = SYSTEM_ELEMENT_max; break;
+                case CONTROL_ELEMENT: max = CONTROL_ELEMENT_max; break;
+                case LAYER_ELEMENT: max = LAYER_ELEMENT_max; break;
+                case SCOREDEF_ELEMENT: max = SCOREDEF_ELEMENT_max; break;
+                case TEXT_ELEMENT: max = TEXT_ELEMENT_max; break;
+                default: break;
+            }
+            for (int i = id; i <= max; i++) bits.set(i);
+        }
+    };
+
+    m_classIds.reset();
+    setClassIds(m_classIds, classIds);
+    m_containerIds.reset();
+    setClassIds(m_containerIds, containerIds);
+    setClassIds(m_containerIds, { EDITORIAL_ELEMENT });
+    m_hasClassIds = true;
+}
+
 //----------------------------------------------------------------------------
 // Object functor methods
 //----------------------------------------------------------------------------
 
 int Object::AddLayerElementToFlatList(FunctorParams *functorParams)
 {
-    AddLayerElementToFlatListParams *params = dynamic_cast<AddLayerElementToFlatListParams *>(functorParams);
+    AddLayerElementToFlatListParams *params = vrv_cast<AddLayerElementToFlatListParams *>(functorParams);
     assert(params);
 
     params->m_flatList->push_back(this);
@@ -824,7 +989,7 @@ int Object::AddLayerElementToFlatList(FunctorParams *functorParams)
 
 int Object::FindByUuid(FunctorParams *functorParams)
 {
-    FindByUuidParams *params = dynamic_cast<FindByUuidParams *>(functorParams);
+    FindByUuidParams *params = vrv_cast<FindByUuidParams *>(functorParams);
     assert(params);
 
     if (params->m_element) {
@@ -843,7 +1008,7 @@ int Object::FindByUuid(FunctorParams *functorParams)
 
 int Object::FindByAttComparison(FunctorParams *functorParams)
 {
-    FindByAttComparisonParams *params = dynamic_cast<FindByAttComparisonParams *>(functorParams);
+    FindByAttComparisonParams *params = vrv_cast<FindByAttComparisonParams *>(functorParams);
     assert(params);
 
     if (params->m_element) {
@@ -863,7 +1028,7 @@ int Object::FindByAttComparison(FunctorParams *functorParams)
 
 int Object::FindExtremeByAttComparison(FunctorParams *functorParams)
 {
-    FindExtremeByAttComparisonParams *params = dynamic_cast<FindExtremeByAttComparisonParams *>(functorParams);
+    FindExtremeByAttComparisonParams *params = vrv_cast<FindExtremeByAttComparisonParams *>(functorParams);
     assert(params);
 
     // evaluate by applying the AttComparison operator()
@@ -876,7 +1041,7 @@ int Object::FindExtremeByAttComparison(FunctorParams *functorParams)
 
 int Object::FindAllByAttComparison(FunctorParams *functorParams)
 {
-    FindAllByAttComparisonParams *params = dynamic_cast<FindAllByAttComparisonParams *>(functorParams);
+    FindAllByAttComparisonParams *params = vrv_cast<FindAllByAttComparisonParams *>(functorParams);
     assert(params);
 
     // evaluate by applying the AttComparison operator()
@@ -889,7 +1054,7 @@ int Object::FindAllByAttComparison(FunctorParams *functorParams)
 
 int Object::SetCautionaryScoreDef(FunctorParams *functorParams)
 {
-    SetCautionaryScoreDefParams *params = dynamic_cast<SetCautionaryScoreDefParams *>(functorParams);
+    SetCautionaryScoreDefParams *params = vrv_cast<SetCautionaryScoreDefParams *>(functorParams);
     assert(params);
 
     assert(params->m_currentScoreDef);
@@ -915,7 +1080,7 @@ int Object::SetCautionaryScoreDef(FunctorParams *functorParams)
 
 int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 {
-    SetCurrentScoreDefParams *params = dynamic_cast<SetCurrentScoreDefParams *>(functorParams);
+    SetCurrentScoreDefParams *params = vrv_cast<SetCurrentScoreDefParams *>(functorParams);
     assert(params);
 
     assert(params->m_upcomingScoreDef);
@@ -1048,7 +1213,7 @@ int Object::SetCurrentScoreDef(FunctorParams *functorParams)
 
 int Object::GetAlignmentLeftRight(FunctorParams *functorParams)
 {
-    GetAlignmentLeftRightParams *params = dynamic_cast<GetAlignmentLeftRightParams *>(functorParams);
+    GetAlignmentLeftRightParams *params = vrv_cast<GetAlignmentLeftRightParams *>(functorParams);
     assert(params);
 
     if (!this->IsLayerElement()) return FUNCTOR_CONTINUE;
@@ -1066,7 +1231,7 @@ int Object::GetAlignmentLeftRight(FunctorParams *functorParams)
 
 int Object::SetOverflowBBoxes(FunctorParams *functorParams)
 {
-    SetOverflowBBoxesParams *params = dynamic_cast<SetOverflowBBoxesParams *>(functorParams);
+    SetOverflowBBoxesParams *params = vrv_cast<SetOverflowBBoxesParams *>(functorParams);
     assert(params);
 
     // starting a new staff
@@ -1165,7 +1330,7 @@ int Object::SetOverflowBBoxes(FunctorParams *functorParams)
 
 int Object::SetOverflowBBoxesEnd(FunctorParams *functorParams)
 {
-    SetOverflowBBoxesParams *params = dynamic_cast<SetOverflowBBoxesParams *>(functorParams);
+    SetOverflowBBoxesParams *params = vrv_cast<SetOverflowBBoxesParams *>(functorParams);
     assert(params);
 
     // starting new layer
@@ -1191,7 +1356,7 @@ int Object::SetOverflowBBoxesEnd(FunctorParams *functorParams)
 
 int Object::Save(FunctorParams *functorParams)
 {
-    SaveParams *params = dynamic_cast<SaveParams *>(functorParams);
+    SaveParams *params = vrv_cast<SaveParams *>(functorParams);
     assert(params);
 
     if (!params->m_output->WriteObject(this)) {
@@ -1202,7 +1367,7 @@ int Object::Save(FunctorParams *functorParams)
 
 int Object::SaveEnd(FunctorParams *functorParams)
 {
-    SaveParams *params = dynamic_cast<SaveParams *>(functorParams);
+    SaveParams *params = vrv_cast<SaveParams *>(functorParams);
     assert(params);
 
     if (!params->m_output->WriteObjectEnd(this)) {
@@ -125,14 +125,17 @@ void Page::LayOutTranscription(bool force)
 
     CalcStemParams calcStemParams(doc);
     Functor calcStem(&Object::CalcStem);
+    calcStem.SetClassIds({ LAYER, BEAM, CHORD, FTREM, NOTE, STEM }, Functor::s_layerElementContainerIds);
     this->Process(&calcStem, &calcStemParams);
 
     FunctorDocParams calcChordNoteHeadsParams(doc);
     Functor calcChordNoteHeads(&Object::CalcChordNoteHeads);
+    calcChordNoteHeads.SetClassIds({ NOTE }, Functor::s_layerElementContainerIds);
     this->Process(&calcChordNoteHeads, &calcChordNoteHeadsParams);
 
     CalcDotsParams calcDotsParams(doc);
     Functor calcDots(&Object::CalcDots);
+    calcDots.SetClassIds({ CHORD, NOTE, REST }, Functor::s_layerElementContainerIds);
     this->Process(&calcDots, &calcDotsParams);
 
     // Render it for filling the bounding box
@@ -148,6 +151,7 @@ void Page::LayOutTranscription(bool force)
 
     FunctorDocParams calcLegerLinesParams(doc);
     Functor calcLedgerLines(&Object::CalcLedgerLines);
+    calcLedgerLines.SetClassIds({ NOTE }, Functor::s_layerElementContainerIds);
     this->Process(&calcLedgerLines, &calcLegerLinesParams);
 
     m_layoutDone = true;
@@ -200,10 +204,12 @@ void Page::LayOutHorizontally()
             // LogDebug("Longest duration is DUR_* code %d", longestActualDur);
         }
 
-        Functor setAlignmentX(&Object::SetAlignmentXPos);
-        SetAlignmentXPosParams setAlignmentXPosParams(doc, &setAlignmentX);
-        setAlignmentXPosParams.m_longestActualDur = longestActualDur;
-        this->Process(&setAlignmentX, &setAlignmentXPosParams);
+        this->ProcessMeasures(doc, [doc, longestActualDur](const ArrayOfObjects &measures) {
+            Functor setAlignmentX(&Object::SetAlignmentXPos);
+            SetAlignmentXPosParams setAlignmentXPosParams(doc, &setAlignmentX);
+            setAlignmentXPosParams.m_longestActualDur = longestActualDur;
+            for (auto &measure : measures) measure->Process(&setAlignmentX, &setAlignmentXPosParams);
+        });
     }
 
     // Set the pitch / pos alignement
@@ -211,17 +217,24 @@ void Page::LayOutHorizontally()
     Functor setAlignmentPitchPos(&Object::SetAlignmentPitchPos);
     this->Process(&setAlignmentPitchPos, &setAlignmentPitchPosParams);
 
-    CalcStemParams calcStemParams(doc);
-    Functor calcStem(&Object::CalcStem);
-    this->Process(&calcStem, &calcStemParams);
+    this->ProcessMeasures(doc, [doc](const ArrayOfObjects &measures) {
+        CalcStemParams calcStemParams(doc);
+        Functor calcStem(&Object::CalcStem);
+        calcStem.SetClassIds({ LAYER, BEAM, CHORD, FTREM, NOTE, STEM }, Functor::s_layerElementContainerIds);
+        for (auto &measure : measures) measure->Process(&calcStem, &calcStemParams);
+    });
 
     FunctorDocParams calcChordNoteHeadsParams(doc);
     Functor calcChordNoteHeads(&Object::CalcChordNoteHeads);
+    calcChordNoteHeads.SetClassIds({ NOTE }, Functor::s_layerElementContainerIds);
     this->Process(&calcChordNoteHeads, &calcChordNoteHeadsParams);
 
-    CalcDotsParams calcDotsParams(doc);
-    Functor calcDots(&Object::CalcDots);
-    this->Process(&calcDots, &calcDotsParams);
+    this->ProcessMeasures(doc, [doc](const ArrayOfObjects &measures) {
+        CalcDotsParams calcDotsParams(doc);
+        Functor calcDots(&Object::CalcDots);
+        calcDots.SetClassIds({ CHORD, NOTE, REST }, Functor::s_layerElementContainerIds);
+        for (auto &measure : measures) measure->Process(&calcDots, &calcDotsParams);
+    });
 
     // Render it for filling the bounding box
     View view;
@@ -231,31 +244,37 @@ void Page::LayOutHorizontally()
     view.SetPage(this->GetIdx(), false);
     view.DrawCurrentPage(&bBoxDC, false);
 
-    // Adjust the x position of the LayerElement where multiple layer collide
-    // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
-    Functor adjustLayers(&Object::AdjustLayers);
-    AdjustLayersParams adjustLayersParams(doc, &adjustLayers, doc->m_scoreDef.GetStaffNs());
-    this->Process(&adjustLayers, &adjustLayersParams);
-
-    // Adjust the X position of the accidentals, including in chords
-    Functor adjustAccidX(&Object::AdjustAccidX);
-    AdjustAccidXParams adjustAccidXParams(doc, &adjustAccidX);
-    this->Process(&adjustAccidX, &adjustAccidXParams);
-
-    // Adjust the X shift of the Alignment looking at the bounding boxes
-    // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
-    Functor adjustXPos(&Object::AdjustXPos);
-    Functor adjustXPosEnd(&Object::AdjustXPosEnd);
-    AdjustXPosParams adjustXPosParams(doc, &adjustXPos, &adjustXPosEnd, doc->m_scoreDef.GetStaffNs());
-    this->Process(&adjustXPos, &adjustXPosParams, &adjustXPosEnd);
-
-    // Adjust the X shift of the Alignment looking at the bounding boxes
-    // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
-    Functor adjustGraceXPos(&Object::AdjustGraceXPos);
-    Functor adjustGraceXPosEnd(&Object::AdjustGraceXPosEnd);
-    AdjustGraceXPosParams adjustGraceXPosParams(
-        doc, &adjustGraceXPos, &adjustGraceXPosEnd, doc->m_scoreDef.GetStaffNs());
-    this->Process(&adjustGraceXPos, &adjustGraceXPosParams, &adjustGraceXPosEnd);
+    // The adjustments below only look at the aligners and the bounding boxes within each measure
+    // (the staff @n are taken before since the scoreDef list cannot be built concurrently)
+    const std::vector<int> staffNs = doc->m_scoreDef.GetStaffNs();
+    this->ProcessMeasures(doc, [doc, &staffNs](const ArrayOfObjects &measures) {
+        // Adjust the x position of the LayerElement where multiple layer collide
+        // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
+        Functor adjustLayers(&Object::AdjustLayers);
+        AdjustLayersParams adjustLayersParams(doc, &adjustLayers, staffNs);
+        for (auto &measure : measures) measure->Process(&adjustLayers, &adjustLayersParams);
+
+        // Adjust the X position of the accidentals, including in chords
+        Functor adjustAccidX(&Object::AdjustAccidX);
+        AdjustAccidXParams adjustAccidXParams(doc, &adjustAccidX);
+        for (auto &measure : measures) measure->Process(&adjustAccidX, &adjustAccidXParams);
+
+        // Adjust the X shift of the Alignment looking at the bounding boxes
+        // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
+        Functor adjustXPos(&Object::AdjustXPos);
+        Functor adjustXPosEnd(&Object::AdjustXPosEnd);
+        AdjustXPosParams adjustXPosParams(doc, &adjustXPos, &adjustXPosEnd, staffNs);
+        for (auto &measure : measures) measure->Process(&adjustXPos, &adjustXPosParams, &adjustXPosEnd);
+
+        // Adjust the X shift of the Alignment looking at the bounding boxes
+        // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
+        Functor adjustGraceXPos(&Object::AdjustGraceXPos);
+        Functor adjustGraceXPosEnd(&Object::AdjustGraceXPosEnd);
+        AdjustGraceXPosParams adjustGraceXPosParams(doc, &adjustGraceXPos, &adjustGraceXPosEnd, staffNs);
+        for (auto &measure : measures) {
+            measure->Process(&adjustGraceXPos, &adjustGraceXPosParams, &adjustGraceXPosEnd);
+        }
+    });
 
     // We need to populate processing lists for processing the document by Layer (for matching @tie) and
     // by Verse (for matching syllable connectors)
@@ -287,6 +306,7 @@ void Page::LayOutVertically()
 
     FunctorDocParams calcLegerLinesParams(doc);
     Functor calcLedgerLines(&Object::CalcLedgerLines);
+    calcLedgerLines.SetClassIds({ NOTE }, Functor::s_layerElementContainerIds);
     this->Process(&calcLedgerLines, &calcLegerLinesParams);
 
     // Align the content of the page using system aligners
@@ -302,6 +322,11 @@ void Page::LayOutVertically()
     Functor calcArtic(&Object::CalcArtic);
     this->Process(&calcArtic, &calcArticParams);
 
+    // Index the layer elements of each system by x for adjusting the slurs - the horizontal layout is done
+    IndexLayerElementsParams indexLayerElementsParams;
+    Functor indexLayerElements(&Object::IndexLayerElements);
+    this->Process(&indexLayerElements, &indexLayerElementsParams);
+
     // Render it for filling the bounding box
     View view;
     BBoxDeviceContext bBoxDC(&view, 0, 0);
@@ -381,6 +406,7 @@ void Page::LayOutPitchPos()
 
     CalcStemParams calcStemParams(doc);
     Functor calcStem(&Object::CalcStem);
+    calcStem.SetClassIds({ LAYER, BEAM, CHORD, FTREM, NOTE, STEM }, Functor::s_layerElementContainerIds);
     this->Process(&calcStem, &calcStemParams);
 }
 
@@ -450,6 +476,19 @@ void Page::AdjustSylSpacingByVerse(PrepareProcessingListsParams &listsParams, Do
     }
 }
 
+void Page::ProcessMeasures(Doc *doc, const std::function<void(const ArrayOfObjects &measures)> &processMeasures)
+{
+    assert(doc);
+
+    AttComparison matchType(MEASURE);
+    ArrayOfObjects measures;
+    this->FindAllChildByAttComparison(&measures, &matchType);
+
+    ProcessInChunks((int)measures.size(), doc->GetLayoutThreads(), [&measures, &processMeasures](int begin, int end) {
+        processMeasures(ArrayOfObjects(measures.begin() + begin, measures.begin() + end));
+    });
+}
+
 void Page::UpgradePageBasedMEI(Doc *doc)
 {
     // Once we have the GetPPU in Page through LibMEI, call this from Doc::SetDrawingPage and
@@ -461,7 +500,7 @@ void Page::UpgradePageBasedMEI(Doc *doc)
 
 int Page::ApplyPPUFactor(FunctorParams *functorParams)
 {
-    ApplyPPUFactorParams *params = dynamic_cast<ApplyPPUFactorParams *>(functorParams);
+    ApplyPPUFactorParams *params = vrv_cast<ApplyPPUFactorParams *>(functorParams);
     assert(params);
 
     params->m_page = this;
@@ -84,11 +84,11 @@ void Slur::GetCrossStaffOverflows(
 
     // No cross-staff endpoints, check if the slur itself crosses staves
     if (!startStaff) {
-        startStaff = dynamic_cast<Staff *>(this->GetStart()->GetFirstParent(STAFF));
+        startStaff = vrv_cast<Staff *>(this->GetStart()->GetFirstParent(STAFF));
         assert(startStaff);
     }
     if (!endStaff) {
-        endStaff = dynamic_cast<Staff *>(this->GetEnd()->GetFirstParent(STAFF));
+        endStaff = vrv_cast<Staff *>(this->GetEnd()->GetFirstParent(STAFF));
         assert(endStaff);
     }
 
@@ -28,6 +28,8 @@
 
 //----------------------------------------------------------------------------
 
+#include "pugixml.hpp"
+
 namespace vrv {
 
 #define space " "
@@ -41,6 +43,162 @@ static inline double DegToRad(double deg)
 // static inline double RadToDeg(double deg) { return (deg * 180.0) / M_PI; } // unused
 }
 
+//----------------------------------------------------------------------------
+// Serialization helpers
+//----------------------------------------------------------------------------
+
+/**
+ * Append a text with the XML escaping (the same as pugixml) for attribute values or for text content.
+ */
+static void AppendEscaped(std::string &output, const std::string &text, bool attribute)
+{
+    for (unsigned int i = 0; i < text.length(); i++) {
+        unsigned char c = text[i];
+        switch (c) {
+            case '&': output.append("&amp;"); break;
+            case '<': output.append("&lt;"); break;
+            case '>': output.append("&gt;"); break;
+            case '"':
+                if (attribute)
+                    output.append("&quot;");
+                else
+                    output.push_back(c);
+                break;
+            default:
+                // control characters (except tab, and new lines in text content) are written as char references
+                if ((c < 32) && (c != '\t') && (attribute || ((c != '\r') && (c != '\n')))) {
+                    output.append(StringFormat("&#%d;", c));
+                }
+                else {
+                    output.push_back(c);
+                }
+        }
+    }
+}
+
+/**
+ * @name Append an attribute to a serialized element with the value formatted as by pugixml
+ */
+///@{
+static void AppendAttribute(std::string &element, const std::string &name, const std::string &value)
+{
+    element.push_back(' ');
+    element.append(name);
+    element.append("=\"");
+    AppendEscaped(element, value, true);
+    element.push_back('"');
+}
+
+static void AppendAttribute(std::string &element, const std::string &name, int value)
+{
+    AppendAttribute(element, name, StringFormat("%d", value));
+}
+
+static void AppendAttribute(std::string &element, const std::string &name, float value)
+{
+    AppendAttribute(element, name, StringFormat("%.9g", value));
+}
+
+static void AppendAttribute(std::string &element, const std::string &name, double value)
+{
+    AppendAttribute(element, name, StringFormat("%.17g", value));
+}
+///@}
+
+/**
+ * Append a new line with the indentation for the depth
+ */
+static void AppendNewLine(std::string &output, int depth)
+{
+    output.push_back('\n');
+    output.append(depth, '\t');
+}
+
+//----------------------------------------------------------------------------
+// SvgElement
+//----------------------------------------------------------------------------
+
+SvgElement::SvgElement(const std::string &name, SvgElement *parent)
+{
+    m_name = name;
+    m_parent = parent;
+    m_depth = (parent) ? parent->m_depth + 1 : 0;
+    m_streamed = false;
+}
+
+SvgElement::~SvgElement()
+{
+    std::list<SvgChild>::iterator iter;
+    for (iter = m_children.begin(); iter != m_children.end(); iter++) {
+        if (iter->m_element) delete iter->m_element;
+    }
+    for (iter = m_gChildren.begin(); iter != m_gChildren.end(); iter++) {
+        if (iter->m_element) delete iter->m_element;
+    }
+}
+
+SvgElement *SvgElement::AppendElement(const std::string &name)
+{
+    SvgChild child;
+    child.m_element = new SvgElement(name, this);
+    if (name == "g")
+        m_gChildren.push_back(child);
+    else
+        m_children.push_back(child);
+    return child.m_element;
+}
+
+void SvgElement::AppendContent(const std::string &content)
+{
+    SvgChild child;
+    child.m_element = NULL;
+    child.m_content = content;
+    m_children.push_back(child);
+}
+
+void SvgElement::PrependContent(const std::string &content)
+{
+    SvgChild child;
+    child.m_element = NULL;
+    child.m_content = content;
+    m_children.push_front(child);
+}
+
+void SvgElement::Serialize(std::string &output) const
+{
+    output.push_back('<');
+    output.append(m_name);
+    output.append(m_attributes);
+
+    if (m_children.empty() && m_gChildren.empty()) {
+        output.append(" />");
+        return;
+    }
+    output.push_back('>');
+
+    std::list<SvgChild>::const_iterator iter;
+    for (iter = m_children.begin(); iter != m_children.end(); iter++) {
+        this->SerializeChild(*iter, output);
+    }
+    for (iter = m_gChildren.begin(); iter != m_gChildren.end(); iter++) {
+        this->SerializeChild(*iter, output);
+    }
+
+    AppendNewLine(output, m_depth);
+    output.append("</");
+    output.append(m_name);
+    output.push_back('>');
+}
+
+void SvgElement::SerializeChild(const SvgChild &child, std::string &output) const
+{
+    AppendNewLine(output, m_depth + 1);
+    if (child.m_element)
+        child.m_element->Serialize(output);
+    else
+        output.append(child.m_content);
+}
+
 //----------------------------------------------------------------------------
 // SvgDeviceContext
 //----------------------------------------------------------------------------
@@ -59,27 +217,32 @@ SvgDeviceContext::SvgDeviceContext(int width, int height) : DeviceContext()
     SetPen(AxBLACK, 1, AxSOLID);
 
     m_smufl_glyphs.clear();
+    m_smufl_glyphs_set.clear();
 
     m_committed = false;
     m_vrvTextFont = false;
 
     // create the initial SVG element
     // width and height need to be set later; these are taken care of in "commit"
-    m_svgNode = m_svgDoc.append_child("svg");
-    m_svgNode.append_attribute("version") = "1.1";
-    m_svgNode.append_attribute("xmlns") = "http://www.w3.org/2000/svg";
-    m_svgNode.append_attribute("xmlns:xlink") = "http://www.w3.org/1999/xlink";
-    m_svgNode.append_attribute("overflow") = "visible";
+    // its start tag is written only then and it is considered as streamed from the start
+    m_svgElement = new SvgElement("svg", NULL);
+    AppendAttribute(m_svgElement->m_attributes, "version", "1.1");
+    AppendAttribute(m_svgElement->m_attributes, "xmlns", "http://www.w3.org/2000/svg");
+    AppendAttribute(m_svgElement->m_attributes, "xmlns:xlink", "http://www.w3.org/1999/xlink");
+    AppendAttribute(m_svgElement->m_attributes, "overflow", "visible");
+    m_svgElement->m_streamed = true;
+    m_pageMarginElement = NULL;
 
     // start the stack
-    m_svgNodeStack.push_back(m_svgNode);
-    m_currentNode = m_svgNode;
+    m_svgElementStack.push_back(m_svgElement);
+    m_currentElement = m_svgElement;
 
     m_outdata.clear();
 }
 
 SvgDeviceContext::~SvgDeviceContext()
 {
+    delete m_svgElement;
 }
 
 bool SvgDeviceContext::CopyFileToStream(const std::string &filename, std::ostream &dest)
@@ -97,55 +260,59 @@ void SvgDeviceContext::Commit(bool xml_declaration)
         return;
     }
 
-    // take care of width/height once userScale is updated
-    m_svgNode.prepend_attribute("height") = StringFormat("%dpx", (int)((double)m_height * m_userScaleY)).c_str();
-    m_svgNode.prepend_attribute("width") = StringFormat("%dpx", (int)((double)m_width * m_userScaleX)).c_str();
+    // end the root element
+    this->WriteChildren(m_svgElement, NULL);
+    m_outdata.append("\n</svg>\n");
 
-    // add the woff VerovioText font if needed
-    if (m_vrvTextFont) {
-        std::string woff = Resources::GetPath() + "/woff.xml";
-        pugi::xml_document woffDoc;
-        woffDoc.load_file(woff.c_str());
-        m_svgNode.prepend_copy(woffDoc.first_child());
+    // the header to be inserted at the beginning of the buffer
+    std::string header;
+    if (xml_declaration) {
+        header.append("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n");
     }
 
-    // header
-    if (m_smufl_glyphs.size() > 0) {
+    // take care of width/height once userScale is updated
+    header.append("<svg");
+    AppendAttribute(header, "width", StringFormat("%dpx", (int)((double)m_width * m_userScaleX)));
+    AppendAttribute(header, "height", StringFormat("%dpx", (int)((double)m_height * m_userScaleY)));
+    header.append(m_svgElement->m_attributes);
+    header.push_back('>');
 
-        pugi::xml_node defs = m_svgNode.prepend_child("defs");
-        pugi::xml_document sourceDoc;
+    // add description statement
+    AppendNewLine(header, 1);
+    header.append("<desc>");
+    AppendEscaped(header, StringFormat("Engraved by Verovio %s", GetVersion().c_str()), false);
+    header.append("</desc>");
 
-        // for each needed glyph
-        std::vector<std::string>::const_iterator it;
+    // header
+    if (m_smufl_glyphs.size() > 0) {
+        assert(m_resources);
+        AppendNewLine(header, 1);
+        header.append("<defs>\n");
+        // for each needed glyph, the cached definition
+        std::vector<const Glyph *>::const_iterator it;
         for (it = m_smufl_glyphs.begin(); it != m_smufl_glyphs.end(); ++it) {
-            // load the XML file that contains it as a pugi::xml_document
-            std::ifstream source((*it).c_str());
-            sourceDoc.load(source);
-
-            // copy all the nodes inside into the master document
-            for (pugi::xml_node child = sourceDoc.first_child(); child; child = child.next_sibling()) {
-                defs.append_copy(child);
-            }
+            header.append(m_resources->GetGlyphDefs(*it));
         }
+        header.append("\t</defs>");
     }
 
-    unsigned int output_flags = pugi::format_default | pugi::format_no_declaration;
-    if (xml_declaration) {
-        // edit the xml declaration
-        output_flags = pugi::format_default;
-        pugi::xml_node decl = m_svgDoc.prepend_child(pugi::node_declaration);
-        decl.append_attribute("version") = "1.0";
-        decl.append_attribute("encoding") = "UTF-8";
-        decl.append_attribute("standalone") = "no";
+    // add the woff VerovioText font if needed
+    if (m_vrvTextFont) {
+        assert(m_resources);
+        std::string woff = m_resources->GetResourcePath() + "/woff.xml";
+        pugi::xml_document woffDoc;
+        woffDoc.load_file(woff.c_str());
+        if (woffDoc.first_child()) {
+            std::ostringstream woffStream;
+            woffDoc.first_child().print(woffStream, "\t", pugi::format_default, pugi::encoding_auto, 1);
+            // remove the indentation and the final new line since they are added here
+            std::string woffStr = woffStream.str();
+            AppendNewLine(header, 1);
+            header.append(woffStr, 1, woffStr.length() - 2);
+        }
     }
 
-    // add description statement
-    pugi::xml_node desc = m_svgNode.prepend_child("desc");
-    desc.append_child(pugi::node_pcdata)
-        .set_value(StringFormat("Engraved by Verovio %s", GetVersion().c_str()).c_str());
-
-    // save the glyph data to m_outdata
-    m_svgDoc.save(m_outdata, "\t", output_flags);
+    m_outdata.insert(0, header);
 
     m_committed = true;
 }
@@ -166,11 +333,11 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
         }
     }
 
-    m_currentNode = m_currentNode.append_child("g");
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("class") = baseClass.c_str();
+    this->StartElement("g");
+    AppendAttribute(m_currentElement->m_attributes, "class", baseClass);
     if (gId.length() > 0) {
-        m_currentNode.append_attribute("id") = gId.c_str();
+        AppendAttribute(m_currentElement->m_attributes, "id", gId);
+        if (!m_graphicIds.count(gId)) m_graphicIds[gId] = m_currentElement;
     }
 
     // this sets staffDef styles for lyrics
@@ -195,7 +362,7 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
             styleStr.append(
                 "font-weight:" + staff->AttCommon::FontweightToStr(staff->m_drawingStaffDef->GetLyricWeight()) + ";");
         }
-        if (!styleStr.empty()) m_currentNode.append_attribute("style") = styleStr.c_str();
+        if (!styleStr.empty()) AppendAttribute(m_currentElement->m_attributes, "style", styleStr);
     }
 
     if (object->HasAttClass(ATT_COLOR)) {
@@ -203,15 +370,17 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
         assert(att);
         if (att->HasColor()) {
             // SS Ignore color
-			//m_currentNode.append_attribute("fill") = att->GetColor().c_str();
+			//AppendAttribute(m_currentElement->m_attributes, "fill", att->GetColor());
         }
     }
 
 	if (object->Is(NOTE)) {
 		Note *note = dynamic_cast<Note *>(object);
 		assert(note);
-		double timeofElementOn = note->m_playingOnset *1000 / 120;
-		double timeofElementOff = note->m_playingOffset *1000 / 120;
+		// Use the tempo map of the document, as Toolkit::GetTimeForElement does
+		assert(m_doc);
+		double timeofElementOn = m_doc->GetRealTimeForScoreTime(note->m_playingOnset);
+		double timeofElementOff = m_doc->GetRealTimeForScoreTime(note->m_playingOffset);
 		double timeofElementDuration = timeofElementOff - timeofElementOn;
 
 		int measureNoteIdx = -1;
@@ -236,8 +405,8 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
 			}
 			float measureOn = measureOnRaw * 1000 / 120;
 			float measureOff = measureOffRaw * 1000 / 120;
-			m_currentNode.append_attribute("m_on") = measureOn;
-			m_currentNode.append_attribute("m_off") = measureOff;
+			AppendAttribute(m_currentElement->m_attributes, "m_on", measureOn);
+			AppendAttribute(m_currentElement->m_attributes, "m_off", measureOff);
 		}
 		*/
 
@@ -304,21 +473,24 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
 			Layer *layer = dynamic_cast<Layer *>(layer_obj);
 		}
 
-		m_currentNode.append_attribute("time_on") = timeofElementOn;
-		m_currentNode.append_attribute("time_off") = timeofElementOff;
-		m_currentNode.append_attribute("time_len") = timeofElementDuration;
-		m_currentNode.append_attribute("fill") = vrv::RGBToHexStr(0,pitch,0).c_str();
+		AppendAttribute(m_currentElement->m_attributes, "time_on", timeofElementOn);
+		AppendAttribute(m_currentElement->m_attributes, "time_off", timeofElementOff);
+		AppendAttribute(m_currentElement->m_attributes, "time_len", timeofElementDuration);
+		AppendAttribute(m_currentElement->m_attributes, "fill", vrv::RGBToHexStr(0,pitch,0));
 		
-		//m_currentNode.append_attribute("fill") = "red";
+		//AppendAttribute(m_currentElement->m_attributes, "fill", "red");
 	}
 
     if (object->HasAttClass(ATT_COMMONPART)) {
         AttCommonPart *att = dynamic_cast<AttCommonPart *>(object);
         assert(att);
         if (att->HasLabel()) {
-            pugi::xml_node svgTitle = m_currentNode.prepend_child("title");
-            svgTitle.append_attribute("class") = "labelAttr";
-            svgTitle.append_child(pugi::node_pcdata).set_value(att->GetLabel().c_str());
+            std::string svgTitle = "<title";
+            AppendAttribute(svgTitle, "class", "labelAttr");
+            svgTitle.push_back('>');
+            AppendEscaped(svgTitle, att->GetLabel(), false);
+            svgTitle.append("</title>");
+            m_currentElement->PrependContent(svgTitle);
         }
     }
 
@@ -326,20 +498,20 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
         AttLang *att = dynamic_cast<AttLang *>(object);
         assert(att);
         if (att->HasLang()) {
-            m_currentNode.append_attribute("xml:lang") = att->GetLang().c_str();
+            AppendAttribute(m_currentElement->m_attributes, "xml:lang", att->GetLang());
         }
     }
 
     if (object->HasAttClass(ATT_TYPOGRAPHY)) {
         AttTypography *att = dynamic_cast<AttTypography *>(object);
         assert(att);
-        if (att->HasFontname()) m_currentNode.append_attribute("font-family") = att->GetFontname().c_str();
+        if (att->HasFontname()) AppendAttribute(m_currentElement->m_attributes, "font-family", att->GetFontname());
         if (att->HasFontstyle())
-            m_currentNode.append_attribute("font-style")
-                = att->AttConverter::FontstyleToStr(att->GetFontstyle()).c_str();
+            AppendAttribute(m_currentElement->m_attributes, "font-style",
+                att->AttConverter::FontstyleToStr(att->GetFontstyle()));
         if (att->HasFontweight())
-            m_currentNode.append_attribute("font-weight")
-                = att->AttConverter::FontweightToStr(att->GetFontweight()).c_str();
+            AppendAttribute(m_currentElement->m_attributes, "font-weight",
+                att->AttConverter::FontweightToStr(att->GetFontweight()));
     }
 
     if (object->HasAttClass(ATT_VISIBILITY)) {
@@ -347,10 +519,10 @@ void SvgDeviceContext::StartGraphic(Object *object, std::string gClass, std::str
         assert(att);
         if (att->HasVisible()) {
             if (att->GetVisible() == BOOLEAN_true) {
-                m_currentNode.append_attribute("visibility") = "visible";
+                AppendAttribute(m_currentElement->m_attributes, "visibility", "visible");
             }
             else if (att->GetVisible() == BOOLEAN_false) {
-                m_currentNode.append_attribute("visibility") = "hidden";
+                AppendAttribute(m_currentElement->m_attributes, "visibility", "hidden");
             }
         }
     }
@@ -367,11 +539,11 @@ void SvgDeviceContext::StartCustomGraphic(std::string name, std::string gClass,
         name.append(" " + gClass);
     }
 
-    m_currentNode = m_currentNode.append_child("g");
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("class") = name.c_str();
+    this->StartElement("g");
+    AppendAttribute(m_currentElement->m_attributes, "class", name);
     if (gId.length() > 0) {
-        m_currentNode.append_attribute("id") = gId.c_str();
+        AppendAttribute(m_currentElement->m_attributes, "id", gId);
+        if (!m_graphicIds.count(gId)) m_graphicIds[gId] = m_currentElement;
     }
 }
 
@@ -383,42 +555,41 @@ void SvgDeviceContext::StartTextGraphic(Object *object, std::string gClass, std:
         baseClass.append(" " + gClass);
     }
 
-    m_currentNode = AppendChild("tspan");
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("class") = baseClass.c_str();
-    m_currentNode.append_attribute("id") = gId.c_str();
+    this->StartElement("tspan");
+    AppendAttribute(m_currentElement->m_attributes, "class", baseClass);
+    AppendAttribute(m_currentElement->m_attributes, "id", gId);
 
     if (object->HasAttClass(ATT_COLOR)) {
         AttColor *att = dynamic_cast<AttColor *>(object);
         assert(att);
-        if (att->HasColor()) m_currentNode.append_attribute("fill") = att->GetColor().c_str();
+        if (att->HasColor()) AppendAttribute(m_currentElement->m_attributes, "fill", att->GetColor());
     }
 
     if (object->HasAttClass(ATT_LANG)) {
         AttLang *att = dynamic_cast<AttLang *>(object);
         assert(att);
         if (att->HasLang()) {
-            m_currentNode.append_attribute("xml:lang") = att->GetLang().c_str();
+            AppendAttribute(m_currentElement->m_attributes, "xml:lang", att->GetLang());
         }
     }
 
     if (object->HasAttClass(ATT_TYPOGRAPHY)) {
         AttTypography *att = dynamic_cast<AttTypography *>(object);
         assert(att);
-        if (att->HasFontname()) m_currentNode.append_attribute("font-family") = att->GetFontname().c_str();
+        if (att->HasFontname()) AppendAttribute(m_currentElement->m_attributes, "font-family", att->GetFontname());
         if (att->HasFontstyle())
-            m_currentNode.append_attribute("font-style")
-                = att->AttConverter::FontstyleToStr(att->GetFontstyle()).c_str();
+            AppendAttribute(m_currentElement->m_attributes, "font-style",
+                att->AttConverter::FontstyleToStr(att->GetFontstyle()));
         if (att->HasFontweight())
-            m_currentNode.append_attribute("font-weight")
-                = att->AttConverter::FontweightToStr(att->GetFontweight()).c_str();
+            AppendAttribute(m_currentElement->m_attributes, "font-weight",
+                att->AttConverter::FontweightToStr(att->GetFontweight()));
     }
 
     if (object->HasAttClass(ATT_WHITESPACE)) {
         AttWhitespace *att = dynamic_cast<AttWhitespace *>(object);
         assert(att);
         if (att->HasSpace()) {
-            m_currentNode.append_attribute("xml:space") = att->GetSpace().c_str();
+            AppendAttribute(m_currentElement->m_attributes, "xml:space", att->GetSpace());
             ;
         }
     }
@@ -426,38 +597,34 @@ void SvgDeviceContext::StartTextGraphic(Object *object, std::string gClass, std:
 
 void SvgDeviceContext::ResumeGraphic(Object *object, std::string gId)
 {
-    std::string xpath = "//g[@id=\"" + gId + "\"]";
-    pugi::xpath_node selection = m_currentNode.select_single_node(xpath.c_str());
-    if (selection) {
-        m_currentNode = selection.node();
+    // the first <g> with the id in the system being drawn - the previous systems have already been written
+    std::map<std::string, SvgElement *>::iterator iter = m_graphicIds.find(gId);
+    if (iter != m_graphicIds.end()) {
+        m_currentElement = iter->second;
     }
-    m_svgNodeStack.push_back(m_currentNode);
+    m_svgElementStack.push_back(m_currentElement);
 }
 
 void SvgDeviceContext::EndGraphic(Object *object, View *view)
 {
     DrawSvgBoundingBox(object, view);
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    this->CloseElement();
 }
 
 void SvgDeviceContext::EndCustomGraphic()
 {
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    this->CloseElement();
 }
 
 void SvgDeviceContext::EndResumedGraphic(Object *object, View *view)
 {
     DrawSvgBoundingBox(object, view);
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    this->CloseElement();
 }
 
 void SvgDeviceContext::EndTextGraphic(Object *object, View *view)
 {
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    this->CloseElement();
 }
 
 void SvgDeviceContext::StartPage()
@@ -466,36 +633,35 @@ void SvgDeviceContext::StartPage()
     m_vrvTextFont = false;
 
     // default styles
-    m_currentNode = m_currentNode.append_child("style");
-    m_currentNode.append_attribute("type") = "text/css";
-    m_currentNode.append_child(pugi::node_pcdata)
-        .set_value("g.page-margin{font-family:Times;} g.tempo{font-weight:bold;} g.dir, g.dynam {font-style:italic;}");
-    m_currentNode = m_svgNodeStack.back();
+    std::string style = "<style";
+    AppendAttribute(style, "type", "text/css");
+    style.append(">g.page-margin{font-family:Times;} g.tempo{font-weight:bold;} g.dir, g.dynam {font-style:italic;}");
+    style.append("</style>");
+    m_currentElement->AppendContent(style);
 
     // a graphic for definition scaling
-    m_currentNode = m_currentNode.append_child("svg");
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("class") = "definition-scale";
-    m_currentNode.append_attribute("viewBox")
-        = StringFormat("0 0 %d %d", m_width * DEFINITION_FACTOR, m_height * DEFINITION_FACTOR).c_str();
+    this->StartElement("svg");
+    AppendAttribute(m_currentElement->m_attributes, "class", "definition-scale");
+    AppendAttribute(m_currentElement->m_attributes, "viewBox",
+        StringFormat("0 0 %d %d", m_width * DEFINITION_FACTOR, m_height * DEFINITION_FACTOR));
 
     // a graphic for the origin
-    m_currentNode = m_currentNode.append_child("g");
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("class") = "page-margin";
-    m_currentNode.append_attribute("transform")
-        = StringFormat("translate(%d, %d)", (int)((double)m_originX), (int)((double)m_originY)).c_str();
+    this->StartElement("g");
+    m_pageMarginElement = m_currentElement;
+    AppendAttribute(m_currentElement->m_attributes, "class", "page-margin");
+    AppendAttribute(m_currentElement->m_attributes, "transform",
+        StringFormat("translate(%d, %d)", (int)((double)m_originX), (int)((double)m_originY)));
 }
 
 void SvgDeviceContext::EndPage()
 {
     // end page-margin
-    m_svgNodeStack.pop_back();
+    this->CloseElement();
+    m_pageMarginElement = NULL;
     // end definition-scale
-    m_svgNodeStack.pop_back();
+    this->CloseElement();
     // end page-scale
-    // m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    // this->CloseElement();
 }
 
 void SvgDeviceContext::SetBackground(int colour, int style)
@@ -539,32 +705,124 @@ Point SvgDeviceContext::GetLogicalOrigin()
     return Point(m_originX, m_originY);
 }
 
-pugi::xml_node SvgDeviceContext::AppendChild(std::string name)
+void SvgDeviceContext::AppendChild(const std::string &element)
 {
-    pugi::xml_node g = m_currentNode.child("g");
-    if (g)
-        return m_currentNode.insert_child_before(name.c_str(), g);
-    else
-        return m_currentNode.append_child(name.c_str());
+    m_currentElement->AppendContent(element);
+}
+
+void SvgDeviceContext::StartElement(const std::string &name)
+{
+    m_currentElement = m_currentElement->AppendElement(name);
+    m_svgElementStack.push_back(m_currentElement);
+}
+
+void SvgDeviceContext::CloseElement()
+{
+    SvgElement *element = m_svgElementStack.back();
+    m_svgElementStack.pop_back();
+    m_currentElement = m_svgElementStack.back();
+
+    // the element is still open (e.g., resumed graphic not found)
+    if (std::find(m_svgElementStack.begin(), m_svgElementStack.end(), element) != m_svgElementStack.end()) return;
+
+    if (element->m_streamed) {
+        this->EndStreamedElement(element);
+    }
+    // a system is written as soon as it is closed since nothing can be added to it anymore
+    else if (m_pageMarginElement && (element->m_parent == m_pageMarginElement)) {
+        this->FlushElement(element);
+    }
+}
+
+void SvgDeviceContext::StreamElement(SvgElement *element)
+{
+    if (element->m_streamed) return;
+
+    SvgElement *parent = element->m_parent;
+    assert(parent);
+    this->StreamElement(parent);
+    this->WriteChildren(parent, element);
+
+    AppendNewLine(m_outdata, element->m_depth);
+    m_outdata.push_back('<');
+    m_outdata.append(element->m_name);
+    m_outdata.append(element->m_attributes);
+    m_outdata.push_back('>');
+    element->m_streamed = true;
+}
+
+void SvgDeviceContext::FlushElement(SvgElement *element)
+{
+    SvgElement *parent = element->m_parent;
+    assert(parent);
+    this->StreamElement(parent);
+    this->WriteChildren(parent, element);
+
+    // the element is now the first child of its parent
+    std::list<SvgChild> &children = (element->m_name == "g") ? parent->m_gChildren : parent->m_children;
+    assert(!children.empty() && (children.front().m_element == element));
+    parent->SerializeChild(children.front(), m_outdata);
+    children.pop_front();
+    delete element;
+
+    // the elements written cannot be resumed anymore
+    m_graphicIds.clear();
+}
+
+void SvgDeviceContext::EndStreamedElement(SvgElement *element)
+{
+    this->WriteChildren(element, NULL);
+    AppendNewLine(m_outdata, element->m_depth);
+    m_outdata.append("</");
+    m_outdata.append(element->m_name);
+    m_outdata.push_back('>');
+
+    SvgElement *parent = element->m_parent;
+    assert(parent);
+    this->WriteChildren(parent, element);
+    // remove the element from its parent without writing it again
+    std::list<SvgChild> &children = (element->m_name == "g") ? parent->m_gChildren : parent->m_children;
+    assert(!children.empty() && (children.front().m_element == element));
+    children.pop_front();
+    delete element;
+}
+
+void SvgDeviceContext::WriteChildren(SvgElement *element, SvgElement *until)
+{
+    std::list<SvgChild> *lists[2] = { &element->m_children, &element->m_gChildren };
+    for (int i = 0; i < 2; i++) {
+        std::list<SvgChild> &children = *lists[i];
+        while (!children.empty() && (!until || (children.front().m_element != until))) {
+            element->SerializeChild(children.front(), m_outdata);
+            if (children.front().m_element) {
+                delete children.front().m_element;
+                // the elements written cannot be resumed anymore
+                m_graphicIds.clear();
+            }
+            children.pop_front();
+        }
+        if (!children.empty()) break;
+    }
 }
 
 // Drawing methods
 void SvgDeviceContext::DrawComplexBezierPath(Point bezier1[4], Point bezier2[4])
 {
-    pugi::xml_node pathChild = AppendChild("path");
-    pathChild.append_attribute("d")
-        = StringFormat("M%d,%d C%d,%d %d,%d %d,%d C%d,%d %d,%d %d,%d", bezier1[0].x, bezier1[0].y, // M command
-              bezier1[1].x, bezier1[1].y, bezier1[2].x, bezier1[2].y, bezier1[3].x, bezier1[3].y, // First bezier
-              bezier2[2].x, bezier2[2].y, bezier2[1].x, bezier2[1].y, bezier2[0].x, bezier2[0].y // Second Bezier
-              )
-              .c_str();
-    // pathChild.append_attribute("fill") = "#000000";
-    // pathChild.append_attribute("fill-opacity") = "1";
-    pathChild.append_attribute("stroke") = StringFormat("#%s", GetColour(m_penStack.top().GetColour()).c_str()).c_str();
-    pathChild.append_attribute("stroke-linecap") = "round";
-    pathChild.append_attribute("stroke-linejoin") = "round";
-    // pathChild.append_attribute("stroke-opacity") = "1";
-    pathChild.append_attribute("stroke-width") = m_penStack.top().GetWidth();
+    std::string pathChild = "<path";
+    AppendAttribute(pathChild, "d",
+        StringFormat("M%d,%d C%d,%d %d,%d %d,%d C%d,%d %d,%d %d,%d", bezier1[0].x, bezier1[0].y, // M command
+            bezier1[1].x, bezier1[1].y, bezier1[2].x, bezier1[2].y, bezier1[3].x, bezier1[3].y, // First bezier
+            bezier2[2].x, bezier2[2].y, bezier2[1].x, bezier2[1].y, bezier2[0].x, bezier2[0].y // Second Bezier
+            ));
+    // AppendAttribute(pathChild, "fill", "#000000");
+    // AppendAttribute(pathChild, "fill-opacity", "1");
+    AppendAttribute(pathChild, "stroke", StringFormat("#%s", GetColour(m_penStack.top().GetColour()).c_str()));
+    AppendAttribute(pathChild, "stroke-linecap", "round");
+    AppendAttribute(pathChild, "stroke-linejoin", "round");
+    // AppendAttribute(pathChild, "stroke-opacity", "1");
+    AppendAttribute(pathChild, "stroke-width", m_penStack.top().GetWidth());
+    pathChild.append(" />");
+    AppendChild(pathChild);
 }
 
 void SvgDeviceContext::DrawCircle(int x, int y, int radius)
@@ -583,18 +841,19 @@ void SvgDeviceContext::DrawEllipse(int x, int y, int width, int height)
     int rh = height / 2;
     int rw = width / 2;
 
-    pugi::xml_node ellipseChild = AppendChild("ellipse");
-    ellipseChild.append_attribute("cx") = x + rw;
-    ellipseChild.append_attribute("cy") = y + rh;
-    ellipseChild.append_attribute("rx") = rw;
-    ellipseChild.append_attribute("ry") = rh;
-    if (currentBrush.GetOpacity() != 1.0) ellipseChild.append_attribute("fill-opacity") = currentBrush.GetOpacity();
-    if (currentPen.GetOpacity() != 1.0) ellipseChild.append_attribute("stroke-opacity") = currentPen.GetOpacity();
+    std::string ellipseChild = "<ellipse";
+    AppendAttribute(ellipseChild, "cx", x + rw);
+    AppendAttribute(ellipseChild, "cy", y + rh);
+    AppendAttribute(ellipseChild, "rx", rw);
+    AppendAttribute(ellipseChild, "ry", rh);
+    if (currentBrush.GetOpacity() != 1.0) AppendAttribute(ellipseChild, "fill-opacity", currentBrush.GetOpacity());
+    if (currentPen.GetOpacity() != 1.0) AppendAttribute(ellipseChild, "stroke-opacity", currentPen.GetOpacity());
     if (currentPen.GetWidth() > 0) {
-        ellipseChild.append_attribute("stroke-width") = currentPen.GetWidth();
-        ellipseChild.append_attribute("stroke")
-            = StringFormat("#%s", GetColour(m_penStack.top().GetColour()).c_str()).c_str();
+        AppendAttribute(ellipseChild, "stroke-width", currentPen.GetWidth());
+        AppendAttribute(ellipseChild, "stroke", StringFormat("#%s", GetColour(m_penStack.top().GetColour()).c_str()));
     }
+    ellipseChild.append(" />");
+    AppendChild(ellipseChild);
 }
 
 void SvgDeviceContext::DrawEllipticArc(int x, int y, int width, int height, double start, double end)
@@ -655,29 +914,31 @@ void SvgDeviceContext::DrawEllipticArc(int x, int y, int width, int height, doub
     else
         fSweep = 0;
 
-    pugi::xml_node pathChild = AppendChild("path");
-    pathChild.append_attribute("d") = StringFormat("M%d %d A%d %d 0.0 %d %d %d %d", int(xs), int(ys), abs(int(rx)),
-                                          abs(int(ry)), fArc, fSweep, int(xe), int(ye))
-                                          .c_str();
-    // pathChild.append_attribute("fill") = "#000000";
-    if (currentBrush.GetOpacity() != 1.0) pathChild.append_attribute("fill-opacity") = currentBrush.GetOpacity();
-    if (currentPen.GetOpacity() != 1.0) pathChild.append_attribute("stroke-opacity") = currentPen.GetOpacity();
+    std::string pathChild = "<path";
+    AppendAttribute(pathChild, "d", StringFormat("M%d %d A%d %d 0.0 %d %d %d %d", int(xs), int(ys), abs(int(rx)),
+                                        abs(int(ry)), fArc, fSweep, int(xe), int(ye)));
+    // AppendAttribute(pathChild, "fill", "#000000");
+    if (currentBrush.GetOpacity() != 1.0) AppendAttribute(pathChild, "fill-opacity", currentBrush.GetOpacity());
+    if (currentPen.GetOpacity() != 1.0) AppendAttribute(pathChild, "stroke-opacity", currentPen.GetOpacity());
     if (currentPen.GetWidth() > 0) {
-        pathChild.append_attribute("stroke-width") = currentPen.GetWidth();
-        pathChild.append_attribute("stroke")
-            = StringFormat("#%s", GetColour(m_penStack.top().GetColour()).c_str()).c_str();
+        AppendAttribute(pathChild, "stroke-width", currentPen.GetWidth());
+        AppendAttribute(pathChild, "stroke", StringFormat("#%s", GetColour(m_penStack.top().GetColour()).c_str()));
     }
+    pathChild.append(" />");
+    AppendChild(pathChild);
 }
 
 void SvgDeviceContext::DrawLine(int x1, int y1, int x2, int y2)
 {
-    pugi::xml_node pathChild = AppendChild("path");
-    pathChild.append_attribute("d") = StringFormat("M%d %d L%d %d", x1, y1, x2, y2).c_str();
-    pathChild.append_attribute("stroke") = StringFormat("#%s", GetColour(m_penStack.top().GetColour()).c_str()).c_str();
+    std::string pathChild = "<path";
+    AppendAttribute(pathChild, "d", StringFormat("M%d %d L%d %d", x1, y1, x2, y2));
+    AppendAttribute(pathChild, "stroke", StringFormat("#%s", GetColour(m_penStack.top().GetColour()).c_str()));
     if (m_penStack.top().GetDashLength() > 0)
-        pathChild.append_attribute("stroke-dasharray")
-            = StringFormat("%d, %d", m_penStack.top().GetDashLength(), m_penStack.top().GetDashLength()).c_str();
-    if (m_penStack.top().GetWidth() > 1) pathChild.append_attribute("stroke-width") = m_penStack.top().GetWidth();
+        AppendAttribute(pathChild, "stroke-dasharray",
+            StringFormat("%d, %d", m_penStack.top().GetDashLength(), m_penStack.top().GetDashLength()));
+    if (m_penStack.top().GetWidth() > 1) AppendAttribute(pathChild, "stroke-width", m_penStack.top().GetWidth());
+    pathChild.append(" />");
+    AppendChild(pathChild);
 }
 
 void SvgDeviceContext::DrawPolygon(int n, Point points[], int xoffset, int yoffset, int fill_style)
@@ -688,28 +949,28 @@ void SvgDeviceContext::DrawPolygon(int n, Point points[], int xoffset, int yoffs
     Pen currentPen = m_penStack.top();
     Brush currentBrush = m_brushStack.top();
 
-    pugi::xml_node polygonChild = AppendChild("polygon");
+    std::string polygonChild = "<polygon";
     // if (fillStyle == wxODDEVEN_RULE)
-    //    polygonChild.append_attribute("fill-rule") = "evenodd;";
+    //    AppendAttribute(polygonChild, "fill-rule", "evenodd;");
     // else
     if (currentPen.GetWidth() > 0)
-        polygonChild.append_attribute("stroke")
-            = StringFormat("#%s", GetColour(currentPen.GetColour()).c_str()).c_str();
+        AppendAttribute(polygonChild, "stroke", StringFormat("#%s", GetColour(currentPen.GetColour()).c_str()));
     if (currentPen.GetWidth() > 1)
-        polygonChild.append_attribute("stroke-width") = StringFormat("%d", currentPen.GetWidth()).c_str();
+        AppendAttribute(polygonChild, "stroke-width", StringFormat("%d", currentPen.GetWidth()));
     if (currentPen.GetOpacity() != 1.0)
-        polygonChild.append_attribute("stroke-opacity") = StringFormat("%f", currentPen.GetOpacity()).c_str();
+        AppendAttribute(polygonChild, "stroke-opacity", StringFormat("%f", currentPen.GetOpacity()));
     if (currentBrush.GetColour() != AxBLACK)
-        polygonChild.append_attribute("fill")
-            = StringFormat("#%s", GetColour(currentBrush.GetColour()).c_str()).c_str();
+        AppendAttribute(polygonChild, "fill", StringFormat("#%s", GetColour(currentBrush.GetColour()).c_str()));
     if (currentBrush.GetOpacity() != 1.0)
-        polygonChild.append_attribute("fill-opacity") = StringFormat("%f", currentBrush.GetOpacity()).c_str();
+        AppendAttribute(polygonChild, "fill-opacity", StringFormat("%f", currentBrush.GetOpacity()));
 
     std::string pointsString;
     for (int i = 0; i < n; i++) {
         pointsString += StringFormat("%d,%d ", points[i].x + xoffset, points[i].y + yoffset);
     }
-    polygonChild.append_attribute("points") = pointsString.c_str();
+    AppendAttribute(polygonChild, "points", pointsString);
+    polygonChild.append(" />");
+    AppendChild(polygonChild);
 }
 
 void SvgDeviceContext::DrawRectangle(int x, int y, int width, int height)
@@ -731,18 +992,20 @@ void SvgDeviceContext::DrawRoundedRectangle(int x, int y, int width, int height,
         x -= width;
     }
 
-    pugi::xml_node rectChild = AppendChild("rect");
-    rectChild.append_attribute("x") = x;
-    rectChild.append_attribute("y") = y;
-    rectChild.append_attribute("height") = height;
-    rectChild.append_attribute("width") = width;
-    if (radius != 0) rectChild.append_attribute("rx") = radius;
+    std::string rectChild = "<rect";
+    AppendAttribute(rectChild, "x", x);
+    AppendAttribute(rectChild, "y", y);
+    AppendAttribute(rectChild, "height", height);
+    AppendAttribute(rectChild, "width", width);
+    if (radius != 0) AppendAttribute(rectChild, "rx", radius);
+    rectChild.append(" />");
+    AppendChild(rectChild);
     // for empty rectangles with bounding boxes
     /*
-    rectChild.append_attribute("fill-opacity") = "0.0";
-    rectChild.append_attribute("stroke-opacity") = "1.0";
-    rectChild.append_attribute("stroke-width") = "10";
-    rectChild.append_attribute("stroke") = StringFormat("#%s", GetColour(m_penStack.top().GetColour()).c_str()).c_str();
+    AppendAttribute(rectChild, "fill-opacity", "0.0");
+    AppendAttribute(rectChild, "stroke-opacity", "1.0");
+    AppendAttribute(rectChild, "stroke-width", "10");
+    AppendAttribute(rectChild, "stroke", StringFormat("#%s", GetColour(m_penStack.top().GetColour()).c_str()));
     */
 }
 
@@ -758,51 +1021,49 @@ void SvgDeviceContext::StartText(int x, int y, char alignment)
         anchor = "middle";
     }
 
-    m_currentNode = AppendChild("text");
-    m_svgNodeStack.push_back(m_currentNode);
-    m_currentNode.append_attribute("x") = x;
-    m_currentNode.append_attribute("y") = y;
+    this->StartElement("text");
+    AppendAttribute(m_currentElement->m_attributes, "x", x);
+    AppendAttribute(m_currentElement->m_attributes, "y", y);
     // unless dx, dy have a value they don't need to be set
-    // m_currentNode.append_attribute("dx") = 0;
-    // m_currentNode.append_attribute("dy") = 0;
+    // AppendAttribute(m_currentElement->m_attributes, "dx", 0);
+    // AppendAttribute(m_currentElement->m_attributes, "dy", 0);
     if (!anchor.empty()) {
-        m_currentNode.append_attribute("text-anchor") = anchor.c_str();
+        AppendAttribute(m_currentElement->m_attributes, "text-anchor", anchor);
     }
     // font-size seems to be required in <text> in FireFox and also we set it to 0px so space
     // is not added between tspan elements
-    m_currentNode.append_attribute("font-size") = "0px";
+    AppendAttribute(m_currentElement->m_attributes, "font-size", "0px");
     //
     if (!m_fontStack.top()->GetFaceName().empty()) {
-        m_currentNode.append_attribute("font-family") = m_fontStack.top()->GetFaceName().c_str();
+        AppendAttribute(m_currentElement->m_attributes, "font-family", m_fontStack.top()->GetFaceName());
     }
     if (m_fontStack.top()->GetStyle() != FONTSTYLE_NONE) {
         if (m_fontStack.top()->GetStyle() == FONTSTYLE_italic) {
-            m_currentNode.append_attribute("font-style") = "italic";
+            AppendAttribute(m_currentElement->m_attributes, "font-style", "italic");
         }
         else if (m_fontStack.top()->GetStyle() == FONTSTYLE_normal) {
-            m_currentNode.append_attribute("font-style") = "normal";
+            AppendAttribute(m_currentElement->m_attributes, "font-style", "normal");
         }
         else if (m_fontStack.top()->GetStyle() == FONTSTYLE_oblique) {
-            m_currentNode.append_attribute("font-style") = "oblique";
+            AppendAttribute(m_currentElement->m_attributes, "font-style", "oblique");
         }
     }
     if (m_fontStack.top()->GetWeight() != FONTWEIGHT_NONE) {
         if (m_fontStack.top()->GetWeight() == FONTWEIGHT_bold) {
-            m_currentNode.append_attribute("font-weight") = "bold";
+            AppendAttribute(m_currentElement->m_attributes, "font-weight", "bold");
         }
     }
 }
 
 void SvgDeviceContext::MoveTextTo(int x, int y)
 {
-    m_currentNode.append_attribute("x") = x;
-    m_currentNode.append_attribute("y") = y;
+    AppendAttribute(m_currentElement->m_attributes, "x", x);
+    AppendAttribute(m_currentElement->m_attributes, "y", y);
 }
 
 void SvgDeviceContext::EndText()
 {
-    m_svgNodeStack.pop_back();
-    m_currentNode = m_svgNodeStack.back();
+    this->CloseElement();
 }
 
 void SvgDeviceContext::DrawText(const std::string &text, const std::wstring wtext)
@@ -816,17 +1077,20 @@ void SvgDeviceContext::DrawText(const std::string &text, const std::wstring wtex
         svgText.replace(0, 1, "\xC2\xA0");
     }
 
-    pugi::xml_node textChild = AppendChild("tspan");
+    std::string textChild = "<tspan";
     if (!m_fontStack.top()->GetFaceName().empty()) {
-        textChild.append_attribute("font-family") = m_fontStack.top()->GetFaceName().c_str();
+        AppendAttribute(textChild, "font-family", m_fontStack.top()->GetFaceName());
         // Special case where we want to specifiy if the VerovioText font (woff) needs to be included in the output
         if (m_fontStack.top()->GetFaceName() == "VerovioText") this->VrvTextFont();
     }
     if (m_fontStack.top()->GetPointSize() != 0) {
-        textChild.append_attribute("font-size") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
+        AppendAttribute(textChild, "font-size", StringFormat("%dpx", m_fontStack.top()->GetPointSize()));
     }
-    textChild.append_attribute("class") = "text";
-    textChild.append_child(pugi::node_pcdata).set_value(svgText.c_str());
+    AppendAttribute(textChild, "class", "text");
+    textChild.push_back('>');
+    AppendEscaped(textChild, svgText, false);
+    textChild.append("</tspan>");
+    AppendChild(textChild);
 }
 
 void SvgDeviceContext::DrawRotatedText(const std::string &text, int x, int y, double angle)
@@ -837,32 +1101,32 @@ void SvgDeviceContext::DrawRotatedText(const std::string &text, int x, int y, do
 void SvgDeviceContext::DrawMusicText(const std::wstring &text, int x, int y, bool setSmuflGlyph)
 {
     assert(m_fontStack.top());
+    assert(m_resources);
 
     int w, h, gx, gy;
 
     // print chars one by one
     for (unsigned int i = 0; i < text.length(); i++) {
         wchar_t c = text.at(i);
-        Glyph *glyph = Resources::GetGlyph(c);
+        const Glyph *glyph = m_resources->GetGlyph(c);
         if (!glyph) {
             continue;
         }
 
-        std::string path = glyph->GetPath();
-
         // Add the glyph to the array for the <defs>
-        std::vector<std::string>::const_iterator it = std::find(m_smufl_glyphs.begin(), m_smufl_glyphs.end(), path);
-        if (it == m_smufl_glyphs.end()) {
-            m_smufl_glyphs.push_back(path);
+        if (m_smufl_glyphs_set.insert(glyph).second) {
+            m_smufl_glyphs.push_back(glyph);
         }
 
         // Write the char in the SVG
-        pugi::xml_node useChild = AppendChild("use");
-        useChild.append_attribute("xlink:href") = StringFormat("#%s", glyph->GetCodeStr().c_str()).c_str();
-        useChild.append_attribute("x") = x;
-        useChild.append_attribute("y") = y;
-        useChild.append_attribute("height") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
-        useChild.append_attribute("width") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
+        std::string useChild = "<use";
+        AppendAttribute(useChild, "xlink:href", StringFormat("#%s", glyph->GetCodeStr().c_str()));
+        AppendAttribute(useChild, "x", x);
+        AppendAttribute(useChild, "y", y);
+        AppendAttribute(useChild, "height", StringFormat("%dpx", m_fontStack.top()->GetPointSize()));
+        AppendAttribute(useChild, "width", StringFormat("%dpx", m_fontStack.top()->GetPointSize()));
+        useChild.append(" />");
+        AppendChild(useChild);
 
         // Get the bounds of the char
         if (glyph->GetHorizAdvX() > 0)
@@ -909,7 +1173,24 @@ std::string SvgDeviceContext::GetStringSVG(bool xml_declaration)
 {
     if (!m_committed) Commit(xml_declaration);
 
-    return m_outdata.str();
+    return m_outdata;
+}
+
+void SvgDeviceContext::WriteSVG(std::string &output, bool xml_declaration)
+{
+    if (!m_committed) Commit(xml_declaration);
+
+    if (output.empty())
+        output.swap(m_outdata);
+    else
+        output.append(m_outdata);
+}
+
+void SvgDeviceContext::WriteSVG(std::ostream &output, bool xml_declaration)
+{
+    if (!m_committed) Commit(xml_declaration);
+
+    output << m_outdata;
 }
 
 void SvgDeviceContext::DrawSvgBoundingBox(Object *object, View *view)
@@ -947,7 +1228,7 @@ void SvgDeviceContext::DrawSvgBoundingBox(Object *object, View *view)
 
         for (iter = anchors.begin(); iter != anchors.end(); iter++) {
             if (object->GetBoundingBoxGlyph() != 0) {
-                Glyph *glyph = Resources::GetGlyph(object->GetBoundingBoxGlyph());
+                const Glyph *glyph = m_resources->GetGlyph(object->GetBoundingBoxGlyph());
                 assert(glyph);
 
                 if (glyph->HasAnchor(*iter)) {
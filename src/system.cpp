@@ -35,7 +35,7 @@ System::System() : Object("system-"), DrawingListInterface(), AttCommon(), AttTy
     RegisterAttClass(ATT_TYPED);
 
     // We set parent to it because we want to access the parent doc from the aligners
-    m_systemAligner.SetParent(this);
+    m_systemAligner.SetMemberParent(this);
 
     // owned pointers need to be set to NULL;
     m_drawingScoreDef = NULL;
@@ -71,6 +71,9 @@ void System::Reset()
     m_drawingJustifiableWidth = 0;
     m_drawingLabelsWidth = 0;
     m_drawingAbbrLabelsWidth = 0;
+
+    m_layerElementXs.clear();
+    m_layerElementXsDone = false;
 }
 
 void System::AddChild(Object *child)
@@ -101,7 +104,8 @@ int System::GetDrawingX() const
 {
     if (m_xAbs != VRV_UNSET) return m_xAbs;
 
-    m_cachedDrawingX = 0;
+    // Only write the cache once since the measures can be laid out concurrently (see Page::ProcessMeasures)
+    if (m_cachedDrawingX != 0) m_cachedDrawingX = 0;
     return m_drawingXRel;
 }
 
@@ -109,7 +113,7 @@ int System::GetDrawingY() const
 {
     if (m_yAbs != VRV_UNSET) return m_yAbs;
 
-    m_cachedDrawingY = 0;
+    if (m_cachedDrawingY != 0) m_cachedDrawingY = 0;
     return m_drawingYRel;
 }
 
@@ -166,6 +170,28 @@ void System::SetDrawingScoreDef(ScoreDef *drawingScoreDef)
     *m_drawingScoreDef = *drawingScoreDef;
 }
 
+bool System::GetLayerElementsBetween(
+    std::vector<LayerElement *> *elements, int staffN, int layerN, int minPos, int maxPos) const
+{
+    assert(elements);
+
+    if (!m_layerElementXsDone) return false;
+
+    auto iter = m_layerElementXs.find(std::make_pair(staffN, layerN));
+    if (iter == m_layerElementXs.end()) return true;
+
+    // The running maximum is increasing, so all the elements before the first one above minPos are outside and
+    // the look up stops at the first one above maxPos
+    auto compare = [](int pos, const std::pair<LayerElement *, int> &element) { return pos < element.second; };
+    auto first = std::upper_bound(iter->second.begin(), iter->second.end(), minPos, compare);
+    auto last = std::upper_bound(first, iter->second.end(), maxPos, compare);
+    for (; first != last; ++first) {
+        int x = first->first->GetDrawingX();
+        if ((x > minPos) && (x < maxPos)) elements->push_back(first->first);
+    }
+    return true;
+}
+
 //----------------------------------------------------------------------------
 // System functor methods
 //----------------------------------------------------------------------------
@@ -186,6 +212,9 @@ int System::ResetHorizontalAlignment(FunctorParams *functorParams)
     m_drawingLabelsWidth = 0;
     m_drawingAbbrLabelsWidth = 0;
 
+    m_layerElementXs.clear();
+    m_layerElementXsDone = false;
+
     return FUNCTOR_CONTINUE;
 }
 
@@ -198,9 +227,18 @@ int System::ResetVerticalAlignment(FunctorParams *functorParams)
     return FUNCTOR_CONTINUE;
 }
 
+int System::ResetDrawing(FunctorParams *functorParams)
+{
+    // Layer elements can be added or removed when preparing the drawing
+    m_layerElementXs.clear();
+    m_layerElementXsDone = false;
+
+    return FUNCTOR_CONTINUE;
+}
+
 int System::ApplyPPUFactor(FunctorParams *functorParams)
 {
-    ApplyPPUFactorParams *params = dynamic_cast<ApplyPPUFactorParams *>(functorParams);
+    ApplyPPUFactorParams *params = vrv_cast<ApplyPPUFactorParams *>(functorParams);
     assert(params);
 
     if (m_xAbs != VRV_UNSET) m_xAbs /= params->m_page->GetPPUFactor();
@@ -213,7 +251,7 @@ int System::ApplyPPUFactor(FunctorParams *functorParams)
 
 int System::AlignHorizontally(FunctorParams *functorParams)
 {
-    AlignHorizontallyParams *params = dynamic_cast<AlignHorizontallyParams *>(functorParams);
+    AlignHorizontallyParams *params = vrv_cast<AlignHorizontallyParams *>(functorParams);
     assert(params);
 
     // since we are starting a new system its first scoreDef will need to be a SYSTEM_SCOREDEF
@@ -224,7 +262,7 @@ int System::AlignHorizontally(FunctorParams *functorParams)
 
 int System::AlignVertically(FunctorParams *functorParams)
 {
-    AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
+    AlignVerticallyParams *params = vrv_cast<AlignVerticallyParams *>(functorParams);
     assert(params);
 
     params->m_systemAligner = &m_systemAligner;
@@ -234,7 +272,7 @@ int System::AlignVertically(FunctorParams *functorParams)
 
 int System::AlignVerticallyEnd(FunctorParams *functorParams)
 {
-    AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
+    AlignVerticallyParams *params = vrv_cast<AlignVerticallyParams *>(functorParams);
     assert(params);
 
     params->m_cumulatedShift = params->m_doc->GetSpacingStaff() * params->m_doc->GetDrawingUnit(100);
@@ -246,7 +284,7 @@ int System::AlignVerticallyEnd(FunctorParams *functorParams)
 
 int System::AdjustYPos(FunctorParams *functorParams)
 {
-    AdjustYPosParams *params = dynamic_cast<AdjustYPosParams *>(functorParams);
+    AdjustYPosParams *params = vrv_cast<AdjustYPosParams *>(functorParams);
     assert(params);
 
     params->m_previousOverflowBelow = 0;
@@ -260,7 +298,7 @@ int System::AdjustYPos(FunctorParams *functorParams)
 
 int System::AlignMeasures(FunctorParams *functorParams)
 {
-    AlignMeasuresParams *params = dynamic_cast<AlignMeasuresParams *>(functorParams);
+    AlignMeasuresParams *params = vrv_cast<AlignMeasuresParams *>(functorParams);
     assert(params);
 
     SetDrawingXRel(this->m_systemLeftMar + this->GetDrawingLabelsWidth());
@@ -272,7 +310,7 @@ int System::AlignMeasures(FunctorParams *functorParams)
 
 int System::AlignMeasuresEnd(FunctorParams *functorParams)
 {
-    AlignMeasuresParams *params = dynamic_cast<AlignMeasuresParams *>(functorParams);
+    AlignMeasuresParams *params = vrv_cast<AlignMeasuresParams *>(functorParams);
     assert(params);
 
     m_drawingTotalWidth = params->m_shift + this->GetDrawingLabelsWidth();
@@ -283,7 +321,7 @@ int System::AlignMeasuresEnd(FunctorParams *functorParams)
 
 int System::AlignSystems(FunctorParams *functorParams)
 {
-    AlignSystemsParams *params = dynamic_cast<AlignSystemsParams *>(functorParams);
+    AlignSystemsParams *params = vrv_cast<AlignSystemsParams *>(functorParams);
     assert(params);
 
     SetDrawingYRel(params->m_shift);
@@ -297,7 +335,7 @@ int System::AlignSystems(FunctorParams *functorParams)
 
 int System::JustifyX(FunctorParams *functorParams)
 {
-    JustifyXParams *params = dynamic_cast<JustifyXParams *>(functorParams);
+    JustifyXParams *params = vrv_cast<JustifyXParams *>(functorParams);
     assert(params);
 
     assert(GetParent());
@@ -332,7 +370,7 @@ int System::JustifyX(FunctorParams *functorParams)
 
 int System::AdjustStaffOverlap(FunctorParams *functorParams)
 {
-    AdjustStaffOverlapParams *params = dynamic_cast<AdjustStaffOverlapParams *>(functorParams);
+    AdjustStaffOverlapParams *params = vrv_cast<AdjustStaffOverlapParams *>(functorParams);
     assert(params);
 
     params->m_previous = NULL;
@@ -343,7 +381,7 @@ int System::AdjustStaffOverlap(FunctorParams *functorParams)
 
 int System::AdjustFloatingPostioners(FunctorParams *functorParams)
 {
-    AdjustFloatingPostionersParams *params = dynamic_cast<AdjustFloatingPostionersParams *>(functorParams);
+    AdjustFloatingPostionersParams *params = vrv_cast<AdjustFloatingPostionersParams *>(functorParams);
     assert(params);
 
     AdjustFloatingPostionerGrpsParams adjustFloatingPostionerGrpsParams(params->m_doc);
@@ -395,9 +433,21 @@ int System::AdjustFloatingPostioners(FunctorParams *functorParams)
     return FUNCTOR_SIBLINGS;
 }
 
+int System::IndexLayerElements(FunctorParams *functorParams)
+{
+    IndexLayerElementsParams *params = vrv_cast<IndexLayerElementsParams *>(functorParams);
+    assert(params);
+
+    m_layerElementXs.clear();
+    m_layerElementXsDone = true;
+    params->m_layerElementXs = &m_layerElementXs;
+
+    return FUNCTOR_CONTINUE;
+}
+
 int System::CastOffPages(FunctorParams *functorParams)
 {
-    CastOffPagesParams *params = dynamic_cast<CastOffPagesParams *>(functorParams);
+    CastOffPagesParams *params = vrv_cast<CastOffPagesParams *>(functorParams);
     assert(params);
 
     if ((params->m_currentPage->GetChildCount() > 0)
@@ -420,7 +470,7 @@ int System::CastOffPages(FunctorParams *functorParams)
 
 int System::UnCastOff(FunctorParams *functorParams)
 {
-    UnCastOffParams *params = dynamic_cast<UnCastOffParams *>(functorParams);
+    UnCastOffParams *params = vrv_cast<UnCastOffParams *>(functorParams);
     assert(params);
 
     // Just move all the content of the system to the continous one (parameter)
@@ -433,7 +483,7 @@ int System::UnCastOff(FunctorParams *functorParams)
 
 int System::CastOffSystemsEnd(FunctorParams *functorParams)
 {
-    CastOffSystemsParams *params = dynamic_cast<CastOffSystemsParams *>(functorParams);
+    CastOffSystemsParams *params = vrv_cast<CastOffSystemsParams *>(functorParams);
     assert(params);
 
     if (params->m_pendingObjects.empty()) return FUNCTOR_STOP;
@@ -27,7 +27,7 @@ TextElement::TextElement() : Object("te-"), AttCommon(), AttTyped()
     Reset();
 }
 
-TextElement::TextElement(std::string classid) : Object(classid), AttCommon(), AttTyped()
+TextElement::TextElement(const char *classid) : Object(classid), AttCommon(), AttTyped()
 {
     RegisterAttClass(ATT_COMMON);
     RegisterAttClass(ATT_TYPED);
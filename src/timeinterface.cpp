@@ -93,7 +93,7 @@ std::string TimePointInterface::ExtractUuidFragment(std::string refUuid)
 Measure *TimePointInterface::GetStartMeasure()
 {
     if (!m_start) return NULL;
-    return dynamic_cast<Measure *>(this->m_start->GetFirstParent(MEASURE));
+    return vrv_cast<Measure *>(this->m_start->GetFirstParent(MEASURE));
 }
 
 bool TimePointInterface::IsOnStaff(int n)
@@ -107,7 +107,7 @@ bool TimePointInterface::IsOnStaff(int n)
         return false;
     }
     else if (m_start) {
-        Staff *staff = dynamic_cast<Staff *>(m_start->GetFirstParent(STAFF));
+        Staff *staff = vrv_cast<Staff *>(m_start->GetFirstParent(STAFF));
         if (staff && (staff->GetN() == n)) return true;
     }
     return false;
@@ -122,7 +122,7 @@ std::vector<Staff *> TimePointInterface::GetTstampStaves(Measure *measure)
         staffList = this->GetStaff();
     }
     else if (m_start && !m_start->Is(TIMESTAMP_ATTR)) {
-        Staff *staff = dynamic_cast<Staff *>(m_start->GetFirstParent(STAFF));
+        Staff *staff = vrv_cast<Staff *>(m_start->GetFirstParent(STAFF));
         if (staff) staffList.push_back(staff->GetN());
     }
     else if (measure->GetChildCount(STAFF) == 1) {
@@ -188,7 +188,8 @@ bool TimeSpanningInterface::SetStartAndEnd(LayerElement *element)
     if (!m_start && !m_startUuid.empty() && (element->GetUuid() == m_startUuid)) {
         this->SetStart(element);
     }
-    else if (!m_end && !m_endUuid.empty() && (element->GetUuid() == m_endUuid)) {
+    // Not an else if since @startid and @endid can be identical
+    if (!m_end && !m_endUuid.empty() && (element->GetUuid() == m_endUuid)) {
         this->SetEnd(element);
     }
     return (m_start && m_end);
@@ -197,7 +198,7 @@ bool TimeSpanningInterface::SetStartAndEnd(LayerElement *element)
 Measure *TimeSpanningInterface::GetEndMeasure()
 {
     if (!m_end) return NULL;
-    return dynamic_cast<Measure *>(this->m_end->GetFirstParent(MEASURE));
+    return vrv_cast<Measure *>(this->m_end->GetFirstParent(MEASURE));
 }
 
 bool TimeSpanningInterface::IsSpanningMeasures()
@@ -212,7 +213,7 @@ bool TimeSpanningInterface::IsSpanningMeasures()
 
 int TimePointInterface::InterfacePrepareTimestamps(FunctorParams *functorParams, Object *object)
 {
-    PrepareTimestampsParams *params = dynamic_cast<PrepareTimestampsParams *>(functorParams);
+    PrepareTimestampsParams *params = vrv_cast<PrepareTimestampsParams *>(functorParams);
     assert(params);
 
     // First we check if the object has already a mapped @startid (it should not)
@@ -241,39 +242,62 @@ int TimePointInterface::InterfaceResetDrawing(FunctorParams *functorParams, Obje
 
 int TimePointInterface::InterfacePrepareTimePointing(FunctorParams *functorParams, Object *object)
 {
-    PrepareTimePointingParams *params = dynamic_cast<PrepareTimePointingParams *>(functorParams);
+    PrepareTimePointingParams *params = vrv_cast<PrepareTimePointingParams *>(functorParams);
     assert(params);
 
     if (!this->HasStartid()) return FUNCTOR_CONTINUE;
 
     this->SetUuidStr();
-    params->m_timePointingInterfaces.push_back(std::make_pair(this, object->GetClassId()));
+    // Keep it until the element is reached (see LayerElement::PrepareTimePointing)
+    params->m_timePointingInterfaces[m_startUuid].push_back(std::make_pair(this, object->GetClassId()));
 
     return FUNCTOR_CONTINUE;
 }
 
 int TimeSpanningInterface::InterfacePrepareTimeSpanning(FunctorParams *functorParams, Object *object)
 {
-    PrepareTimeSpanningParams *params = dynamic_cast<PrepareTimeSpanningParams *>(functorParams);
+    PrepareTimeSpanningParams *params = vrv_cast<PrepareTimeSpanningParams *>(functorParams);
     assert(params);
 
     if (!this->HasStartid() && !this->HasEndid()) {
         return FUNCTOR_CONTINUE;
     }
 
-    if (params->m_fillList == false) {
-        return FUNCTOR_CONTINUE;
-    }
-
     this->SetUuidStr();
-    params->m_timeSpanningInterfaces.push_back(std::make_pair(this, object->GetClassId()));
+    std::pair<TimeSpanningInterface *, ClassId> interface = std::make_pair(this, object->GetClassId());
+
+    // Dir, dynam and harm are only matched with the elements of their measure (not processed yet when going backward)
+    // They are dropped at the end of the measure (see Measure::PrepareTimeSpanningEnd)
+    bool measureOnly = object->Is({ DIR, DYNAM, HARM });
+    if (!measureOnly) params->m_timeSpanningInterfaces.push_back(interface);
+
+    std::vector<std::string> uuids;
+    if (!m_startUuid.empty()) uuids.push_back(m_startUuid);
+    if (!m_endUuid.empty() && (m_endUuid != m_startUuid)) uuids.push_back(m_endUuid);
+    for (auto &uuid : uuids) {
+        // The element was already processed because it comes after in the encoding
+        if (!measureOnly) {
+            MapOfLayerElementsByUuid::iterator element = params->m_layerElements.find(uuid);
+            if (element != params->m_layerElements.end()) {
+                this->SetStartAndEnd(element->second);
+                continue;
+            }
+        }
+        // Otherwise keep it until the element is reached (see LayerElement::PrepareTimeSpanning)
+        if (measureOnly) {
+            params->m_measurePendingInterfaces[uuid].push_back(interface);
+        }
+        else {
+            params->m_pendingInterfaces[uuid].push_back(interface);
+        }
+    }
 
     return FUNCTOR_CONTINUE;
 }
 
 int TimeSpanningInterface::InterfacePrepareTimestamps(FunctorParams *functorParams, Object *object)
 {
-    PrepareTimestampsParams *params = dynamic_cast<PrepareTimestampsParams *>(functorParams);
+    PrepareTimestampsParams *params = vrv_cast<PrepareTimestampsParams *>(functorParams);
     assert(params);
 
     // First we check if the object has already a mapped @endid (it should not)
@@ -300,7 +324,7 @@ int TimeSpanningInterface::InterfacePrepareTimestamps(FunctorParams *functorPara
 
 int TimeSpanningInterface::InterfaceFillStaffCurrentTimeSpanning(FunctorParams *functorParams, Object *object)
 {
-    FillStaffCurrentTimeSpanningParams *params = dynamic_cast<FillStaffCurrentTimeSpanningParams *>(functorParams);
+    FillStaffCurrentTimeSpanningParams *params = vrv_cast<FillStaffCurrentTimeSpanningParams *>(functorParams);
     assert(params);
 
     if (this->IsSpanningMeasures()) {
@@ -9,7 +9,10 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <assert.h>
+#include <atomic>
+#include <thread>
 
 //----------------------------------------------------------------------------
 
@@ -39,16 +42,56 @@ namespace vrv {
 const char *UTF_16_BE_BOM = "\xFE\xFF";
 const char *UTF_16_LE_BOM = "\xFF\xFE";
 
+// "VRVL" and the version of the layout snapshot format
+const uint32_t LAYOUT_SNAPSHOT_MAGIC = 0x4c565256;
+const uint32_t LAYOUT_SNAPSHOT_VERSION = 1;
+
 //----------------------------------------------------------------------------
-// Toolkit
+// Layout snapshot helpers
 //----------------------------------------------------------------------------
 
-char *Toolkit::m_humdrumBuffer = NULL;
+static void WriteSnapshotWord(std::string &snapshot, uint32_t word)
+{
+    for (int i = 0; i < 4; i++) {
+        snapshot.push_back((char)((word >> (8 * i)) & 0xFF));
+    }
+}
+
+static void WriteSnapshotString(std::string &snapshot, const std::string &str)
+{
+    WriteSnapshotWord(snapshot, (uint32_t)str.size());
+    snapshot += str;
+}
 
-Toolkit::Toolkit(bool initFont)
+static bool ReadSnapshotWord(const std::string &snapshot, size_t &pos, uint32_t &word)
+{
+    if (pos + 4 > snapshot.size()) return false;
+    word = 0;
+    for (int i = 0; i < 4; i++) {
+        word |= (uint32_t)(unsigned char)snapshot[pos + i] << (8 * i);
+    }
+    pos += 4;
+    return true;
+}
+
+static bool ReadSnapshotString(const std::string &snapshot, size_t &pos, std::string &str)
+{
+    uint32_t length = 0;
+    if (!ReadSnapshotWord(snapshot, pos, length) || (pos + length > snapshot.size())) return false;
+    str = snapshot.substr(pos, length);
+    pos += length;
+    return true;
+}
+
+//----------------------------------------------------------------------------
+// ToolkitOptions
+//----------------------------------------------------------------------------
+
+ToolkitOptions::ToolkitOptions()
 {
     m_scale = DEFAULT_SCALE;
     m_format = AUTO;
+    m_outformat = UNKNOWN;
 
     // default page size
     m_pageHeight = DEFAULT_PAGE_HEIGHT;
@@ -64,14 +107,24 @@ Toolkit::Toolkit(bool initFont)
     m_adjustPageHeight = false;
     m_noJustification = false;
     m_evenNoteSpacing = false;
+    m_humType = 0;
+    m_layoutThreads = 1;
     m_showBoundingBoxes = false;
     m_scoreBasedMei = false;
+}
+
+//----------------------------------------------------------------------------
+// Toolkit
+//----------------------------------------------------------------------------
 
+Toolkit::Toolkit(bool initFont)
+{
     m_cString = NULL;
     m_humdrumBuffer = NULL;
 
+    m_resourcePath = Resources::GetPath();
     if (initFont) {
-        Resources::InitFonts();
+        m_doc.SetResources(Resources::GetResources(m_resourcePath, m_font));
     }
 }
 
@@ -89,10 +142,23 @@ Toolkit::~Toolkit()
 
 bool Toolkit::SetResourcePath(const std::string &path)
 {
-    Resources::SetPath(path);
-    return Resources::InitFonts();
+    const Resources *resources = Resources::GetResources(path, m_font);
+    if (!resources) return false;
+    m_resourcePath = path;
+    m_doc.SetResources(resources);
+    return true;
 };
 
+void Toolkit::CopyOptions(const Toolkit &toolkit)
+{
+    m_options = toolkit.m_options;
+
+    // The resources are immutable and can be shared
+    m_font = toolkit.m_font;
+    m_resourcePath = toolkit.m_resourcePath;
+    m_doc.SetResources(toolkit.m_doc.GetResources());
+}
+
 bool Toolkit::SetBorder(int border)
 {
     // We use left margin values because for now we cannot specify different values for each margin
@@ -101,7 +167,7 @@ bool Toolkit::SetBorder(int border)
             MIN_PAGE_LEFT_MAR, MAX_PAGE_LEFT_MAR);
         return false;
     }
-    m_border = border;
+    m_options.m_border = border;
     return true;
 }
 
@@ -112,7 +178,7 @@ bool Toolkit::SetScale(int scale)
             MAX_SCALE);
         return false;
     }
-    m_scale = scale;
+    m_options.m_scale = scale;
     return true;
 }
 
@@ -123,7 +189,7 @@ bool Toolkit::SetPageHeight(int h)
             MIN_PAGE_HEIGHT, MAX_PAGE_HEIGHT);
         return false;
     }
-    m_pageHeight = h;
+    m_options.m_pageHeight = h;
     return true;
 }
 
@@ -134,7 +200,7 @@ bool Toolkit::SetPageWidth(int w)
             MIN_PAGE_WIDTH, MAX_PAGE_WIDTH);
         return false;
     }
-    m_pageWidth = w;
+    m_options.m_pageWidth = w;
     return true;
 };
 
@@ -145,7 +211,7 @@ bool Toolkit::SetSpacingStaff(int spacingStaff)
             MIN_SPACING_STAFF, MAX_SPACING_STAFF);
         return false;
     }
-    m_spacingStaff = spacingStaff;
+    m_options.m_spacingStaff = spacingStaff;
     return true;
 }
 
@@ -156,7 +222,7 @@ bool Toolkit::SetSpacingSystem(int spacingSystem)
             DEFAULT_SPACING_SYSTEM, MIN_SPACING_SYSTEM, MAX_SPACING_SYSTEM);
         return false;
     }
-    m_spacingSystem = spacingSystem;
+    m_options.m_spacingSystem = spacingSystem;
     return true;
 }
 
@@ -167,7 +233,7 @@ bool Toolkit::SetSpacingLinear(float spacingLinear)
             DEFAULT_SPACING_LINEAR, MIN_SPACING_LINEAR, MAX_SPACING_LINEAR);
         return false;
     }
-    m_spacingLinear = spacingLinear;
+    m_options.m_spacingLinear = spacingLinear;
     return true;
 }
 
@@ -178,20 +244,20 @@ bool Toolkit::SetSpacingNonLinear(float spacingNonLinear)
             DEFAULT_SPACING_NON_LINEAR, MIN_SPACING_NON_LINEAR, MAX_SPACING_NON_LINEAR);
         return false;
     }
-    m_spacingNonLinear = spacingNonLinear;
+    m_options.m_spacingNonLinear = spacingNonLinear;
     return true;
 }
 
 bool Toolkit::SetOutputFormat(std::string const &outformat)
 {
     if (outformat == "humdrum") {
-        m_outformat = HUMDRUM;
+        m_options.m_outformat = HUMDRUM;
     }
     else if (outformat == "mei") {
-        m_outformat = MEI;
+        m_options.m_outformat = MEI;
     }
     else if (outformat == "midi") {
-        m_outformat = MIDI;
+        m_options.m_outformat = MIDI;
     }
     else if (outformat != "svg") {
         LogError("Output format can only be: mei, humdrum, midi or svg");
@@ -203,25 +269,25 @@ bool Toolkit::SetOutputFormat(std::string const &outformat)
 bool Toolkit::SetFormat(std::string const &informat)
 {
     if (informat == "pae") {
-        m_format = PAE;
+        m_options.m_format = PAE;
     }
     else if (informat == "darms") {
-        m_format = DARMS;
+        m_options.m_format = DARMS;
     }
     else if (informat == "humdrum") {
-        m_format = HUMDRUM;
+        m_options.m_format = HUMDRUM;
     }
     else if (informat == "mei") {
-        m_format = MEI;
+        m_options.m_format = MEI;
     }
     else if (informat == "musicxml") {
-        m_format = MUSICXML;
+        m_options.m_format = MUSICXML;
     }
     else if (informat == "musicxml-hum") {
-        m_format = MUSICXMLHUM;
+        m_options.m_format = MUSICXMLHUM;
     }
     else if (informat == "auto") {
-        m_format = AUTO;
+        m_options.m_format = AUTO;
     }
     else {
         LogError("Input format can only be: mei, humdrum, pae, musicxml or darms");
@@ -232,18 +298,20 @@ bool Toolkit::SetFormat(std::string const &informat)
 
 void Toolkit::SetAppXPathQueries(std::vector<std::string> const &xPathQueries)
 {
-    m_appXPathQueries = xPathQueries;
-    m_appXPathQueries.erase(std::remove_if(m_appXPathQueries.begin(), m_appXPathQueries.end(),
-                                [](const std::string &s) { return s.empty(); }),
-        m_appXPathQueries.end());
+    m_options.m_appXPathQueries = xPathQueries;
+    m_options.m_appXPathQueries.erase(std::remove_if(m_options.m_appXPathQueries.begin(),
+                                          m_options.m_appXPathQueries.end(),
+                                          [](const std::string &s) { return s.empty(); }),
+        m_options.m_appXPathQueries.end());
 }
 
 void Toolkit::SetChoiceXPathQueries(std::vector<std::string> const &xPathQueries)
 {
-    m_choiceXPathQueries = xPathQueries;
-    m_choiceXPathQueries.erase(std::remove_if(m_choiceXPathQueries.begin(), m_choiceXPathQueries.end(),
-                                   [](const std::string &s) { return s.empty(); }),
-        m_choiceXPathQueries.end());
+    m_options.m_choiceXPathQueries = xPathQueries;
+    m_options.m_choiceXPathQueries.erase(std::remove_if(m_options.m_choiceXPathQueries.begin(),
+                                             m_options.m_choiceXPathQueries.end(),
+                                             [](const std::string &s) { return s.empty(); }),
+        m_options.m_choiceXPathQueries.end());
 }
 
 FileFormat Toolkit::IdentifyInputFormat(const string &data)
@@ -328,7 +396,11 @@ FileFormat Toolkit::IdentifyInputFormat(const string &data)
 
 bool Toolkit::SetFont(std::string const &font)
 {
-    return Resources::SetFont(font);
+    const Resources *resources = Resources::GetResources(m_resourcePath, font);
+    if (!resources) return false;
+    m_font = font;
+    m_doc.SetResources(resources);
+    return true;
 };
 
 bool Toolkit::LoadFile(const std::string &filename)
@@ -409,7 +481,7 @@ bool Toolkit::LoadData(const std::string &data)
     string newData;
     FileInputStream *input = NULL;
 
-    auto inputFormat = m_format;
+    auto inputFormat = m_options.m_format;
     if (inputFormat == AUTO) {
         inputFormat = IdentifyInputFormat(data);
     }
@@ -424,32 +496,14 @@ bool Toolkit::LoadData(const std::string &data)
     else if (inputFormat == HUMDRUM) {
         // LogMessage("Importing Humdrum data");
 
-        Doc tempdoc;
-        HumdrumInput *tempinput = new HumdrumInput(&tempdoc, "");
-        tempinput->SetTypeOption(GetHumType());
+        // The Humdrum data is imported directly into the document (no MEI round trip)
+        HumdrumInput *humdrumInput = new HumdrumInput(&m_doc, "");
+        humdrumInput->SetTypeOption(GetHumType());
 
         if (GetOutputFormat() == HUMDRUM) {
-            tempinput->SetOutputFormat("humdrum");
+            humdrumInput->SetOutputFormat("humdrum");
         }
-
-        if (!tempinput->ImportString(data)) {
-            LogError("Error importing Humdrum data");
-            delete tempinput;
-            return false;
-        }
-
-        SetHumdrumBuffer(tempinput->GetHumdrumString().c_str());
-
-        if (GetOutputFormat() == HUMDRUM) {
-            return true;
-        }
-
-        MeiOutput meioutput(&tempdoc, "");
-        meioutput.SetScoreBasedMEI(true);
-        newData = meioutput.GetOutput();
-        delete tempinput;
-
-        input = new MeiInput(&m_doc, "");
+        input = humdrumInput;
     }
 #endif
     else if (inputFormat == MEI) {
@@ -471,23 +525,13 @@ bool Toolkit::LoadData(const std::string &data)
             LogError("Error converting MusicXML");
             return false;
         }
-        std::string buffer = conversion.str();
-        SetHumdrumBuffer(buffer.c_str());
-
-        // Now convert Humdrum into MEI:
-        Doc tempdoc;
-        FileInputStream *tempinput = new HumdrumInput(&tempdoc, "");
-        tempinput->SetTypeOption(GetHumType());
-        if (!tempinput->ImportString(conversion.str())) {
-            LogError("Error importing Humdrum data");
-            delete tempinput;
-            return false;
-        }
-        MeiOutput meioutput(&tempdoc, "");
-        meioutput.SetScoreBasedMEI(true);
-        newData = meioutput.GetOutput();
-        delete tempinput;
-        input = new MeiInput(&m_doc, "");
+        newData = conversion.str();
+        SetHumdrumBuffer(newData.c_str());
+
+        // Now import the Humdrum data directly into the document
+        HumdrumInput *humdrumInput = new HumdrumInput(&m_doc, "");
+        humdrumInput->SetTypeOption(GetHumType());
+        input = humdrumInput;
     }
 #endif
     else {
@@ -502,14 +546,14 @@ bool Toolkit::LoadData(const std::string &data)
     }
 
     // xpath queries?
-    if (m_appXPathQueries.size() > 0) {
-        input->SetAppXPathQueries(m_appXPathQueries);
+    if (m_options.m_appXPathQueries.size() > 0) {
+        input->SetAppXPathQueries(m_options.m_appXPathQueries);
     }
-    if (m_choiceXPathQueries.size() > 0) {
-        input->SetChoiceXPathQueries(m_choiceXPathQueries);
+    if (m_options.m_choiceXPathQueries.size() > 0) {
+        input->SetChoiceXPathQueries(m_options.m_choiceXPathQueries);
     }
-    if (m_mdivXPathQuery.length() > 0) {
-        input->SetMdivXPathQuery(m_mdivXPathQuery);
+    if (m_options.m_mdivXPathQuery.length() > 0) {
+        input->SetMdivXPathQuery(m_options.m_mdivXPathQuery);
     }
 
     // load the file
@@ -519,6 +563,20 @@ bool Toolkit::LoadData(const std::string &data)
         return false;
     }
 
+#ifndef NO_HUMDRUM_SUPPORT
+    if (inputFormat == HUMDRUM) {
+        HumdrumInput *humdrumInput = dynamic_cast<HumdrumInput *>(input);
+        assert(humdrumInput);
+        SetHumdrumBuffer(humdrumInput->GetHumdrumString().c_str());
+
+        // Only the Humdrum buffer is needed
+        if (GetOutputFormat() == HUMDRUM) {
+            delete input;
+            return true;
+        }
+    }
+#endif
+
     m_doc.SetPageHeight(this->GetPageHeight());
     m_doc.SetPageWidth(this->GetPageWidth());
     m_doc.SetPageRightMar(this->GetBorder());
@@ -529,6 +587,7 @@ bool Toolkit::LoadData(const std::string &data)
     m_doc.SetSpacingStaff(this->GetSpacingStaff());
     m_doc.SetSpacingSystem(this->GetSpacingSystem());
     m_doc.SetEvenSpacing(this->GetEvenNoteSpacing());
+    m_doc.SetLayoutThreads(this->GetLayoutThreads());
 
     m_doc.PrepareDrawing();
 
@@ -536,21 +595,25 @@ bool Toolkit::LoadData(const std::string &data)
     // DARMS have no layout information. MEI files _can_ have it, but it
     // might have been ignored because of the --ignore-layout option.
     // Regardless, we won't do layout if the --no-layout option was set.
-    if (!m_noLayout) {
-        if (input->HasLayoutInformation() && !m_ignoreLayout) {
+    if (!m_options.m_noLayout) {
+        if (input->HasLayoutInformation() && !m_options.m_ignoreLayout) {
             // LogElapsedTimeStart();
             m_doc.CastOffEncodingDoc();
             // LogElapsedTimeEnd("layout");
         }
-        else {
+        else if (m_layoutCacheFile.empty()) {
             // LogElapsedTimeStart();
             m_doc.CastOffDoc();
             // LogElapsedTimeEnd("layout");
         }
+        else if (!this->LoadLayoutSnapshot(data)) {
+            m_doc.CastOffDoc();
+            this->SaveLayoutSnapshot(data);
+        }
     }
 
     // disable justification if there's no layout or no justification
-    if (m_noLayout || m_noJustification) {
+    if (m_options.m_noLayout || m_options.m_noJustification) {
         m_doc.SetJustificationX(false);
     }
 
@@ -560,6 +623,118 @@ bool Toolkit::LoadData(const std::string &data)
     return true;
 }
 
+uint64_t Toolkit::GetLayoutSnapshotKey(const std::string &data)
+{
+    // Everything that changes the system and page breaks
+    std::string options = StringFormat("%s %d %d %d %d %d %d %f %f %d %d %s %s", vrv::GetVersion().c_str(),
+        m_options.m_format, m_options.m_pageHeight, m_options.m_pageWidth, m_options.m_border,
+        m_options.m_spacingStaff, m_options.m_spacingSystem, m_options.m_spacingLinear, m_options.m_spacingNonLinear,
+        m_options.m_evenNoteSpacing, m_options.m_humType, m_font.c_str(), m_options.m_mdivXPathQuery.c_str());
+    std::vector<std::string>::iterator iter;
+    for (iter = m_options.m_appXPathQueries.begin(); iter != m_options.m_appXPathQueries.end(); iter++) {
+        options += " app:" + (*iter);
+    }
+    for (iter = m_options.m_choiceXPathQueries.begin(); iter != m_options.m_choiceXPathQueries.end(); iter++) {
+        options += " choice:" + (*iter);
+    }
+
+    // 64-bit FNV-1a hash of the data and of the options
+    uint64_t key = 14695981039346656037ULL;
+    std::string::const_iterator c;
+    for (c = data.begin(); c != data.end(); c++) {
+        key = (key ^ (unsigned char)(*c)) * 1099511628211ULL;
+    }
+    for (c = options.begin(); c != options.end(); c++) {
+        key = (key ^ (unsigned char)(*c)) * 1099511628211ULL;
+    }
+    return key;
+}
+
+bool Toolkit::LoadLayoutSnapshot(const std::string &data)
+{
+    std::ifstream in(m_layoutCacheFile.c_str(), std::ios::in | std::ios::binary);
+    if (!in.is_open()) {
+        return false;
+    }
+    std::string snapshot((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+
+    // See SaveLayoutSnapshot for the layout of the file
+    size_t pos = 0;
+    uint32_t magic = 0, version = 0, keyLow = 0, keyHigh = 0, pageCount = 0, systemCount = 0;
+    if (!ReadSnapshotWord(snapshot, pos, magic) || !ReadSnapshotWord(snapshot, pos, version)
+        || (magic != LAYOUT_SNAPSHOT_MAGIC) || (version != LAYOUT_SNAPSHOT_VERSION)) {
+        LogWarning("The layout cache file '%s' is not a valid layout snapshot", m_layoutCacheFile.c_str());
+        return false;
+    }
+    uint64_t key = this->GetLayoutSnapshotKey(data);
+    if (!ReadSnapshotWord(snapshot, pos, keyLow) || !ReadSnapshotWord(snapshot, pos, keyHigh)
+        || (keyLow != (uint32_t)key) || (keyHigh != (uint32_t)(key >> 32))) {
+        return false;
+    }
+
+    ArrayOfUuidCountPairs pages;
+    ArrayOfUuidCountPairs systems;
+    bool valid = (ReadSnapshotWord(snapshot, pos, pageCount) && ReadSnapshotWord(snapshot, pos, systemCount));
+    for (uint32_t i = 0; valid && (i < pageCount + systemCount); i++) {
+        std::pair<std::string, int> entry;
+        uint32_t count = 0;
+        valid = (ReadSnapshotString(snapshot, pos, entry.first) && ReadSnapshotWord(snapshot, pos, count));
+        entry.second = (int)count;
+        if (i < pageCount)
+            pages.push_back(entry);
+        else
+            systems.push_back(entry);
+    }
+    if (!valid || (pos != snapshot.size())) {
+        LogWarning("The layout snapshot in '%s' is truncated", m_layoutCacheFile.c_str());
+        return false;
+    }
+
+    if (!m_doc.ApplyCastOff(systems, pages)) {
+        LogWarning("The layout snapshot in '%s' does not match the data", m_layoutCacheFile.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool Toolkit::SaveLayoutSnapshot(const std::string &data)
+{
+    ArrayOfUuidCountPairs pages;
+    ArrayOfUuidCountPairs systems;
+    m_doc.GetCastOff(systems, pages);
+
+    // The snapshot is made of 32-bit little-endian words and of strings preceded by their length:
+    // magic, version, key (low and high words), page count, system count,
+    // and then the uuid and the child count of each page and of each system
+    std::string snapshot;
+    uint64_t key = this->GetLayoutSnapshotKey(data);
+    WriteSnapshotWord(snapshot, LAYOUT_SNAPSHOT_MAGIC);
+    WriteSnapshotWord(snapshot, LAYOUT_SNAPSHOT_VERSION);
+    WriteSnapshotWord(snapshot, (uint32_t)key);
+    WriteSnapshotWord(snapshot, (uint32_t)(key >> 32));
+    WriteSnapshotWord(snapshot, (uint32_t)pages.size());
+    WriteSnapshotWord(snapshot, (uint32_t)systems.size());
+    ArrayOfUuidCountPairs::iterator iter;
+    for (iter = pages.begin(); iter != pages.end(); iter++) {
+        WriteSnapshotString(snapshot, iter->first);
+        WriteSnapshotWord(snapshot, (uint32_t)iter->second);
+    }
+    for (iter = systems.begin(); iter != systems.end(); iter++) {
+        WriteSnapshotString(snapshot, iter->first);
+        WriteSnapshotWord(snapshot, (uint32_t)iter->second);
+    }
+
+    std::ofstream out(m_layoutCacheFile.c_str(), std::ios::out | std::ios::binary);
+    if (!out.is_open()) {
+        LogError("Unable to write the layout snapshot to '%s'", m_layoutCacheFile.c_str());
+        return false;
+    }
+    out.write(snapshot.data(), snapshot.size());
+    out.close();
+    return true;
+}
+
 std::string Toolkit::GetMEI(int pageNo, bool scoreBased)
 {
     // Page number is one-based - correct it to 0-based first
@@ -573,7 +748,7 @@ std::string Toolkit::GetMEI(int pageNo, bool scoreBased)
 bool Toolkit::SaveFile(const std::string &filename)
 {
     MeiOutput meioutput(&m_doc, filename.c_str());
-    meioutput.SetScoreBasedMEI(m_scoreBasedMei);
+    meioutput.SetScoreBasedMEI(m_options.m_scoreBasedMei);
     if (!meioutput.ExportFile()) {
         LogError("Unknown error");
         return false;
@@ -703,6 +878,41 @@ std::string Toolkit::GetElementAttr(const std::string &xmlId)
 #endif
 }
 
+std::string Toolkit::GetMdivs(const std::string &data)
+{
+#if defined(USE_EMSCRIPTEN) || defined(PYTHON_BINDING)
+    jsonxx::Array a;
+
+    if (IdentifyInputFormat(data) != MEI) {
+        LogError("The <mdiv> elements can be listed only for MEI data");
+        return a.json();
+    }
+    MeiMdivScan scan;
+    if (!scan.Scan(data)) {
+        LogMessage("No <mdiv> could be found");
+        return a.json();
+    }
+
+    // Fill the JSON array with one object per <mdiv>
+    pugi::xpath_node_set mdivs = scan.GetMdivs();
+    pugi::xpath_node_set::const_iterator iter;
+    for (iter = mdivs.begin(); iter != mdivs.end(); iter++) {
+        jsonxx::Object o;
+        pugi::xml_attribute attribute;
+        for (attribute = iter->node().first_attribute(); attribute; attribute = attribute.next_attribute()) {
+            o << attribute.name() << attribute.value();
+        }
+        o << "xPathQuery" << scan.GetMdivXPathQuery(iter->node());
+        a << o;
+    }
+    return a.json();
+
+#else
+    // The non-js version of the app should not use this function.
+    return "";
+#endif
+}
+
 bool Toolkit::Edit(const std::string &json_editorAction)
 {
 #ifdef USE_EMSCRIPTEN
@@ -790,8 +1000,9 @@ void Toolkit::RedoLayout()
     m_doc.SetSpacingStaff(this->GetSpacingStaff());
     m_doc.SetSpacingSystem(this->GetSpacingSystem());
 
+    // Only the page size and the spacing options changed, so the horizontal layout of the measures can be kept
     m_doc.UnCastOffDoc();
-    m_doc.CastOffDoc();
+    m_doc.CastOffDoc(true);
 }
 
 void Toolkit::RedoPagePitchPosLayout()
@@ -806,42 +1017,57 @@ void Toolkit::RedoPagePitchPosLayout()
     page->LayOutPitchPos();
 }
 
-std::string Toolkit::RenderToSvg(int pageNo, bool xml_declaration)
+SvgDeviceContext *Toolkit::CreateSvgDeviceContext()
 {
-    // Page number is one-based - correct it to 0-based first
-    pageNo--;
-
-    // Get the current system for the SVG clipping size
-    m_view.SetPage(pageNo);
-
     // Adjusting page width and height according to the options
-    int width = m_pageWidth;
-    int height = m_pageHeight;
+    int width = m_options.m_pageWidth;
+    int height = m_options.m_pageHeight;
 
-    if (m_noLayout) width = m_doc.GetAdjustedDrawingPageWidth();
-    if (m_adjustPageHeight || m_noLayout) height = m_doc.GetAdjustedDrawingPageHeight();
+    if (m_options.m_noLayout) width = m_doc.GetAdjustedDrawingPageWidth();
+    if (m_options.m_adjustPageHeight || m_options.m_noLayout) height = m_doc.GetAdjustedDrawingPageHeight();
 
     // Create the SVG object, h & w come from the system
     // We will need to set the size of the page after having drawn it depending on the options
-    SvgDeviceContext svg(width, height);
+    SvgDeviceContext *svg = new SvgDeviceContext(width, height);
 
     // set scale and border from user options
-    svg.SetUserScale(m_view.GetPPUFactor() * (double)m_scale / 100, m_view.GetPPUFactor() * (double)m_scale / 100);
+    svg->SetUserScale(m_view.GetPPUFactor() * (double)m_options.m_scale / 100,
+        m_view.GetPPUFactor() * (double)m_options.m_scale / 100);
 
     // debug BB?
-    svg.SetDrawBoundingBoxes(m_showBoundingBoxes);
+    svg->SetDrawBoundingBoxes(m_options.m_showBoundingBoxes);
+
+    return svg;
+}
+
+SvgDeviceContext *Toolkit::RenderToSvgDeviceContext(int pageNo)
+{
+    // Page number is one-based - correct it to 0-based first
+    pageNo--;
+
+    // Get the current system for the SVG clipping size
+    m_view.SetPage(pageNo);
+
+    SvgDeviceContext *svg = this->CreateSvgDeviceContext();
 
     // render the page
-    m_view.DrawCurrentPage(&svg, false);
+    m_view.DrawCurrentPage(svg, false);
+
+    return svg;
+}
 
-    std::string out_str = svg.GetStringSVG(xml_declaration);
+std::string Toolkit::RenderToSvg(int pageNo, bool xml_declaration)
+{
+    SvgDeviceContext *svg = this->RenderToSvgDeviceContext(pageNo);
+
+    std::string out_str;
+    svg->WriteSVG(out_str, xml_declaration);
+    delete svg;
     return out_str;
 }
 
 bool Toolkit::RenderToSvgFile(const std::string &filename, int pageNo)
 {
-    std::string output = RenderToSvg(pageNo, true);
-
     std::ofstream outfile;
     outfile.open(filename.c_str());
 
@@ -850,11 +1076,70 @@ bool Toolkit::RenderToSvgFile(const std::string &filename, int pageNo)
         return false;
     }
 
-    outfile << output;
+    // write the SVG directly to the file
+    SvgDeviceContext *svg = this->RenderToSvgDeviceContext(pageNo);
+    svg->WriteSVG(outfile, true);
+    delete svg;
+
     outfile.close();
     return true;
 }
 
+bool Toolkit::RenderAllToSvg(std::vector<std::string> &svgs, int threads, bool xml_declaration)
+{
+    int pageCount = this->GetPageCount();
+    svgs.assign(pageCount, "");
+
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    threads = std::min(threads, pageCount);
+
+    // Drawing the pages concurrently is possible only if they all share the drawing dimensions of the document
+    bool concurrent = (threads > 1) && (m_doc.GetType() != Transcription);
+    int i;
+    for (i = 0; concurrent && (i < pageCount); i++) {
+        Page *page = dynamic_cast<Page *>(m_doc.GetChild(i));
+        assert(page);
+        if (page->m_pageHeight != -1) concurrent = false;
+    }
+
+    if (!concurrent) {
+        for (i = 0; i < pageCount; i++) {
+            svgs.at(i) = this->RenderToSvg(i + 1, xml_declaration);
+        }
+        return true;
+    }
+
+    // The layout modifies the document and is done page by page first
+    std::vector<SvgDeviceContext *> svgDCs;
+    for (i = 0; i < pageCount; i++) {
+        m_view.SetPage(i);
+        svgDCs.push_back(this->CreateSvgDeviceContext());
+    }
+
+    // Then each worker draws the pages with its own view, the document being only read
+    std::atomic<int> nextPage(0);
+    auto renderPages = [&]() {
+        View view;
+        view.SetDoc(&m_doc);
+        int pageIdx;
+        while ((pageIdx = nextPage++) < pageCount) {
+            view.DrawLaidOutPage(svgDCs.at(pageIdx), pageIdx, false);
+            svgDCs.at(pageIdx)->WriteSVG(svgs.at(pageIdx), xml_declaration);
+            delete svgDCs.at(pageIdx);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (i = 0; i < threads; i++) {
+        workers.push_back(std::thread(renderPages));
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    return true;
+}
+
 std::string Toolkit::GetHumdrum()
 {
     return GetHumdrumBuffer();
@@ -901,12 +1186,10 @@ std::string Toolkit::GetElementsAtTime(int millisec)
     jsonxx::Object o;
     jsonxx::Array a;
 
-    double time = (double)(millisec * 120 / 1000);
-    NoteOnsetOffsetComparison matchTime(time);
     ArrayOfObjects notes;
-    // Here we would need to check that the midi export is done
+    // The time index is filled by the MIDI export
     if (m_doc.GetMidiExportDone()) {
-        m_doc.FindAllChildByAttComparison(&notes, &matchTime);
+        m_doc.GetNotesAtTime(&notes, m_doc.GetScoreTimeForRealTime(millisec));
 
         // Get the pageNo from the first note (if any)
         int pageNo = -1;
@@ -952,7 +1235,7 @@ int Toolkit::GetPageWithElement(const std::string &xmlId)
     if (!element) {
         return 0;
     }
-    Page *page = dynamic_cast<Page *>(element->GetFirstParent(PAGE));
+    Page *page = vrv_cast<Page *>(element->GetFirstParent(PAGE));
     if (!page) {
         return 0;
     }
@@ -963,10 +1246,10 @@ double Toolkit::GetTimeForElement(const std::string &xmlId)
 {
     Object *element = m_doc.FindChildByUuid(xmlId);
     double timeofElement = 0.0;
-    if (element->Is(NOTE)) {
+    if (element && element->Is(NOTE)) {
         Note *note = dynamic_cast<Note *>(element);
         assert(note);
-        timeofElement = note->m_playingOnset * 1000 / 120;
+        timeofElement = m_doc.GetRealTimeForScoreTime(note->m_playingOnset);
     }
     return timeofElement;
 }
@@ -1063,6 +1346,7 @@ const char *Toolkit::GetHumdrumBuffer()
 bool Toolkit::Drag(std::string elementId, int x, int y)
 {
     if (!m_doc.GetDrawingPage()) return false;
+    m_doc.ResetCastOffLayout();
 
     // Try to get the element on the current drawing page
     Object *element = m_doc.GetDrawingPage()->FindChildByUuid(elementId);
@@ -1074,7 +1358,7 @@ bool Toolkit::Drag(std::string elementId, int x, int y)
     if (element->Is(NOTE)) {
         Note *note = dynamic_cast<Note *>(element);
         assert(note);
-        Layer *layer = dynamic_cast<Layer *>(note->GetFirstParent(LAYER));
+        Layer *layer = vrv_cast<Layer *>(note->GetFirstParent(LAYER));
         if (!layer) return false;
         int oct;
         data_PITCHNAME pname
@@ -1090,6 +1374,7 @@ bool Toolkit::Insert(std::string elementType, std::string startid, std::string e
 {
     LogMessage("Insert!");
     if (!m_doc.GetDrawingPage()) return false;
+    m_doc.ResetCastOffLayout();
     Object *start = m_doc.GetDrawingPage()->FindChildByUuid(startid);
     Object *end = m_doc.GetDrawingPage()->FindChildByUuid(endid);
     // Check if both start and end elements exist
@@ -1107,7 +1392,7 @@ bool Toolkit::Insert(std::string elementType, std::string startid, std::string e
         return false;
     }
 
-    Measure *measure = dynamic_cast<Measure *>(start->GetFirstParent(MEASURE));
+    Measure *measure = vrv_cast<Measure *>(start->GetFirstParent(MEASURE));
     assert(measure);
     if (elementType == "slur") {
         Slur *slur = new Slur();
@@ -1123,6 +1408,7 @@ bool Toolkit::Insert(std::string elementType, std::string startid, std::string e
 bool Toolkit::Set(std::string elementId, std::string attrType, std::string attrValue)
 {
     if (!m_doc.GetDrawingPage()) return false;
+    m_doc.ResetCastOffLayout();
     Object *element = m_doc.GetDrawingPage()->FindChildByUuid(elementId);
     if (Att::SetCmn(element, attrType, attrValue)) return true;
     if (Att::SetCmnornaments(element, attrType, attrValue)) return true;
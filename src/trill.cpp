@@ -25,6 +25,7 @@ Trill::Trill() : ControlElement("trill-"), TimePointInterface(), AttColor(), Att
 {
     RegisterInterface(TimePointInterface::GetAttClasses(), TimePointInterface::IsInterface());
     RegisterAttClass(ATT_COLOR);
+    RegisterAttClass(ATT_ORNAMENTACCID);
     RegisterAttClass(ATT_PLACEMENT);
 
     Reset();
@@ -23,6 +23,73 @@
 
 namespace vrv {
 
+//----------------------------------------------------------------------------
+// HorizontalBBoxIndex
+//----------------------------------------------------------------------------
+
+void HorizontalBBoxIndex::Add(BoundingBox *box)
+{
+    assert(box);
+
+    m_boxes.push_back(box);
+    // Boxes without content bounding box never overlap
+    if (!box->HasContentBB()) return;
+
+    int left = box->GetContentLeft();
+    int width = box->GetContentRight() - left;
+    int group = HorizontalBBoxIndex::GetWidthGroup(width);
+    if (group >= (int)m_lefts.size()) {
+        m_lefts.resize(group + 1);
+        m_maxWidths.resize(group + 1, 0);
+    }
+    m_maxWidths.at(group) = std::max(m_maxWidths.at(group), width);
+    m_lefts.at(group).insert(std::make_pair(left, (int)m_boxes.size() - 1));
+}
+
+void HorizontalBBoxIndex::Clear()
+{
+    m_boxes.clear();
+    m_lefts.clear();
+    m_maxWidths.clear();
+}
+
+int HorizontalBBoxIndex::GetWidthGroup(int width)
+{
+    int group = 0;
+    while (width > 0) {
+        width >>= 1;
+        group++;
+    }
+    return group;
+}
+
+void HorizontalBBoxIndex::FindHorizontalContentOverlaps(const BoundingBox *box, ArrayOfBoundingBoxes *overlaps) const
+{
+    assert(box);
+    assert(overlaps);
+
+    overlaps->clear();
+    if (!box->HasContentBB()) return;
+
+    int left = box->GetContentLeft();
+    int right = box->GetContentRight();
+    std::vector<int> positions;
+    for (int group = 0; group < (int)m_lefts.size(); ++group) {
+        const std::set<std::pair<int, int> > &lefts = m_lefts.at(group);
+        if (lefts.empty()) continue;
+        // Only the boxes starting before the right of the box and less than the largest width of the group before
+        // its left can overlap
+        auto iter = lefts.lower_bound(std::make_pair(left - m_maxWidths.at(group), 0));
+        auto end = lefts.lower_bound(std::make_pair(right, 0));
+        for (; iter != end; ++iter) {
+            if (box->HorizontalContentOverlap(m_boxes.at(iter->second))) positions.push_back(iter->second);
+        }
+    }
+    // Keep the order in which they were added since the adjustments are cumulative
+    std::sort(positions.begin(), positions.end());
+    for (auto &position : positions) overlaps->push_back(m_boxes.at(position));
+}
+
 //----------------------------------------------------------------------------
 // SystemAligner
 //----------------------------------------------------------------------------
@@ -78,7 +145,7 @@ StaffAlignment *SystemAligner::GetStaffAlignmentForStaffN(int staffN) const
     StaffAlignment *alignment = NULL;
     int i;
     for (i = 0; i < this->GetChildCount(); i++) {
-        alignment = dynamic_cast<StaffAlignment *>(m_children.at(i));
+        alignment = vrv_cast<StaffAlignment *>(m_children.at(i));
         assert(alignment);
 
         if ((alignment->GetStaff()) && (alignment->GetStaff()->GetN() == staffN)) return alignment;
@@ -170,7 +237,7 @@ void StaffAlignment::SetVerseCount(int verse_count)
 int StaffAlignment::CalcOverflowAbove(BoundingBox *box)
 {
     if (box->Is(FLOATING_POSITIONER)) {
-        FloatingPositioner *positioner = dynamic_cast<FloatingPositioner *>(box);
+        FloatingPositioner *positioner = vrv_cast<FloatingPositioner *>(box);
         assert(positioner);
         return positioner->GetContentTop() - this->GetYRel();
     }
@@ -180,7 +247,7 @@ int StaffAlignment::CalcOverflowAbove(BoundingBox *box)
 int StaffAlignment::CalcOverflowBelow(BoundingBox *box)
 {
     if (box->Is(FLOATING_POSITIONER)) {
-        FloatingPositioner *positioner = dynamic_cast<FloatingPositioner *>(box);
+        FloatingPositioner *positioner = vrv_cast<FloatingPositioner *>(box);
         assert(positioner);
         return -(positioner->GetContentBottom() + m_staffHeight - this->GetYRel());
     }
@@ -210,7 +277,7 @@ void StaffAlignment::SetCurrentFloatingPositioner(FloatingObject *object, Object
 
 int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
 {
-    AdjustFloatingPostionersParams *params = dynamic_cast<AdjustFloatingPostionersParams *>(functorParams);
+    AdjustFloatingPostionersParams *params = vrv_cast<AdjustFloatingPostionersParams *>(functorParams);
     assert(params);
 
     int staffSize = this->GetStaffSize();
@@ -225,11 +292,12 @@ int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
             this->SetOverflowBelow(this->m_overflowBelow + this->GetVerseCount() * (height - descender + margin));
             // For now just clear the overflowBelow, which avoids the overlap to be calculated. We could also keep them
             // and check if they are some lyrics in order to know if the overlap needs to be calculated or not.
-            m_overflowBelowBBoxes.clear();
+            m_overflowBelowBBoxes.Clear();
         }
         return FUNCTOR_SIBLINGS;
     }
 
+    ArrayOfBoundingBoxes overlaps;
     ArrayOfFloatingPositioners::iterator iter;
     for (iter = m_floatingPositioners.begin(); iter != m_floatingPositioners.end(); ++iter) {
         assert((*iter)->GetObject());
@@ -245,7 +313,7 @@ int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
             bool skipBelow = false;
 
             if ((*iter)->GetObject()->Is(SLUR)) {
-                Slur *slur = dynamic_cast<Slur *>((*iter)->GetObject());
+                Slur *slur = vrv_cast<Slur *>((*iter)->GetObject());
                 assert(slur);
                 slur->GetCrossStaffOverflows(this, (*iter)->m_cuvreDir, skipAbove, skipBelow);
             }
@@ -255,7 +323,7 @@ int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
             if (overflowAbove > params->m_doc->GetDrawingStaffLineWidth(staffSize) / 2) {
                 // LogMessage("%sparams->m_doctop overflow: %d", current->GetUuid().c_str(), overflowAbove);
                 this->SetOverflowAbove(overflowAbove);
-                this->m_overflowAboveBBoxes.push_back((*iter));
+                this->m_overflowAboveBBoxes.Add((*iter));
             }
 
             int overflowBelow = 0;
@@ -263,7 +331,7 @@ int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
             if (overflowBelow > params->m_doc->GetDrawingStaffLineWidth(staffSize) / 2) {
                 // LogMessage("%s bottom overflow: %d", current->GetUuid().c_str(), overflowBelow);
                 this->SetOverflowBelow(overflowBelow);
-                this->m_overflowBelowBBoxes.push_back((*iter));
+                this->m_overflowBelowBBoxes.Add((*iter));
             }
             continue;
         }
@@ -271,32 +339,28 @@ int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
         // This sets the default position (without considering any overflowing box)
         (*iter)->CalcDrawingYRel(params->m_doc, this, NULL);
 
-        ArrayOfBoundingBoxes *overflowBoxes = &m_overflowBelowBBoxes;
+        HorizontalBBoxIndex *overflowBoxes = &m_overflowBelowBBoxes;
         // above?
         if ((*iter)->GetDrawingPlace() == STAFFREL_above) {
             overflowBoxes = &m_overflowAboveBBoxes;
         }
-        auto i = overflowBoxes->begin();
-        auto end = overflowBoxes->end();
-        while (i != end) {
-            // find all the overflowing elements from the staff that overlap horizonatally
-            i = std::find_if(i, end, [iter](BoundingBox *elem) { return (*iter)->HorizontalContentOverlap(elem); });
-            if (i != end) {
-                // update the yRel accordingly
-                (*iter)->CalcDrawingYRel(params->m_doc, this, *i);
-                i++;
-            }
+        // find all the overflowing elements from the staff that overlap horizonatally
+        overflowBoxes->FindHorizontalContentOverlaps((*iter), &overlaps);
+        ArrayOfBoundingBoxes::iterator i;
+        for (i = overlaps.begin(); i != overlaps.end(); ++i) {
+            // update the yRel accordingly
+            (*iter)->CalcDrawingYRel(params->m_doc, this, *i);
         }
         //  Now update the staffAlignment max overflow (above or below) and add the positioner to the list of
         //  overflowing elements
         if ((*iter)->GetDrawingPlace() == STAFFREL_above) {
             int overflowAbove = this->CalcOverflowAbove((*iter));
-            overflowBoxes->push_back((*iter));
+            overflowBoxes->Add((*iter));
             this->SetOverflowAbove(overflowAbove);
         }
         else {
             int overflowBelow = this->CalcOverflowBelow((*iter));
-            overflowBoxes->push_back((*iter));
+            overflowBoxes->Add((*iter));
             this->SetOverflowBelow(overflowBelow);
         }
     }
@@ -306,7 +370,7 @@ int StaffAlignment::AdjustFloatingPostioners(FunctorParams *functorParams)
 
 int StaffAlignment::AdjustFloatingPostionerGrps(FunctorParams *functorParams)
 {
-    AdjustFloatingPostionerGrpsParams *params = dynamic_cast<AdjustFloatingPostionerGrpsParams *>(functorParams);
+    AdjustFloatingPostionerGrpsParams *params = vrv_cast<AdjustFloatingPostionerGrpsParams *>(functorParams);
     assert(params);
 
     ArrayOfFloatingPositioners positioners;
@@ -360,7 +424,7 @@ int StaffAlignment::AdjustFloatingPostionerGrps(FunctorParams *functorParams)
 
 int StaffAlignment::AdjustStaffOverlap(FunctorParams *functorParams)
 {
-    AdjustStaffOverlapParams *params = dynamic_cast<AdjustStaffOverlapParams *>(functorParams);
+    AdjustStaffOverlapParams *params = vrv_cast<AdjustStaffOverlapParams *>(functorParams);
     assert(params);
 
     // This is the bottom alignment (or something is wrong)
@@ -371,25 +435,22 @@ int StaffAlignment::AdjustStaffOverlap(FunctorParams *functorParams)
         return FUNCTOR_SIBLINGS;
     }
 
-    ArrayOfBoundingBoxes::iterator iter;
+    ArrayOfBoundingBoxes overlaps;
+    ArrayOfBoundingBoxes::const_iterator iter;
     // go through all the elements of the top staff that have an overflow below
-    for (iter = params->m_previous->m_overflowBelowBBoxes.begin();
-         iter != params->m_previous->m_overflowBelowBBoxes.end(); iter++) {
-        auto i = m_overflowAboveBBoxes.begin();
-        auto end = m_overflowAboveBBoxes.end();
-        while (i != end) {
-            // find all the elements from the bottom staff that have an overflow at the top with an horizontal overap
-            i = std::find_if(i, end, [iter](BoundingBox *elem) { return (*iter)->HorizontalContentOverlap(elem); });
-            if (i != end) {
-                // calculate the vertical overlap and see if this is more than the expected space
-                int overflowBelow = params->m_previous->CalcOverflowBelow(*iter);
-                int overflowAbove = this->CalcOverflowAbove(*i);
-                int spacing = std::max(params->m_previous->m_overflowBelow, this->m_overflowAbove);
-                if (spacing < (overflowBelow + overflowAbove)) {
-                    // LogDebug("Overlap %d", (overflowBelow + overflowAbove) - spacing);
-                    this->SetOverlap((overflowBelow + overflowAbove) - spacing);
-                }
-                i++;
+    const ArrayOfBoundingBoxes *previousBoxes = params->m_previous->m_overflowBelowBBoxes.GetBoxes();
+    for (iter = previousBoxes->begin(); iter != previousBoxes->end(); iter++) {
+        // find all the elements from the bottom staff that have an overflow at the top with an horizontal overap
+        m_overflowAboveBBoxes.FindHorizontalContentOverlaps(*iter, &overlaps);
+        ArrayOfBoundingBoxes::iterator i;
+        for (i = overlaps.begin(); i != overlaps.end(); ++i) {
+            // calculate the vertical overlap and see if this is more than the expected space
+            int overflowBelow = params->m_previous->CalcOverflowBelow(*iter);
+            int overflowAbove = this->CalcOverflowAbove(*i);
+            int spacing = std::max(params->m_previous->m_overflowBelow, this->m_overflowAbove);
+            if (spacing < (overflowBelow + overflowAbove)) {
+                // LogDebug("Overlap %d", (overflowBelow + overflowAbove) - spacing);
+                this->SetOverlap((overflowBelow + overflowAbove) - spacing);
             }
         }
     }
@@ -401,7 +462,7 @@ int StaffAlignment::AdjustStaffOverlap(FunctorParams *functorParams)
 
 int StaffAlignment::AlignVerticallyEnd(FunctorParams *functorParams)
 {
-    AlignVerticallyParams *params = dynamic_cast<AlignVerticallyParams *>(functorParams);
+    AlignVerticallyParams *params = vrv_cast<AlignVerticallyParams *>(functorParams);
     assert(params);
 
     SetYRel(-params->m_cumulatedShift);
@@ -413,7 +474,7 @@ int StaffAlignment::AlignVerticallyEnd(FunctorParams *functorParams)
 
 int StaffAlignment::AdjustYPos(FunctorParams *functorParams)
 {
-    AdjustYPosParams *params = dynamic_cast<AdjustYPosParams *>(functorParams);
+    AdjustYPosParams *params = vrv_cast<AdjustYPosParams *>(functorParams);
     assert(params);
 
     int maxOverlfowAbove;
@@ -35,6 +35,8 @@ View::View()
     m_currentMeasure = NULL;
     m_currentStaff = NULL;
     m_currentSystem = NULL;
+
+    m_bBoxDC = NULL;
 }
 
 View::~View()
@@ -107,6 +109,14 @@ void View::Next(bool forward)
     SetPage(m_pageIdx);
 }
 
+std::string View::GetGraphicUuid(Object *object) const
+{
+    assert(object);
+
+    if (m_bBoxDC) return "";
+    return object->GetUuid();
+}
+
 int View::ToDeviceContextX(int i)
 {
     return i;
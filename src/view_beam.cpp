@@ -76,7 +76,7 @@ void View::DrawBeam(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     /******************************************************************/
     // Start the Beam graphic and draw the children
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     /******************************************************************/
     // Draw the children
@@ -305,7 +305,7 @@ void View::DrawFTrem(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     /******************************************************************/
     // Start the grahic
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     /******************************************************************/
     // Draw the children
@@ -13,6 +13,7 @@
 #include <iostream>
 #define _USE_MATH_DEFINES // needed by Windows for math constants like "M_PI"
 #include <math.h>
+#include <mutex>
 #include <sstream>
 
 //----------------------------------------------------------------------------
@@ -53,6 +54,9 @@
 
 namespace vrv {
 
+/** Guards the drawing of the elements spanning over several systems (see View::DrawLaidOutPage) */
+static std::mutex s_timeSpanningMutex;
+
 //----------------------------------------------------------------------------
 // View - FloatingObject - ControlElement
 //----------------------------------------------------------------------------
@@ -68,57 +72,57 @@ void View::DrawControlElement(DeviceContext *dc, ControlElement *element, Measur
     if (element->HasInterface(INTERFACE_TIME_SPANNING) && !element->Is(DIR) && !element->Is(DYNAM)
         && !element->Is(FERMATA) && !element->Is(HARM)) {
         // create placeholder
-        dc->StartGraphic(element, "", element->GetUuid());
+        dc->StartGraphic(element, "", GetGraphicUuid(element));
         dc->EndGraphic(element, this);
         system->AddToDrawingList(element);
     }
     else if (element->Is(BREATH)) {
-        Breath *breath = dynamic_cast<Breath *>(element);
+        Breath *breath = vrv_cast<Breath *>(element);
         assert(breath);
         DrawBreath(dc, breath, measure, system);
     }
     else if (element->Is(DIR)) {
-        Dir *dir = dynamic_cast<Dir *>(element);
+        Dir *dir = vrv_cast<Dir *>(element);
         assert(dir);
         DrawDir(dc, dir, measure, system);
     }
     else if (element->Is(DYNAM)) {
-        Dynam *dynam = dynamic_cast<Dynam *>(element);
+        Dynam *dynam = vrv_cast<Dynam *>(element);
         assert(dynam);
         DrawDynam(dc, dynam, measure, system);
     }
     else if (element->Is(FERMATA)) {
-        Fermata *fermata = dynamic_cast<Fermata *>(element);
+        Fermata *fermata = vrv_cast<Fermata *>(element);
         assert(fermata);
         DrawFermata(dc, fermata, measure, system);
     }
     else if (element->Is(HARM)) {
-        Harm *harm = dynamic_cast<Harm *>(element);
+        Harm *harm = vrv_cast<Harm *>(element);
         assert(harm);
         DrawHarm(dc, harm, measure, system);
     }
     else if (element->Is(MORDENT)) {
-        Mordent *mordent = dynamic_cast<Mordent *>(element);
+        Mordent *mordent = vrv_cast<Mordent *>(element);
         assert(mordent);
         DrawMordent(dc, mordent, measure, system);
     }
     else if (element->Is(PEDAL)) {
-        Pedal *pedal = dynamic_cast<Pedal *>(element);
+        Pedal *pedal = vrv_cast<Pedal *>(element);
         assert(pedal);
         DrawPedal(dc, pedal, measure, system);
     }
     else if (element->Is(TEMPO)) {
-        Tempo *tempo = dynamic_cast<Tempo *>(element);
+        Tempo *tempo = vrv_cast<Tempo *>(element);
         assert(tempo);
         DrawTempo(dc, tempo, measure, system);
     }
     else if (element->Is(TRILL)) {
-        Trill *trill = dynamic_cast<Trill *>(element);
+        Trill *trill = vrv_cast<Trill *>(element);
         assert(trill);
         DrawTrill(dc, trill, measure, system);
     }
     else if (element->Is(TURN)) {
-        Turn *turn = dynamic_cast<Turn *>(element);
+        Turn *turn = vrv_cast<Turn *>(element);
         assert(turn);
         DrawTurn(dc, turn, measure, system);
     }
@@ -144,8 +148,13 @@ void View::DrawTimeSpanningElement(DeviceContext *dc, Object *element, System *s
     if (!interface->HasStartAndEnd()) return;
 
     // Get the parent system of the first and last note
-    System *parentSystem1 = dynamic_cast<System *>(interface->GetStart()->GetFirstParent(SYSTEM));
-    System *parentSystem2 = dynamic_cast<System *>(interface->GetEnd()->GetFirstParent(SYSTEM));
+    System *parentSystem1 = vrv_cast<System *>(interface->GetStart()->GetFirstParent(SYSTEM));
+    System *parentSystem2 = vrv_cast<System *>(interface->GetEnd()->GetFirstParent(SYSTEM));
+
+    // The element is drawn from each system it spans over, possibly by views drawing other pages concurrently,
+    // and its current floating positioner is shared between them
+    std::unique_lock<std::mutex> lock(s_timeSpanningMutex, std::defer_lock);
+    if ((system != parentSystem1) || (system != parentSystem2)) lock.lock();
 
     int x1, x2;
     Object *objectX = NULL;
@@ -284,13 +293,13 @@ void View::DrawHairpin(
     if (start->Is(TIMESTAMP_ATTR))
         layer1 = dynamic_cast<Layer *>(staff->FindChildByType(LAYER));
     else
-        layer1 = dynamic_cast<Layer *>(start->GetFirstParent(LAYER));
+        layer1 = vrv_cast<Layer *>(start->GetFirstParent(LAYER));
 
     // idem
     if (end->Is(TIMESTAMP_ATTR))
         layer2 = dynamic_cast<Layer *>(staff->FindChildByType(LAYER));
     else
-        layer2 = dynamic_cast<Layer *>(end->GetFirstParent(LAYER));
+        layer2 = vrv_cast<Layer *>(end->GetFirstParent(LAYER));
 
     assert(layer1 && layer2);
 
@@ -388,7 +397,7 @@ void View::DrawHairpin(
     y2 -= m_doc->GetDrawingStemWidth(staff->m_drawingStaffSize) / 2;
 
     if (graphic)
-        dc->ResumeGraphic(graphic, graphic->GetUuid());
+        dc->ResumeGraphic(graphic, GetGraphicUuid(graphic));
     else
         dc->StartGraphic(hairpin, "spanning-hairpin", "");
     // dc->DeactivateGraphic();
@@ -446,7 +455,7 @@ void View::DrawOctave(
     /************** draw it **************/
 
     if (graphic)
-        dc->ResumeGraphic(graphic, graphic->GetUuid());
+        dc->ResumeGraphic(graphic, GetGraphicUuid(graphic));
     else
         dc->StartGraphic(octave, "spanning-octave", "");
 
@@ -555,7 +564,7 @@ void View::DrawSlur(DeviceContext *dc, Slur *slur, int x1, int x2, Staff *staff,
     }
 
     if (start->Is(NOTE)) {
-        startNote = dynamic_cast<Note *>(start);
+        startNote = vrv_cast<Note *>(start);
         assert(startNote);
         startParentChord = startNote->IsChordTone();
         startStemDir = startNote->GetDrawingStemDir();
@@ -566,7 +575,7 @@ void View::DrawSlur(DeviceContext *dc, Slur *slur, int x1, int x2, Staff *staff,
         startStemDir = startChord->GetDrawingStemDir();
     }
     if (end->Is(NOTE)) {
-        endNote = dynamic_cast<Note *>(end);
+        endNote = vrv_cast<Note *>(end);
         assert(endNote);
         endParentChord = endNote->IsChordTone();
         endStemDir = endNote->GetDrawingStemDir();
@@ -584,13 +593,13 @@ void View::DrawSlur(DeviceContext *dc, Slur *slur, int x1, int x2, Staff *staff,
     //if (start->Is(TIMESTAMP_ATTR))
     //    layer1 = dynamic_cast<Layer *>(staff->FindChildByType(LAYER));
     //else
-    layer1 = dynamic_cast<Layer *>(start->GetFirstParent(LAYER));
+    layer1 = vrv_cast<Layer *>(start->GetFirstParent(LAYER));
 
     // idem
     //if (end->Is(TIMESTAMP_ATTR))
     //    layer2 = dynamic_cast<Layer *>(staff->FindChildByType(LAYER));
     //else
-    layer2 = dynamic_cast<Layer *>(end->GetFirstParent(LAYER));
+    layer2 = vrv_cast<Layer *>(end->GetFirstParent(LAYER));
 
     assert(layer1 && layer2);
 
@@ -817,7 +826,7 @@ void View::DrawSlur(DeviceContext *dc, Slur *slur, int x1, int x2, Staff *staff,
         start->FindAllChildByAttComparison(&artics, &matchType);
         // Then the @n of each first staffDef
         for (articIter = artics.begin(); articIter != artics.end(); articIter++) {
-            Artic *artic = dynamic_cast<Artic *>(*articIter);
+            Artic *artic = vrv_cast<Artic *>(*articIter);
             assert(artic);
             ArticPart *outsidePart = artic->GetOutsidePart();
             if (outsidePart) {
@@ -835,7 +844,7 @@ void View::DrawSlur(DeviceContext *dc, Slur *slur, int x1, int x2, Staff *staff,
         end->FindAllChildByAttComparison(&artics, &matchType);
         // Then the @n of each first staffDef
         for (articIter = artics.begin(); articIter != artics.end(); articIter++) {
-            Artic *artic = dynamic_cast<Artic *>(*articIter);
+            Artic *artic = vrv_cast<Artic *>(*articIter);
             assert(artic);
             ArticPart *outsidePart = artic->GetOutsidePart();
             if (outsidePart) {
@@ -850,7 +859,7 @@ void View::DrawSlur(DeviceContext *dc, Slur *slur, int x1, int x2, Staff *staff,
     }
 
     if (graphic)
-        dc->ResumeGraphic(graphic, graphic->GetUuid());
+        dc->ResumeGraphic(graphic, GetGraphicUuid(graphic));
     else
         dc->StartGraphic(slur, "spanning-slur", "");
     DrawThickBezierCurve(dc, points, thickness, staff->m_drawingStaffSize, angle);
@@ -910,21 +919,25 @@ float View::AdjustSlur(Slur *slur, Staff *staff, int layerN, curvature_CURVEDIR
 
     /************** content **************/
 
-    System *system = dynamic_cast<System *>(staff->GetFirstParent(SYSTEM));
+    System *system = vrv_cast<System *>(staff->GetFirstParent(SYSTEM));
     assert(system);
     FindTimeSpanningLayerElementsParams findTimeSpanningLayerElementsParams;
     findTimeSpanningLayerElementsParams.m_minPos = p1->x;
     findTimeSpanningLayerElementsParams.m_maxPos = p2->x;
-    std::vector<AttComparison *> filters;
-    // Create ad comparison object for each type / @n
     // For now we only look at one layer (assumed layer1 == layer2)
-    AttCommonNComparison matchStaff(STAFF, staff->GetN());
-    AttCommonNComparison matchLayer(LAYER, layerN);
-    filters.push_back(&matchStaff);
-    filters.push_back(&matchLayer);
-
-    Functor timeSpanningLayerElements(&Object::FindTimeSpanningLayerElements);
-    system->Process(&timeSpanningLayerElements, &findTimeSpanningLayerElementsParams, NULL, &filters);
+    // Use the index of the system when the layout is done, otherwise (e.g., horizontal layout) process the system
+    if (!system->GetLayerElementsBetween(
+            &findTimeSpanningLayerElementsParams.m_spanningContent, staff->GetN(), layerN, p1->x, p2->x)) {
+        std::vector<AttComparison *> filters;
+        // Create ad comparison object for each type / @n
+        AttCommonNComparison matchStaff(STAFF, staff->GetN());
+        AttCommonNComparison matchLayer(LAYER, layerN);
+        filters.push_back(&matchStaff);
+        filters.push_back(&matchLayer);
+
+        Functor timeSpanningLayerElements(&Object::FindTimeSpanningLayerElements);
+        system->Process(&timeSpanningLayerElements, &findTimeSpanningLayerElementsParams, NULL, &filters);
+    }
     // if (spanningContent.size() > 12) LogDebug("### %d %s", spanningContent.size(), slur->GetUuid().c_str());
 
     ArrayOfLayerElementPointPairs spanningContentPoints;
@@ -1267,8 +1280,8 @@ void View::DrawTie(DeviceContext *dc, Tie *tie, int x1, int x2, Staff *staff, ch
 
     parentChord1 = note1->IsChordTone();
 
-    Layer *layer1 = dynamic_cast<Layer *>(note1->GetFirstParent(LAYER));
-    Layer *layer2 = dynamic_cast<Layer *>(note2->GetFirstParent(LAYER));
+    Layer *layer1 = vrv_cast<Layer *>(note1->GetFirstParent(LAYER));
+    Layer *layer2 = vrv_cast<Layer *>(note2->GetFirstParent(LAYER));
     assert(layer1 && layer2);
 
     if (layer1->GetN() != layer2->GetN()) {
@@ -1419,7 +1432,7 @@ void View::DrawTie(DeviceContext *dc, Tie *tie, int x1, int x2, Staff *staff, ch
     tie->GetCurrentFloatingPositioner()->UpdateCurvePosition(bezier, 0.0, thickness, drawingCurveDir);
 
     if (graphic)
-        dc->ResumeGraphic(graphic, graphic->GetUuid());
+        dc->ResumeGraphic(graphic, GetGraphicUuid(graphic));
     else
         dc->StartGraphic(tie, "spanning-tie", "");
     DrawThickBezierCurve(dc, bezier, thickness, staff->m_drawingStaffSize);
@@ -1466,7 +1479,7 @@ void View::DrawSylConnector(
     }
 
     if (graphic) {
-        dc->ResumeGraphic(graphic, graphic->GetUuid());
+        dc->ResumeGraphic(graphic, GetGraphicUuid(graphic));
     }
     else
         dc->StartGraphic(syl, "spanning-connector", "");
@@ -1542,7 +1555,7 @@ void View::DrawBreath(DeviceContext *dc, Breath *breath, Measure *measure, Syste
     // Cannot draw a breath that has no start position
     if (!breath->GetStart()) return;
 
-    dc->StartGraphic(breath, "", breath->GetUuid());
+    dc->StartGraphic(breath, "", GetGraphicUuid(breath));
 
     int x = breath->GetStart()->GetDrawingX();
 
@@ -1579,7 +1592,7 @@ void View::DrawDir(DeviceContext *dc, Dir *dir, Measure *measure, System *system
     // Cannot draw a dir that has no start position
     if (!dir->GetStart()) return;
 
-    dc->StartGraphic(dir, "", dir->GetUuid());
+    dc->StartGraphic(dir, "", GetGraphicUuid(dir));
 
     FontInfo dirTxt;
 
@@ -1626,7 +1639,7 @@ void View::DrawDynam(DeviceContext *dc, Dynam *dynam, Measure *measure, System *
     // Cannot draw dynamics that have no start position
     if (!dynam->GetStart()) return;
 
-    dc->StartGraphic(dynam, "", dynam->GetUuid());
+    dc->StartGraphic(dynam, "", GetGraphicUuid(dynam));
 
     bool isSymbolOnly = dynam->IsSymbolOnly();
     std::wstring dynamSymbol;
@@ -1683,7 +1696,7 @@ void View::DrawFb(DeviceContext *dc, Staff *staff, Fb *fb, int x, int y, bool &s
     assert(dc);
     assert(fb);
 
-    dc->StartGraphic(fb, "", fb->GetUuid());
+    dc->StartGraphic(fb, "", GetGraphicUuid(fb));
 
     FontInfo *fontDim = m_doc->GetDrawingLyricFont(staff->m_drawingStaffSize);
     int descender = -m_doc->GetTextGlyphDescender(L'q', fontDim, false);
@@ -1729,7 +1742,7 @@ void View::DrawFermata(DeviceContext *dc, Fermata *fermata, Measure *measure, Sy
     // Cannot draw a fermata that has no start position
     if (!fermata->GetStart()) return;
 
-    dc->StartGraphic(fermata, "", fermata->GetUuid());
+    dc->StartGraphic(fermata, "", GetGraphicUuid(fermata));
 
     int x = fermata->GetStart()->GetDrawingX();
 
@@ -1784,7 +1797,7 @@ void View::DrawHarm(DeviceContext *dc, Harm *harm, Measure *measure, System *sys
     // Cannot draw a harmony indication that has no start position
     if (!harm->GetStart()) return;
 
-    dc->StartGraphic(harm, "", harm->GetUuid());
+    dc->StartGraphic(harm, "", GetGraphicUuid(harm));
 
     FontInfo dirTxt;
 
@@ -1836,7 +1849,7 @@ void View::DrawMordent(DeviceContext *dc, Mordent *mordent, Measure *measure, Sy
     // Cannot draw a mordent that has no start position
     if (!mordent->GetStart()) return;
 
-    dc->StartGraphic(mordent, "", mordent->GetUuid());
+    dc->StartGraphic(mordent, "", GetGraphicUuid(mordent));
 
     int x = mordent->GetStart()->GetDrawingX();
 
@@ -1938,7 +1951,7 @@ void View::DrawPedal(DeviceContext *dc, Pedal *pedal, Measure *measure, System *
     // Cannot draw a pedal that has no start position
     if (!pedal->GetStart()) return;
 
-    dc->StartGraphic(pedal, "", pedal->GetUuid());
+    dc->StartGraphic(pedal, "", GetGraphicUuid(pedal));
 
     int x = pedal->GetStart()->GetDrawingX();
 
@@ -1979,7 +1992,7 @@ void View::DrawTempo(DeviceContext *dc, Tempo *tempo, Measure *measure, System *
     // Cannot draw a tempo that has no start position
     if (!tempo->GetStart()) return;
 
-    dc->StartGraphic(tempo, "", tempo->GetUuid());
+    dc->StartGraphic(tempo, "", GetGraphicUuid(tempo));
 
     FontInfo tempoTxt;
 
@@ -2039,7 +2052,7 @@ void View::DrawTrill(DeviceContext *dc, Trill *trill, Measure *measure, System *
     // Cannot draw a trill that has no start position
     if (!trill->GetStart()) return;
 
-    dc->StartGraphic(trill, "", trill->GetUuid());
+    dc->StartGraphic(trill, "", GetGraphicUuid(trill));
 
     int x = trill->GetStart()->GetDrawingX();
 
@@ -2099,7 +2112,7 @@ void View::DrawTurn(DeviceContext *dc, Turn *turn, Measure *measure, System *sys
     // Cannot draw a turn that has no start position
     if (!turn->GetStart()) return;
 
-    dc->StartGraphic(turn, "", turn->GetUuid());
+    dc->StartGraphic(turn, "", GetGraphicUuid(turn));
 
     int x = turn->GetStart()->GetDrawingX();
     if (turn->GetDelayed() == true) LogWarning("delayed turns not supported");
@@ -2149,29 +2162,29 @@ void View::DrawSystemElement(DeviceContext *dc, SystemElement *element, System *
     assert(system);
 
     if (element->Is(BOUNDARY_END)) {
-        BoundaryEnd *boundaryEnd = dynamic_cast<BoundaryEnd *>(element);
+        BoundaryEnd *boundaryEnd = vrv_cast<BoundaryEnd *>(element);
         assert(boundaryEnd);
         assert(boundaryEnd->GetStart());
-        dc->StartGraphic(element, boundaryEnd->GetStart()->GetUuid(), element->GetUuid());
+        dc->StartGraphic(element, GetGraphicUuid(boundaryEnd->GetStart()), GetGraphicUuid(element));
         dc->EndGraphic(element, this);
     }
     else if (element->Is(ENDING)) {
         // Create placeholder - A graphic for the end boundary will be created
         // but only if it is on a different system - See View::DrawEnding
         // The Ending is added to the System drawing list by View::DrawMeasure
-        dc->StartGraphic(element, "boundaryStart", element->GetUuid());
+        dc->StartGraphic(element, "boundaryStart", GetGraphicUuid(element));
         dc->EndGraphic(element, this);
     }
     else if (element->Is(PB)) {
-        dc->StartGraphic(element, "", element->GetUuid());
+        dc->StartGraphic(element, "", GetGraphicUuid(element));
         dc->EndGraphic(element, this);
     }
     else if (element->Is(SB)) {
-        dc->StartGraphic(element, "", element->GetUuid());
+        dc->StartGraphic(element, "", GetGraphicUuid(element));
         dc->EndGraphic(element, this);
     }
     else if (element->Is(SECTION)) {
-        dc->StartGraphic(element, "boundaryStart", element->GetUuid());
+        dc->StartGraphic(element, "boundaryStart", GetGraphicUuid(element));
         dc->EndGraphic(element, this);
     }
 }
@@ -2200,13 +2213,17 @@ void View::DrawEnding(DeviceContext *dc, Ending *ending, System *system)
     if (!ending->GetMeasure() || !endingEndBoundary->GetMeasure()) return;
 
     // Get the parent system of the first and last note
-    System *parentSystem1 = dynamic_cast<System *>(ending->GetFirstParent(SYSTEM));
-    System *parentSystem2 = dynamic_cast<System *>(endingEndBoundary->GetFirstParent(SYSTEM));
+    System *parentSystem1 = vrv_cast<System *>(ending->GetFirstParent(SYSTEM));
+    System *parentSystem2 = vrv_cast<System *>(endingEndBoundary->GetFirstParent(SYSTEM));
 
     assert(parentSystem1 && parentSystem2);
     // in non debug mode
     if (!parentSystem1 || !parentSystem2) return;
 
+    // Same as in View::DrawTimeSpanningElement - the current floating positioner is shared between the systems
+    std::unique_lock<std::mutex> lock(s_timeSpanningMutex, std::defer_lock);
+    if ((system != parentSystem1) || (system != parentSystem2)) lock.lock();
+
     int x1, x2;
     Object *objectX;
     Measure *measure = NULL;
@@ -2259,7 +2276,7 @@ void View::DrawEnding(DeviceContext *dc, Ending *ending, System *system)
     }
 
     if ((spanningType == SPANNING_START_END) || (spanningType == SPANNING_START))
-        dc->ResumeGraphic(ending, ending->GetUuid());
+        dc->ResumeGraphic(ending, GetGraphicUuid(ending));
     else
         dc->StartGraphic(ending, "spanning-ending", "");
 
@@ -190,7 +190,7 @@ void View::DrawAccid(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
         return;
     }
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     /************** editorial accidental **************/
 
@@ -230,12 +230,12 @@ void View::DrawArtic(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     assert(staff);
     assert(measure);
 
-    Artic *artic = dynamic_cast<Artic *>(element);
+    Artic *artic = vrv_cast<Artic *>(element);
     assert(artic);
 
     /************** draw the artic **************/
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     DrawLayerChildren(dc, artic, layer, staff, measure);
 
@@ -270,7 +270,7 @@ void View::DrawArticPart(DeviceContext *dc, LayerElement *element, Layer *layer,
 
     bool drawingCueSize = true;
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     dc->SetFont(m_doc->GetDrawingSmuflFont(staff->m_drawingStaffSize, drawingCueSize));
 
@@ -334,7 +334,7 @@ void View::DrawBarLine(DeviceContext *dc, LayerElement *element, Layer *layer, S
     assert(staff);
     assert(measure);
 
-    BarLine *barLine = dynamic_cast<BarLine *>(element);
+    BarLine *barLine = vrv_cast<BarLine *>(element);
     assert(barLine);
 
     if (barLine->GetForm() == BARRENDITION_invis) {
@@ -342,7 +342,7 @@ void View::DrawBarLine(DeviceContext *dc, LayerElement *element, Layer *layer, S
         return;
     }
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     int y = staff->GetDrawingY();
     DrawBarLine(dc, y, y - m_doc->GetDrawingStaffSize(staff->m_drawingStaffSize), barLine);
@@ -358,10 +358,10 @@ void View::DrawBeatRpt(DeviceContext *dc, LayerElement *element, Layer *layer, S
     assert(staff);
     assert(measure);
 
-    BeatRpt *beatRpt = dynamic_cast<BeatRpt *>(element);
+    BeatRpt *beatRpt = vrv_cast<BeatRpt *>(element);
     assert(beatRpt);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     int x = element->GetDrawingX();
     int xSymbol = x;
@@ -394,7 +394,7 @@ void View::DrawBTrem(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     assert(staff);
     assert(measure);
 
-    BTrem *bTrem = dynamic_cast<BTrem *>(element);
+    BTrem *bTrem = vrv_cast<BTrem *>(element);
     assert(bTrem);
 
     data_STEMDIRECTION stemDir = STEMDIRECTION_NONE;
@@ -426,7 +426,7 @@ void View::DrawBTrem(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
         return;
     }
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     DrawLayerChildren(dc, bTrem, layer, staff, measure);
 
@@ -515,7 +515,7 @@ void View::DrawChord(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     assert(staff);
     assert(measure);
 
-    Chord *chord = dynamic_cast<Chord *>(element);
+    Chord *chord = vrv_cast<Chord *>(element);
     assert(chord);
 
     if (chord->m_crossStaff) staff = chord->m_crossStaff;
@@ -528,6 +528,7 @@ void View::DrawChord(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
 
         CalcStemParams calcStemParams(this->m_doc);
         Functor calcStem(&Object::CalcStem);
+        calcStem.SetClassIds({ LAYER, BEAM, CHORD, FTREM, NOTE, STEM }, Functor::s_layerElementContainerIds);
         chord->Process(&calcStem, &calcStemParams);
     }
 
@@ -552,7 +553,7 @@ void View::DrawClef(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     assert(staff);
     assert(measure);
 
-    Clef *clef = dynamic_cast<Clef *>(element);
+    Clef *clef = vrv_cast<Clef *>(element);
     assert(clef);
 
     int y = staff->GetDrawingY();
@@ -637,7 +638,7 @@ void View::DrawClef(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
         }
     }
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     DrawSmuflCode(dc, x, y, sym, staff->m_drawingStaffSize, cueSize);
 
@@ -655,7 +656,7 @@ void View::DrawCustos(DeviceContext *dc, LayerElement *element, Layer *layer, St
     // Custos *custos = dynamic_cast<Custos *>(element);
     // assert(custos);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     int x = element->GetDrawingX();
     int y = element->GetDrawingY();
@@ -676,10 +677,10 @@ void View::DrawDot(DeviceContext *dc, LayerElement *element, Layer *layer, Staff
     assert(staff);
     assert(measure);
 
-    Dot *dot = dynamic_cast<Dot *>(element);
+    Dot *dot = vrv_cast<Dot *>(element);
     assert(dot);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     int x = element->GetDrawingX();
     int y = element->GetDrawingY();
@@ -703,10 +704,10 @@ void View::DrawDots(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     assert(staff);
     assert(measure);
 
-    Dots *dots = dynamic_cast<Dots *>(element);
+    Dots *dots = vrv_cast<Dots *>(element);
     assert(dots);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     MapOfDotLocs::const_iterator iter;
     const MapOfDotLocs *map = dots->GetMapOfDotLocs();
@@ -735,17 +736,17 @@ void View::DrawDurationElement(DeviceContext *dc, LayerElement *element, Layer *
     assert(measure);
 
     if (dynamic_cast<Chord *>(element)) {
-        dc->StartGraphic(element, "", element->GetUuid());
+        dc->StartGraphic(element, "", GetGraphicUuid(element));
         DrawChord(dc, element, layer, staff, measure);
         dc->EndGraphic(element, this);
     }
     else if (dynamic_cast<Note *>(element)) {
-        dc->StartGraphic(element, "", element->GetUuid());
+        dc->StartGraphic(element, "", GetGraphicUuid(element));
         DrawNote(dc, element, layer, staff, measure);
         dc->EndGraphic(element, this);
     }
     else if (dynamic_cast<Rest *>(element)) {
-        dc->StartGraphic(element, "", element->GetUuid());
+        dc->StartGraphic(element, "", GetGraphicUuid(element));
         DrawRest(dc, element, layer, staff, measure);
         dc->EndGraphic(element, this);
     }
@@ -759,16 +760,16 @@ void View::DrawFlag(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     assert(staff);
     assert(measure);
 
-    Flag *flag = dynamic_cast<Flag *>(element);
+    Flag *flag = vrv_cast<Flag *>(element);
     assert(flag);
 
-    Stem *stem = dynamic_cast<Stem *>(flag->GetFirstParent(STEM));
+    Stem *stem = vrv_cast<Stem *>(flag->GetFirstParent(STEM));
     assert(stem);
 
     int x = flag->GetDrawingX() - m_doc->GetDrawingStemWidth(staff->m_drawingStaffSize) / 2;
     int y = flag->GetDrawingY();
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     wchar_t code = flag->GetSmuflCode(stem->GetDrawingStemDir());
     DrawSmuflCode(dc, x, y, code, staff->m_drawingStaffSize, flag->IsCueSize());
@@ -814,7 +815,7 @@ void View::DrawKeySig(DeviceContext *dc, LayerElement *element, Layer *layer, St
         return;
     }
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     x = element->GetDrawingX();
     // HARDCODED
@@ -878,10 +879,10 @@ void View::DrawMeterSig(DeviceContext *dc, LayerElement *element, Layer *layer,
     assert(staff);
     assert(measure);
 
-    MeterSig *meterSig = dynamic_cast<MeterSig *>(element);
+    MeterSig *meterSig = vrv_cast<MeterSig *>(element);
     assert(meterSig);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     int y = staff->GetDrawingY() - m_doc->GetDrawingUnit(staff->m_drawingStaffSize) * (staff->m_drawingLines - 1);
     int x = element->GetDrawingX();
@@ -916,10 +917,10 @@ void View::DrawMRest(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     assert(staff);
     assert(measure);
 
-    MRest *mRest = dynamic_cast<MRest *>(element);
+    MRest *mRest = vrv_cast<MRest *>(element);
     assert(mRest);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     mRest->CenterDrawingX();
 
@@ -947,12 +948,12 @@ void View::DrawMRpt(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     assert(staff);
     assert(measure);
 
-    MRpt *mRpt = dynamic_cast<MRpt *>(element);
+    MRpt *mRpt = vrv_cast<MRpt *>(element);
     assert(mRpt);
 
     mRpt->CenterDrawingX();
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     DrawMRptPart(dc, element->GetDrawingX(), SMUFL_E500_repeat1Bar, mRpt->m_drawingMeasureCount, false, staff);
 
@@ -967,12 +968,12 @@ void View::DrawMRpt2(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     assert(staff);
     assert(measure);
 
-    MRpt2 *mRpt2 = dynamic_cast<MRpt2 *>(element);
+    MRpt2 *mRpt2 = vrv_cast<MRpt2 *>(element);
     assert(mRpt2);
 
     mRpt2->CenterDrawingX();
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     DrawMRptPart(dc, element->GetDrawingX(), SMUFL_E501_repeat2Bars, 2, true, staff);
 
@@ -987,14 +988,14 @@ void View::DrawMultiRest(DeviceContext *dc, LayerElement *element, Layer *layer,
     assert(staff);
     assert(measure);
 
-    MultiRest *multiRest = dynamic_cast<MultiRest *>(element);
+    MultiRest *multiRest = vrv_cast<MultiRest *>(element);
     assert(multiRest);
 
     multiRest->CenterDrawingX();
 
     int x1, x2, y1, y2, length;
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     int width = measure->GetInnerWidth();
     int xCentered = multiRest->GetDrawingX();
@@ -1066,12 +1067,12 @@ void View::DrawMultiRpt(DeviceContext *dc, LayerElement *element, Layer *layer,
     assert(staff);
     assert(measure);
 
-    MultiRpt *multiRpt = dynamic_cast<MultiRpt *>(element);
+    MultiRpt *multiRpt = vrv_cast<MultiRpt *>(element);
     assert(multiRpt);
 
     multiRpt->CenterDrawingX();
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     DrawMRptPart(dc, element->GetDrawingX(), SMUFL_E501_repeat2Bars, multiRpt->GetNum(), true, staff);
 
@@ -1144,9 +1145,9 @@ void View::DrawNote(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     /************** peripherals: **************/
 
     if (note->GetDrawingTieAttr()) {
-        System *system = dynamic_cast<System *>(measure->GetFirstParent(SYSTEM));
+        System *system = vrv_cast<System *>(measure->GetFirstParent(SYSTEM));
         // create a placeholder for the tie attribute that will be drawn from the system
-        dc->StartGraphic(note->GetDrawingTieAttr(), "", note->GetDrawingTieAttr()->GetUuid().c_str());
+        dc->StartGraphic(note->GetDrawingTieAttr(), "", GetGraphicUuid(note->GetDrawingTieAttr()));
         dc->EndGraphic(note->GetDrawingTieAttr(), this);
         if (system) system->AddToDrawingList(note->GetDrawingTieAttr());
     }
@@ -1164,7 +1165,7 @@ void View::DrawRest(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     assert(staff);
     assert(measure);
 
-    Rest *rest = dynamic_cast<Rest *>(element);
+    Rest *rest = vrv_cast<Rest *>(element);
     assert(rest);
 
     if (rest->IsMensural()) {
@@ -1210,7 +1211,7 @@ void View::DrawSpace(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     assert(staff);
     assert(measure);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
     dc->DrawPlaceholder(ToDeviceContextX(element->GetDrawingX()), ToDeviceContextY(element->GetDrawingY()));
     dc->EndGraphic(element, this);
 }
@@ -1226,7 +1227,7 @@ void View::DrawStem(DeviceContext *dc, LayerElement *element, Layer *layer, Staf
     Stem *stem = dynamic_cast<Stem *>(element);
     assert(stem);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     DrawFilledRectangle(dc, stem->GetDrawingX() - m_doc->GetDrawingStemWidth(staff->m_drawingStaffSize) / 2,
         stem->GetDrawingY(), stem->GetDrawingX() + m_doc->GetDrawingStemWidth(staff->m_drawingStaffSize) / 2,
@@ -1258,7 +1259,7 @@ void View::DrawSyl(DeviceContext *dc, LayerElement *element, Layer *layer, Staff
     syl->SetDrawingXRel(-m_doc->GetDrawingUnit(staff->m_drawingStaffSize) * 2);
     syl->SetDrawingYRel(GetSylYRel(syl, staff));
 
-    dc->StartGraphic(syl, "", syl->GetUuid());
+    dc->StartGraphic(syl, "", GetGraphicUuid(syl));
     dc->DeactivateGraphicY();
 
     dc->SetBrush(m_currentColour, AxSOLID);
@@ -1285,7 +1286,7 @@ void View::DrawSyl(DeviceContext *dc, LayerElement *element, Layer *layer, Staff
     dc->ResetBrush();
 
     if (syl->GetStart() && syl->GetEnd()) {
-        System *currentSystem = dynamic_cast<System *>(measure->GetFirstParent(SYSTEM));
+        System *currentSystem = vrv_cast<System *>(measure->GetFirstParent(SYSTEM));
         // Postpone the drawing of the syl to the end of the system; this will call DrawSylConnector
         // that will look if the last note is in the same system (or not) and draw the connectors accordingly
         if (currentSystem) {
@@ -1305,10 +1306,10 @@ void View::DrawTuplet(DeviceContext *dc, LayerElement *element, Layer *layer, St
     assert(staff);
     assert(measure);
 
-    Tuplet *tuplet = dynamic_cast<Tuplet *>(element);
+    Tuplet *tuplet = vrv_cast<Tuplet *>(element);
     assert(tuplet);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     // Draw the inner elements
     DrawLayerChildren(dc, tuplet, layer, staff, measure);
@@ -1327,10 +1328,10 @@ void View::DrawVerse(DeviceContext *dc, LayerElement *element, Layer *layer, Sta
     assert(staff);
     assert(measure);
 
-    Verse *verse = dynamic_cast<Verse *>(element);
+    Verse *verse = vrv_cast<Verse *>(element);
     assert(verse);
 
-    dc->StartGraphic(verse, "", verse->GetUuid());
+    dc->StartGraphic(verse, "", GetGraphicUuid(verse));
 
     DrawLayerChildren(dc, verse, layer, staff, measure);
 
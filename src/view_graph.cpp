@@ -14,6 +14,7 @@
 
 //----------------------------------------------------------------------------
 
+#include "bboxdevicecontext.h"
 #include "devicecontext.h"
 #include "doc.h"
 #include "style.h"
@@ -25,6 +26,12 @@ void View::DrawVerticalLine(DeviceContext *dc, int y1, int y2, int x1, int nbr)
 {
     assert(dc);
 
+    if (dc == m_bBoxDC) {
+        m_bBoxDC->UpdateLineBB(ToDeviceContextX(x1), ToDeviceContextY(y1), ToDeviceContextX(x1), ToDeviceContextY(y2),
+            std::max(1, ToDeviceContextX(nbr)));
+        return;
+    }
+
     dc->SetPen(m_currentColour, std::max(1, ToDeviceContextX(nbr)), AxSOLID);
     dc->SetBrush(m_currentColour, AxSOLID);
 
@@ -39,6 +46,12 @@ void View::DrawHorizontalLine(DeviceContext *dc, int x1, int x2, int y1, int nbr
 {
     assert(dc);
 
+    if (dc == m_bBoxDC) {
+        m_bBoxDC->UpdateLineBB(ToDeviceContextX(x1), ToDeviceContextY(y1), ToDeviceContextX(x2), ToDeviceContextY(y1),
+            std::max(1, ToDeviceContextX(nbr)));
+        return;
+    }
+
     dc->SetPen(m_currentColour, std::max(1, ToDeviceContextX(nbr)), AxSOLID);
     dc->SetBrush(m_currentColour, AxSOLID);
 
@@ -79,6 +92,12 @@ void View::DrawFilledRectangle(DeviceContext *dc, int x1, int y1, int x2, int y2
 
     BoundingBox::Swap(y1, y2);
 
+    if (dc == m_bBoxDC) {
+        m_bBoxDC->UpdateRectangleBB(
+            ToDeviceContextX(x1), ToDeviceContextY(y1), ToDeviceContextX(x2 - x1), ToDeviceContextX(y1 - y2), 0);
+        return;
+    }
+
     dc->SetPen(m_currentColour, 0, AxSOLID);
     dc->SetBrush(m_currentColour, AxSOLID);
 
@@ -148,6 +167,11 @@ void View::DrawDot(DeviceContext *dc, int x, int y, int staffSize)
 {
     int r = std::max(ToDeviceContextX(m_doc->GetDrawingDoubleUnit(staffSize) / 5), 2);
 
+    if (dc == m_bBoxDC) {
+        m_bBoxDC->BBoxDeviceContext::DrawCircle(ToDeviceContextX(x), ToDeviceContextY(y), r);
+        return;
+    }
+
     dc->SetPen(m_currentColour, 0, AxSOLID);
     dc->SetBrush(m_currentColour, AxSOLID);
 
@@ -163,6 +187,12 @@ void View::DrawSmuflCode(DeviceContext *dc, int x, int y, wchar_t code, int staf
 
     if (code == 0) return;
 
+    if (dc == m_bBoxDC) {
+        m_bBoxDC->UpdateGlyphBB(code, ToDeviceContextX(x), ToDeviceContextY(y),
+            m_doc->GetDrawingSmuflFont(staffSize, dimin)->GetPointSize(), setBBGlyph);
+        return;
+    }
+
     dc->SetBackground(AxBLUE);
     dc->SetBackgroundMode(AxTRANSPARENT);
 
@@ -187,6 +217,13 @@ void View::DrawSmuflString(
 
     int xDC = ToDeviceContextX(x);
 
+    // Centering needs the text extent, which is given with the font set
+    if ((dc == m_bBoxDC) && !center) {
+        m_bBoxDC->UpdateMusicTextBB(
+            s, xDC, ToDeviceContextY(y), m_doc->GetDrawingSmuflFont(staffSize, dimin)->GetPointSize(), setBBGlyph);
+        return;
+    }
+
     dc->SetBrush(m_currentColour, AxSOLID);
     dc->SetFont(m_doc->GetDrawingSmuflFont(staffSize, dimin));
 
@@ -145,7 +145,7 @@ void View::DrawMensuralRest(DeviceContext *dc, LayerElement *element, Layer *lay
 
     wchar_t charCode;
 
-    Rest *rest = dynamic_cast<Rest *>(element);
+    Rest *rest = vrv_cast<Rest *>(element);
     assert(rest);
 
     bool drawingCueSize = rest->IsCueSize();
@@ -179,7 +179,7 @@ void View::DrawMensur(DeviceContext *dc, LayerElement *element, Layer *layer, St
     Mensur *mensur = dynamic_cast<Mensur *>(element);
     assert(mensur);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     int x;
 
@@ -445,7 +445,7 @@ void View::DrawMaximaToBrevis(DeviceContext *dc, int y, LayerElement *element, L
     assert(layer);
     assert(staff);
 
-    Note *note = dynamic_cast<Note *>(element);
+    Note *note = vrv_cast<Note *>(element);
     assert(note);
 
     int xn, xLeft, xRight, yTop, yBottom, y3, y4;
@@ -520,10 +520,10 @@ void View::DrawLigature(DeviceContext *dc, LayerElement *element, Layer *layer,
     assert(layer);
     assert(staff);
 
-    Ligature *ligature = dynamic_cast<Ligature *>(element);
+    Ligature *ligature = vrv_cast<Ligature *>(element);
     assert(ligature);
 
-    dc->StartGraphic(ligature, "", ligature->GetUuid());
+    dc->StartGraphic(ligature, "", GetGraphicUuid(ligature));
 
     // Draw children (notes)
     DrawLayerChildren(dc, ligature, layer, staff, measure);
@@ -729,7 +729,7 @@ void View::DrawProport(DeviceContext *dc, LayerElement *element, Layer *layer, S
 
     Proport *proport = dynamic_cast<Proport *>(element);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
 
     int y = staff->GetDrawingY() - (m_doc->GetDrawingUnit(staff->m_drawingStaffSize) * 4);
     int x = element->GetDrawingX();
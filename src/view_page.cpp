@@ -14,6 +14,7 @@
 //----------------------------------------------------------------------------
 
 #include "attcomparison.h"
+#include "bboxdevicecontext.h"
 #include "beam.h"
 #include "clef.h"
 #include "controlelement.h"
@@ -52,6 +53,38 @@ void View::DrawCurrentPage(DeviceContext *dc, bool background)
 
     m_currentPage = m_doc->SetDrawingPage(m_pageIdx);
 
+    DrawPage(dc, background);
+}
+
+void View::DrawLaidOutPage(DeviceContext *dc, int pageIdx, bool background)
+{
+    assert(dc);
+    assert(m_doc);
+    assert(m_doc->HasPage(pageIdx));
+
+    m_pageIdx = pageIdx;
+    m_currentPage = vrv_cast<Page *>(m_doc->GetChild(pageIdx));
+    assert(m_currentPage);
+
+    m_currentElement = NULL;
+    m_currentLayer = NULL;
+    m_currentMeasure = NULL;
+    m_currentStaff = NULL;
+    m_currentSystem = NULL;
+
+    DrawPage(dc, background);
+}
+
+void View::DrawPage(DeviceContext *dc, bool background)
+{
+    assert(dc);
+    assert(m_currentPage);
+
+    dc->SetResources(m_doc->GetResources());
+    dc->SetDoc(m_doc);
+
+    m_bBoxDC = (dc->Is(BBOX_DEVICE_CONTEXT)) ? vrv_cast<BBoxDeviceContext *>(dc) : NULL;
+
     int i;
 
     // Keep the width of the initial scoreDef
@@ -77,6 +110,8 @@ void View::DrawCurrentPage(DeviceContext *dc, bool background)
     }
 
     dc->EndPage();
+
+    m_bBoxDC = NULL;
 }
 
 double View::GetPPUFactor() const
@@ -135,7 +170,7 @@ void View::DrawSystem(DeviceContext *dc, System *system)
     assert(dc);
     assert(system);
 
-    dc->StartGraphic(system, "", system->GetUuid());
+    dc->StartGraphic(system, "", GetGraphicUuid(system));
 
     // first we need to clear the drawing list of postponed elements
     system->ResetDrawingList();
@@ -225,7 +260,7 @@ void View::DrawScoreDef(DeviceContext *dc, ScoreDef *scoreDef, Measure *measure,
         // scoreDef->SetDrawLabels(false);
     }
     else {
-        dc->StartGraphic(barLine, "", barLine->GetUuid());
+        dc->StartGraphic(barLine, "", GetGraphicUuid(barLine));
         DrawBarLines(dc, measure, staffGrp, barLine);
         dc->EndGraphic(barLine, this);
     }
@@ -302,7 +337,7 @@ void View::DrawStaffGrp(
             dc->GetTextExtent(label, &extend);
 
             // keep the widest width for the system
-            System *system = dynamic_cast<System *>(measure->GetFirstParent(SYSTEM));
+            System *system = vrv_cast<System *>(measure->GetFirstParent(SYSTEM));
             if (!system) {
                 LogDebug("Staff or System missing in View::DrawStaffDefLabels");
             }
@@ -373,7 +408,7 @@ void View::DrawStaffDefLabels(DeviceContext *dc, Measure *measure, ScoreDef *sco
 
         AttCommonNComparison comparison(STAFF, staffDef->GetN());
         Staff *staff = dynamic_cast<Staff *>(measure->FindChildByAttComparison(&comparison, 1));
-        System *system = dynamic_cast<System *>(measure->GetFirstParent(SYSTEM));
+        System *system = vrv_cast<System *>(measure->GetFirstParent(SYSTEM));
 
         if (!staff || !system) {
             LogDebug("Staff or System missing in View::DrawStaffDefLabels");
@@ -703,7 +738,7 @@ void View::DrawMeasure(DeviceContext *dc, Measure *measure, System *system)
 
     // This is a special case where we do not draw (SVG, Bounding boxes, etc.) the measure for unmeasured music
     if (measure->IsMeasuredMusic()) {
-        dc->StartGraphic(measure, "", measure->GetUuid());
+        dc->StartGraphic(measure, "", GetGraphicUuid(measure));
     }
 
     DrawMeasureChildren(dc, measure, measure, system);
@@ -737,7 +772,7 @@ void View::DrawStaff(DeviceContext *dc, Staff *staff, Measure *measure, System *
     assert(measure);
     assert(system);
 
-    dc->StartGraphic(staff, "", staff->GetUuid());
+    dc->StartGraphic(staff, "", GetGraphicUuid(staff));
 
     DrawStaffLines(dc, staff, measure, system);
 
@@ -921,10 +956,10 @@ int View::CalculatePitchCode(Layer *layer, int y_n, int x_pos, int *octave)
     assert(layer);
     assert(octave);
 
-    Staff *parentStaff = dynamic_cast<Staff *>(layer->GetFirstParent(STAFF));
+    Staff *parentStaff = vrv_cast<Staff *>(layer->GetFirstParent(STAFF));
     assert(parentStaff); // Pointer to parent has to be a staff
 
-    static int touches[]
+    static const int touches[]
         = { PITCHNAME_c, PITCHNAME_d, PITCHNAME_e, PITCHNAME_f, PITCHNAME_g, PITCHNAME_a, PITCHNAME_b };
     int y_dec, yb, plafond;
     int degres, octaves, position, code;
@@ -973,7 +1008,7 @@ void View::DrawLayer(DeviceContext *dc, Layer *layer, Staff *staff, Measure *mea
 
     // Now start to draw the layer content
 
-    dc->StartGraphic(layer, "", layer->GetUuid());
+    dc->StartGraphic(layer, "", GetGraphicUuid(layer));
 
     DrawLayerChildren(dc, layer, layer, staff, measure);
 
@@ -995,9 +1030,9 @@ void View::DrawLayerList(DeviceContext *dc, Layer *layer, Staff *staff, Measure
 
     for (iter = drawingList->begin(); iter != drawingList->end(); ++iter) {
         if ((*iter)->Is(classId) && (classId == TUPLET)) {
-            Tuplet *tuplet = dynamic_cast<Tuplet *>((*iter));
+            Tuplet *tuplet = vrv_cast<Tuplet *>((*iter));
             assert(tuplet);
-            dc->ResumeGraphic(tuplet, tuplet->GetUuid());
+            dc->ResumeGraphic(tuplet, GetGraphicUuid(tuplet));
             DrawTupletPostponed(dc, tuplet, layer, staff);
             dc->EndResumedGraphic(tuplet, this);
         }
@@ -1027,7 +1062,7 @@ void View::DrawSystemChildren(DeviceContext *dc, Object *parent, System *system)
         // scoreDef are not drawn directly, but anything else should not be possible
         else if (current->Is(SCOREDEF)) {
             // nothing to do, then
-            ScoreDef *scoreDef = dynamic_cast<ScoreDef *>(current);
+            ScoreDef *scoreDef = vrv_cast<ScoreDef *>(current);
             assert(scoreDef);
             SetScoreDefDrawingWidth(dc, scoreDef);
         }
@@ -1174,7 +1209,7 @@ void View::DrawSystemEditorialElement(DeviceContext *dc, EditorialElement *eleme
     std::string boundaryStart;
     if (element->IsBoundaryElement()) boundaryStart = "boundaryStart";
 
-    dc->StartGraphic(element, boundaryStart, element->GetUuid());
+    dc->StartGraphic(element, boundaryStart, GetGraphicUuid(element));
     // EditorialElements at the system level that are visible have no children
     // if (element->m_visibility == Visible) {
     //    DrawSystemChildren(dc, element, system);
@@ -1190,7 +1225,7 @@ void View::DrawMeasureEditorialElement(DeviceContext *dc, EditorialElement *elem
     else if (element->Is(CHOICE))
         assert((dynamic_cast<Choice *>(element))->GetLevel() == EDITORIAL_MEASURE);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
     if (element->m_visibility == Visible) {
         DrawMeasureChildren(dc, element, measure, system);
     }
@@ -1205,7 +1240,7 @@ void View::DrawStaffEditorialElement(DeviceContext *dc, EditorialElement *elemen
     else if (element->Is(CHOICE))
         assert((dynamic_cast<Choice *>(element))->GetLevel() == EDITORIAL_STAFF);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
     if (element->m_visibility == Visible) {
         DrawStaffChildren(dc, element, staff, measure);
     }
@@ -1221,7 +1256,7 @@ void View::DrawLayerEditorialElement(
     else if (element->Is(CHOICE))
         assert((dynamic_cast<Choice *>(element))->GetLevel() == EDITORIAL_LAYER);
 
-    dc->StartGraphic(element, "", element->GetUuid());
+    dc->StartGraphic(element, "", GetGraphicUuid(element));
     if (element->m_visibility == Visible) {
         DrawLayerChildren(dc, element, layer, staff, measure);
     }
@@ -1236,7 +1271,7 @@ void View::DrawTextEditorialElement(DeviceContext *dc, EditorialElement *element
     else if (element->Is(CHOICE))
         assert((dynamic_cast<Choice *>(element))->GetLevel() == EDITORIAL_TEXT);
 
-    dc->StartTextGraphic(element, "", element->GetUuid());
+    dc->StartTextGraphic(element, "", GetGraphicUuid(element));
     if (element->m_visibility == Visible) {
         DrawTextChildren(dc, element, x, y, setX, setY);
     }
@@ -1251,7 +1286,7 @@ void View::DrawFbEditorialElement(DeviceContext *dc, EditorialElement *element,
     else if (element->Is(CHOICE))
         assert((dynamic_cast<Choice *>(element))->GetLevel() == EDITORIAL_FB);
 
-    dc->StartTextGraphic(element, "", element->GetUuid());
+    dc->StartTextGraphic(element, "", GetGraphicUuid(element));
     if (element->m_visibility == Visible) {
         DrawFbChildren(dc, element, x, y, setX, setY);
     }
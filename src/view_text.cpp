@@ -35,7 +35,7 @@ void View::DrawF(DeviceContext *dc, F *f, int x, int y, bool &setX, bool &setY)
     assert(dc);
     assert(f);
 
-    dc->StartTextGraphic(f, "", f->GetUuid());
+    dc->StartTextGraphic(f, "", GetGraphicUuid(f));
 
     DrawTextChildren(dc, f, x, y, setX, setY);
 
@@ -94,17 +94,17 @@ void View::DrawTextElement(DeviceContext *dc, TextElement *element, int x, int y
     assert(element);
 
     if (element->Is(FIGURE)) {
-        F *f = dynamic_cast<F *>(element);
+        F *f = vrv_cast<F *>(element);
         assert(f);
         DrawF(dc, f, x, y, setX, setY);
     }
     if (element->Is(REND)) {
-        Rend *rend = dynamic_cast<Rend *>(element);
+        Rend *rend = vrv_cast<Rend *>(element);
         assert(rend);
         DrawRend(dc, rend, x, y, setX, setY);
     }
     else if (element->Is(TEXT)) {
-        Text *text = dynamic_cast<Text *>(element);
+        Text *text = vrv_cast<Text *>(element);
         assert(text);
         DrawText(dc, text, x, y, setX, setY);
     }
@@ -115,7 +115,7 @@ void View::DrawRend(DeviceContext *dc, Rend *rend, int x, int y, bool &setX, boo
     assert(dc);
     assert(rend);
 
-    dc->StartTextGraphic(rend, "", rend->GetUuid());
+    dc->StartTextGraphic(rend, "", GetGraphicUuid(rend));
 
     FontInfo rendFont;
     bool customFont = false;
@@ -136,7 +136,7 @@ data_STEMDIRECTION View::GetTupletCoordinates(Tuplet *tuplet, Layer *layer, Poin
     ListOfObjects::iterator iter = tupletChildren->begin();
     while (iter != tupletChildren->end()) {
         if ((*iter)->Is(NOTE)) {
-            Note *currentNote = dynamic_cast<Note *>(*iter);
+            Note *currentNote = vrv_cast<Note *>(*iter);
             assert(currentNote);
             if (currentNote->GetDrawingStemDir() == STEMDIRECTION_up)
                 ups++;
@@ -191,7 +191,7 @@ data_STEMDIRECTION View::GetTupletCoordinates(Tuplet *tuplet, Layer *layer, Poin
         iter = tupletChildren->begin();
         while (iter != tupletChildren->end()) {
             if ((*iter)->Is(NOTE)) {
-                Note *currentNote = dynamic_cast<Note *>(*iter);
+                Note *currentNote = vrv_cast<Note *>(*iter);
                 assert(currentNote);
 
                 if (direction == STEMDIRECTION_up) {
@@ -228,7 +228,7 @@ data_STEMDIRECTION View::GetTupletCoordinates(Tuplet *tuplet, Layer *layer, Poin
         iter = tupletChildren->begin();
         while (iter != tupletChildren->end()) {
             if ((*iter)->Is(NOTE)) {
-                Note *currentNote = dynamic_cast<Note *>(*iter);
+                Note *currentNote = vrv_cast<Note *>(*iter);
                 assert(currentNote);
 
                 if (currentNote->GetDrawingStemDir() == direction) {
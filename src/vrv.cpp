@@ -12,10 +12,12 @@
 
 #include <assert.h>
 #include <cmath>
+#include <mutex>
 #include <sstream>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <thread>
 #include <vector>
 
 #ifndef _WIN32
@@ -56,15 +58,69 @@ namespace vrv {
 // Static members with some default values
 //----------------------------------------------------------------------------
 
-std::string Resources::m_path = "/usr/local/share/verovio";
-std::map<wchar_t, Glyph> Resources::m_font;
-std::map<wchar_t, Glyph> Resources::m_textFont;
+std::string Resources::s_defaultPath = "/usr/local/share/verovio";
+
+/** The font resource sets loaded so far, with the mutex guarding the access to them and to the default path */
+static std::map<std::string, Resources *> s_resourcesCache;
+static std::mutex s_resourcesMutex;
 
 //----------------------------------------------------------------------------
 // Font related methods
 //----------------------------------------------------------------------------
 
+Resources::Resources(const std::string &path, const std::string &fontName)
+{
+    m_resourcePath = path;
+    m_fontName = fontName;
+}
+
+Resources::~Resources()
+{
+}
+
+std::string Resources::GetPath()
+{
+    std::lock_guard<std::mutex> lock(s_resourcesMutex);
+    return s_defaultPath;
+}
+
+void Resources::SetPath(std::string path)
+{
+    std::lock_guard<std::mutex> lock(s_resourcesMutex);
+    s_defaultPath = path;
+}
+
 bool Resources::InitFonts()
+{
+    return (GetResources() != NULL);
+}
+
+const Resources *Resources::GetResources(const std::string &fontName)
+{
+    return GetResources(GetPath(), fontName);
+}
+
+const Resources *Resources::GetResources(const std::string &path, const std::string &fontName)
+{
+    // The Leipzig font is loaded by default anyway
+    std::string font = (fontName == "Leipzig") ? "" : fontName;
+    std::string key = path + "\n" + font;
+
+    // The lock is held while loading so a set is never loaded twice
+    std::lock_guard<std::mutex> lock(s_resourcesMutex);
+    std::map<std::string, Resources *>::iterator iter = s_resourcesCache.find(key);
+    if (iter != s_resourcesCache.end()) return iter->second;
+
+    Resources *resources = new Resources(path, font);
+    if (!resources->Load()) {
+        delete resources;
+        return NULL;
+    }
+    s_resourcesCache[key] = resources;
+    return resources;
+}
+
+bool Resources::Load()
 {
     // We will need to rethink this for adding the option to add custom fonts
     // Font Bravura first since it is expected to have always all symbols
@@ -77,6 +133,8 @@ bool Resources::InitFonts()
         return false;
     }
 
+    if (!m_fontName.empty() && !LoadFont(m_fontName)) return false;
+
     if (!InitTextFont()) {
         LogError("Text font could not be initialized.");
         return false;
@@ -85,28 +143,43 @@ bool Resources::InitFonts()
     return true;
 }
 
-bool Resources::SetFont(std::string fontName)
+const Glyph *Resources::GetGlyph(wchar_t smuflCode) const
 {
-    return LoadFont(fontName);
+    std::map<wchar_t, Glyph>::const_iterator iter = m_font.find(smuflCode);
+    if (iter == m_font.end()) return NULL;
+    return &iter->second;
 }
 
-Glyph *Resources::GetGlyph(wchar_t smuflCode)
+const Glyph *Resources::GetTextGlyph(wchar_t code) const
 {
-    if (!m_font.count(smuflCode)) return NULL;
-    return &m_font[smuflCode];
+    std::map<wchar_t, Glyph>::const_iterator iter = m_textFont.find(code);
+    if (iter == m_textFont.end()) return NULL;
+    return &iter->second;
 }
 
-Glyph *Resources::GetTextGlyph(wchar_t code)
+const std::string &Resources::GetGlyphDefs(const Glyph *glyph) const
 {
-    if (!m_textFont.count(code)) return NULL;
-    return &m_textFont[code];
+    assert(glyph);
+
+    std::lock_guard<std::mutex> lock(m_glyphDefsMutex);
+    std::map<const Glyph *, std::string>::iterator iter = m_glyphDefs.find(glyph);
+    if (iter != m_glyphDefs.end()) return iter->second;
+
+    // Serialize the content of the glyph file as it is written within the <defs> of a SVG file (depth 2)
+    std::ostringstream defs;
+    pugi::xml_document sourceDoc;
+    sourceDoc.load_file(glyph->GetPath().c_str());
+    for (pugi::xml_node child = sourceDoc.first_child(); child; child = child.next_sibling()) {
+        child.print(defs, "\t", pugi::format_default, pugi::encoding_auto, 2);
+    }
+    return (m_glyphDefs[glyph] = defs.str());
 }
 
 bool Resources::LoadFont(std::string fontName)
 {
     ::DIR *dir;
     dirent *pdir;
-    std::string dirname = Resources::GetPath() + "/" + fontName;
+    std::string dirname = m_resourcePath + "/" + fontName;
     dir = opendir(dirname.c_str());
 
     if (!dir) {
@@ -127,7 +200,7 @@ bool Resources::LoadFont(std::string fontName)
             }
             std::string codeStr = pdir->d_name;
             codeStr = codeStr.substr(0, 4);
-            Glyph glyph(Resources::GetPath() + "/" + fontName + "/" + pdir->d_name, codeStr);
+            Glyph glyph(m_resourcePath + "/" + fontName + "/" + pdir->d_name, codeStr);
             m_font[smuflCode] = glyph;
         }
     }
@@ -136,7 +209,7 @@ bool Resources::LoadFont(std::string fontName)
 
     // Then load the bounding boxes (if bounding box file is provided)
     pugi::xml_document doc;
-    std::string filename = Resources::GetPath() + "/" + fontName + ".xml";
+    std::string filename = m_resourcePath + "/" + fontName + ".xml";
     pugi::xml_parse_result result = doc.load_file(filename.c_str());
     if (!result) {
         // File not found, default bounding boxes will be used
@@ -196,7 +269,7 @@ bool Resources::InitTextFont()
     pugi::xml_document doc;
     // For now, we have only Times bounding boxes for ASCII chars
     // For any other char, we currently use 'o' bounding box
-    std::string filename = Resources::GetPath() + "/text/Times.xml";
+    std::string filename = m_resourcePath + "/text/Times.xml";
     pugi::xml_parse_result result = doc.load_file(filename.c_str());
     if (!result) {
         // File not found, default bounding boxes will be used
@@ -377,6 +450,31 @@ bool Check(Object *object)
     return (object != NULL);
 }
 
+void ProcessInChunks(int count, int threads, const std::function<void(int begin, int end)> &process)
+{
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    threads = std::min(threads, count);
+
+    if (threads <= 1) {
+        if (count > 0) process(0, count);
+        return;
+    }
+
+    // The first chunks have one more item if they cannot be even
+    int chunkSize = count / threads;
+    int remainder = count % threads;
+    std::vector<std::thread> workers;
+    int begin = chunkSize + ((remainder > 0) ? 1 : 0);
+    int i;
+    for (i = 1; i < threads; i++) {
+        int end = begin + chunkSize + ((i < remainder) ? 1 : 0);
+        workers.push_back(std::thread(process, begin, end));
+        begin = end;
+    }
+    process(0, chunkSize + ((remainder > 0) ? 1 : 0));
+    for (auto &worker : workers) worker.join();
+}
+
 //----------------------------------------------------------------------------
 // Various helpers
 //----------------------------------------------------------------------------
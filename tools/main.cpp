@@ -5,15 +5,23 @@
 // Copyright (c) Authors and others. All rights reserved.
 /////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <assert.h>
+#include <atomic>
+#include <chrono>
+#include <fstream>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
+#include <thread>
 
 #ifndef _WIN32
+#include <dirent.h>
 #include <getopt.h>
 #else
+#include "win_dirent.h"
 #include "win_getopt.h"
 #endif
 
@@ -55,6 +63,182 @@ bool dir_exists(string dir)
     }
 }
 
+bool file_exists(string file)
+{
+    struct stat st;
+    if ((stat(file.c_str(), &st) == 0) && (((st.st_mode) & S_IFMT) == S_IFREG)) {
+        return true;
+    }
+    else {
+        return false;
+    }
+}
+
+// Get the input files of a batch, either the files of a directory or the lines of a manifest file
+bool get_batch_files(string const &batch, vector<string> &files)
+{
+    if (dir_exists(batch)) {
+        ::DIR *dir = opendir(batch.c_str());
+        if (!dir) return false;
+        dirent *pdir;
+        while ((pdir = readdir(dir))) {
+            string file = batch + "/" + pdir->d_name;
+            if (file_exists(file)) files.push_back(file);
+        }
+        closedir(dir);
+        std::sort(files.begin(), files.end());
+        return true;
+    }
+
+    ifstream manifest(batch.c_str());
+    if (!manifest.is_open()) return false;
+    for (string line; getline(manifest, line);) {
+        if (!line.empty() && (line[line.size() - 1] == '\r')) line.erase(line.size() - 1);
+        // Skip empty lines and comments
+        if (line.empty() || (line[0] == '#')) continue;
+        files.push_back(line);
+    }
+    return true;
+}
+
+// Convert one file of a batch to all the output formats - return an error message if it fails
+string convert_batch_file(Toolkit &toolkit, string const &infile, string const &outdir,
+    vector<string> const &outformats, bool all_pages, int &pageCount)
+{
+    pageCount = 0;
+    if (!toolkit.LoadFile(infile)) {
+        return "The file could not be loaded";
+    }
+    pageCount = toolkit.GetPageCount();
+
+    string outfile = removeExtension(outdir.empty() ? infile : outdir + "/" + basename(infile));
+
+    for (auto const &outformat : outformats) {
+        if (outformat == "svg") {
+            if (pageCount < 1) {
+                return "The file has no page to render";
+            }
+            int to = (all_pages) ? pageCount : 1;
+            int p;
+            for (p = 1; p <= to; p++) {
+                string cur_outfile = outfile;
+                if (all_pages) {
+                    cur_outfile += StringFormat("_%03d", p);
+                }
+                cur_outfile += ".svg";
+                if (!toolkit.RenderToSvgFile(cur_outfile, p)) {
+                    return "Unable to write SVG to " + cur_outfile;
+                }
+            }
+        }
+        else if (outformat == "mei") {
+            if (!toolkit.SaveFile(outfile + ".mei")) {
+                return "Unable to write MEI to " + outfile + ".mei";
+            }
+        }
+        else if (outformat == "midi") {
+            if (!toolkit.RenderToMidiFile(outfile + ".mid")) {
+                return "Unable to write MIDI to " + outfile + ".mid";
+            }
+        }
+    }
+    return "";
+}
+
+// Convert all the files of a batch with a pool of toolkits sharing the options and the fonts of toolkit
+// The summary is written with one tab-separated line per file to summary_file (or to the standard output)
+int run_batch(Toolkit &toolkit, string const &batch, string const &outdir, string const &outformat, bool all_pages,
+    int threads, string const &summary_file)
+{
+    vector<string> files;
+    if (!get_batch_files(batch, files)) {
+        cerr << "The batch '" << batch << "' could not be read." << endl;
+        return 1;
+    }
+
+    vector<string> outformats;
+    istringstream outformat_stream(outformat);
+    for (string format; getline(outformat_stream, format, ',');) {
+        if ((format != "svg") && (format != "mei") && (format != "midi")) {
+            cerr << "Output format can only be 'mei', 'svg', or 'midi' (or a comma-separated list) in batch mode."
+                 << endl;
+            return 1;
+        }
+        outformats.push_back(format);
+    }
+
+    if (!outdir.empty() && !dir_exists(outdir)) {
+        cerr << "The output directory '" << outdir << "' does not exist." << endl;
+        return 1;
+    }
+
+    ofstream summary_stream;
+    if (!summary_file.empty()) {
+        summary_stream.open(summary_file.c_str());
+        if (!summary_stream.is_open()) {
+            cerr << "Unable to write the batch summary to " << summary_file << "." << endl;
+            return 1;
+        }
+    }
+    ostream &summary = (summary_file.empty()) ? cout : summary_stream;
+
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    threads = std::max(1, std::min(threads, (int)files.size()));
+
+    // The first toolkit is the one with the options and the fonts loaded
+    vector<Toolkit *> toolkits;
+    toolkits.push_back(&toolkit);
+    int i;
+    for (i = 1; i < threads; i++) {
+        Toolkit *poolToolkit = new Toolkit(false);
+        poolToolkit->CopyOptions(toolkit);
+        toolkits.push_back(poolToolkit);
+    }
+
+    std::atomic<size_t> nextFile(0);
+    std::mutex summaryMutex;
+    int failures = 0;
+
+    summary << "file\tstatus\tpages\ttime_ms\terror" << endl;
+
+    auto convertFiles = [&](Toolkit *poolToolkit) {
+        size_t fileIdx;
+        while ((fileIdx = nextFile++) < files.size()) {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            int pageCount;
+            string error
+                = convert_batch_file(*poolToolkit, files.at(fileIdx), outdir, outformats, all_pages, pageCount);
+            double elapsed
+                = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+            std::lock_guard<std::mutex> lock(summaryMutex);
+            if (!error.empty()) failures++;
+            summary << files.at(fileIdx) << "\t" << (error.empty() ? "ok" : "error") << "\t" << pageCount << "\t"
+                    << StringFormat("%.1f", elapsed) << "\t" << error << endl;
+        }
+    };
+
+    if (threads == 1) {
+        convertFiles(&toolkit);
+    }
+    else {
+        vector<std::thread> workers;
+        for (i = 0; i < threads; i++) {
+            workers.push_back(std::thread(convertFiles, toolkits.at(i)));
+        }
+        for (auto &worker : workers) {
+            worker.join();
+        }
+    }
+
+    for (i = 1; i < threads; i++) {
+        delete toolkits.at(i);
+    }
+
+    cerr << files.size() << " file(s) converted with " << failures << " failure(s)." << endl;
+    return (failures > 0) ? 1 : 0;
+}
+
 void display_version()
 {
     cerr << "Verovio " << vrv::GetVersion() << endl;
@@ -103,6 +287,13 @@ void display_usage()
 
     cerr << " --all-pages                Output all pages with one output file per page" << endl;
 
+    cerr << " --batch=PATH               Convert all the files of the PATH directory or listed in the PATH" << endl;
+    cerr << "                            file (one per line); -o gives the output directory and -t can be a list" << endl;
+    cerr << "                            such as \"svg,mei,midi\"; a tab-separated summary is written to" << endl;
+    cerr << "                            the standard output" << endl;
+
+    cerr << " --batch-summary=FILE       Write the summary of the batch to FILE instead" << endl;
+
     cerr << " --app-xpath-query=QR*      Set the xPath query for selecting <app> child elements," << endl;
     cerr << "                            for example: \"./rdg[contains(@source, 'source-id')]\";" << endl;
     cerr << "                            by default the <lem> or the first <rdg> is selected" << endl;
@@ -122,6 +313,8 @@ void display_usage()
     cerr << " --ignore-layout            Ignore all encoded layout information (if any)" << endl;
     cerr << "                            and fully recalculate the layout" << endl;
 
+    cerr << " --layout-cache=FILE        Reuse the system and page breaks saved in FILE if they match" << endl;
+    cerr << "                            the input and the options; otherwise save them to FILE" << endl;
     cerr << " --mdiv-xpath-query=QR      Set the xPath query for selecting the <mdiv> to be rendered;" << endl;
     cerr << "                            only one <mdiv> can be rendered" << endl;
 
@@ -140,6 +333,10 @@ void display_usage()
 
     cerr << " --spacing-system=SP        Specify the spacing above each system (in MEI vu)" << endl;
 
+    cerr << " --threads=N                Use N threads for preparing and laying out the measures and drawing all" << endl;
+    cerr << "                            pages, or for converting a batch (default is 1; 0 for one thread per core)"
+         << endl;
+
     cerr << " --xml-id-seed=INT          Seed the random number generator for XML IDs" << endl;
 
     // Debugging options
@@ -172,12 +369,15 @@ int main(int argc, char **argv)
     int even_note_spacing = 0;
     int show_bounding_boxes = 0;
     int page = 1;
+    int threads = 1;
+    string batch;
+    string batch_summary;
     int show_help = 0;
     int show_version = 0;
 
     // Create the toolkit instance without loading the font because
     // the resource path might be specified in the parameters
-    // The fonts will be loaded later with Resources::InitFonts()
+    // The fonts will be loaded later with Toolkit::SetResourcePath()
     Toolkit toolkit(false);
 
     if (argc < 2) {
@@ -189,18 +389,21 @@ int main(int argc, char **argv)
 
     static struct option long_options[] = { { "adjust-page-height", no_argument, &adjust_page_height, 1 },
         { "all-pages", no_argument, &all_pages, 1 }, { "app-xpath-query", required_argument, 0, 0 },
+        { "batch", required_argument, 0, 0 }, { "batch-summary", required_argument, 0, 0 },
         { "border", required_argument, 0, 'b' }, { "choice-xpath-query", required_argument, 0, 0 },
         { "even-note-spacing", no_argument, &even_note_spacing, 1 }, { "font", required_argument, 0, 0 },
         { "format", required_argument, 0, 'f' }, { "help", no_argument, &show_help, 1 },
         { "hum-type", no_argument, &hum_type, 1 }, { "ignore-layout", no_argument, &ignore_layout, 1 },
-        { "mdiv-xpath-query", required_argument, 0, 0 }, { "no-layout", no_argument, &no_layout, 1 },
-        { "no-mei-hdr", no_argument, &no_mei_hdr, 1 }, { "no-justification", no_argument, &no_justification, 1 },
+        { "layout-cache", required_argument, 0, 0 }, { "mdiv-xpath-query", required_argument, 0, 0 },
+        { "no-layout", no_argument, &no_layout, 1 }, { "no-mei-hdr", no_argument, &no_mei_hdr, 1 },
+        { "no-justification", no_argument, &no_justification, 1 },
         { "outfile", required_argument, 0, 'o' }, { "page", required_argument, 0, 0 },
         { "page-height", required_argument, 0, 'h' }, { "page-width", required_argument, 0, 'w' },
         { "resources", required_argument, 0, 'r' }, { "scale", required_argument, 0, 's' },
         { "show-bounding-boxes", no_argument, &show_bounding_boxes, 1 }, { "spacing-linear", required_argument, 0, 0 },
         { "spacing-non-linear", required_argument, 0, 0 }, { "spacing-staff", required_argument, 0, 0 },
-        { "spacing-system", required_argument, 0, 0 }, { "type", required_argument, 0, 't' },
+        { "spacing-system", required_argument, 0, 0 }, { "threads", required_argument, 0, 0 },
+        { "type", required_argument, 0, 't' },
         { "version", no_argument, &show_version, 1 }, { "xml-id-seed", required_argument, 0, 0 }, { 0, 0, 0, 0 } };
 
     int option_index = 0;
@@ -217,9 +420,18 @@ int main(int argc, char **argv)
                     cout << string(optarg) << endl;
                     choiceXPathQueries.push_back(string(optarg));
                 }
-                if (strcmp(long_options[option_index].name, "font") == 0) {
+                if (strcmp(long_options[option_index].name, "batch") == 0) {
+                    batch = string(optarg);
+                }
+                else if (strcmp(long_options[option_index].name, "batch-summary") == 0) {
+                    batch_summary = string(optarg);
+                }
+                else if (strcmp(long_options[option_index].name, "font") == 0) {
                     font = string(optarg);
                 }
+                else if (strcmp(long_options[option_index].name, "layout-cache") == 0) {
+                    toolkit.SetLayoutCacheFile(string(optarg));
+                }
                 else if (strcmp(long_options[option_index].name, "mdiv-xpath-query") == 0) {
                     cout << string(optarg) << endl;
                     toolkit.SetMdivXPathQuery(string(optarg));
@@ -227,6 +439,9 @@ int main(int argc, char **argv)
                 else if (strcmp(long_options[option_index].name, "page") == 0) {
                     page = atoi(optarg);
                 }
+                else if (strcmp(long_options[option_index].name, "threads") == 0) {
+                    threads = atoi(optarg);
+                }
                 else if (strcmp(long_options[option_index].name, "spacing-linear") == 0) {
                     if (!toolkit.SetSpacingLinear(atof(optarg))) {
                         exit(1);
@@ -276,7 +491,8 @@ int main(int argc, char **argv)
 
             case 't':
                 outformat = string(optarg);
-                toolkit.SetOutputFormat(string(optarg));
+                // A list of formats is possible in batch mode
+                if (outformat.find(',') == string::npos) toolkit.SetOutputFormat(outformat);
                 break;
 
             case 's':
@@ -331,14 +547,14 @@ int main(int argc, char **argv)
     if (optind <= argc - 1) {
         infile = string(argv[optind]);
     }
-    else {
+    else if (batch.empty()) {
         cerr << "Incorrect number of arguments: expected one input file but found none." << endl << endl;
         display_usage();
         exit(1);
     }
 
     // If we output svg or do not request no layout to be performed then we need the font
-    if ((outformat == "svg") || !toolkit.GetNoLayout()) {
+    if ((outformat == "svg") || !toolkit.GetNoLayout() || !batch.empty()) {
         // Make sure the user uses a valid Resource path
         // Save many headaches for empty SVGs
         if (!dir_exists(vrv::Resources::GetPath())) {
@@ -348,7 +564,7 @@ int main(int argc, char **argv)
         }
 
         // Load the music font from the resource directory
-        if (!Resources::InitFonts()) {
+        if (!toolkit.SetResourcePath(vrv::Resources::GetPath())) {
             cerr << "The music font could not be loaded; please check the contents of the resource directory." << endl;
             exit(1);
         }
@@ -360,6 +576,14 @@ int main(int argc, char **argv)
         }
     }
 
+    if (!batch.empty()) {
+        if (all_pages) toolkit.SetScoreBasedMei(true);
+        return run_batch(toolkit, batch, outfile, outformat, all_pages, threads, batch_summary);
+    }
+
+    // With a single file, the threads are also used for preparing the drawing and for the horizontal layout
+    toolkit.SetLayoutThreads(threads);
+
     if (outformat != "svg" && outformat != "mei" && outformat != "midi" && outformat != "humdrum" && outformat != "svgmidi") {
         cerr << "Output format can only be 'mei', 'svg', 'midi', or 'humdrum'." << endl;
         exit(1);
@@ -420,7 +644,22 @@ int main(int argc, char **argv)
         to = toolkit.GetPageCount() + 1;
     }
 
-    if (outformat == "svg") {
+    if ((outformat == "svg") && all_pages && (threads != 1) && !std_output) {
+        vector<string> svgs;
+        toolkit.RenderAllToSvg(svgs, threads, true);
+        int p;
+        for (p = from; p < to; p++) {
+            std::string cur_outfile = outfile + StringFormat("_%03d", p) + ".svg";
+            std::ofstream outsvg(cur_outfile.c_str());
+            if (!outsvg.is_open()) {
+                cerr << "Unable to write SVG to " << cur_outfile << "." << endl;
+                exit(1);
+            }
+            outsvg << svgs.at(p - 1);
+            cerr << "Output written to " << cur_outfile << "." << endl;
+        }
+    }
+    else if (outformat == "svg") {
         int p;
         for (p = from; p < to; p++) {
             std::string cur_outfile = outfile;